@@ -87,10 +87,11 @@ class CCodeGenerator(CodeGenerator):
     self.sources = []
     self.sources_client = []
     self.sources_server = []
+    self.structs = {}
 
   def _get_def_type(self, field):
     ctype = self.C_PRIMITIVE_TYPES_MAP.get(field.vtype, 'struct %s' % field.vtype)
-    if field.repeated:
+    if field.repeated or field.vtype == 'chunks':
       ctype = 'z_array_t'
     return ctype
 
@@ -105,6 +106,8 @@ class CCodeGenerator(CodeGenerator):
     return self.C_PRIMITIVE_TYPES_NAME_MAP.get(vtype, vtype)
 
   def add_struct(self, entity):
+    self.structs[entity.name] = entity
+
     fields = []
     for field in entity.fields:
       ctype = self._get_def_type(field)
@@ -159,6 +162,31 @@ class CCodeGenerator(CodeGenerator):
         z_bitmap_set(msg->{ENTITY_NAME}_fields_bitmap, {FIELD_BITMAP_ID});
         break;
       }
+"""
+      elif field.vtype == 'chunks':
+        # chunks: z_bytes_ref_t array sent as a single bytes field
+        fields_alloc.append('  z_array_open(&(msg->%s), sizeof(z_bytes_ref_t));' % field.name)
+        parse_blob = """
+  do {
+    size_t i;
+    for (i = 0; i < msg->{FIELD_NAME}.count; ++i) {
+      z_bytes_ref_t *value = z_array_get(&(msg->{FIELD_NAME}), z_bytes_ref_t, i);
+      z_bytes_ref_release(value);
+    }
+  } while (0);
+"""
+        fields_free.append(replace(parse_blob, rvars))
+        fields_free.append('  z_array_close(&(msg->%s));' % field.name)
+        parse_blob = """
+      case {FIELD_UID}: { /* chunks {FIELD_NAME} */
+        z_bytes_ref_t *chunk = z_array_push_back(&(msg->{FIELD_NAME}));
+        if (Z_MALLOC_IS_NULL(chunk)) return(-1);
+        z_bytes_ref_reset(chunk);
+        r = z_reader_decode_bytes(reader, length, chunk);
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->{ENTITY_NAME}_fields_bitmap, {FIELD_BITMAP_ID});
+        break;
+      }
 """
       elif field.vtype in 'bytes':
         fields_alloc.append('  z_bytes_ref_reset(&(msg->%s));' % field.name)
@@ -202,6 +230,18 @@ class CCodeGenerator(CodeGenerator):
 
     dump_fields = []
     for field in entity.fields:
+      if field.vtype == 'chunks':
+        parse_blob = """
+  fprintf(stream, "\\n  {FIELD_UID}: chunks {FIELD_NAME} = ");
+  if ({ENTITY_NAME}_has_{FIELD_NAME}(msg)) {
+    z_dump_chunks(stream, &(msg->{FIELD_NAME}));
+  } else {
+    fprintf(stream, "MISSING");
+  }
+"""
+        dump_fields.append(replace(parse_blob, {'{FIELD_UID}': field.uid, '{FIELD_NAME}': field.name}))
+        continue
+
       if not field.vtype in self.C_PRIMITIVE_TYPES_MAP:
         continue
 
@@ -286,6 +326,19 @@ class CCodeGenerator(CodeGenerator):
   }
 """
         parse_blob_size = "/* TODO {FIELD_NAME} */"
+      elif field.vtype == 'chunks':
+        parse_blob_write = """
+  if ({ENTITY_NAME}_has_{FIELD_NAME}(msg)) {
+    r = z_write_field_chunks(buffer, {FIELD_UID}, &(msg->{FIELD_NAME}));
+    if (Z_UNLIKELY(r)) return(-{FIELD_UID});
+  }
+"""
+        parse_blob_size = """
+  if ({ENTITY_NAME}_has_{FIELD_NAME}(msg)) {
+    size_t length = z_chunks_size(&(msg->{FIELD_NAME}));
+    size += z_encoded_field_length({FIELD_UID}, length) + length;
+  }
+"""
       elif field.vtype in self.C_PRIMITIVE_TYPES_MAP:
         parse_blob_write = """
   if ({ENTITY_NAME}_has_{FIELD_NAME}(msg)) {
@@ -325,6 +378,17 @@ class CCodeGenerator(CodeGenerator):
       all_fields_write.append(replace(parse_blob_write, rvars))
       all_fields_size.append(replace(parse_blob_size, rvars))
 
+    # Trailing chunks are sent by ref, write_head() skips their data
+    head_write = None
+    if entity.fields and entity.fields[-1].vtype == 'chunks':
+      field = entity.fields[-1]
+      head_write = all_fields_write[:-1] + [replace("""
+  if ({ENTITY_NAME}_has_{FIELD_NAME}(msg)) {
+    r = z_write_field_head(buffer, {FIELD_UID}, z_chunks_size(&(msg->{FIELD_NAME})));
+    if (Z_UNLIKELY(r)) return(-{FIELD_UID});
+  }
+""", {'{FIELD_UID}': field.uid, '{FIELD_NAME}': field.name})]
+
     rheaders = {
       '{ENTITY_FIELDS}': '\n'.join(fields),
       '{ENTITY_HAS_MACROS}': '\n'.join(has_macros),
@@ -364,6 +428,7 @@ int    {ENTITY_NAME}_write (struct {ENTITY_NAME} *msg, z_buffer_t *buffer);
 void   {ENTITY_NAME}_dump  (FILE *stream, const struct {ENTITY_NAME} *msg);
 """, rheaders, rvars))
 
+
     self.sources.append(replace("""
 struct {ENTITY_NAME} *{ENTITY_NAME}_alloc (struct {ENTITY_NAME} *msg) {
   if (msg == NULL) {
@@ -431,6 +496,17 @@ void {ENTITY_NAME}_dump (FILE *stream, const struct {ENTITY_NAME} *msg) {
 }
 """, rsources, rvars))
 
+    if head_write is not None:
+      self.headers.append(replace("""int    {ENTITY_NAME}_write_head (struct {ENTITY_NAME} *msg, z_buffer_t *buffer);
+""", rvars))
+      self.sources.append(replace("""
+int {ENTITY_NAME}_write_head (struct {ENTITY_NAME} *msg, z_buffer_t *buffer) {
+  int r = 0;
+  {HEAD_FIELDS_WRITE}
+  return(r);
+}
+""", {'{HEAD_FIELDS_WRITE}': '\n'.join(head_write)}, rvars))
+
   def add_rpc_client(self, entity):
     rpc_ids = []
     for call in entity.calls:
@@ -664,9 +740,11 @@ int {ENTITY_NAME}_client_push_request (z_iopoll_t *iopoll,
   def add_rpc_server(self, entity):
     rpc_ids = []
     rpc_methods = []
+    rpc_ctx_sizes = []
     for call in entity.calls:
       spaces = ' ' * len(call.name)
       rpc_ids.append('#define %s_ID %d' % (call.name.upper(), call.uid))
+      rpc_ctx_sizes.append('  char %s[z_rpc_ctx_size(struct %s, struct %s)];' % (call.name, call.atype, call.rtype))
       rpc_methods.append("  int (*%s) (z_rpc_ctx_t *ctx,\n" % (call.name) +
                          "        %s   struct %s *req,\n" % (spaces, call.atype) +
                          "        %s   struct %s *resp);" % (spaces, call.rtype))
@@ -738,6 +816,24 @@ int {ENTITY_NAME}_client_push_request (z_iopoll_t *iopoll,
     }
 """, rvars))
 
+      rentity = self.structs.get(call.rtype)
+      if rentity is not None and rentity.fields and rentity.fields[-1].vtype == 'chunks':
+        rvars['{RESP_CHUNKS}'] = rentity.fields[-1].name
+        resp_handle.append(replace("""
+    case {REQ_ID}: { /* {REQ_ID} {REQ_NAME} */
+      struct {REQ_RTYPE} *resp = (struct {REQ_RTYPE} *)ctx->resp;
+      {REQ_ATYPE}_free((struct {REQ_ATYPE} *)ctx->req);
+      r = {REQ_RTYPE}_write_head(resp, &buffer);
+      /* The chunks are sent by ref, without copying them */
+      z_ipc_msgbuf_push_refs(msgbuf, buffer.block, buffer.size,
+                             {REQ_RTYPE}_has_{RESP_CHUNKS}(resp) ? &(resp->{RESP_CHUNKS}) : NULL);
+      {REQ_RTYPE}_free(resp);
+      pushed = 1;
+      break;
+    }
+""", rvars))
+        continue
+
       resp_handle.append(replace("""
     case {REQ_ID}: { /* {REQ_ID} {REQ_NAME} */
       {REQ_ATYPE}_free((struct {REQ_ATYPE} *)ctx->req);
@@ -750,6 +846,7 @@ int {ENTITY_NAME}_client_push_request (z_iopoll_t *iopoll,
     rheaders = {
       '{RPC_METHODS}': '\n'.join(rpc_methods),
       '{RPC_IDS}': '\n'.join(rpc_ids),
+      '{RPC_CTX_SIZES}': '\n'.join(rpc_ctx_sizes),
     }
 
     rsources = {
@@ -759,6 +856,7 @@ int {ENTITY_NAME}_client_push_request (z_iopoll_t *iopoll,
 
     rvars = {
       '{ENTITY_NAME}': entity.name,
+      '{ENTITY_NAME_UPPER}': entity.name.upper(),
     }
 
     self.headers_server.append(replace("""
@@ -766,6 +864,13 @@ struct {ENTITY_NAME}_server {
 {RPC_METHODS}
 };
 
+/* Reserve the rpc ctx pool for the largest ctx of the calls */
+union {ENTITY_NAME}_server_ctx {
+{RPC_CTX_SIZES}
+};
+
+#define {ENTITY_NAME_UPPER}_SERVER_CTX_ISIZE    sizeof(union {ENTITY_NAME}_server_ctx)
+
 {RPC_IDS}
 
 int  {ENTITY_NAME}_server_parse (const struct {ENTITY_NAME}_server *proto,
@@ -776,6 +881,10 @@ int  {ENTITY_NAME}_server_push_response (z_rpc_ctx_t *ctx,
 """, rheaders, rvars))
 
     self.sources_server.append(replace("""
+/* Every ctx of the calls fits the rpc ctx pool */
+typedef char __{ENTITY_NAME}_server_ctx_check[
+  ({ENTITY_NAME_UPPER}_SERVER_CTX_ISIZE <= Z_MEMORY_SLAB_MAX_ISIZE) ? 1 : -1];
+
 int {ENTITY_NAME}_server_parse (const struct {ENTITY_NAME}_server *proto,
                                 z_ipc_client_t *client,
                                 const struct iovec iov[2])
@@ -819,6 +928,7 @@ int  {ENTITY_NAME}_server_push_response (z_rpc_ctx_t *ctx,
                                          z_ipc_msgbuf_t *msgbuf)
 {
   z_buffer_t buffer;
+  int pushed = 0;
   int r = -1;
 
   if (Z_UNLIKELY(z_buffer_alloc(&buffer) == NULL)) {
@@ -843,7 +953,8 @@ int  {ENTITY_NAME}_server_push_response (z_rpc_ctx_t *ctx,
       break;
   }
 
-  z_ipc_msgbuf_push(msgbuf, buffer.block, buffer.size);
+  if (!pushed)
+    z_ipc_msgbuf_push(msgbuf, buffer.block, buffer.size);
   z_ipc_client_set_writable(ctx->client, 1);
   Z_LOG_TRACE("Send response of size=%zu time=%.5fsec",
               buffer.size, (z_time_micros() - ctx->req_time) / 1000000.0f);
@@ -708,8 +708,8 @@ class RaleighSL(Project):
                  ('objects', ['src/raleighsl/objects']),
                  #('oid', ['src/raleighsl/plugins/oid']),
                  ('semantics', ['src/raleighsl/semantics']),
-                 #('space', ['src/raleighsl/plugins/space']),
-                 #('format', ['src/raleighsl/plugins/format']),
+                 ('space', ['src/raleighsl/space']),
+                 ('formats', ['src/raleighsl/formats']),
                 ]
 
     return BuildLibrary(self.NAME, self.VERSION,
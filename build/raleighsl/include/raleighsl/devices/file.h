@@ -0,0 +1,53 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _RALEIGHSL_FILE_H_
+#define _RALEIGHSL_FILE_H_
+
+#include <raleighsl/raleighsl.h>
+
+#define RALEIGHSL_FILE_DEVICE(x)          Z_CAST(raleighsl_file_device_t, x)
+
+#define RALEIGHSL_FILE_DEVICE_BUFFERED    (0)
+#define RALEIGHSL_FILE_DEVICE_DIRECT      (1 << 0)
+
+#define RALEIGHSL_FILE_DEVICE_ALIGN       (4096)
+
+Z_TYPEDEF_STRUCT(raleighsl_file_device)
+
+struct raleighsl_file_device {
+  raleighsl_device_t __base__;            /* Device base object */
+
+  int      fd;                            /* Device file descriptor */
+  uint32_t flags;                         /* Buffered/Direct I/O flags */
+  uint32_t align;                         /* Direct I/O alignment */
+  uint32_t pad;
+
+  uint64_t size;                          /* Device capacity */
+  uint64_t used;                          /* Device high-water mark */
+};
+
+extern const raleighsl_device_plug_t raleighsl_device_file;
+
+raleighsl_errno_t raleighsl_file_device_open  (raleighsl_file_device_t *device,
+                                               const char *path,
+                                               uint64_t size,
+                                               uint32_t flags);
+void              raleighsl_file_device_close (raleighsl_file_device_t *device);
+
+void *  raleighsl_file_device_buffer_alloc (const raleighsl_file_device_t *device,
+                                            unsigned int size);
+void    raleighsl_file_device_buffer_free  (void *buffer);
+
+#endif /* !_RALEIGHSL_FILE_H_ */
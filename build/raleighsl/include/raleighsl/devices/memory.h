@@ -0,0 +1,22 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _RALEIGHSL_MEMORY_H_
+#define _RALEIGHSL_MEMORY_H_
+
+#include <raleighsl/raleighsl.h>
+
+extern const raleighsl_device_plug_t raleighsl_device_memory;
+
+#endif /* !_RALEIGHSL_MEMORY_H_ */
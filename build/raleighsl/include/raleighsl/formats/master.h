@@ -0,0 +1,26 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _RALEIGHSL_MASTER_H_
+#define _RALEIGHSL_MASTER_H_
+
+#include <raleighsl/raleighsl.h>
+
+/* The master block takes the first block of the device */
+#define RALEIGHSL_MASTER_OFFSET           (0)
+#define RALEIGHSL_MASTER_SIZE             (4 << 10)
+
+extern const raleighsl_format_plug_t raleighsl_format_master;
+
+#endif /* !_RALEIGHSL_MASTER_H_ */
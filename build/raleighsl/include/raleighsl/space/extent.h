@@ -0,0 +1,26 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _RALEIGHSL_EXTENT_H_
+#define _RALEIGHSL_EXTENT_H_
+
+#include <raleighsl/raleighsl.h>
+
+/* The extents are allocated from the device area that follows the journal */
+#define RALEIGHSL_EXTENT_OFFSET           RALEIGHSL_CHECKPOINT_OFFSET
+#define RALEIGHSL_EXTENT_BLOCK_SIZE       (4096)
+
+extern const raleighsl_space_plug_t raleighsl_space_extent;
+
+#endif /* !_RALEIGHSL_EXTENT_H_ */
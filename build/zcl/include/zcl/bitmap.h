@@ -0,0 +1,44 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _Z_BITMAP_H_
+#define _Z_BITMAP_H_
+
+#include <zcl/config.h>
+__Z_BEGIN_DECLS__
+
+#include <zcl/macros.h>
+#include <zcl/bits.h>
+
+#define z_bitmap_size(num_bits)         (((num_bits) + 7) >> 3)
+#define z_bitmap_byte(bmap, bit)        *((bmap) + ((bit) >> 3))
+
+#define z_bitmap_set(bmap, bit)         z_set_1bit(z_bitmap_byte(bmap, bit), bit)
+#define z_bitmap_clear(bmap, bit)       z_clear_1bit(z_bitmap_byte(bmap, bit), bit)
+#define z_bitmap_change(bmap, bit, v)   z_change_1bit(z_bitmap_byte(bmap, bit), bit, v)
+#define z_bitmap_test(bmap, bit)        z_fetch_1bit(z_bitmap_byte(bmap, bit), bit)
+
+void  z_bitmap_change_bits  (uint8_t *bitmap,
+                             size_t offset,
+                             size_t num_bits,
+                             int value);
+int   z_bitmap_find_first   (const uint8_t *bitmap,
+                             size_t offset,
+                             size_t bitmap_size,
+                             int value,
+                             size_t *idx);
+
+__Z_END_DECLS__
+
+#endif /* _Z_BITMAP_H_ */
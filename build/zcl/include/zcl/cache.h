@@ -0,0 +1,103 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _Z_CACHE_H_
+#define _Z_CACHE_H_
+
+#include <zcl/config.h>
+__Z_BEGIN_DECLS__
+
+#include <zcl/macros.h>
+#include <zcl/dlink.h>
+#include <stdio.h>
+
+#define Z_CACHE(x)                      Z_CAST(z_cache_t, x)
+
+Z_TYPEDEF_ENUM(z_cache_type)
+Z_TYPEDEF_STRUCT(z_cache_entry)
+Z_TYPEDEF_STRUCT(z_cache_policy)
+Z_TYPEDEF_STRUCT(z_cache)
+
+/*
+ * Called before an entry is evicted: return > 0 to evict it, < 0 to keep
+ * it and look at the next candidate, 0 to stop the reclaim.
+ * The entries referenced out of the cache are pinned, never evicted.
+ */
+typedef int (*z_cache_evict_t) (void *udata,
+                                unsigned int size,
+                                z_cache_entry_t *entry);
+
+/*
+ * The lookups are lock-free, a released entry is handed to the free
+ * callback once no reader can see it anymore. A hit only marks the entry
+ * as accessed, the policy applies it when the entry reaches the reclaim.
+ * The weight is the entry footprint (1 by default), with a budget set the
+ * reclaim runs until both the entries and the total weight fit.
+ */
+struct z_cache_entry {
+  z_cache_entry_t *hash;
+  z_dlink_node_t cache;
+
+  uint64_t oid;
+  uint64_t weight;
+  uint32_t refs;
+  uint16_t state;
+  uint16_t accessed;
+};
+
+enum z_cache_type {
+  Z_CACHE_LRU,
+  Z_CACHE_2Q,
+  Z_CACHE_CLOCK_PRO,      /* hot/cold clocks, hits only set the ref-bit */
+  Z_CACHE_TINYLFU,        /* frequency admission, scan resistant */
+};
+
+struct z_cache_policy {
+  void (*insert)  (z_cache_t *cache,
+                   z_cache_entry_t *entry);
+  void (*remove)  (z_cache_t *cache,
+                   z_cache_entry_t *entry);
+  void (*reclaim) (z_cache_t *cache);
+  int  (*init)    (z_cache_t *cache);
+  void (*destroy) (z_cache_t *cache);
+  void (*dump)    (FILE *stream, z_cache_t *cache);
+
+  z_cache_type_t type;
+};
+
+#define z_cache_entry_oid(entry)     ((entry)->oid)
+
+void              z_cache_entry_init (z_cache_entry_t *entry,
+                                      uint64_t oid);
+void              z_cache_entry_set_weight (z_cache_t *cache,
+                                            z_cache_entry_t *entry,
+                                            uint64_t weight);
+
+z_cache_t *       z_cache_alloc      (z_cache_type_t type,
+                                      unsigned int capacity,
+                                      z_mem_free_t entry_free,
+                                      z_cache_evict_t entry_evict,
+                                      void *user_data);
+void              z_cache_free       (z_cache_t *cache);
+void              z_cache_release    (z_cache_t *cache, z_cache_entry_t *entry);
+z_cache_entry_t * z_cache_try_insert (z_cache_t *cache, z_cache_entry_t *entry);
+z_cache_entry_t * z_cache_lookup     (z_cache_t *cache, uint64_t oid);
+z_cache_entry_t * z_cache_remove     (z_cache_t *cache, uint64_t oid);
+void              z_cache_reclaim    (z_cache_t *cache, unsigned int capacity);
+void              z_cache_budget     (z_cache_t *cache, uint64_t budget);
+uint64_t          z_cache_weight     (z_cache_t *cache);
+void              z_cache_dump       (FILE *stream, z_cache_t *cache);
+__Z_END_DECLS__
+
+#endif /* _Z_CACHE_H_ */
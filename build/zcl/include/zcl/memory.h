@@ -0,0 +1,120 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _Z_MEMORY_H_
+#define _Z_MEMORY_H_
+
+#include <zcl/config.h>
+__Z_BEGIN_DECLS__
+
+#include <zcl/macros.h>
+#include <zcl/allocator.h>
+#include <zcl/histogram.h>
+#include <zcl/slab.h>
+
+#define Z_MEMORY_ALLOCATOR(x)         (Z_MEMORY(x)->allocator)
+#define Z_MEMORY_DATA(x)              (Z_MEMORY(x)->data)
+#define Z_MEMORY(x)                   Z_CAST(z_memory_t, x)
+
+#define Z_MALLOC_IS_NULL(x)           (Z_UNLIKELY((x) == NULL))
+
+Z_TYPEDEF_STRUCT(z_memory)
+
+/* The structs up to 512 bytes are served by the slabs, in 16 bytes steps */
+#define Z_MEMORY_SLAB_ALIGN_SHIFT      (4)
+#define Z_MEMORY_SLAB_MAX_ISIZE        (512)
+#define Z_MEMORY_SLAB_SIZE             (Z_MEMORY_SLAB_MAX_ISIZE >> Z_MEMORY_SLAB_ALIGN_SHIFT)
+
+#define z_memory_slab_align(x)         z_align_up(x, 1 << Z_MEMORY_SLAB_ALIGN_SHIFT)
+#define z_memory_slab_index(x)         ((z_memory_slab_align(x) >> Z_MEMORY_SLAB_ALIGN_SHIFT) - 1)
+
+/*
+ * Dedicated pools of the objects allocated and freed on every request,
+ * their slabs are not shared with the other structs of the size class.
+ * An item freed on another cpu goes to the magazine of that cpu and is
+ * returned to the owner slab in batches, with the magazine flush.
+ */
+#define Z_MEMORY_POOL_TASK             (0)
+#define Z_MEMORY_POOL_RPC_CTX          (1)
+#define Z_MEMORY_POOLS                 (2)
+
+/* The pool item size, see z_memory_pool_reserve() */
+#define z_memory_pool_isize(memory, pool)   ((memory)->pools[pool].isize)
+
+struct z_memory {
+  z_allocator_t *allocator;
+  z_slab_cache_t slabs[Z_MEMORY_SLAB_SIZE];
+  z_slab_magazine_t magazines[Z_MEMORY_SLAB_SIZE];
+  z_slab_cache_t pools[Z_MEMORY_POOLS];
+  z_slab_magazine_t pool_magazines[Z_MEMORY_POOLS];
+  z_histogram_t histo;
+  uint64_t histo_events[28];
+};
+
+typedef void (*z_mem_item_t) (void *udata, void *object);
+typedef void (*z_mem_free_t) (void *udata, void *object);
+
+z_memory_t *z_memory_open   (z_memory_t *memory, z_allocator_t *allocator);
+void        z_memory_close  (z_memory_t *memory);
+
+void        z_memory_stats_dump (z_memory_t *memory, FILE *stream);
+
+/* basic alloc/realloc/free */
+void *z_memory_raw_alloc   (z_memory_t *memory, size_t size);
+void *z_memory_raw_realloc (z_memory_t *memory, void *ptr, size_t size);
+
+#define z_memory_alloc(memory, type, size)                                    \
+  ((type *)z_memory_raw_alloc(memory, size)) \
+
+#define z_memory_realloc(memory, type, ptr, size)                             \
+  ((type *)z_memory_raw_realloc(memory, ptr, size))
+
+#define z_memory_free(memory, ptr)                                            \
+  z_allocator_free(memory->allocator, ptr)
+
+/* struct alloc/free */
+#define z_memory_struct_alloc(memory, type)                                   \
+  ((type *)__z_memory_struct_alloc(memory, sizeof(type)))
+  //;fprintf(stderr, "[MALLOC] %lu STRUCT %s\n", sizeof(type), #type);
+
+#define z_memory_struct_free(memory, type, ptr)                               \
+  __z_memory_struct_free(memory, sizeof(type), ptr)
+
+/* pool alloc/free */
+void  z_memory_pool_reserve (int pool, size_t isize);
+void *z_memory_pool_alloc (z_memory_t *memory, int pool);
+void  z_memory_pool_free  (z_memory_t *memory, int pool, void *ptr);
+
+/* array alloc/realloc/free */
+#define z_memory_array_alloc(memory, type, n)                                 \
+  ((type *)z_memory_raw_alloc(memory, (n) * sizeof(type)))
+
+#define z_memory_array_realloc(memory, ptr, type, n)                          \
+  z_memory_realloc(memory, type, ptr, (n) * sizeof(type))
+
+#define z_memory_array_free(memory, ptr)                                      \
+  z_memory_free(memory, ptr)
+
+/* utils */
+#define z_memory_dup(memory, type, src, size)                                 \
+  ((type *)__z_memory_dup(memory, src, size))
+
+void *__z_memory_struct_alloc (z_memory_t *memory, size_t size);
+void  __z_memory_struct_free  (z_memory_t *memory, size_t size, void *ptr);
+
+void *__z_memory_dup    (z_memory_t *memory, const void *src, size_t size);
+
+__Z_END_DECLS__
+
+#endif /* _Z_MEMORY_H_ */
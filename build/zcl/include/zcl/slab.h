@@ -0,0 +1,85 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _Z_SLAB_H_
+#define _Z_SLAB_H_
+
+#include <zcl/config.h>
+__Z_BEGIN_DECLS__
+
+#include <zcl/freelist.h>
+#include <zcl/locking.h>
+#include <zcl/macros.h>
+
+#define Z_SLAB_SIZE             (64 * 1024)
+#define Z_SLAB_MAGAZINE_SIZE    (32)
+
+Z_TYPEDEF_STRUCT(z_slab_magazine)
+Z_TYPEDEF_STRUCT(z_slab_cache)
+Z_TYPEDEF_STRUCT(z_slab)
+
+/*
+ * A slab is a Z_SLAB_SIZE aligned block, the header at its start links
+ * it to the owner cache, so the owner of an item is found by masking
+ * its address. The slabs with free items are on the partial list, a
+ * slab that becomes empty is kept for the next refill or unmapped.
+ */
+struct z_slab {
+  z_slab_cache_t *cache;
+  z_slab_t *prev;
+  z_slab_t *next;
+  z_free_list_t free_list;
+  uint8_t *bump;
+  uint32_t inuse;
+  uint32_t magic;
+};
+
+struct z_slab_cache {
+  z_spinlock_t lock;
+  z_slab_t *partial;
+  z_slab_t *full;
+  z_slab_t *empty;
+  uint32_t isize;
+  uint32_t nitems;
+  uint64_t nslabs;
+  /* Items handed out and not freed, kept in debug builds */
+  uint64_t nlive;
+};
+
+/*
+ * z_slab_owner() returns the cache of a slab item, or NULL for the
+ * pointers that do not come from a slab (e.g. the allocator ones).
+ *
+ * The magazine is the per-cpu front of a cache, alloc and free touch the
+ * slabs only to refill or to flush half of the magazine.
+ */
+struct z_slab_magazine {
+  z_spinlock_t lock;
+  unsigned int count;
+  void *items[Z_SLAB_MAGAZINE_SIZE];
+};
+
+int     z_slab_cache_open     (z_slab_cache_t *cache, size_t isize);
+void    z_slab_cache_close    (z_slab_cache_t *cache);
+z_slab_cache_t *z_slab_owner  (const void *ptr);
+
+void    z_slab_magazine_open  (z_slab_magazine_t *magazine);
+void    z_slab_magazine_close (z_slab_magazine_t *magazine);
+
+void *  z_slab_alloc          (z_slab_magazine_t *magazine, z_slab_cache_t *cache);
+void    z_slab_free           (z_slab_magazine_t *magazine, void *ptr);
+
+__Z_END_DECLS__
+
+#endif /* _Z_SLAB_H_ */
@@ -12,34 +12,33 @@
  *   limitations under the License.
  */
 
-#ifndef _Z_MEMPOOL_H_
-#define _Z_MEMPOOL_H_
+#ifndef _Z_TEST_H_
+#define _Z_TEST_H_
 
 #include <zcl/config.h>
 __Z_BEGIN_DECLS__
 
-#include <zcl/allocator.h>
-#include <zcl/freelist.h>
-#include <zcl/locking.h>
 #include <zcl/macros.h>
 
-#define Z_MMPOOL_BLOCKS     4
+#ifndef Z_TEST_MAX
+  #define Z_TEST_MAX          255
+#endif /* !Z_TEST_MAX */
 
-Z_TYPEDEF_STRUCT(z_mempool)
+Z_TYPEDEF_STRUCT(z_test)
 
-struct z_mempool {
-  z_spinlock_t lock;
-  uint8_t *blocks[Z_MMPOOL_BLOCKS];
-  z_free_list_t free_lists[Z_MMPOOL_BLOCKS];
-  size_t size;
-};
+typedef int (*z_test_func_t) (z_test_t *test);
+
+struct z_test {
+  int             (*setup)        (z_test_t *test);
+  int             (*tear_down)    (z_test_t *test);
 
-int     z_mempool_open    (z_mempool_t *mmpool, z_allocator_t *allocator, size_t size);
-void    z_mempool_close   (z_mempool_t *mmpool, z_allocator_t *allocator);
+  z_test_func_t   funcs[Z_TEST_MAX];
+  void *          user_data;
+};
 
-void *  z_mempool_alloc   (z_mempool_t *mmpool);
-int     z_mempool_free    (z_mempool_t *mmpool, void *ptr);
+int     z_test_run      (z_test_t *test, void *user_data);
 
 __Z_END_DECLS__
 
-#endif /* _Z_MEMPOOL_H_ */
+#endif /* !_Z_TEST_H_ */
+
@@ -168,27 +168,28 @@ class RaleighClient(IpcRpcClient):
   # ===========================================================================
   #  Flow
   # ===========================================================================
-  def flow_append(self, oid, data, txn_id=None):
+  def flow_append(self, oid, value, txn_id=None):
     data  = z_encode_field_uint(1, oid)
-    data += z_encode_field_bytes(2, data)
+    data += z_encode_field_bytes(2, value)
     if txn_id: data += z_encode_field_uint(0, txn_id)
     self.send_message(50, data)
     return self._sync_recv({0: self.STATUS_FIELDS,
-                            1: ('size', 'uint', None)})
+                            1: ('size', 'uint', None),
+                            2: ('offset', 'uint', None)})
 
-  def flow_inject(self, oid, offset, data, txn_id=None):
+  def flow_inject(self, oid, offset, value, txn_id=None):
     data  = z_encode_field_uint(1, oid)
     data += z_encode_field_uint(2, offset)
-    data += z_encode_field_bytes(3, data)
+    data += z_encode_field_bytes(3, value)
     if txn_id: data += z_encode_field_uint(0, txn_id)
     self.send_message(51, data)
     return self._sync_recv({0: self.STATUS_FIELDS,
                             1: ('size', 'uint', None)})
 
-  def flow_write(self, oid, offset, data, txn_id=None):
+  def flow_write(self, oid, offset, value, txn_id=None):
     data  = z_encode_field_uint(1, oid)
     data += z_encode_field_uint(2, offset)
-    data += z_encode_field_bytes(3, data)
+    data += z_encode_field_bytes(3, value)
     if txn_id: data += z_encode_field_uint(0, txn_id)
     self.send_message(52, data)
     return self._sync_recv({0: self.STATUS_FIELDS,
@@ -220,6 +221,16 @@ class RaleighClient(IpcRpcClient):
     return self._sync_recv({0: self.STATUS_FIELDS,
                             1: ('data', 'bytes', None)})
 
+  def flow_subscribe(self, oid, offset, size=None, txn_id=None):
+    data  = z_encode_field_uint(1, oid)
+    data += z_encode_field_uint(2, offset)
+    if size is not None: data += z_encode_field_uint(3, size)
+    if txn_id: data += z_encode_field_uint(0, txn_id)
+    self.send_message(56, data)
+    return self._sync_recv({0: self.STATUS_FIELDS,
+                            1: ('size', 'uint', None),
+                            2: ('data', 'bytes', None)})
+
   # ===========================================================================
   #  Deque
   # ===========================================================================
@@ -231,14 +242,33 @@ class RaleighClient(IpcRpcClient):
     self.send_message(60, data)
     return self._sync_recv({0: self.STATUS_FIELDS})
 
-  def deque_pop(self, oid, front=True, txn_id=None):
+  def deque_pop(self, oid, front=True, txn_id=None, timeout=None):
     data  = z_encode_field_uint(1, oid)
     data += z_encode_field_uint(2, int(front))
+    if timeout: data += z_encode_field_uint(3, timeout)
     if txn_id: data += z_encode_field_uint(0, txn_id)
     self.send_message(61, data)
     return self._sync_recv({0: self.STATUS_FIELDS,
                             1: ('data', 'bytes', None)})
 
+  def deque_push_n(self, oid, values, front=True, txn_id=None):
+    data  = z_encode_field_uint(1, oid)
+    data += z_encode_field_uint(2, int(front))
+    for value in values:
+      data += z_encode_field_bytes(3, value)
+    if txn_id: data += z_encode_field_uint(0, txn_id)
+    self.send_message(62, data)
+    return self._sync_recv({0: self.STATUS_FIELDS})
+
+  def deque_pop_n(self, oid, count, front=True, txn_id=None):
+    data  = z_encode_field_uint(1, oid)
+    data += z_encode_field_uint(2, int(front))
+    data += z_encode_field_uint(3, count)
+    if txn_id: data += z_encode_field_uint(0, txn_id)
+    self.send_message(63, data)
+    return self._sync_recv({0: self.STATUS_FIELDS,
+                            1: ('data', 'list[bytes]', None)})
+
   # ===========================================================================
   #  Server
   # ===========================================================================
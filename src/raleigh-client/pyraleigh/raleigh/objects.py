@@ -121,11 +121,23 @@ class RaleighDeque(_RaleighObject):
   def push_front(self, data, txn_id=None):
     return self._client.deque_push(self._oid, data, True, txn_id)
 
-  def pop_back(self, txn_id=None):
-    return self._client.deque_pop(self._oid, False, txn_id)
+  def pop_back(self, txn_id=None, timeout=None):
+    return self._client.deque_pop(self._oid, False, txn_id, timeout)
 
-  def pop_front(self, txn_id=None):
-    return self._client.deque_pop(self._oid, True, txn_id)
+  def pop_front(self, txn_id=None, timeout=None):
+    return self._client.deque_pop(self._oid, True, txn_id, timeout)
+
+  def push_back_n(self, values, txn_id=None):
+    return self._client.deque_push_n(self._oid, values, False, txn_id)
+
+  def push_front_n(self, values, txn_id=None):
+    return self._client.deque_push_n(self._oid, values, True, txn_id)
+
+  def pop_back_n(self, count, txn_id=None):
+    return self._client.deque_pop_n(self._oid, count, False, txn_id)
+
+  def pop_front_n(self, count, txn_id=None):
+    return self._client.deque_pop_n(self._oid, count, True, txn_id)
 
 class _RaleighDataObject(_RaleighObject):
   class Reader:
@@ -19,8 +19,11 @@
 #include <zcl/debug.h>
 
 #include <signal.h>
+#include <string.h>
 #include <stdio.h>
 
+#include "rpc/generated/stats_server.h"
+#include "rpc/generated/rpc_server.h"
 #include "server.h"
 
 static struct server_context __global_ctx;
@@ -29,8 +32,9 @@ static void __signal_handler (int signum) {
   __global_ctx.is_running = 0;
 }
 
-static int __raleighsl_open (void) {
+static int __raleighsl_open (const char *path, uint32_t device_flags, int affinity) {
   raleighsl_t *fs = &(__global_ctx.fs);
+  raleighsl_device_t *device = NULL;
   raleighsl_errno_t errno;
 
   if (raleighsl_alloc(fs) == NULL) {
@@ -38,20 +42,49 @@ static int __raleighsl_open (void) {
     return(1);
   }
 
+  /* Shared-nothing mode, the object tasks run on their home cpu */
+  fs->affinity = affinity;
+
   /* Plug objects */
   raleighsl_plug_object(fs, &raleighsl_object_number);
   raleighsl_plug_object(fs, &raleighsl_object_deque);
   raleighsl_plug_object(fs, &raleighsl_object_sset);
   raleighsl_plug_object(fs, &raleighsl_object_flow);
 
-  /* TODO */
+  /* Plug the file-system layers, the master block picks them on open */
+  raleighsl_plug_semantic(fs, &raleighsl_semantic_flat);
+  raleighsl_plug_space(fs, &raleighsl_space_extent);
+  raleighsl_plug_format(fs, &raleighsl_format_master);
+
   const raleighsl_semantic_plug_t *semantic = &raleighsl_semantic_flat;
-  const raleighsl_format_plug_t *format = NULL;
-  const raleighsl_space_plug_t *space = NULL;
-  raleighsl_device_t *device = NULL;
+  const raleighsl_format_plug_t *format = &raleighsl_format_master;
+  const raleighsl_space_plug_t *space = &raleighsl_space_extent;
+
+  /* Without a path everything lives in memory */
+  if (path != NULL) {
+    errno = raleighsl_file_device_open(&(__global_ctx.device), path, 0, device_flags);
+    if (errno) {
+      Z_LOG_FATAL("raleighsl: %s: %s\n", path, raleighsl_errno_string(errno));
+      raleighsl_free(fs);
+      return(2);
+    }
+    device = &(__global_ctx.device.__base__);
+  }
 
-  if ((errno = raleighsl_create(fs, device, format, space, semantic))) {
+  /* A formatted device is mounted and recovered from its journal */
+  errno = RALEIGHSL_ERRNO_FORMAT_NOT_FOUND;
+  if (device != NULL) {
+    errno = raleighsl_open(fs, device, format, NULL, NULL);
+  }
+
+  if (errno == RALEIGHSL_ERRNO_FORMAT_NOT_FOUND) {
+    errno = raleighsl_create(fs, device, format, space, semantic);
+  }
+
+  if (errno) {
     Z_LOG_FATAL("raleighsl: %s\n", raleighsl_errno_string(errno));
+    if (device != NULL)
+      raleighsl_file_device_close(&(__global_ctx.device));
     raleighsl_free(fs);
     return(2);
   }
@@ -60,8 +93,11 @@ static int __raleighsl_open (void) {
 }
 
 static void __raleighsl_close (void) {
-  raleighsl_close(&(__global_ctx.fs));
-  raleighsl_free(&(__global_ctx.fs));
+  raleighsl_t *fs = &(__global_ctx.fs);
+  raleighsl_close(fs);
+  if (fs->device != NULL)
+    raleighsl_file_device_close(&(__global_ctx.device));
+  raleighsl_free(fs);
 }
 
 static void __unplug_ipc (z_ipc_server_t *servers[], int n) {
@@ -71,11 +107,23 @@ static void __unplug_ipc (z_ipc_server_t *servers[], int n) {
 }
 
 int main (int argc, char **argv) {
+  const char *path = (argc > 1) ? argv[1] : NULL;
+  uint32_t device_flags = RALEIGHSL_FILE_DEVICE_BUFFERED;
   z_ipc_server_t *tcp_server[4];
+  int affinity = 0;
+  int i;
 #ifdef Z_SOCKET_HAS_UNIX
   //z_ipc_server_t *unix_server[1];
 #endif /* Z_SOCKET_HAS_UNIX */
 
+  /* raleigh-server [path [direct] [affinity]] */
+  for (i = 2; i < argc; ++i) {
+    if (!strcmp(argv[i], "direct"))
+      device_flags = RALEIGHSL_FILE_DEVICE_DIRECT;
+    else if (!strcmp(argv[i], "affinity"))
+      affinity = 1;
+  }
+
   /* Initialize signals */
   signal(SIGINT, __signal_handler);
 
@@ -83,6 +131,10 @@ int main (int argc, char **argv) {
   if (z_system_allocator_open(&(__global_ctx.allocator)))
     return(1);
 
+  /* The per-cpu pools are sized on the global context open */
+  z_memory_pool_reserve(Z_MEMORY_POOL_RPC_CTX, RALEIGHSL_RPC_SERVER_CTX_ISIZE);
+  z_memory_pool_reserve(Z_MEMORY_POOL_RPC_CTX, STATS_RPC_SERVER_CTX_ISIZE);
+
   /* Initialize global context */
   __global_ctx.is_running = 1;
   if (z_global_context_open(&(__global_ctx.allocator), &__global_ctx)) {
@@ -98,8 +150,18 @@ int main (int argc, char **argv) {
     return(1);
   }
 
+  /* Initialize the timer, it expires the parked requests */
+  if (server_timer_open(&(__global_ctx.timer))) {
+    Z_LOG_FATAL("server_timer_open(): failed\n");
+    z_iopoll_close(&(__global_ctx.iopoll));
+    z_global_context_close();
+    z_allocator_close(&(__global_ctx.allocator));
+    return(1);
+  }
+
   /* Initialize RaleighSL */
-  if (__raleighsl_open()) {
+  if (__raleighsl_open(path, device_flags, affinity)) {
+    server_timer_close(&(__global_ctx.timer));
     z_iopoll_close(&(__global_ctx.iopoll));
     z_global_context_close();
     z_allocator_close(&(__global_ctx.allocator));
@@ -125,6 +187,7 @@ int main (int argc, char **argv) {
   //__unplug_ipc(unix_server, 1);
 #endif /* Z_SOCKET_HAS_UNIX */
 
+  server_timer_close(&(__global_ctx.timer));
   __raleighsl_close();
   z_iopoll_close(&(__global_ctx.iopoll));
   z_global_context_close();
@@ -55,6 +55,46 @@ static void __operation_completed (raleighsl_t *fs,
   raleighsl_rpc_server_push_response(Z_RPC_CTX(ctx), &(client->msgbuf));
 }
 
+/* ============================================================================
+ *  RaleighSL RPC Protocol - Session
+ */
+static struct raleighsl_session *__session_alloc (z_ipc_client_t *client) {
+  struct raleighsl_session *session;
+
+  session = z_memory_struct_alloc(z_global_memory(), struct raleighsl_session);
+  if (Z_MALLOC_IS_NULL(session))
+    return(NULL);
+
+  z_spin_alloc(&(session->lock));
+  z_dlink_init(&(session->subscribers));
+  session->client = client;
+  session->refs = 1;
+  return(session);
+}
+
+static struct raleighsl_session *__session_acquire (struct raleighsl_session *session) {
+  z_atomic_inc(&(session->refs));
+  return(session);
+}
+
+static void __session_release (struct raleighsl_session *session) {
+  if (z_atomic_dec(&(session->refs)) > 0)
+    return;
+
+  z_spin_free(&(session->lock));
+  z_memory_struct_free(z_global_memory(), struct raleighsl_session, session);
+}
+
+static void __session_wake_subscribers (struct raleighsl_session *session);
+
+static void __session_close (struct raleighsl_session *session) {
+  z_lock(&(session->lock), z_spin, {
+    session->client = NULL;
+  });
+  __session_wake_subscribers(session);
+  __session_release(session);
+}
+
 #define __VERIFY_OBJ_PLUG_TYPE(obj, type)                                      \
   if (Z_UNLIKELY((obj)->plug != &raleighsl_object_ ## type))                   \
     return(RALEIGHSL_ERRNO_OBJECT_WRONG_TYPE);
@@ -83,6 +123,24 @@ static void __operation_completed (raleighsl_t *fs,
                                     ctx, &(resp->status)));                    \
   }
 
+/* Reads outside a transaction are served by the last committed version */
+#define __DECLARE_EXEC_SNAPSHOT(name)                                          \
+  static int __rpc_ ## name (z_rpc_ctx_t *ctx,                                 \
+                             struct name ## _request *req,                     \
+                             struct name ## _response *resp)                   \
+  {                                                                            \
+    struct server_context *srv = SERVER_CONTEXT(z_global_context_user_data()); \
+    name ## _response_set_status(resp);                                        \
+    if (req->txn_id != 0) {                                                    \
+      return(raleighsl_exec_read(&(srv->fs), req->txn_id, req->oid,            \
+                                 __ ## name, __operation_completed,            \
+                                 ctx, &(resp->status)));                       \
+    }                                                                          \
+    return(raleighsl_exec_snapshot(&(srv->fs), req->oid,                       \
+                                   __ ## name, __operation_completed,          \
+                                   ctx, &(resp->status)));                     \
+  }
+
 #define __DECLARE_EXEC_READ(name)         __DECLARE_EXEC(read, name)
 #define __DECLARE_EXEC_WRITE(name)        __DECLARE_EXEC(write, name)
 
@@ -322,7 +380,7 @@ static raleighsl_errno_t __number_div (raleighsl_t *fs,
   return(RALEIGHSL_ERRNO_NONE);
 }
 
-__DECLARE_EXEC_READ(number_get)
+__DECLARE_EXEC_SNAPSHOT(number_get)
 __DECLARE_EXEC_WRITE(number_set)
 __DECLARE_EXEC_WRITE(number_cas)
 __DECLARE_EXEC_WRITE(number_add)
@@ -452,7 +510,10 @@ static raleighsl_errno_t __flow_append (raleighsl_t *fs,
     return(errno);
   }
 
+  /* The data was appended at the end, under the write lock */
+  resp->offset = resp->size - req->data.slice.size;
   flow_append_response_set_size(resp);
+  flow_append_response_set_offset(resp);
   return(RALEIGHSL_ERRNO_NONE);
 }
 
@@ -551,6 +612,162 @@ static raleighsl_errno_t __flow_read (raleighsl_t *fs,
   return(RALEIGHSL_ERRNO_NONE);
 }
 
+/*
+ * The subscription is parked on the flow until there is data past the
+ * offset. It is linked to the session: once the client is gone the flow
+ * is woken up and the subscription dropped.
+ */
+struct flow_subscriber {
+  z_dlink_node_t node;
+  struct raleighsl_session *session;
+  z_rpc_ctx_t *ctx;
+  uint64_t oid;
+  int woken;                      /* Wake already sent to the flow */
+};
+
+static raleighsl_errno_t __flow_subscribe (raleighsl_t *fs,
+                                           const raleighsl_transaction_t *transaction,
+                                           raleighsl_object_t *object,
+                                           void *udata)
+{
+  struct flow_subscriber *subscriber = (struct flow_subscriber *)udata;
+  z_rpc_ctx_t *ctx = subscriber->ctx;
+  const struct flow_subscribe_request *req = Z_RPC_CTX_CONST_REQ(struct flow_subscribe_request, ctx);
+  struct flow_subscribe_response *resp = Z_RPC_CTX_RESP(struct flow_subscribe_response, ctx);
+  raleighsl_errno_t errno;
+  int is_gone;
+
+  __VERIFY_OBJ_PLUG_TYPE(object, flow);
+
+  /* Not parked again, the completion drops the request */
+  z_lock(&(subscriber->session->lock), z_spin, {
+    is_gone = (subscriber->session->client == NULL);
+  });
+  if (Z_UNLIKELY(is_gone))
+    return(RALEIGHSL_ERRNO_DATA_NO_ITEMS);
+
+  errno = raleighsl_flow_subscribe(fs, transaction, object, req->offset, req->size,
+                                   &(resp->size), &(resp->data));
+  if (Z_UNLIKELY(errno)) {
+    return(errno);
+  }
+
+  flow_subscribe_response_set_size(resp);
+  flow_subscribe_response_set_data(resp);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static void __flow_subscribe_completed (raleighsl_t *fs,
+                                        uint64_t oid, raleighsl_errno_t errno,
+                                        void *udata, void *error_data)
+{
+  struct flow_subscriber *subscriber = (struct flow_subscriber *)udata;
+  struct raleighsl_session *session = subscriber->session;
+  z_rpc_ctx_t *ctx = subscriber->ctx;
+
+  z_spin_lock(&(session->lock));
+  z_dlink_del(&(subscriber->node));
+  z_memory_struct_free(z_global_memory(), struct flow_subscriber, subscriber);
+  if (session->client != NULL) {
+    __operation_completed(fs, oid, errno, ctx, error_data);
+  } else {
+    flow_subscribe_request_free(Z_RPC_CTX_REQ(struct flow_subscribe_request, ctx));
+    flow_subscribe_response_free(Z_RPC_CTX_RESP(struct flow_subscribe_response, ctx));
+    z_rpc_ctx_free(ctx);
+  }
+  z_spin_unlock(&(session->lock));
+  __session_release(session);
+}
+
+static int __rpc_flow_subscribe (z_rpc_ctx_t *ctx,
+                                 struct flow_subscribe_request *req,
+                                 struct flow_subscribe_response *resp)
+{
+  struct server_context *srv = SERVER_CONTEXT(z_global_context_user_data());
+  struct raleighsl_client *client = RALEIGHSL_CLIENT(ctx->client);
+  struct flow_subscriber *subscriber;
+
+  flow_subscribe_response_set_status(resp);
+
+  subscriber = z_memory_struct_alloc(z_global_memory(), struct flow_subscriber);
+  if (Z_MALLOC_IS_NULL(subscriber))
+    return(-1);
+
+  subscriber->session = __session_acquire(client->session);
+  subscriber->ctx = ctx;
+  subscriber->oid = req->oid;
+  subscriber->woken = 0;
+  z_lock(&(subscriber->session->lock), z_spin, {
+    z_dlink_add_tail(&(subscriber->session->subscribers), &(subscriber->node));
+  });
+
+  if (raleighsl_exec_read(&(srv->fs), req->txn_id, req->oid,
+                          __flow_subscribe, __flow_subscribe_completed,
+                          subscriber, &(resp->status)))
+  {
+    z_lock(&(subscriber->session->lock), z_spin, {
+      z_dlink_del(&(subscriber->node));
+    });
+    __session_release(subscriber->session);
+    z_memory_struct_free(z_global_memory(), struct flow_subscriber, subscriber);
+    return(-1);
+  }
+  return(0);
+}
+
+/* An empty write, the commit runs the parked subscriptions again */
+static raleighsl_errno_t __flow_wake (raleighsl_t *fs,
+                                      raleighsl_transaction_t *transaction,
+                                      raleighsl_object_t *object,
+                                      void *udata)
+{
+  __VERIFY_OBJ_PLUG_TYPE(object, flow);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static void __flow_wake_completed (raleighsl_t *fs,
+                                   uint64_t oid, raleighsl_errno_t errno,
+                                   void *udata, void *error_data)
+{
+}
+
+#define __WAKE_BATCH      (16)
+
+/*
+ * The client is already gone. The oids are collected under the session
+ * lock and the flows woken up out of it, a subscriber may complete (and
+ * be freed) as soon as its flow runs. A failed wake leaves the request
+ * parked until the next commit of the flow, or the file-system close.
+ */
+static void __session_wake_subscribers (struct raleighsl_session *session) {
+  struct server_context *srv = SERVER_CONTEXT(z_global_context_user_data());
+  struct flow_subscriber *subscriber;
+  uint64_t oids[__WAKE_BATCH];
+  int i, count;
+
+  do {
+    count = 0;
+    z_lock(&(session->lock), z_spin, {
+      z_dlink_for_each_entry(&(session->subscribers), subscriber, struct flow_subscriber, node, {
+        if (count == __WAKE_BATCH)
+          break;
+        if (!subscriber->woken) {
+          subscriber->woken = 1;
+          oids[count++] = subscriber->oid;
+        }
+      });
+    });
+
+    for (i = 0; i < count; ++i) {
+      if (raleighsl_exec_write(&(srv->fs), 0, oids[i],
+                               __flow_wake, __flow_wake_completed, NULL, NULL))
+      {
+        Z_LOG_WARN("Unable to wake flow %"PRIu64", the subscription stays parked", oids[i]);
+      }
+    }
+  } while (count == __WAKE_BATCH);
+}
+
 __DECLARE_EXEC_WRITE(flow_append)
 __DECLARE_EXEC_WRITE(flow_inject)
 __DECLARE_EXEC_WRITE(flow_write)
@@ -599,8 +816,197 @@ static raleighsl_errno_t __deque_pop (raleighsl_t *fs,
   return(RALEIGHSL_ERRNO_NONE);
 }
 
+static raleighsl_errno_t __deque_push_n (raleighsl_t *fs,
+                                         raleighsl_transaction_t *transaction,
+                                         raleighsl_object_t *object,
+                                         void *ctx)
+{
+  const struct deque_push_n_request *req = Z_RPC_CTX_CONST_REQ(struct deque_push_n_request, ctx);
+
+  __VERIFY_OBJ_PLUG_TYPE(object, deque);
+  return(raleighsl_deque_push_n(fs, transaction, object, req->front, &(req->data)));
+}
+
+static raleighsl_errno_t __deque_pop_n (raleighsl_t *fs,
+                                        raleighsl_transaction_t *transaction,
+                                        raleighsl_object_t *object,
+                                        void *ctx)
+{
+  const struct deque_pop_n_request *req = Z_RPC_CTX_CONST_REQ(struct deque_pop_n_request, ctx);
+  struct deque_pop_n_response *resp = Z_RPC_CTX_RESP(struct deque_pop_n_response, ctx);
+  raleighsl_errno_t errno;
+
+  __VERIFY_OBJ_PLUG_TYPE(object, deque);
+  if ((errno = raleighsl_deque_pop_n(fs, transaction, object,
+                                     req->front, req->count, &(resp->data))))
+  {
+    return(errno);
+  }
+
+  deque_pop_n_response_set_data(resp);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * A pop with a timeout parks on the empty deque, a commit hands it the
+ * pushed item or the server timer expires it. The client may be gone.
+ * The timer entry is cancelled once the popper is done.
+ */
+struct deque_popper {
+  raleighsl_deque_waiter_t waiter;
+  struct server_timer_entry timer;
+  struct raleighsl_session *session;
+  z_rpc_ctx_t *ctx;
+};
+
+static void __deque_popper_free (struct deque_popper *popper) {
+  struct server_context *srv = SERVER_CONTEXT(z_global_context_user_data());
+  server_timer_cancel(&(srv->timer), &(popper->timer));
+  __session_release(popper->session);
+  z_memory_struct_free(z_global_memory(), struct deque_popper, popper);
+}
+
+/* Returns 1 if the client is gone, the request is released */
+static int __deque_popper_reply (struct deque_popper *popper,
+                                 raleighsl_errno_t errno,
+                                 const z_bytes_ref_t *data)
+{
+  struct raleighsl_session *session = popper->session;
+  z_rpc_ctx_t *ctx = popper->ctx;
+  struct deque_pop_response *resp = Z_RPC_CTX_RESP(struct deque_pop_response, ctx);
+  int is_gone;
+
+  z_spin_lock(&(session->lock));
+  is_gone = (session->client == NULL);
+  if (is_gone) {
+    deque_pop_request_free(Z_RPC_CTX_REQ(struct deque_pop_request, ctx));
+    deque_pop_response_free(resp);
+    z_rpc_ctx_free(ctx);
+  } else {
+    if (data != NULL) {
+      z_bytes_ref_acquire(&(resp->data), data);
+      deque_pop_response_set_data(resp);
+    }
+    __operation_completed(NULL, 0, errno, ctx, &(resp->status));
+  }
+  z_spin_unlock(&(session->lock));
+
+  __deque_popper_free(popper);
+  return(is_gone);
+}
+
+static int __deque_popper_notify (raleighsl_deque_waiter_t *waiter,
+                                  raleighsl_errno_t errno,
+                                  const z_bytes_ref_t *data)
+{
+  return(__deque_popper_reply(z_container_of(waiter, struct deque_popper, waiter), errno, data));
+}
+
+static raleighsl_errno_t __deque_expire (raleighsl_t *fs,
+                                         raleighsl_transaction_t *transaction,
+                                         raleighsl_object_t *object,
+                                         void *ctx)
+{
+  __VERIFY_OBJ_PLUG_TYPE(object, deque);
+  raleighsl_deque_expire(fs, object, z_time_micros());
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static void __deque_expire_completed (raleighsl_t *fs,
+                                      uint64_t oid, raleighsl_errno_t errno,
+                                      void *udata, void *error_data)
+{
+}
+
+static void __deque_expire_timer (void *udata, uint64_t oid) {
+  struct server_context *srv = SERVER_CONTEXT(udata);
+  raleighsl_exec_write(&(srv->fs), 0, oid, __deque_expire, __deque_expire_completed, NULL, NULL);
+}
+
+static raleighsl_errno_t __deque_pop_wait (raleighsl_t *fs,
+                                           raleighsl_transaction_t *transaction,
+                                           raleighsl_object_t *object,
+                                           void *udata)
+{
+  struct server_context *srv = SERVER_CONTEXT(z_global_context_user_data());
+  struct deque_popper *popper = (struct deque_popper *)udata;
+  const struct deque_pop_request *req = Z_RPC_CTX_CONST_REQ(struct deque_pop_request, popper->ctx);
+  struct deque_pop_response *resp = Z_RPC_CTX_RESP(struct deque_pop_response, popper->ctx);
+  raleighsl_errno_t errno;
+
+  __VERIFY_OBJ_PLUG_TYPE(object, deque);
+  popper->waiter.notify = __deque_popper_notify;
+  popper->waiter.deadline = z_time_micros() + req->timeout * 1000ull;
+  popper->waiter.pop_front = req->front;
+
+  errno = raleighsl_deque_pop_wait(fs, transaction, object, &(popper->waiter), &(resp->data));
+  if (errno == RALEIGHSL_ERRNO_SCHED_WAIT) {
+    /* Still holding the object lock, the waiter is not visible yet */
+    popper->timer.func = __deque_expire_timer;
+    popper->timer.udata = srv;
+    popper->timer.deadline = popper->waiter.deadline;
+    popper->timer.arg = raleighsl_oid(object);
+    if (server_timer_add(&(srv->timer), &(popper->timer))) {
+      raleighsl_deque_cancel(fs, object, &(popper->waiter));
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+    }
+    return(errno);
+  }
+
+  if (Z_UNLIKELY(errno)) {
+    return(errno);
+  }
+
+  deque_pop_response_set_data(resp);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static void __deque_pop_wait_completed (raleighsl_t *fs,
+                                        uint64_t oid, raleighsl_errno_t errno,
+                                        void *udata, void *error_data)
+{
+  /* Parked, the deque owns the popper now */
+  if (errno == RALEIGHSL_ERRNO_SCHED_WAIT)
+    return;
+
+  __deque_popper_reply((struct deque_popper *)udata, errno, NULL);
+}
+
+static int __rpc_deque_pop (z_rpc_ctx_t *ctx,
+                            struct deque_pop_request *req,
+                            struct deque_pop_response *resp)
+{
+  struct server_context *srv = SERVER_CONTEXT(z_global_context_user_data());
+  struct raleighsl_client *client = RALEIGHSL_CLIENT(ctx->client);
+  struct deque_popper *popper;
+
+  deque_pop_response_set_status(resp);
+  if (req->timeout == 0) {
+    return(raleighsl_exec_write(&(srv->fs), req->txn_id, req->oid,
+                                __deque_pop, __operation_completed,
+                                ctx, &(resp->status)));
+  }
+
+  popper = z_memory_struct_alloc(z_global_memory(), struct deque_popper);
+  if (Z_MALLOC_IS_NULL(popper))
+    return(-1);
+
+  popper->session = __session_acquire(client->session);
+  popper->timer.index = 0;
+  popper->ctx = ctx;
+  if (raleighsl_exec_write(&(srv->fs), req->txn_id, req->oid,
+                           __deque_pop_wait, __deque_pop_wait_completed,
+                           popper, &(resp->status)))
+  {
+    __deque_popper_free(popper);
+    return(-1);
+  }
+  return(0);
+}
+
 __DECLARE_EXEC_WRITE(deque_push)
-__DECLARE_EXEC_WRITE(deque_pop)
+__DECLARE_EXEC_WRITE(deque_push_n)
+__DECLARE_EXEC_WRITE(deque_pop_n)
 
 /* ============================================================================
  *  RaleighSL RPC Protocol - Server
@@ -665,10 +1071,13 @@ static const struct raleighsl_rpc_server __raleighsl_protocol = {
   .flow_remove   = __rpc_flow_remove,
   .flow_truncate = __rpc_flow_truncate,
   .flow_read     = __rpc_flow_read,
+  .flow_subscribe = __rpc_flow_subscribe,
 
   /* Deque */
   .deque_push   = __rpc_deque_push,
   .deque_pop    = __rpc_deque_pop,
+  .deque_push_n = __rpc_deque_push_n,
+  .deque_pop_n  = __rpc_deque_pop_n,
 
   /* Server */
   .server_ping  = __rpc_server_ping,
@@ -686,6 +1095,11 @@ static int __client_msg_parse (z_iopoll_entity_t *ipc_client, const struct iovec
  */
 static int __client_connected (z_ipc_client_t *ipc_client) {
   struct raleighsl_client *client = RALEIGHSL_CLIENT(ipc_client);
+
+  client->session = __session_alloc(ipc_client);
+  if (Z_MALLOC_IS_NULL(client->session))
+    return(-1);
+
   z_ipc_msgbuf_open(&(client->msgbuf), 512);
   Z_LOG_DEBUG("RaleighSL client connected");
   return(0);
@@ -694,6 +1108,8 @@ static int __client_connected (z_ipc_client_t *ipc_client) {
 static void __client_disconnected (z_ipc_client_t *ipc_client) {
   struct raleighsl_client *client = RALEIGHSL_CLIENT(ipc_client);
   Z_LOG_DEBUG("RaleighSL client disconnected");
+  /* The parked requests must not reply to the closed client */
+  __session_close(client->session);
   z_ipc_msgbuf_close(&(client->msgbuf));
 }
 
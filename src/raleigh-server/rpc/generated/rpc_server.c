@@ -0,0 +1,2082 @@
+
+/* File autogenerated, do not edit */
+#include <zcl/string.h>
+#include <zcl/global.h>
+#include <zcl/iovec.h>
+#include <zcl/debug.h>
+#include <zcl/time.h>
+
+#include "rpc_server.h"
+
+
+/* Every ctx of the calls fits the rpc ctx pool */
+typedef char __raleighsl_rpc_server_ctx_check[
+  (RALEIGHSL_RPC_SERVER_CTX_ISIZE <= Z_MEMORY_SLAB_MAX_ISIZE) ? 1 : -1];
+
+int raleighsl_rpc_server_parse (const struct raleighsl_rpc_server *proto,
+                                z_ipc_client_t *client,
+                                const struct iovec iov[2])
+{
+  z_iovec_reader_t reader;
+  uint64_t req_st_time;
+  uint64_t msg_type;
+  uint64_t req_id;
+  uint64_t size;
+  int r = -1;
+
+  req_st_time = z_time_micros();
+
+  z_iovec_reader_open(&reader, iov, 2);
+  size = z_reader_available(&reader);
+
+  /* Parse the RPC header */
+  if (z_rpc_parse_head(&reader, &msg_type, &req_id, &r)) {
+    Z_LOG_FATAL("Unable to read the Request-Head from the RPC header");
+    return(-1);
+  }
+
+  if (Z_UNLIKELY(!r)) {
+    Z_LOG_FATAL("The request has the response flag");
+    return(-1);
+  }
+
+  switch (msg_type) {
+
+    case 10: { /* 10 semantic_open */
+      z_rpc_ctx_t *ctx;
+      struct semantic_open_response *resp;
+      struct semantic_open_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu semantic_open from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct semantic_open_request, struct semantic_open_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context semantic_open");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct semantic_open_request);
+      req  = Z_RPC_CTX_REQ(struct semantic_open_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct semantic_open_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 10;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = semantic_open_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request semantic_open_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (semantic_open_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request semantic_open_request");
+        semantic_open_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = semantic_open_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response semantic_open_response");
+        semantic_open_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->semantic_open(ctx, req, resp))) {
+        semantic_open_response_free(resp);
+        semantic_open_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 11: { /* 11 semantic_create */
+      z_rpc_ctx_t *ctx;
+      struct semantic_create_response *resp;
+      struct semantic_create_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu semantic_create from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct semantic_create_request, struct semantic_create_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context semantic_create");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct semantic_create_request);
+      req  = Z_RPC_CTX_REQ(struct semantic_create_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct semantic_create_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 11;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = semantic_create_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request semantic_create_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (semantic_create_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request semantic_create_request");
+        semantic_create_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = semantic_create_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response semantic_create_response");
+        semantic_create_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->semantic_create(ctx, req, resp))) {
+        semantic_create_response_free(resp);
+        semantic_create_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 12: { /* 12 semantic_delete */
+      z_rpc_ctx_t *ctx;
+      struct semantic_delete_response *resp;
+      struct semantic_delete_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu semantic_delete from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct semantic_delete_request, struct semantic_delete_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context semantic_delete");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct semantic_delete_request);
+      req  = Z_RPC_CTX_REQ(struct semantic_delete_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct semantic_delete_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 12;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = semantic_delete_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request semantic_delete_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (semantic_delete_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request semantic_delete_request");
+        semantic_delete_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = semantic_delete_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response semantic_delete_response");
+        semantic_delete_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->semantic_delete(ctx, req, resp))) {
+        semantic_delete_response_free(resp);
+        semantic_delete_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 13: { /* 13 semantic_rename */
+      z_rpc_ctx_t *ctx;
+      struct semantic_rename_response *resp;
+      struct semantic_rename_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu semantic_rename from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct semantic_rename_request, struct semantic_rename_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context semantic_rename");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct semantic_rename_request);
+      req  = Z_RPC_CTX_REQ(struct semantic_rename_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct semantic_rename_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 13;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = semantic_rename_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request semantic_rename_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (semantic_rename_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request semantic_rename_request");
+        semantic_rename_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = semantic_rename_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response semantic_rename_response");
+        semantic_rename_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->semantic_rename(ctx, req, resp))) {
+        semantic_rename_response_free(resp);
+        semantic_rename_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 20: { /* 20 transaction_create */
+      z_rpc_ctx_t *ctx;
+      struct transaction_create_response *resp;
+      struct transaction_create_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu transaction_create from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct transaction_create_request, struct transaction_create_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context transaction_create");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct transaction_create_request);
+      req  = Z_RPC_CTX_REQ(struct transaction_create_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct transaction_create_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 20;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = transaction_create_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request transaction_create_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (transaction_create_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request transaction_create_request");
+        transaction_create_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = transaction_create_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response transaction_create_response");
+        transaction_create_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->transaction_create(ctx, req, resp))) {
+        transaction_create_response_free(resp);
+        transaction_create_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 21: { /* 21 transaction_commit */
+      z_rpc_ctx_t *ctx;
+      struct transaction_commit_response *resp;
+      struct transaction_commit_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu transaction_commit from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct transaction_commit_request, struct transaction_commit_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context transaction_commit");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct transaction_commit_request);
+      req  = Z_RPC_CTX_REQ(struct transaction_commit_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct transaction_commit_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 21;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = transaction_commit_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request transaction_commit_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (transaction_commit_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request transaction_commit_request");
+        transaction_commit_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = transaction_commit_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response transaction_commit_response");
+        transaction_commit_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->transaction_commit(ctx, req, resp))) {
+        transaction_commit_response_free(resp);
+        transaction_commit_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 22: { /* 22 transaction_rollback */
+      z_rpc_ctx_t *ctx;
+      struct transaction_rollback_response *resp;
+      struct transaction_rollback_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu transaction_rollback from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct transaction_rollback_request, struct transaction_rollback_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context transaction_rollback");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct transaction_rollback_request);
+      req  = Z_RPC_CTX_REQ(struct transaction_rollback_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct transaction_rollback_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 22;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = transaction_rollback_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request transaction_rollback_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (transaction_rollback_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request transaction_rollback_request");
+        transaction_rollback_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = transaction_rollback_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response transaction_rollback_response");
+        transaction_rollback_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->transaction_rollback(ctx, req, resp))) {
+        transaction_rollback_response_free(resp);
+        transaction_rollback_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 30: { /* 30 number_get */
+      z_rpc_ctx_t *ctx;
+      struct number_get_response *resp;
+      struct number_get_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu number_get from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct number_get_request, struct number_get_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context number_get");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct number_get_request);
+      req  = Z_RPC_CTX_REQ(struct number_get_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct number_get_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 30;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = number_get_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request number_get_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (number_get_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request number_get_request");
+        number_get_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = number_get_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response number_get_response");
+        number_get_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->number_get(ctx, req, resp))) {
+        number_get_response_free(resp);
+        number_get_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 31: { /* 31 number_set */
+      z_rpc_ctx_t *ctx;
+      struct number_set_response *resp;
+      struct number_set_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu number_set from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct number_set_request, struct number_set_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context number_set");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct number_set_request);
+      req  = Z_RPC_CTX_REQ(struct number_set_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct number_set_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 31;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = number_set_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request number_set_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (number_set_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request number_set_request");
+        number_set_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = number_set_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response number_set_response");
+        number_set_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->number_set(ctx, req, resp))) {
+        number_set_response_free(resp);
+        number_set_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 32: { /* 32 number_cas */
+      z_rpc_ctx_t *ctx;
+      struct number_cas_response *resp;
+      struct number_cas_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu number_cas from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct number_cas_request, struct number_cas_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context number_cas");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct number_cas_request);
+      req  = Z_RPC_CTX_REQ(struct number_cas_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct number_cas_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 32;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = number_cas_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request number_cas_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (number_cas_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request number_cas_request");
+        number_cas_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = number_cas_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response number_cas_response");
+        number_cas_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->number_cas(ctx, req, resp))) {
+        number_cas_response_free(resp);
+        number_cas_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 33: { /* 33 number_add */
+      z_rpc_ctx_t *ctx;
+      struct number_add_response *resp;
+      struct number_add_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu number_add from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct number_add_request, struct number_add_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context number_add");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct number_add_request);
+      req  = Z_RPC_CTX_REQ(struct number_add_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct number_add_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 33;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = number_add_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request number_add_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (number_add_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request number_add_request");
+        number_add_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = number_add_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response number_add_response");
+        number_add_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->number_add(ctx, req, resp))) {
+        number_add_response_free(resp);
+        number_add_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 34: { /* 34 number_mul */
+      z_rpc_ctx_t *ctx;
+      struct number_mul_response *resp;
+      struct number_mul_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu number_mul from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct number_mul_request, struct number_mul_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context number_mul");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct number_mul_request);
+      req  = Z_RPC_CTX_REQ(struct number_mul_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct number_mul_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 34;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = number_mul_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request number_mul_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (number_mul_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request number_mul_request");
+        number_mul_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = number_mul_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response number_mul_response");
+        number_mul_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->number_mul(ctx, req, resp))) {
+        number_mul_response_free(resp);
+        number_mul_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 35: { /* 35 number_div */
+      z_rpc_ctx_t *ctx;
+      struct number_div_response *resp;
+      struct number_div_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu number_div from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct number_div_request, struct number_div_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context number_div");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct number_div_request);
+      req  = Z_RPC_CTX_REQ(struct number_div_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct number_div_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 35;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = number_div_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request number_div_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (number_div_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request number_div_request");
+        number_div_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = number_div_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response number_div_response");
+        number_div_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->number_div(ctx, req, resp))) {
+        number_div_response_free(resp);
+        number_div_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 40: { /* 40 sset_insert */
+      z_rpc_ctx_t *ctx;
+      struct sset_insert_response *resp;
+      struct sset_insert_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu sset_insert from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct sset_insert_request, struct sset_insert_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context sset_insert");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct sset_insert_request);
+      req  = Z_RPC_CTX_REQ(struct sset_insert_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct sset_insert_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 40;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = sset_insert_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request sset_insert_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (sset_insert_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request sset_insert_request");
+        sset_insert_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = sset_insert_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response sset_insert_response");
+        sset_insert_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->sset_insert(ctx, req, resp))) {
+        sset_insert_response_free(resp);
+        sset_insert_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 41: { /* 41 sset_update */
+      z_rpc_ctx_t *ctx;
+      struct sset_update_response *resp;
+      struct sset_update_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu sset_update from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct sset_update_request, struct sset_update_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context sset_update");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct sset_update_request);
+      req  = Z_RPC_CTX_REQ(struct sset_update_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct sset_update_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 41;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = sset_update_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request sset_update_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (sset_update_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request sset_update_request");
+        sset_update_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = sset_update_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response sset_update_response");
+        sset_update_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->sset_update(ctx, req, resp))) {
+        sset_update_response_free(resp);
+        sset_update_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 43: { /* 43 sset_pop */
+      z_rpc_ctx_t *ctx;
+      struct sset_pop_response *resp;
+      struct sset_pop_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu sset_pop from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct sset_pop_request, struct sset_pop_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context sset_pop");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct sset_pop_request);
+      req  = Z_RPC_CTX_REQ(struct sset_pop_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct sset_pop_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 43;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = sset_pop_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request sset_pop_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (sset_pop_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request sset_pop_request");
+        sset_pop_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = sset_pop_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response sset_pop_response");
+        sset_pop_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->sset_pop(ctx, req, resp))) {
+        sset_pop_response_free(resp);
+        sset_pop_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 45: { /* 45 sset_get */
+      z_rpc_ctx_t *ctx;
+      struct sset_get_response *resp;
+      struct sset_get_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu sset_get from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct sset_get_request, struct sset_get_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context sset_get");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct sset_get_request);
+      req  = Z_RPC_CTX_REQ(struct sset_get_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct sset_get_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 45;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = sset_get_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request sset_get_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (sset_get_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request sset_get_request");
+        sset_get_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = sset_get_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response sset_get_response");
+        sset_get_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->sset_get(ctx, req, resp))) {
+        sset_get_response_free(resp);
+        sset_get_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 46: { /* 46 sset_scan */
+      z_rpc_ctx_t *ctx;
+      struct sset_scan_response *resp;
+      struct sset_scan_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu sset_scan from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct sset_scan_request, struct sset_scan_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context sset_scan");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct sset_scan_request);
+      req  = Z_RPC_CTX_REQ(struct sset_scan_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct sset_scan_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 46;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = sset_scan_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request sset_scan_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (sset_scan_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request sset_scan_request");
+        sset_scan_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = sset_scan_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response sset_scan_response");
+        sset_scan_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->sset_scan(ctx, req, resp))) {
+        sset_scan_response_free(resp);
+        sset_scan_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 50: { /* 50 flow_append */
+      z_rpc_ctx_t *ctx;
+      struct flow_append_response *resp;
+      struct flow_append_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu flow_append from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct flow_append_request, struct flow_append_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context flow_append");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct flow_append_request);
+      req  = Z_RPC_CTX_REQ(struct flow_append_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct flow_append_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 50;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = flow_append_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request flow_append_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (flow_append_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request flow_append_request");
+        flow_append_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = flow_append_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response flow_append_response");
+        flow_append_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->flow_append(ctx, req, resp))) {
+        flow_append_response_free(resp);
+        flow_append_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 51: { /* 51 flow_inject */
+      z_rpc_ctx_t *ctx;
+      struct flow_inject_response *resp;
+      struct flow_inject_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu flow_inject from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct flow_inject_request, struct flow_inject_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context flow_inject");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct flow_inject_request);
+      req  = Z_RPC_CTX_REQ(struct flow_inject_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct flow_inject_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 51;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = flow_inject_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request flow_inject_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (flow_inject_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request flow_inject_request");
+        flow_inject_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = flow_inject_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response flow_inject_response");
+        flow_inject_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->flow_inject(ctx, req, resp))) {
+        flow_inject_response_free(resp);
+        flow_inject_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 52: { /* 52 flow_write */
+      z_rpc_ctx_t *ctx;
+      struct flow_write_response *resp;
+      struct flow_write_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu flow_write from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct flow_write_request, struct flow_write_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context flow_write");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct flow_write_request);
+      req  = Z_RPC_CTX_REQ(struct flow_write_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct flow_write_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 52;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = flow_write_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request flow_write_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (flow_write_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request flow_write_request");
+        flow_write_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = flow_write_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response flow_write_response");
+        flow_write_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->flow_write(ctx, req, resp))) {
+        flow_write_response_free(resp);
+        flow_write_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 53: { /* 53 flow_remove */
+      z_rpc_ctx_t *ctx;
+      struct flow_remove_response *resp;
+      struct flow_remove_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu flow_remove from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct flow_remove_request, struct flow_remove_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context flow_remove");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct flow_remove_request);
+      req  = Z_RPC_CTX_REQ(struct flow_remove_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct flow_remove_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 53;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = flow_remove_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request flow_remove_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (flow_remove_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request flow_remove_request");
+        flow_remove_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = flow_remove_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response flow_remove_response");
+        flow_remove_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->flow_remove(ctx, req, resp))) {
+        flow_remove_response_free(resp);
+        flow_remove_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 54: { /* 54 flow_truncate */
+      z_rpc_ctx_t *ctx;
+      struct flow_truncate_response *resp;
+      struct flow_truncate_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu flow_truncate from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct flow_truncate_request, struct flow_truncate_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context flow_truncate");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct flow_truncate_request);
+      req  = Z_RPC_CTX_REQ(struct flow_truncate_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct flow_truncate_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 54;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = flow_truncate_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request flow_truncate_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (flow_truncate_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request flow_truncate_request");
+        flow_truncate_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = flow_truncate_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response flow_truncate_response");
+        flow_truncate_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->flow_truncate(ctx, req, resp))) {
+        flow_truncate_response_free(resp);
+        flow_truncate_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 55: { /* 55 flow_read */
+      z_rpc_ctx_t *ctx;
+      struct flow_read_response *resp;
+      struct flow_read_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu flow_read from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct flow_read_request, struct flow_read_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context flow_read");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct flow_read_request);
+      req  = Z_RPC_CTX_REQ(struct flow_read_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct flow_read_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 55;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = flow_read_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request flow_read_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (flow_read_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request flow_read_request");
+        flow_read_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = flow_read_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response flow_read_response");
+        flow_read_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->flow_read(ctx, req, resp))) {
+        flow_read_response_free(resp);
+        flow_read_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 56: { /* 56 flow_subscribe */
+      z_rpc_ctx_t *ctx;
+      struct flow_subscribe_response *resp;
+      struct flow_subscribe_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu flow_subscribe from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct flow_subscribe_request, struct flow_subscribe_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context flow_subscribe");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct flow_subscribe_request);
+      req  = Z_RPC_CTX_REQ(struct flow_subscribe_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct flow_subscribe_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 56;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = flow_subscribe_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request flow_subscribe_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (flow_subscribe_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request flow_subscribe_request");
+        flow_subscribe_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = flow_subscribe_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response flow_subscribe_response");
+        flow_subscribe_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->flow_subscribe(ctx, req, resp))) {
+        flow_subscribe_response_free(resp);
+        flow_subscribe_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 60: { /* 60 deque_push */
+      z_rpc_ctx_t *ctx;
+      struct deque_push_response *resp;
+      struct deque_push_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu deque_push from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct deque_push_request, struct deque_push_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context deque_push");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct deque_push_request);
+      req  = Z_RPC_CTX_REQ(struct deque_push_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct deque_push_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 60;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = deque_push_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request deque_push_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (deque_push_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request deque_push_request");
+        deque_push_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = deque_push_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response deque_push_response");
+        deque_push_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->deque_push(ctx, req, resp))) {
+        deque_push_response_free(resp);
+        deque_push_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 61: { /* 61 deque_pop */
+      z_rpc_ctx_t *ctx;
+      struct deque_pop_response *resp;
+      struct deque_pop_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu deque_pop from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct deque_pop_request, struct deque_pop_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context deque_pop");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct deque_pop_request);
+      req  = Z_RPC_CTX_REQ(struct deque_pop_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct deque_pop_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 61;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = deque_pop_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request deque_pop_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (deque_pop_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request deque_pop_request");
+        deque_pop_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = deque_pop_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response deque_pop_response");
+        deque_pop_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->deque_pop(ctx, req, resp))) {
+        deque_pop_response_free(resp);
+        deque_pop_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 62: { /* 62 deque_push_n */
+      z_rpc_ctx_t *ctx;
+      struct deque_push_n_response *resp;
+      struct deque_push_n_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu deque_push_n from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct deque_push_n_request, struct deque_push_n_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context deque_push_n");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct deque_push_n_request);
+      req  = Z_RPC_CTX_REQ(struct deque_push_n_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct deque_push_n_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 62;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = deque_push_n_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request deque_push_n_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (deque_push_n_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request deque_push_n_request");
+        deque_push_n_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = deque_push_n_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response deque_push_n_response");
+        deque_push_n_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->deque_push_n(ctx, req, resp))) {
+        deque_push_n_response_free(resp);
+        deque_push_n_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 63: { /* 63 deque_pop_n */
+      z_rpc_ctx_t *ctx;
+      struct deque_pop_n_response *resp;
+      struct deque_pop_n_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu deque_pop_n from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct deque_pop_n_request, struct deque_pop_n_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context deque_pop_n");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct deque_pop_n_request);
+      req  = Z_RPC_CTX_REQ(struct deque_pop_n_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct deque_pop_n_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 63;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = deque_pop_n_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request deque_pop_n_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (deque_pop_n_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request deque_pop_n_request");
+        deque_pop_n_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = deque_pop_n_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response deque_pop_n_response");
+        deque_pop_n_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->deque_pop_n(ctx, req, resp))) {
+        deque_pop_n_response_free(resp);
+        deque_pop_n_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 90: { /* 90 server_ping */
+      z_rpc_ctx_t *ctx;
+      struct server_ping_response *resp;
+      struct server_ping_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu server_ping from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct server_ping_request, struct server_ping_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context server_ping");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct server_ping_request);
+      req  = Z_RPC_CTX_REQ(struct server_ping_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct server_ping_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 90;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = server_ping_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request server_ping_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (server_ping_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request server_ping_request");
+        server_ping_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = server_ping_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response server_ping_response");
+        server_ping_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->server_ping(ctx, req, resp))) {
+        server_ping_response_free(resp);
+        server_ping_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 91: { /* 91 server_info */
+      z_rpc_ctx_t *ctx;
+      struct server_info_response *resp;
+      struct server_info_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu server_info from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct server_info_request, struct server_info_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context server_info");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct server_info_request);
+      req  = Z_RPC_CTX_REQ(struct server_info_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct server_info_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 91;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = server_info_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request server_info_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (server_info_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request server_info_request");
+        server_info_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = server_info_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response server_info_response");
+        server_info_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->server_info(ctx, req, resp))) {
+        server_info_response_free(resp);
+        server_info_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 92: { /* 92 server_quit */
+      z_rpc_ctx_t *ctx;
+      struct server_quit_response *resp;
+      struct server_quit_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu server_quit from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct server_quit_request, struct server_quit_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context server_quit");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct server_quit_request);
+      req  = Z_RPC_CTX_REQ(struct server_quit_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct server_quit_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 92;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = server_quit_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request server_quit_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (server_quit_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request server_quit_request");
+        server_quit_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = server_quit_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response server_quit_response");
+        server_quit_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->server_quit(ctx, req, resp))) {
+        server_quit_response_free(resp);
+        server_quit_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 93: { /* 93 server_debug */
+      z_rpc_ctx_t *ctx;
+      struct server_debug_response *resp;
+      struct server_debug_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu server_debug from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct server_debug_request, struct server_debug_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context server_debug");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct server_debug_request);
+      req  = Z_RPC_CTX_REQ(struct server_debug_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct server_debug_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 93;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = server_debug_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request server_debug_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (server_debug_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request server_debug_request");
+        server_debug_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = server_debug_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response server_debug_response");
+        server_debug_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->server_debug(ctx, req, resp))) {
+        server_debug_response_free(resp);
+        server_debug_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    default:
+      Z_LOG_FATAL("Unknown type %u for request %u", msg_type, req_id);
+      break;
+  }
+
+  z_iovec_reader_close(&reader);
+  return(r);
+}
+
+int  raleighsl_rpc_server_push_response (z_rpc_ctx_t *ctx,
+                                         z_ipc_msgbuf_t *msgbuf)
+{
+  z_buffer_t buffer;
+  int pushed = 0;
+  int r = -1;
+
+  if (Z_UNLIKELY(z_buffer_alloc(&buffer) == NULL)) {
+    Z_LOG_FATAL("TODO unable to allocate buffer (free req/resp)\n");
+    return(-1);
+  }
+
+  if (Z_UNLIKELY(z_buffer_reserve(&buffer, 128))) {
+    Z_LOG_FATAL("TODO unable to reserve buffer space (free req/resp)\n");
+    return(-1);
+  }
+
+  /* Write the RPC header */
+  buffer.size = z_rpc_write_head(buffer.block, ctx->msg_type, ctx->req_id, 0);
+
+  /* Write the Response */
+  switch (ctx->msg_type) {
+
+    case 10: { /* 10 semantic_open */
+      semantic_open_request_free((struct semantic_open_request *)ctx->req);
+      r = semantic_open_response_write((struct semantic_open_response *)ctx->resp, &buffer);
+      semantic_open_response_free((struct semantic_open_response *)ctx->resp);
+      break;
+    }
+
+    case 11: { /* 11 semantic_create */
+      semantic_create_request_free((struct semantic_create_request *)ctx->req);
+      r = semantic_create_response_write((struct semantic_create_response *)ctx->resp, &buffer);
+      semantic_create_response_free((struct semantic_create_response *)ctx->resp);
+      break;
+    }
+
+    case 12: { /* 12 semantic_delete */
+      semantic_delete_request_free((struct semantic_delete_request *)ctx->req);
+      r = semantic_delete_response_write((struct semantic_delete_response *)ctx->resp, &buffer);
+      semantic_delete_response_free((struct semantic_delete_response *)ctx->resp);
+      break;
+    }
+
+    case 13: { /* 13 semantic_rename */
+      semantic_rename_request_free((struct semantic_rename_request *)ctx->req);
+      r = semantic_rename_response_write((struct semantic_rename_response *)ctx->resp, &buffer);
+      semantic_rename_response_free((struct semantic_rename_response *)ctx->resp);
+      break;
+    }
+
+    case 20: { /* 20 transaction_create */
+      transaction_create_request_free((struct transaction_create_request *)ctx->req);
+      r = transaction_create_response_write((struct transaction_create_response *)ctx->resp, &buffer);
+      transaction_create_response_free((struct transaction_create_response *)ctx->resp);
+      break;
+    }
+
+    case 21: { /* 21 transaction_commit */
+      transaction_commit_request_free((struct transaction_commit_request *)ctx->req);
+      r = transaction_commit_response_write((struct transaction_commit_response *)ctx->resp, &buffer);
+      transaction_commit_response_free((struct transaction_commit_response *)ctx->resp);
+      break;
+    }
+
+    case 22: { /* 22 transaction_rollback */
+      transaction_rollback_request_free((struct transaction_rollback_request *)ctx->req);
+      r = transaction_rollback_response_write((struct transaction_rollback_response *)ctx->resp, &buffer);
+      transaction_rollback_response_free((struct transaction_rollback_response *)ctx->resp);
+      break;
+    }
+
+    case 30: { /* 30 number_get */
+      number_get_request_free((struct number_get_request *)ctx->req);
+      r = number_get_response_write((struct number_get_response *)ctx->resp, &buffer);
+      number_get_response_free((struct number_get_response *)ctx->resp);
+      break;
+    }
+
+    case 31: { /* 31 number_set */
+      number_set_request_free((struct number_set_request *)ctx->req);
+      r = number_set_response_write((struct number_set_response *)ctx->resp, &buffer);
+      number_set_response_free((struct number_set_response *)ctx->resp);
+      break;
+    }
+
+    case 32: { /* 32 number_cas */
+      number_cas_request_free((struct number_cas_request *)ctx->req);
+      r = number_cas_response_write((struct number_cas_response *)ctx->resp, &buffer);
+      number_cas_response_free((struct number_cas_response *)ctx->resp);
+      break;
+    }
+
+    case 33: { /* 33 number_add */
+      number_add_request_free((struct number_add_request *)ctx->req);
+      r = number_add_response_write((struct number_add_response *)ctx->resp, &buffer);
+      number_add_response_free((struct number_add_response *)ctx->resp);
+      break;
+    }
+
+    case 34: { /* 34 number_mul */
+      number_mul_request_free((struct number_mul_request *)ctx->req);
+      r = number_mul_response_write((struct number_mul_response *)ctx->resp, &buffer);
+      number_mul_response_free((struct number_mul_response *)ctx->resp);
+      break;
+    }
+
+    case 35: { /* 35 number_div */
+      number_div_request_free((struct number_div_request *)ctx->req);
+      r = number_div_response_write((struct number_div_response *)ctx->resp, &buffer);
+      number_div_response_free((struct number_div_response *)ctx->resp);
+      break;
+    }
+
+    case 40: { /* 40 sset_insert */
+      sset_insert_request_free((struct sset_insert_request *)ctx->req);
+      r = sset_insert_response_write((struct sset_insert_response *)ctx->resp, &buffer);
+      sset_insert_response_free((struct sset_insert_response *)ctx->resp);
+      break;
+    }
+
+    case 41: { /* 41 sset_update */
+      sset_update_request_free((struct sset_update_request *)ctx->req);
+      r = sset_update_response_write((struct sset_update_response *)ctx->resp, &buffer);
+      sset_update_response_free((struct sset_update_response *)ctx->resp);
+      break;
+    }
+
+    case 43: { /* 43 sset_pop */
+      sset_pop_request_free((struct sset_pop_request *)ctx->req);
+      r = sset_pop_response_write((struct sset_pop_response *)ctx->resp, &buffer);
+      sset_pop_response_free((struct sset_pop_response *)ctx->resp);
+      break;
+    }
+
+    case 45: { /* 45 sset_get */
+      sset_get_request_free((struct sset_get_request *)ctx->req);
+      r = sset_get_response_write((struct sset_get_response *)ctx->resp, &buffer);
+      sset_get_response_free((struct sset_get_response *)ctx->resp);
+      break;
+    }
+
+    case 46: { /* 46 sset_scan */
+      sset_scan_request_free((struct sset_scan_request *)ctx->req);
+      r = sset_scan_response_write((struct sset_scan_response *)ctx->resp, &buffer);
+      sset_scan_response_free((struct sset_scan_response *)ctx->resp);
+      break;
+    }
+
+    case 50: { /* 50 flow_append */
+      flow_append_request_free((struct flow_append_request *)ctx->req);
+      r = flow_append_response_write((struct flow_append_response *)ctx->resp, &buffer);
+      flow_append_response_free((struct flow_append_response *)ctx->resp);
+      break;
+    }
+
+    case 51: { /* 51 flow_inject */
+      flow_inject_request_free((struct flow_inject_request *)ctx->req);
+      r = flow_inject_response_write((struct flow_inject_response *)ctx->resp, &buffer);
+      flow_inject_response_free((struct flow_inject_response *)ctx->resp);
+      break;
+    }
+
+    case 52: { /* 52 flow_write */
+      flow_write_request_free((struct flow_write_request *)ctx->req);
+      r = flow_write_response_write((struct flow_write_response *)ctx->resp, &buffer);
+      flow_write_response_free((struct flow_write_response *)ctx->resp);
+      break;
+    }
+
+    case 53: { /* 53 flow_remove */
+      flow_remove_request_free((struct flow_remove_request *)ctx->req);
+      r = flow_remove_response_write((struct flow_remove_response *)ctx->resp, &buffer);
+      flow_remove_response_free((struct flow_remove_response *)ctx->resp);
+      break;
+    }
+
+    case 54: { /* 54 flow_truncate */
+      flow_truncate_request_free((struct flow_truncate_request *)ctx->req);
+      r = flow_truncate_response_write((struct flow_truncate_response *)ctx->resp, &buffer);
+      flow_truncate_response_free((struct flow_truncate_response *)ctx->resp);
+      break;
+    }
+
+    case 55: { /* 55 flow_read */
+      struct flow_read_response *resp = (struct flow_read_response *)ctx->resp;
+      flow_read_request_free((struct flow_read_request *)ctx->req);
+      r = flow_read_response_write_head(resp, &buffer);
+      /* The chunks are sent by ref, without copying them */
+      z_ipc_msgbuf_push_refs(msgbuf, buffer.block, buffer.size,
+                             flow_read_response_has_data(resp) ? &(resp->data) : NULL);
+      flow_read_response_free(resp);
+      pushed = 1;
+      break;
+    }
+
+    case 56: { /* 56 flow_subscribe */
+      struct flow_subscribe_response *resp = (struct flow_subscribe_response *)ctx->resp;
+      flow_subscribe_request_free((struct flow_subscribe_request *)ctx->req);
+      r = flow_subscribe_response_write_head(resp, &buffer);
+      /* The chunks are sent by ref, without copying them */
+      z_ipc_msgbuf_push_refs(msgbuf, buffer.block, buffer.size,
+                             flow_subscribe_response_has_data(resp) ? &(resp->data) : NULL);
+      flow_subscribe_response_free(resp);
+      pushed = 1;
+      break;
+    }
+
+    case 60: { /* 60 deque_push */
+      deque_push_request_free((struct deque_push_request *)ctx->req);
+      r = deque_push_response_write((struct deque_push_response *)ctx->resp, &buffer);
+      deque_push_response_free((struct deque_push_response *)ctx->resp);
+      break;
+    }
+
+    case 61: { /* 61 deque_pop */
+      deque_pop_request_free((struct deque_pop_request *)ctx->req);
+      r = deque_pop_response_write((struct deque_pop_response *)ctx->resp, &buffer);
+      deque_pop_response_free((struct deque_pop_response *)ctx->resp);
+      break;
+    }
+
+    case 62: { /* 62 deque_push_n */
+      deque_push_n_request_free((struct deque_push_n_request *)ctx->req);
+      r = deque_push_n_response_write((struct deque_push_n_response *)ctx->resp, &buffer);
+      deque_push_n_response_free((struct deque_push_n_response *)ctx->resp);
+      break;
+    }
+
+    case 63: { /* 63 deque_pop_n */
+      deque_pop_n_request_free((struct deque_pop_n_request *)ctx->req);
+      r = deque_pop_n_response_write((struct deque_pop_n_response *)ctx->resp, &buffer);
+      deque_pop_n_response_free((struct deque_pop_n_response *)ctx->resp);
+      break;
+    }
+
+    case 90: { /* 90 server_ping */
+      server_ping_request_free((struct server_ping_request *)ctx->req);
+      r = server_ping_response_write((struct server_ping_response *)ctx->resp, &buffer);
+      server_ping_response_free((struct server_ping_response *)ctx->resp);
+      break;
+    }
+
+    case 91: { /* 91 server_info */
+      server_info_request_free((struct server_info_request *)ctx->req);
+      r = server_info_response_write((struct server_info_response *)ctx->resp, &buffer);
+      server_info_response_free((struct server_info_response *)ctx->resp);
+      break;
+    }
+
+    case 92: { /* 92 server_quit */
+      server_quit_request_free((struct server_quit_request *)ctx->req);
+      r = server_quit_response_write((struct server_quit_response *)ctx->resp, &buffer);
+      server_quit_response_free((struct server_quit_response *)ctx->resp);
+      break;
+    }
+
+    case 93: { /* 93 server_debug */
+      server_debug_request_free((struct server_debug_request *)ctx->req);
+      r = server_debug_response_write((struct server_debug_response *)ctx->resp, &buffer);
+      server_debug_response_free((struct server_debug_response *)ctx->resp);
+      break;
+    }
+
+    default:
+      Z_LOG_FATAL("Unknown type %"PRIu64" for request\n", ctx->msg_type);
+      break;
+  }
+
+  if (!pushed)
+    z_ipc_msgbuf_push(msgbuf, buffer.block, buffer.size);
+  z_ipc_client_set_writable(ctx->client, 1);
+  Z_LOG_TRACE("Send response of size=%zu time=%.5fsec",
+              buffer.size, (z_time_micros() - ctx->req_time) / 1000000.0f);
+
+  z_rpc_ctx_free(ctx);
+  z_buffer_release(&buffer);
+  z_buffer_free(&buffer);
+  return(r);
+}
\ No newline at end of file
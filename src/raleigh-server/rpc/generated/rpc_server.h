@@ -0,0 +1,194 @@
+
+/* File autogenerated, do not edit */
+#ifndef _RPC_SERVER_H_
+#define _RPC_SERVER_H_
+
+#include <zcl/debug.h>
+#include <zcl/ipc.h>
+#include <zcl/rpc.h>
+
+#include "rpc.h"
+
+
+struct raleighsl_rpc_server {
+  int (*semantic_open) (z_rpc_ctx_t *ctx,
+                        struct semantic_open_request *req,
+                        struct semantic_open_response *resp);
+  int (*semantic_create) (z_rpc_ctx_t *ctx,
+                          struct semantic_create_request *req,
+                          struct semantic_create_response *resp);
+  int (*semantic_delete) (z_rpc_ctx_t *ctx,
+                          struct semantic_delete_request *req,
+                          struct semantic_delete_response *resp);
+  int (*semantic_rename) (z_rpc_ctx_t *ctx,
+                          struct semantic_rename_request *req,
+                          struct semantic_rename_response *resp);
+  int (*transaction_create) (z_rpc_ctx_t *ctx,
+                             struct transaction_create_request *req,
+                             struct transaction_create_response *resp);
+  int (*transaction_commit) (z_rpc_ctx_t *ctx,
+                             struct transaction_commit_request *req,
+                             struct transaction_commit_response *resp);
+  int (*transaction_rollback) (z_rpc_ctx_t *ctx,
+                               struct transaction_rollback_request *req,
+                               struct transaction_rollback_response *resp);
+  int (*number_get) (z_rpc_ctx_t *ctx,
+                     struct number_get_request *req,
+                     struct number_get_response *resp);
+  int (*number_set) (z_rpc_ctx_t *ctx,
+                     struct number_set_request *req,
+                     struct number_set_response *resp);
+  int (*number_cas) (z_rpc_ctx_t *ctx,
+                     struct number_cas_request *req,
+                     struct number_cas_response *resp);
+  int (*number_add) (z_rpc_ctx_t *ctx,
+                     struct number_add_request *req,
+                     struct number_add_response *resp);
+  int (*number_mul) (z_rpc_ctx_t *ctx,
+                     struct number_mul_request *req,
+                     struct number_mul_response *resp);
+  int (*number_div) (z_rpc_ctx_t *ctx,
+                     struct number_div_request *req,
+                     struct number_div_response *resp);
+  int (*sset_insert) (z_rpc_ctx_t *ctx,
+                      struct sset_insert_request *req,
+                      struct sset_insert_response *resp);
+  int (*sset_update) (z_rpc_ctx_t *ctx,
+                      struct sset_update_request *req,
+                      struct sset_update_response *resp);
+  int (*sset_pop) (z_rpc_ctx_t *ctx,
+                   struct sset_pop_request *req,
+                   struct sset_pop_response *resp);
+  int (*sset_get) (z_rpc_ctx_t *ctx,
+                   struct sset_get_request *req,
+                   struct sset_get_response *resp);
+  int (*sset_scan) (z_rpc_ctx_t *ctx,
+                    struct sset_scan_request *req,
+                    struct sset_scan_response *resp);
+  int (*flow_append) (z_rpc_ctx_t *ctx,
+                      struct flow_append_request *req,
+                      struct flow_append_response *resp);
+  int (*flow_inject) (z_rpc_ctx_t *ctx,
+                      struct flow_inject_request *req,
+                      struct flow_inject_response *resp);
+  int (*flow_write) (z_rpc_ctx_t *ctx,
+                     struct flow_write_request *req,
+                     struct flow_write_response *resp);
+  int (*flow_remove) (z_rpc_ctx_t *ctx,
+                      struct flow_remove_request *req,
+                      struct flow_remove_response *resp);
+  int (*flow_truncate) (z_rpc_ctx_t *ctx,
+                        struct flow_truncate_request *req,
+                        struct flow_truncate_response *resp);
+  int (*flow_read) (z_rpc_ctx_t *ctx,
+                    struct flow_read_request *req,
+                    struct flow_read_response *resp);
+  int (*flow_subscribe) (z_rpc_ctx_t *ctx,
+                         struct flow_subscribe_request *req,
+                         struct flow_subscribe_response *resp);
+  int (*deque_push) (z_rpc_ctx_t *ctx,
+                     struct deque_push_request *req,
+                     struct deque_push_response *resp);
+  int (*deque_pop) (z_rpc_ctx_t *ctx,
+                    struct deque_pop_request *req,
+                    struct deque_pop_response *resp);
+  int (*deque_push_n) (z_rpc_ctx_t *ctx,
+                       struct deque_push_n_request *req,
+                       struct deque_push_n_response *resp);
+  int (*deque_pop_n) (z_rpc_ctx_t *ctx,
+                      struct deque_pop_n_request *req,
+                      struct deque_pop_n_response *resp);
+  int (*server_ping) (z_rpc_ctx_t *ctx,
+                      struct server_ping_request *req,
+                      struct server_ping_response *resp);
+  int (*server_info) (z_rpc_ctx_t *ctx,
+                      struct server_info_request *req,
+                      struct server_info_response *resp);
+  int (*server_quit) (z_rpc_ctx_t *ctx,
+                      struct server_quit_request *req,
+                      struct server_quit_response *resp);
+  int (*server_debug) (z_rpc_ctx_t *ctx,
+                       struct server_debug_request *req,
+                       struct server_debug_response *resp);
+};
+
+/* Reserve the rpc ctx pool for the largest ctx of the calls */
+union raleighsl_rpc_server_ctx {
+  char semantic_open[z_rpc_ctx_size(struct semantic_open_request, struct semantic_open_response)];
+  char semantic_create[z_rpc_ctx_size(struct semantic_create_request, struct semantic_create_response)];
+  char semantic_delete[z_rpc_ctx_size(struct semantic_delete_request, struct semantic_delete_response)];
+  char semantic_rename[z_rpc_ctx_size(struct semantic_rename_request, struct semantic_rename_response)];
+  char transaction_create[z_rpc_ctx_size(struct transaction_create_request, struct transaction_create_response)];
+  char transaction_commit[z_rpc_ctx_size(struct transaction_commit_request, struct transaction_commit_response)];
+  char transaction_rollback[z_rpc_ctx_size(struct transaction_rollback_request, struct transaction_rollback_response)];
+  char number_get[z_rpc_ctx_size(struct number_get_request, struct number_get_response)];
+  char number_set[z_rpc_ctx_size(struct number_set_request, struct number_set_response)];
+  char number_cas[z_rpc_ctx_size(struct number_cas_request, struct number_cas_response)];
+  char number_add[z_rpc_ctx_size(struct number_add_request, struct number_add_response)];
+  char number_mul[z_rpc_ctx_size(struct number_mul_request, struct number_mul_response)];
+  char number_div[z_rpc_ctx_size(struct number_div_request, struct number_div_response)];
+  char sset_insert[z_rpc_ctx_size(struct sset_insert_request, struct sset_insert_response)];
+  char sset_update[z_rpc_ctx_size(struct sset_update_request, struct sset_update_response)];
+  char sset_pop[z_rpc_ctx_size(struct sset_pop_request, struct sset_pop_response)];
+  char sset_get[z_rpc_ctx_size(struct sset_get_request, struct sset_get_response)];
+  char sset_scan[z_rpc_ctx_size(struct sset_scan_request, struct sset_scan_response)];
+  char flow_append[z_rpc_ctx_size(struct flow_append_request, struct flow_append_response)];
+  char flow_inject[z_rpc_ctx_size(struct flow_inject_request, struct flow_inject_response)];
+  char flow_write[z_rpc_ctx_size(struct flow_write_request, struct flow_write_response)];
+  char flow_remove[z_rpc_ctx_size(struct flow_remove_request, struct flow_remove_response)];
+  char flow_truncate[z_rpc_ctx_size(struct flow_truncate_request, struct flow_truncate_response)];
+  char flow_read[z_rpc_ctx_size(struct flow_read_request, struct flow_read_response)];
+  char flow_subscribe[z_rpc_ctx_size(struct flow_subscribe_request, struct flow_subscribe_response)];
+  char deque_push[z_rpc_ctx_size(struct deque_push_request, struct deque_push_response)];
+  char deque_pop[z_rpc_ctx_size(struct deque_pop_request, struct deque_pop_response)];
+  char deque_push_n[z_rpc_ctx_size(struct deque_push_n_request, struct deque_push_n_response)];
+  char deque_pop_n[z_rpc_ctx_size(struct deque_pop_n_request, struct deque_pop_n_response)];
+  char server_ping[z_rpc_ctx_size(struct server_ping_request, struct server_ping_response)];
+  char server_info[z_rpc_ctx_size(struct server_info_request, struct server_info_response)];
+  char server_quit[z_rpc_ctx_size(struct server_quit_request, struct server_quit_response)];
+  char server_debug[z_rpc_ctx_size(struct server_debug_request, struct server_debug_response)];
+};
+
+#define RALEIGHSL_RPC_SERVER_CTX_ISIZE    sizeof(union raleighsl_rpc_server_ctx)
+
+#define SEMANTIC_OPEN_ID 10
+#define SEMANTIC_CREATE_ID 11
+#define SEMANTIC_DELETE_ID 12
+#define SEMANTIC_RENAME_ID 13
+#define TRANSACTION_CREATE_ID 20
+#define TRANSACTION_COMMIT_ID 21
+#define TRANSACTION_ROLLBACK_ID 22
+#define NUMBER_GET_ID 30
+#define NUMBER_SET_ID 31
+#define NUMBER_CAS_ID 32
+#define NUMBER_ADD_ID 33
+#define NUMBER_MUL_ID 34
+#define NUMBER_DIV_ID 35
+#define SSET_INSERT_ID 40
+#define SSET_UPDATE_ID 41
+#define SSET_POP_ID 43
+#define SSET_GET_ID 45
+#define SSET_SCAN_ID 46
+#define FLOW_APPEND_ID 50
+#define FLOW_INJECT_ID 51
+#define FLOW_WRITE_ID 52
+#define FLOW_REMOVE_ID 53
+#define FLOW_TRUNCATE_ID 54
+#define FLOW_READ_ID 55
+#define FLOW_SUBSCRIBE_ID 56
+#define DEQUE_PUSH_ID 60
+#define DEQUE_POP_ID 61
+#define DEQUE_PUSH_N_ID 62
+#define DEQUE_POP_N_ID 63
+#define SERVER_PING_ID 90
+#define SERVER_INFO_ID 91
+#define SERVER_QUIT_ID 92
+#define SERVER_DEBUG_ID 93
+
+int  raleighsl_rpc_server_parse (const struct raleighsl_rpc_server *proto,
+                                 z_ipc_client_t *client,
+                                 const struct iovec iov[2]);
+int  raleighsl_rpc_server_push_response (z_rpc_ctx_t *ctx,
+                                         z_ipc_msgbuf_t *msgbuf);
+
+#endif /* !_RPC_SERVER_H_ */
\ No newline at end of file
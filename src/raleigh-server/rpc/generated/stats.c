@@ -0,0 +1,1353 @@
+
+/* File autogenerated, do not edit */
+#include <zcl/global.h>
+#include <zcl/string.h>
+#include <zcl/debug.h>
+
+#include "stats.h"
+
+
+struct rusage_request *rusage_request_alloc (struct rusage_request *msg) {
+  if (msg == NULL) {
+    msg = z_memory_struct_alloc(z_global_memory(), struct rusage_request);
+    if (Z_MALLOC_IS_NULL(msg))
+      return(NULL);
+    msg->rusage_request_ialloc = 1;
+  } else {
+    msg->rusage_request_ialloc = 0;
+  }
+
+  z_memzero(msg->rusage_request_fields_bitmap, 0);
+
+  return(msg);
+}
+
+void rusage_request_free (struct rusage_request *msg) {
+
+  if (msg->rusage_request_ialloc)
+    z_memory_struct_free(z_global_memory(), struct rusage_request, msg);
+}
+
+int rusage_request_parse (struct rusage_request *msg, void *reader, uint64_t size) {
+  uint64_t total_length = 0;
+  uint16_t field_id;
+  uint64_t length;
+  int r = 0;
+
+  while (z_reader_decode_field(reader, &field_id, &length) > 0) {
+    switch (field_id) {
+      
+
+      default: {
+        r = -1;
+        if (z_reader_skip(reader, length))
+          return(-1);
+        break;
+      }
+    }
+
+    total_length += length;
+    if (Z_UNLIKELY(total_length >= size))
+      break;
+  }
+
+  return(r);
+}
+
+size_t rusage_request_size (struct rusage_request *msg) {
+  size_t size = 0;
+  
+  return(size);
+}
+
+int rusage_request_write (struct rusage_request *msg, z_buffer_t *buffer) {
+  int r = 0;
+  
+  return(r);
+}
+
+void rusage_request_dump (FILE *stream, const struct rusage_request *msg) {
+  fprintf(stream, "rusage_request {");
+  
+  fprintf(stream, "\n}\n");
+}
+
+struct rusage_response *rusage_response_alloc (struct rusage_response *msg) {
+  if (msg == NULL) {
+    msg = z_memory_struct_alloc(z_global_memory(), struct rusage_response);
+    if (Z_MALLOC_IS_NULL(msg))
+      return(NULL);
+    msg->rusage_response_ialloc = 1;
+  } else {
+    msg->rusage_response_ialloc = 0;
+  }
+
+  z_memzero(msg->rusage_response_fields_bitmap, 2);
+
+  return(msg);
+}
+
+void rusage_response_free (struct rusage_response *msg) {
+
+  if (msg->rusage_response_ialloc)
+    z_memory_struct_free(z_global_memory(), struct rusage_response, msg);
+}
+
+int rusage_response_parse (struct rusage_response *msg, void *reader, uint64_t size) {
+  uint64_t total_length = 0;
+  uint16_t field_id;
+  uint64_t length;
+  int r = 0;
+
+  while (z_reader_decode_field(reader, &field_id, &length) > 0) {
+    switch (field_id) {
+      
+      case 1: { /* uint64 utime */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->utime));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 0);
+        break;
+      }
+
+      case 2: { /* uint64 stime */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->stime));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 1);
+        break;
+      }
+
+      case 3: { /* uint64 maxrss */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->maxrss));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 2);
+        break;
+      }
+
+      case 4: { /* uint64 minflt */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->minflt));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 3);
+        break;
+      }
+
+      case 5: { /* uint64 majflt */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->majflt));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 4);
+        break;
+      }
+
+      case 6: { /* uint64 inblock */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->inblock));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 5);
+        break;
+      }
+
+      case 7: { /* uint64 oublock */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->oublock));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 6);
+        break;
+      }
+
+      case 8: { /* uint64 nvcsw */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->nvcsw));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 7);
+        break;
+      }
+
+      case 9: { /* uint64 nivcsw */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->nivcsw));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 8);
+        break;
+      }
+
+      case 10: { /* uint64 iowait */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->iowait));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 9);
+        break;
+      }
+
+      case 11: { /* uint64 ioread */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->ioread));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 10);
+        break;
+      }
+
+      case 12: { /* uint64 iowrite */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->iowrite));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rusage_response_fields_bitmap, 11);
+        break;
+      }
+
+      default: {
+        r = -1;
+        if (z_reader_skip(reader, length))
+          return(-1);
+        break;
+      }
+    }
+
+    total_length += length;
+    if (Z_UNLIKELY(total_length >= size))
+      break;
+  }
+
+  return(r);
+}
+
+size_t rusage_response_size (struct rusage_response *msg) {
+  size_t size = 0;
+  
+  if (rusage_response_has_utime(msg)) {
+    size_t length = z_uint64_size(msg->utime);
+    size += z_encoded_field_length(1, length) + length;
+  }
+
+  if (rusage_response_has_stime(msg)) {
+    size_t length = z_uint64_size(msg->stime);
+    size += z_encoded_field_length(2, length) + length;
+  }
+
+  if (rusage_response_has_maxrss(msg)) {
+    size_t length = z_uint64_size(msg->maxrss);
+    size += z_encoded_field_length(3, length) + length;
+  }
+
+  if (rusage_response_has_minflt(msg)) {
+    size_t length = z_uint64_size(msg->minflt);
+    size += z_encoded_field_length(4, length) + length;
+  }
+
+  if (rusage_response_has_majflt(msg)) {
+    size_t length = z_uint64_size(msg->majflt);
+    size += z_encoded_field_length(5, length) + length;
+  }
+
+  if (rusage_response_has_inblock(msg)) {
+    size_t length = z_uint64_size(msg->inblock);
+    size += z_encoded_field_length(6, length) + length;
+  }
+
+  if (rusage_response_has_oublock(msg)) {
+    size_t length = z_uint64_size(msg->oublock);
+    size += z_encoded_field_length(7, length) + length;
+  }
+
+  if (rusage_response_has_nvcsw(msg)) {
+    size_t length = z_uint64_size(msg->nvcsw);
+    size += z_encoded_field_length(8, length) + length;
+  }
+
+  if (rusage_response_has_nivcsw(msg)) {
+    size_t length = z_uint64_size(msg->nivcsw);
+    size += z_encoded_field_length(9, length) + length;
+  }
+
+  if (rusage_response_has_iowait(msg)) {
+    size_t length = z_uint64_size(msg->iowait);
+    size += z_encoded_field_length(10, length) + length;
+  }
+
+  if (rusage_response_has_ioread(msg)) {
+    size_t length = z_uint64_size(msg->ioread);
+    size += z_encoded_field_length(11, length) + length;
+  }
+
+  if (rusage_response_has_iowrite(msg)) {
+    size_t length = z_uint64_size(msg->iowrite);
+    size += z_encoded_field_length(12, length) + length;
+  }
+  return(size);
+}
+
+int rusage_response_write (struct rusage_response *msg, z_buffer_t *buffer) {
+  int r = 0;
+  
+  if (rusage_response_has_utime(msg)) {
+    r = z_write_field_uint64(buffer, 1, msg->utime);
+    if (Z_UNLIKELY(r)) return(-1);
+  }
+
+  if (rusage_response_has_stime(msg)) {
+    r = z_write_field_uint64(buffer, 2, msg->stime);
+    if (Z_UNLIKELY(r)) return(-2);
+  }
+
+  if (rusage_response_has_maxrss(msg)) {
+    r = z_write_field_uint64(buffer, 3, msg->maxrss);
+    if (Z_UNLIKELY(r)) return(-3);
+  }
+
+  if (rusage_response_has_minflt(msg)) {
+    r = z_write_field_uint64(buffer, 4, msg->minflt);
+    if (Z_UNLIKELY(r)) return(-4);
+  }
+
+  if (rusage_response_has_majflt(msg)) {
+    r = z_write_field_uint64(buffer, 5, msg->majflt);
+    if (Z_UNLIKELY(r)) return(-5);
+  }
+
+  if (rusage_response_has_inblock(msg)) {
+    r = z_write_field_uint64(buffer, 6, msg->inblock);
+    if (Z_UNLIKELY(r)) return(-6);
+  }
+
+  if (rusage_response_has_oublock(msg)) {
+    r = z_write_field_uint64(buffer, 7, msg->oublock);
+    if (Z_UNLIKELY(r)) return(-7);
+  }
+
+  if (rusage_response_has_nvcsw(msg)) {
+    r = z_write_field_uint64(buffer, 8, msg->nvcsw);
+    if (Z_UNLIKELY(r)) return(-8);
+  }
+
+  if (rusage_response_has_nivcsw(msg)) {
+    r = z_write_field_uint64(buffer, 9, msg->nivcsw);
+    if (Z_UNLIKELY(r)) return(-9);
+  }
+
+  if (rusage_response_has_iowait(msg)) {
+    r = z_write_field_uint64(buffer, 10, msg->iowait);
+    if (Z_UNLIKELY(r)) return(-10);
+  }
+
+  if (rusage_response_has_ioread(msg)) {
+    r = z_write_field_uint64(buffer, 11, msg->ioread);
+    if (Z_UNLIKELY(r)) return(-11);
+  }
+
+  if (rusage_response_has_iowrite(msg)) {
+    r = z_write_field_uint64(buffer, 12, msg->iowrite);
+    if (Z_UNLIKELY(r)) return(-12);
+  }
+  return(r);
+}
+
+void rusage_response_dump (FILE *stream, const struct rusage_response *msg) {
+  fprintf(stream, "rusage_response {");
+  
+  fprintf(stream, "\n  1: uint64 utime = ");
+  if (rusage_response_has_utime(msg)) {
+    z_dump_uint64(stream, msg->utime);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  2: uint64 stime = ");
+  if (rusage_response_has_stime(msg)) {
+    z_dump_uint64(stream, msg->stime);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  3: uint64 maxrss = ");
+  if (rusage_response_has_maxrss(msg)) {
+    z_dump_uint64(stream, msg->maxrss);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  4: uint64 minflt = ");
+  if (rusage_response_has_minflt(msg)) {
+    z_dump_uint64(stream, msg->minflt);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  5: uint64 majflt = ");
+  if (rusage_response_has_majflt(msg)) {
+    z_dump_uint64(stream, msg->majflt);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  6: uint64 inblock = ");
+  if (rusage_response_has_inblock(msg)) {
+    z_dump_uint64(stream, msg->inblock);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  7: uint64 oublock = ");
+  if (rusage_response_has_oublock(msg)) {
+    z_dump_uint64(stream, msg->oublock);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  8: uint64 nvcsw = ");
+  if (rusage_response_has_nvcsw(msg)) {
+    z_dump_uint64(stream, msg->nvcsw);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  9: uint64 nivcsw = ");
+  if (rusage_response_has_nivcsw(msg)) {
+    z_dump_uint64(stream, msg->nivcsw);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  10: uint64 iowait = ");
+  if (rusage_response_has_iowait(msg)) {
+    z_dump_uint64(stream, msg->iowait);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  11: uint64 ioread = ");
+  if (rusage_response_has_ioread(msg)) {
+    z_dump_uint64(stream, msg->ioread);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  12: uint64 iowrite = ");
+  if (rusage_response_has_iowrite(msg)) {
+    z_dump_uint64(stream, msg->iowrite);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+  fprintf(stream, "\n}\n");
+}
+
+struct rpc_histogram *rpc_histogram_alloc (struct rpc_histogram *msg) {
+  if (msg == NULL) {
+    msg = z_memory_struct_alloc(z_global_memory(), struct rpc_histogram);
+    if (Z_MALLOC_IS_NULL(msg))
+      return(NULL);
+    msg->rpc_histogram_ialloc = 1;
+  } else {
+    msg->rpc_histogram_ialloc = 0;
+  }
+
+  z_memzero(msg->rpc_histogram_fields_bitmap, 1);
+  z_array_open(&(msg->bounds), sizeof(uint64_t));
+  z_array_open(&(msg->events), sizeof(uint64_t));
+  return(msg);
+}
+
+void rpc_histogram_free (struct rpc_histogram *msg) {
+  z_array_close(&(msg->bounds));
+  z_array_close(&(msg->events));
+  if (msg->rpc_histogram_ialloc)
+    z_memory_struct_free(z_global_memory(), struct rpc_histogram, msg);
+}
+
+int rpc_histogram_parse (struct rpc_histogram *msg, void *reader, uint64_t size) {
+  uint64_t total_length = 0;
+  uint16_t field_id;
+  uint64_t length;
+  int r = 0;
+
+  while (z_reader_decode_field(reader, &field_id, &length) > 0) {
+    switch (field_id) {
+      
+      case 0: { /* uint64 nevents */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->nevents));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rpc_histogram_fields_bitmap, 0);
+        break;
+      }
+
+      case 1: { /* uint64 min */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->min));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rpc_histogram_fields_bitmap, 1);
+        break;
+      }
+
+      case 2: { /* uint64 max */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->max));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rpc_histogram_fields_bitmap, 2);
+        break;
+      }
+
+      case 3: { /* uint64 sum */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->sum));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rpc_histogram_fields_bitmap, 3);
+        break;
+      }
+
+      case 4: { /* uint16 nbuckets */
+        if (Z_UNLIKELY(length > sizeof(uint16_t))) return(-1);
+        r = z_reader_decode_uint16(reader, length, &(msg->nbuckets));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rpc_histogram_fields_bitmap, 4);
+        break;
+      }
+
+      case 5: { /* list[uint64] bounds */
+        uint64_t bounds;
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &bounds);
+        if (Z_UNLIKELY(r)) return(-1);
+        r = z_array_push_back_copy(&(msg->bounds), &bounds);
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rpc_histogram_fields_bitmap, 5);
+        break;
+      }
+
+      case 6: { /* list[uint64] events */
+        uint64_t events;
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &events);
+        if (Z_UNLIKELY(r)) return(-1);
+        r = z_array_push_back_copy(&(msg->events), &events);
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->rpc_histogram_fields_bitmap, 6);
+        break;
+      }
+
+      default: {
+        r = -1;
+        if (z_reader_skip(reader, length))
+          return(-1);
+        break;
+      }
+    }
+
+    total_length += length;
+    if (Z_UNLIKELY(total_length >= size))
+      break;
+  }
+
+  return(r);
+}
+
+size_t rpc_histogram_size (struct rpc_histogram *msg) {
+  size_t size = 0;
+  
+  if (rpc_histogram_has_nevents(msg)) {
+    size_t length = z_uint64_size(msg->nevents);
+    size += z_encoded_field_length(0, length) + length;
+  }
+
+  if (rpc_histogram_has_min(msg)) {
+    size_t length = z_uint64_size(msg->min);
+    size += z_encoded_field_length(1, length) + length;
+  }
+
+  if (rpc_histogram_has_max(msg)) {
+    size_t length = z_uint64_size(msg->max);
+    size += z_encoded_field_length(2, length) + length;
+  }
+
+  if (rpc_histogram_has_sum(msg)) {
+    size_t length = z_uint64_size(msg->sum);
+    size += z_encoded_field_length(3, length) + length;
+  }
+
+  if (rpc_histogram_has_nbuckets(msg)) {
+    size_t length = z_uint16_size(msg->nbuckets);
+    size += z_encoded_field_length(4, length) + length;
+  }
+/* TODO bounds */
+/* TODO events */
+  return(size);
+}
+
+int rpc_histogram_write (struct rpc_histogram *msg, z_buffer_t *buffer) {
+  int r = 0;
+  
+  if (rpc_histogram_has_nevents(msg)) {
+    r = z_write_field_uint64(buffer, 0, msg->nevents);
+    if (Z_UNLIKELY(r)) return(-0);
+  }
+
+  if (rpc_histogram_has_min(msg)) {
+    r = z_write_field_uint64(buffer, 1, msg->min);
+    if (Z_UNLIKELY(r)) return(-1);
+  }
+
+  if (rpc_histogram_has_max(msg)) {
+    r = z_write_field_uint64(buffer, 2, msg->max);
+    if (Z_UNLIKELY(r)) return(-2);
+  }
+
+  if (rpc_histogram_has_sum(msg)) {
+    r = z_write_field_uint64(buffer, 3, msg->sum);
+    if (Z_UNLIKELY(r)) return(-3);
+  }
+
+  if (rpc_histogram_has_nbuckets(msg)) {
+    r = z_write_field_uint16(buffer, 4, msg->nbuckets);
+    if (Z_UNLIKELY(r)) return(-4);
+  }
+
+  if (rpc_histogram_has_bounds(msg)) {
+    size_t i;
+    for (i = 0; i < msg->bounds.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->bounds), uint64_t, i);
+      r = z_write_field_uint64(buffer, 5, *value);
+      if (Z_UNLIKELY(r)) return(-5);
+    }
+  }
+
+  if (rpc_histogram_has_events(msg)) {
+    size_t i;
+    for (i = 0; i < msg->events.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->events), uint64_t, i);
+      r = z_write_field_uint64(buffer, 6, *value);
+      if (Z_UNLIKELY(r)) return(-6);
+    }
+  }
+  return(r);
+}
+
+void rpc_histogram_dump (FILE *stream, const struct rpc_histogram *msg) {
+  fprintf(stream, "rpc_histogram {");
+  
+  fprintf(stream, "\n  0: uint64 nevents = ");
+  if (rpc_histogram_has_nevents(msg)) {
+    z_dump_uint64(stream, msg->nevents);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  1: uint64 min = ");
+  if (rpc_histogram_has_min(msg)) {
+    z_dump_uint64(stream, msg->min);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  2: uint64 max = ");
+  if (rpc_histogram_has_max(msg)) {
+    z_dump_uint64(stream, msg->max);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  3: uint64 sum = ");
+  if (rpc_histogram_has_sum(msg)) {
+    z_dump_uint64(stream, msg->sum);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  4: uint16 nbuckets = ");
+  if (rpc_histogram_has_nbuckets(msg)) {
+    z_dump_uint16(stream, msg->nbuckets);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  5: uint64 bounds = ");
+  if (rpc_histogram_has_bounds(msg)) {
+
+    size_t i;
+    for (i = 0; i < msg->bounds.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->bounds), uint64_t, i);
+      fprintf(stream, "[%zu]", i);
+      z_dump_uint64(stream, *value);
+    }
+
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  6: uint64 events = ");
+  if (rpc_histogram_has_events(msg)) {
+
+    size_t i;
+    for (i = 0; i < msg->events.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->events), uint64_t, i);
+      fprintf(stream, "[%zu]", i);
+      z_dump_uint64(stream, *value);
+    }
+
+  } else {
+    fprintf(stream, "MISSING");
+  }
+  fprintf(stream, "\n}\n");
+}
+
+struct memusage_request *memusage_request_alloc (struct memusage_request *msg) {
+  if (msg == NULL) {
+    msg = z_memory_struct_alloc(z_global_memory(), struct memusage_request);
+    if (Z_MALLOC_IS_NULL(msg))
+      return(NULL);
+    msg->memusage_request_ialloc = 1;
+  } else {
+    msg->memusage_request_ialloc = 0;
+  }
+
+  z_memzero(msg->memusage_request_fields_bitmap, 0);
+
+  return(msg);
+}
+
+void memusage_request_free (struct memusage_request *msg) {
+
+  if (msg->memusage_request_ialloc)
+    z_memory_struct_free(z_global_memory(), struct memusage_request, msg);
+}
+
+int memusage_request_parse (struct memusage_request *msg, void *reader, uint64_t size) {
+  uint64_t total_length = 0;
+  uint16_t field_id;
+  uint64_t length;
+  int r = 0;
+
+  while (z_reader_decode_field(reader, &field_id, &length) > 0) {
+    switch (field_id) {
+      
+
+      default: {
+        r = -1;
+        if (z_reader_skip(reader, length))
+          return(-1);
+        break;
+      }
+    }
+
+    total_length += length;
+    if (Z_UNLIKELY(total_length >= size))
+      break;
+  }
+
+  return(r);
+}
+
+size_t memusage_request_size (struct memusage_request *msg) {
+  size_t size = 0;
+  
+  return(size);
+}
+
+int memusage_request_write (struct memusage_request *msg, z_buffer_t *buffer) {
+  int r = 0;
+  
+  return(r);
+}
+
+void memusage_request_dump (FILE *stream, const struct memusage_request *msg) {
+  fprintf(stream, "memusage_request {");
+  
+  fprintf(stream, "\n}\n");
+}
+
+struct memusage_response *memusage_response_alloc (struct memusage_response *msg) {
+  if (msg == NULL) {
+    msg = z_memory_struct_alloc(z_global_memory(), struct memusage_response);
+    if (Z_MALLOC_IS_NULL(msg))
+      return(NULL);
+    msg->memusage_response_ialloc = 1;
+  } else {
+    msg->memusage_response_ialloc = 0;
+  }
+
+  z_memzero(msg->memusage_response_fields_bitmap, 2);
+
+  return(msg);
+}
+
+void memusage_response_free (struct memusage_response *msg) {
+
+  if (msg->memusage_response_ialloc)
+    z_memory_struct_free(z_global_memory(), struct memusage_response, msg);
+}
+
+int memusage_response_parse (struct memusage_response *msg, void *reader, uint64_t size) {
+  uint64_t total_length = 0;
+  uint16_t field_id;
+  uint64_t length;
+  int r = 0;
+
+  while (z_reader_decode_field(reader, &field_id, &length) > 0) {
+    switch (field_id) {
+      
+      case 0: { /* uint32 arena */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->arena));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 0);
+        break;
+      }
+
+      case 1: { /* uint32 ordblks */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->ordblks));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 1);
+        break;
+      }
+
+      case 2: { /* uint32 smblks */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->smblks));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 2);
+        break;
+      }
+
+      case 3: { /* uint32 hblks */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->hblks));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 3);
+        break;
+      }
+
+      case 4: { /* uint32 hblkhd */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->hblkhd));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 4);
+        break;
+      }
+
+      case 5: { /* uint32 usmblks */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->usmblks));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 5);
+        break;
+      }
+
+      case 6: { /* uint32 fsmblks */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->fsmblks));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 6);
+        break;
+      }
+
+      case 7: { /* uint32 uordblks */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->uordblks));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 7);
+        break;
+      }
+
+      case 8: { /* uint32 fordblks */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->fordblks));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 8);
+        break;
+      }
+
+      case 9: { /* uint32 keepcost */
+        if (Z_UNLIKELY(length > sizeof(uint32_t))) return(-1);
+        r = z_reader_decode_uint32(reader, length, &(msg->keepcost));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 9);
+        break;
+      }
+
+      case 10: { /* uint64 sysused */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->sysused));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 10);
+        break;
+      }
+
+      case 11: { /* uint64 sysfree */
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &(msg->sysfree));
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->memusage_response_fields_bitmap, 11);
+        break;
+      }
+
+      default: {
+        r = -1;
+        if (z_reader_skip(reader, length))
+          return(-1);
+        break;
+      }
+    }
+
+    total_length += length;
+    if (Z_UNLIKELY(total_length >= size))
+      break;
+  }
+
+  return(r);
+}
+
+size_t memusage_response_size (struct memusage_response *msg) {
+  size_t size = 0;
+  
+  if (memusage_response_has_arena(msg)) {
+    size_t length = z_uint32_size(msg->arena);
+    size += z_encoded_field_length(0, length) + length;
+  }
+
+  if (memusage_response_has_ordblks(msg)) {
+    size_t length = z_uint32_size(msg->ordblks);
+    size += z_encoded_field_length(1, length) + length;
+  }
+
+  if (memusage_response_has_smblks(msg)) {
+    size_t length = z_uint32_size(msg->smblks);
+    size += z_encoded_field_length(2, length) + length;
+  }
+
+  if (memusage_response_has_hblks(msg)) {
+    size_t length = z_uint32_size(msg->hblks);
+    size += z_encoded_field_length(3, length) + length;
+  }
+
+  if (memusage_response_has_hblkhd(msg)) {
+    size_t length = z_uint32_size(msg->hblkhd);
+    size += z_encoded_field_length(4, length) + length;
+  }
+
+  if (memusage_response_has_usmblks(msg)) {
+    size_t length = z_uint32_size(msg->usmblks);
+    size += z_encoded_field_length(5, length) + length;
+  }
+
+  if (memusage_response_has_fsmblks(msg)) {
+    size_t length = z_uint32_size(msg->fsmblks);
+    size += z_encoded_field_length(6, length) + length;
+  }
+
+  if (memusage_response_has_uordblks(msg)) {
+    size_t length = z_uint32_size(msg->uordblks);
+    size += z_encoded_field_length(7, length) + length;
+  }
+
+  if (memusage_response_has_fordblks(msg)) {
+    size_t length = z_uint32_size(msg->fordblks);
+    size += z_encoded_field_length(8, length) + length;
+  }
+
+  if (memusage_response_has_keepcost(msg)) {
+    size_t length = z_uint32_size(msg->keepcost);
+    size += z_encoded_field_length(9, length) + length;
+  }
+
+  if (memusage_response_has_sysused(msg)) {
+    size_t length = z_uint64_size(msg->sysused);
+    size += z_encoded_field_length(10, length) + length;
+  }
+
+  if (memusage_response_has_sysfree(msg)) {
+    size_t length = z_uint64_size(msg->sysfree);
+    size += z_encoded_field_length(11, length) + length;
+  }
+  return(size);
+}
+
+int memusage_response_write (struct memusage_response *msg, z_buffer_t *buffer) {
+  int r = 0;
+  
+  if (memusage_response_has_arena(msg)) {
+    r = z_write_field_uint32(buffer, 0, msg->arena);
+    if (Z_UNLIKELY(r)) return(-0);
+  }
+
+  if (memusage_response_has_ordblks(msg)) {
+    r = z_write_field_uint32(buffer, 1, msg->ordblks);
+    if (Z_UNLIKELY(r)) return(-1);
+  }
+
+  if (memusage_response_has_smblks(msg)) {
+    r = z_write_field_uint32(buffer, 2, msg->smblks);
+    if (Z_UNLIKELY(r)) return(-2);
+  }
+
+  if (memusage_response_has_hblks(msg)) {
+    r = z_write_field_uint32(buffer, 3, msg->hblks);
+    if (Z_UNLIKELY(r)) return(-3);
+  }
+
+  if (memusage_response_has_hblkhd(msg)) {
+    r = z_write_field_uint32(buffer, 4, msg->hblkhd);
+    if (Z_UNLIKELY(r)) return(-4);
+  }
+
+  if (memusage_response_has_usmblks(msg)) {
+    r = z_write_field_uint32(buffer, 5, msg->usmblks);
+    if (Z_UNLIKELY(r)) return(-5);
+  }
+
+  if (memusage_response_has_fsmblks(msg)) {
+    r = z_write_field_uint32(buffer, 6, msg->fsmblks);
+    if (Z_UNLIKELY(r)) return(-6);
+  }
+
+  if (memusage_response_has_uordblks(msg)) {
+    r = z_write_field_uint32(buffer, 7, msg->uordblks);
+    if (Z_UNLIKELY(r)) return(-7);
+  }
+
+  if (memusage_response_has_fordblks(msg)) {
+    r = z_write_field_uint32(buffer, 8, msg->fordblks);
+    if (Z_UNLIKELY(r)) return(-8);
+  }
+
+  if (memusage_response_has_keepcost(msg)) {
+    r = z_write_field_uint32(buffer, 9, msg->keepcost);
+    if (Z_UNLIKELY(r)) return(-9);
+  }
+
+  if (memusage_response_has_sysused(msg)) {
+    r = z_write_field_uint64(buffer, 10, msg->sysused);
+    if (Z_UNLIKELY(r)) return(-10);
+  }
+
+  if (memusage_response_has_sysfree(msg)) {
+    r = z_write_field_uint64(buffer, 11, msg->sysfree);
+    if (Z_UNLIKELY(r)) return(-11);
+  }
+  return(r);
+}
+
+void memusage_response_dump (FILE *stream, const struct memusage_response *msg) {
+  fprintf(stream, "memusage_response {");
+  
+  fprintf(stream, "\n  0: uint32 arena = ");
+  if (memusage_response_has_arena(msg)) {
+    z_dump_uint32(stream, msg->arena);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  1: uint32 ordblks = ");
+  if (memusage_response_has_ordblks(msg)) {
+    z_dump_uint32(stream, msg->ordblks);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  2: uint32 smblks = ");
+  if (memusage_response_has_smblks(msg)) {
+    z_dump_uint32(stream, msg->smblks);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  3: uint32 hblks = ");
+  if (memusage_response_has_hblks(msg)) {
+    z_dump_uint32(stream, msg->hblks);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  4: uint32 hblkhd = ");
+  if (memusage_response_has_hblkhd(msg)) {
+    z_dump_uint32(stream, msg->hblkhd);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  5: uint32 usmblks = ");
+  if (memusage_response_has_usmblks(msg)) {
+    z_dump_uint32(stream, msg->usmblks);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  6: uint32 fsmblks = ");
+  if (memusage_response_has_fsmblks(msg)) {
+    z_dump_uint32(stream, msg->fsmblks);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  7: uint32 uordblks = ");
+  if (memusage_response_has_uordblks(msg)) {
+    z_dump_uint32(stream, msg->uordblks);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  8: uint32 fordblks = ");
+  if (memusage_response_has_fordblks(msg)) {
+    z_dump_uint32(stream, msg->fordblks);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  9: uint32 keepcost = ");
+  if (memusage_response_has_keepcost(msg)) {
+    z_dump_uint32(stream, msg->keepcost);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  10: uint64 sysused = ");
+  if (memusage_response_has_sysused(msg)) {
+    z_dump_uint64(stream, msg->sysused);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  11: uint64 sysfree = ");
+  if (memusage_response_has_sysfree(msg)) {
+    z_dump_uint64(stream, msg->sysfree);
+  } else {
+    fprintf(stream, "MISSING");
+  }
+  fprintf(stream, "\n}\n");
+}
+
+struct iopoll_request *iopoll_request_alloc (struct iopoll_request *msg) {
+  if (msg == NULL) {
+    msg = z_memory_struct_alloc(z_global_memory(), struct iopoll_request);
+    if (Z_MALLOC_IS_NULL(msg))
+      return(NULL);
+    msg->iopoll_request_ialloc = 1;
+  } else {
+    msg->iopoll_request_ialloc = 0;
+  }
+
+  z_memzero(msg->iopoll_request_fields_bitmap, 0);
+
+  return(msg);
+}
+
+void iopoll_request_free (struct iopoll_request *msg) {
+
+  if (msg->iopoll_request_ialloc)
+    z_memory_struct_free(z_global_memory(), struct iopoll_request, msg);
+}
+
+int iopoll_request_parse (struct iopoll_request *msg, void *reader, uint64_t size) {
+  uint64_t total_length = 0;
+  uint16_t field_id;
+  uint64_t length;
+  int r = 0;
+
+  while (z_reader_decode_field(reader, &field_id, &length) > 0) {
+    switch (field_id) {
+      
+
+      default: {
+        r = -1;
+        if (z_reader_skip(reader, length))
+          return(-1);
+        break;
+      }
+    }
+
+    total_length += length;
+    if (Z_UNLIKELY(total_length >= size))
+      break;
+  }
+
+  return(r);
+}
+
+size_t iopoll_request_size (struct iopoll_request *msg) {
+  size_t size = 0;
+  
+  return(size);
+}
+
+int iopoll_request_write (struct iopoll_request *msg, z_buffer_t *buffer) {
+  int r = 0;
+  
+  return(r);
+}
+
+void iopoll_request_dump (FILE *stream, const struct iopoll_request *msg) {
+  fprintf(stream, "iopoll_request {");
+  
+  fprintf(stream, "\n}\n");
+}
+
+struct iopoll_response *iopoll_response_alloc (struct iopoll_response *msg) {
+  if (msg == NULL) {
+    msg = z_memory_struct_alloc(z_global_memory(), struct iopoll_response);
+    if (Z_MALLOC_IS_NULL(msg))
+      return(NULL);
+    msg->iopoll_response_ialloc = 1;
+  } else {
+    msg->iopoll_response_ialloc = 0;
+  }
+
+  z_memzero(msg->iopoll_response_fields_bitmap, 1);
+  z_array_open(&(msg->waits), sizeof(uint64_t));
+  z_array_open(&(msg->reads), sizeof(uint64_t));
+  z_array_open(&(msg->writes), sizeof(uint64_t));
+  return(msg);
+}
+
+void iopoll_response_free (struct iopoll_response *msg) {
+  z_array_close(&(msg->waits));
+  z_array_close(&(msg->reads));
+  z_array_close(&(msg->writes));
+  if (msg->iopoll_response_ialloc)
+    z_memory_struct_free(z_global_memory(), struct iopoll_response, msg);
+}
+
+int iopoll_response_parse (struct iopoll_response *msg, void *reader, uint64_t size) {
+  uint64_t total_length = 0;
+  uint16_t field_id;
+  uint64_t length;
+  int r = 0;
+
+  while (z_reader_decode_field(reader, &field_id, &length) > 0) {
+    switch (field_id) {
+      
+      case 0: { /* list[uint64] waits */
+        uint64_t waits;
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &waits);
+        if (Z_UNLIKELY(r)) return(-1);
+        r = z_array_push_back_copy(&(msg->waits), &waits);
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->iopoll_response_fields_bitmap, 0);
+        break;
+      }
+
+      case 1: { /* list[uint64] reads */
+        uint64_t reads;
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &reads);
+        if (Z_UNLIKELY(r)) return(-1);
+        r = z_array_push_back_copy(&(msg->reads), &reads);
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->iopoll_response_fields_bitmap, 1);
+        break;
+      }
+
+      case 2: { /* list[uint64] writes */
+        uint64_t writes;
+        if (Z_UNLIKELY(length > sizeof(uint64_t))) return(-1);
+        r = z_reader_decode_uint64(reader, length, &writes);
+        if (Z_UNLIKELY(r)) return(-1);
+        r = z_array_push_back_copy(&(msg->writes), &writes);
+        if (Z_UNLIKELY(r)) return(-1);
+        z_bitmap_set(msg->iopoll_response_fields_bitmap, 2);
+        break;
+      }
+
+      default: {
+        r = -1;
+        if (z_reader_skip(reader, length))
+          return(-1);
+        break;
+      }
+    }
+
+    total_length += length;
+    if (Z_UNLIKELY(total_length >= size))
+      break;
+  }
+
+  return(r);
+}
+
+size_t iopoll_response_size (struct iopoll_response *msg) {
+  size_t size = 0;
+  /* TODO waits */
+/* TODO reads */
+/* TODO writes */
+  return(size);
+}
+
+int iopoll_response_write (struct iopoll_response *msg, z_buffer_t *buffer) {
+  int r = 0;
+  
+  if (iopoll_response_has_waits(msg)) {
+    size_t i;
+    for (i = 0; i < msg->waits.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->waits), uint64_t, i);
+      r = z_write_field_uint64(buffer, 0, *value);
+      if (Z_UNLIKELY(r)) return(-0);
+    }
+  }
+
+  if (iopoll_response_has_reads(msg)) {
+    size_t i;
+    for (i = 0; i < msg->reads.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->reads), uint64_t, i);
+      r = z_write_field_uint64(buffer, 1, *value);
+      if (Z_UNLIKELY(r)) return(-1);
+    }
+  }
+
+  if (iopoll_response_has_writes(msg)) {
+    size_t i;
+    for (i = 0; i < msg->writes.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->writes), uint64_t, i);
+      r = z_write_field_uint64(buffer, 2, *value);
+      if (Z_UNLIKELY(r)) return(-2);
+    }
+  }
+  return(r);
+}
+
+void iopoll_response_dump (FILE *stream, const struct iopoll_response *msg) {
+  fprintf(stream, "iopoll_response {");
+  
+  fprintf(stream, "\n  0: uint64 waits = ");
+  if (iopoll_response_has_waits(msg)) {
+
+    size_t i;
+    for (i = 0; i < msg->waits.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->waits), uint64_t, i);
+      fprintf(stream, "[%zu]", i);
+      z_dump_uint64(stream, *value);
+    }
+
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  1: uint64 reads = ");
+  if (iopoll_response_has_reads(msg)) {
+
+    size_t i;
+    for (i = 0; i < msg->reads.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->reads), uint64_t, i);
+      fprintf(stream, "[%zu]", i);
+      z_dump_uint64(stream, *value);
+    }
+
+  } else {
+    fprintf(stream, "MISSING");
+  }
+
+  fprintf(stream, "\n  2: uint64 writes = ");
+  if (iopoll_response_has_writes(msg)) {
+
+    size_t i;
+    for (i = 0; i < msg->writes.count; ++i) {
+      const uint64_t *value = z_array_get(&(msg->writes), uint64_t, i);
+      fprintf(stream, "[%zu]", i);
+      z_dump_uint64(stream, *value);
+    }
+
+  } else {
+    fprintf(stream, "MISSING");
+  }
+  fprintf(stream, "\n}\n");
+}
\ No newline at end of file
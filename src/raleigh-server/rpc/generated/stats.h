@@ -0,0 +1,237 @@
+
+/* File autogenerated, do not edit */
+#ifndef _STATS_H_
+#define _STATS_H_
+
+#include <zcl/bytesref.h>
+#include <zcl/macros.h>
+#include <zcl/coding.h>
+#include <zcl/reader.h>
+#include <zcl/writer.h>
+#include <zcl/array.h>
+#include <zcl/buffer.h>
+#include <zcl/bitmap.h>
+#include <zcl/debug.h>
+
+
+struct rusage_request {
+  /* Internal states */
+  uint8_t rusage_request_fields_bitmap[0];
+  int rusage_request_ialloc;
+
+  /* Fields */
+
+};
+
+
+
+struct rusage_request *rusage_request_alloc (struct rusage_request *msg);
+void   rusage_request_free (struct rusage_request *msg);
+int    rusage_request_parse (struct rusage_request *msg, void *reader, uint64_t size);
+size_t rusage_request_size  (struct rusage_request *msg);
+int    rusage_request_write (struct rusage_request *msg, z_buffer_t *buffer);
+void   rusage_request_dump  (FILE *stream, const struct rusage_request *msg);
+
+struct rusage_response {
+  /* Internal states */
+  uint8_t rusage_response_fields_bitmap[2];
+  int rusage_response_ialloc;
+
+  /* Fields */
+  uint64_t   utime;                       /*  1: uint64  */
+  uint64_t   stime;                       /*  2: uint64  */
+  uint64_t   maxrss;                      /*  3: uint64  */
+  uint64_t   minflt;                      /*  4: uint64  */
+  uint64_t   majflt;                      /*  5: uint64  */
+  uint64_t   inblock;                     /*  6: uint64  */
+  uint64_t   oublock;                     /*  7: uint64  */
+  uint64_t   nvcsw;                       /*  8: uint64  */
+  uint64_t   nivcsw;                      /*  9: uint64  */
+  uint64_t   iowait;                      /* 10: uint64  */
+  uint64_t   ioread;                      /* 11: uint64  */
+  uint64_t   iowrite;                     /* 12: uint64  */
+};
+
+#define rusage_response_has_utime(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 0)
+#define rusage_response_set_utime(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 0)
+#define rusage_response_has_stime(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 1)
+#define rusage_response_set_stime(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 1)
+#define rusage_response_has_maxrss(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 2)
+#define rusage_response_set_maxrss(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 2)
+#define rusage_response_has_minflt(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 3)
+#define rusage_response_set_minflt(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 3)
+#define rusage_response_has_majflt(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 4)
+#define rusage_response_set_majflt(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 4)
+#define rusage_response_has_inblock(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 5)
+#define rusage_response_set_inblock(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 5)
+#define rusage_response_has_oublock(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 6)
+#define rusage_response_set_oublock(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 6)
+#define rusage_response_has_nvcsw(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 7)
+#define rusage_response_set_nvcsw(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 7)
+#define rusage_response_has_nivcsw(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 8)
+#define rusage_response_set_nivcsw(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 8)
+#define rusage_response_has_iowait(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 9)
+#define rusage_response_set_iowait(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 9)
+#define rusage_response_has_ioread(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 10)
+#define rusage_response_set_ioread(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 10)
+#define rusage_response_has_iowrite(msg)  z_bitmap_test((msg)->rusage_response_fields_bitmap, 11)
+#define rusage_response_set_iowrite(msg)  z_bitmap_set((msg)->rusage_response_fields_bitmap, 11)
+
+struct rusage_response *rusage_response_alloc (struct rusage_response *msg);
+void   rusage_response_free (struct rusage_response *msg);
+int    rusage_response_parse (struct rusage_response *msg, void *reader, uint64_t size);
+size_t rusage_response_size  (struct rusage_response *msg);
+int    rusage_response_write (struct rusage_response *msg, z_buffer_t *buffer);
+void   rusage_response_dump  (FILE *stream, const struct rusage_response *msg);
+
+struct rpc_histogram {
+  /* Internal states */
+  uint8_t rpc_histogram_fields_bitmap[1];
+  int rpc_histogram_ialloc;
+
+  /* Fields */
+  uint64_t   nevents;                     /*  0: uint64  */
+  uint64_t   min;                         /*  1: uint64  */
+  uint64_t   max;                         /*  2: uint64  */
+  uint64_t   sum;                         /*  3: uint64  */
+  uint16_t   nbuckets;                    /*  4: uint16  */
+  z_array_t  bounds;                      /*  5: list[uint64]  */
+  z_array_t  events;                      /*  6: list[uint64]  */
+};
+
+#define rpc_histogram_has_nevents(msg)  z_bitmap_test((msg)->rpc_histogram_fields_bitmap, 0)
+#define rpc_histogram_set_nevents(msg)  z_bitmap_set((msg)->rpc_histogram_fields_bitmap, 0)
+#define rpc_histogram_has_min(msg)  z_bitmap_test((msg)->rpc_histogram_fields_bitmap, 1)
+#define rpc_histogram_set_min(msg)  z_bitmap_set((msg)->rpc_histogram_fields_bitmap, 1)
+#define rpc_histogram_has_max(msg)  z_bitmap_test((msg)->rpc_histogram_fields_bitmap, 2)
+#define rpc_histogram_set_max(msg)  z_bitmap_set((msg)->rpc_histogram_fields_bitmap, 2)
+#define rpc_histogram_has_sum(msg)  z_bitmap_test((msg)->rpc_histogram_fields_bitmap, 3)
+#define rpc_histogram_set_sum(msg)  z_bitmap_set((msg)->rpc_histogram_fields_bitmap, 3)
+#define rpc_histogram_has_nbuckets(msg)  z_bitmap_test((msg)->rpc_histogram_fields_bitmap, 4)
+#define rpc_histogram_set_nbuckets(msg)  z_bitmap_set((msg)->rpc_histogram_fields_bitmap, 4)
+#define rpc_histogram_has_bounds(msg)  z_bitmap_test((msg)->rpc_histogram_fields_bitmap, 5)
+#define rpc_histogram_set_bounds(msg)  z_bitmap_set((msg)->rpc_histogram_fields_bitmap, 5)
+#define rpc_histogram_has_events(msg)  z_bitmap_test((msg)->rpc_histogram_fields_bitmap, 6)
+#define rpc_histogram_set_events(msg)  z_bitmap_set((msg)->rpc_histogram_fields_bitmap, 6)
+
+struct rpc_histogram *rpc_histogram_alloc (struct rpc_histogram *msg);
+void   rpc_histogram_free (struct rpc_histogram *msg);
+int    rpc_histogram_parse (struct rpc_histogram *msg, void *reader, uint64_t size);
+size_t rpc_histogram_size  (struct rpc_histogram *msg);
+int    rpc_histogram_write (struct rpc_histogram *msg, z_buffer_t *buffer);
+void   rpc_histogram_dump  (FILE *stream, const struct rpc_histogram *msg);
+
+struct memusage_request {
+  /* Internal states */
+  uint8_t memusage_request_fields_bitmap[0];
+  int memusage_request_ialloc;
+
+  /* Fields */
+
+};
+
+
+
+struct memusage_request *memusage_request_alloc (struct memusage_request *msg);
+void   memusage_request_free (struct memusage_request *msg);
+int    memusage_request_parse (struct memusage_request *msg, void *reader, uint64_t size);
+size_t memusage_request_size  (struct memusage_request *msg);
+int    memusage_request_write (struct memusage_request *msg, z_buffer_t *buffer);
+void   memusage_request_dump  (FILE *stream, const struct memusage_request *msg);
+
+struct memusage_response {
+  /* Internal states */
+  uint8_t memusage_response_fields_bitmap[2];
+  int memusage_response_ialloc;
+
+  /* Fields */
+  uint32_t   arena;                       /*  0: uint32  */
+  uint32_t   ordblks;                     /*  1: uint32  */
+  uint32_t   smblks;                      /*  2: uint32  */
+  uint32_t   hblks;                       /*  3: uint32  */
+  uint32_t   hblkhd;                      /*  4: uint32  */
+  uint32_t   usmblks;                     /*  5: uint32  */
+  uint32_t   fsmblks;                     /*  6: uint32  */
+  uint32_t   uordblks;                    /*  7: uint32  */
+  uint32_t   fordblks;                    /*  8: uint32  */
+  uint32_t   keepcost;                    /*  9: uint32  */
+  uint64_t   sysused;                     /* 10: uint64  */
+  uint64_t   sysfree;                     /* 11: uint64  */
+};
+
+#define memusage_response_has_arena(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 0)
+#define memusage_response_set_arena(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 0)
+#define memusage_response_has_ordblks(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 1)
+#define memusage_response_set_ordblks(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 1)
+#define memusage_response_has_smblks(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 2)
+#define memusage_response_set_smblks(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 2)
+#define memusage_response_has_hblks(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 3)
+#define memusage_response_set_hblks(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 3)
+#define memusage_response_has_hblkhd(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 4)
+#define memusage_response_set_hblkhd(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 4)
+#define memusage_response_has_usmblks(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 5)
+#define memusage_response_set_usmblks(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 5)
+#define memusage_response_has_fsmblks(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 6)
+#define memusage_response_set_fsmblks(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 6)
+#define memusage_response_has_uordblks(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 7)
+#define memusage_response_set_uordblks(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 7)
+#define memusage_response_has_fordblks(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 8)
+#define memusage_response_set_fordblks(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 8)
+#define memusage_response_has_keepcost(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 9)
+#define memusage_response_set_keepcost(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 9)
+#define memusage_response_has_sysused(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 10)
+#define memusage_response_set_sysused(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 10)
+#define memusage_response_has_sysfree(msg)  z_bitmap_test((msg)->memusage_response_fields_bitmap, 11)
+#define memusage_response_set_sysfree(msg)  z_bitmap_set((msg)->memusage_response_fields_bitmap, 11)
+
+struct memusage_response *memusage_response_alloc (struct memusage_response *msg);
+void   memusage_response_free (struct memusage_response *msg);
+int    memusage_response_parse (struct memusage_response *msg, void *reader, uint64_t size);
+size_t memusage_response_size  (struct memusage_response *msg);
+int    memusage_response_write (struct memusage_response *msg, z_buffer_t *buffer);
+void   memusage_response_dump  (FILE *stream, const struct memusage_response *msg);
+
+struct iopoll_request {
+  /* Internal states */
+  uint8_t iopoll_request_fields_bitmap[0];
+  int iopoll_request_ialloc;
+
+  /* Fields */
+
+};
+
+
+
+struct iopoll_request *iopoll_request_alloc (struct iopoll_request *msg);
+void   iopoll_request_free (struct iopoll_request *msg);
+int    iopoll_request_parse (struct iopoll_request *msg, void *reader, uint64_t size);
+size_t iopoll_request_size  (struct iopoll_request *msg);
+int    iopoll_request_write (struct iopoll_request *msg, z_buffer_t *buffer);
+void   iopoll_request_dump  (FILE *stream, const struct iopoll_request *msg);
+
+struct iopoll_response {
+  /* Internal states */
+  uint8_t iopoll_response_fields_bitmap[1];
+  int iopoll_response_ialloc;
+
+  /* Fields */
+  z_array_t  waits;                       /*  0: list[uint64]  */
+  z_array_t  reads;                       /*  1: list[uint64]  */
+  z_array_t  writes;                      /*  2: list[uint64]  */
+};
+
+#define iopoll_response_has_waits(msg)  z_bitmap_test((msg)->iopoll_response_fields_bitmap, 0)
+#define iopoll_response_set_waits(msg)  z_bitmap_set((msg)->iopoll_response_fields_bitmap, 0)
+#define iopoll_response_has_reads(msg)  z_bitmap_test((msg)->iopoll_response_fields_bitmap, 1)
+#define iopoll_response_set_reads(msg)  z_bitmap_set((msg)->iopoll_response_fields_bitmap, 1)
+#define iopoll_response_has_writes(msg)  z_bitmap_test((msg)->iopoll_response_fields_bitmap, 2)
+#define iopoll_response_set_writes(msg)  z_bitmap_set((msg)->iopoll_response_fields_bitmap, 2)
+
+struct iopoll_response *iopoll_response_alloc (struct iopoll_response *msg);
+void   iopoll_response_free (struct iopoll_response *msg);
+int    iopoll_response_parse (struct iopoll_response *msg, void *reader, uint64_t size);
+size_t iopoll_response_size  (struct iopoll_response *msg);
+int    iopoll_response_write (struct iopoll_response *msg, z_buffer_t *buffer);
+void   iopoll_response_dump  (FILE *stream, const struct iopoll_response *msg);
+
+#endif /* !_STATS_H_ */
\ No newline at end of file
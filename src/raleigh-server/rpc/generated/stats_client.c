@@ -0,0 +1,268 @@
+
+/*
+ * File autogenerated, do not edit.
+ * (this file should be part of the client library)
+ */
+#include <zcl/string.h>
+#include <zcl/global.h>
+#include <zcl/iovec.h>
+#include <zcl/debug.h>
+#include <zcl/time.h>
+
+#include "stats_client.h"
+
+
+static int __stats_rpc_client_parse_request (z_iovec_reader_t *reader,
+                                                 uint64_t msg_type,
+                                                 uint64_t req_id)
+{
+  return(-1);
+}
+
+static int __stats_rpc_client_parse_response (z_iovec_reader_t *reader,
+                                                  z_rpc_map_t *rpc_map,
+                                                  uint64_t msg_type,
+                                                  uint64_t req_id)
+{
+  z_rpc_call_t *call;
+  uint64_t size;
+  int r = -1;
+
+  size = z_reader_available(reader);
+  call = z_rpc_map_remove(rpc_map, req_id);
+
+  switch (msg_type) {
+
+    case RUSAGE_ID: {
+      struct rusage_response *resp = NULL;
+
+      resp = rusage_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response rusage_response");
+        /* TODO */
+        break;
+      }
+
+      if ((r = rusage_response_parse(resp, reader, size))) {
+        Z_LOG_FATAL("Unable to parse message {REQ_ATYPE}");
+        rusage_response_free(resp);
+        /* TODO */
+        break;
+      }
+
+      call->callback(call->ctx, call->ucallback, call->udata);
+      rusage_response_free(resp);
+      /* TODO */
+      break;
+    }
+
+    case MEMUSAGE_ID: {
+      struct memusage_response *resp = NULL;
+
+      resp = memusage_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response memusage_response");
+        /* TODO */
+        break;
+      }
+
+      if ((r = memusage_response_parse(resp, reader, size))) {
+        Z_LOG_FATAL("Unable to parse message {REQ_ATYPE}");
+        memusage_response_free(resp);
+        /* TODO */
+        break;
+      }
+
+      call->callback(call->ctx, call->ucallback, call->udata);
+      memusage_response_free(resp);
+      /* TODO */
+      break;
+    }
+
+    case IOPOLL_ID: {
+      struct iopoll_response *resp = NULL;
+
+      resp = iopoll_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response iopoll_response");
+        /* TODO */
+        break;
+      }
+
+      if ((r = iopoll_response_parse(resp, reader, size))) {
+        Z_LOG_FATAL("Unable to parse message {REQ_ATYPE}");
+        iopoll_response_free(resp);
+        /* TODO */
+        break;
+      }
+
+      call->callback(call->ctx, call->ucallback, call->udata);
+      iopoll_response_free(resp);
+      /* TODO */
+      break;
+    }
+
+    default:
+      /* ctx->handle_unknown(client, Z_IPC_UNKNOWN_MESSAGE, msg_type, req_id); */
+      Z_LOG_FATAL("Unknown type %u for response %u", msg_type, req_id);
+      break;
+  }
+
+  return(r);
+}
+
+int stats_rpc_client_parse (z_iopoll_entity_t *client,
+                                z_rpc_map_t *rpc_map,
+                                const struct iovec iov[2])
+{
+  z_iovec_reader_t reader;
+  uint64_t msg_type;
+  uint64_t req_id;
+  int is_req;
+  int r = -1;
+
+  z_iovec_reader_open(&reader, iov, 2);
+
+  /* Parse the RPC header */
+  if (z_rpc_parse_head(&reader, &msg_type, &req_id, &is_req)) {
+    Z_LOG_FATAL("Unable to read the Request-Head from the RPC header");
+    return(-1);
+  }
+
+  if (Z_UNLIKELY(is_req)) {
+    r = __stats_rpc_client_parse_request(&reader, msg_type, req_id);
+  } else {
+    r = __stats_rpc_client_parse_response(&reader, rpc_map, msg_type, req_id);
+  }
+
+  z_iovec_reader_close(&reader);
+  return(r);
+}
+
+z_rpc_ctx_t *stats_rpc_client_build_request (z_iopoll_entity_t *client,
+                                                 uint64_t msg_type,
+                                                 uint64_t req_id)
+{
+  z_rpc_ctx_t *ctx;
+
+  switch (msg_type) {
+
+    case RUSAGE_ID: {
+      ctx = z_rpc_ctx_alloc(struct rusage_request, struct rusage_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context rusage");
+        return(NULL);
+      }
+
+      /* TODO: CHECK ME! */
+      z_rpc_ctx_init(ctx, struct rusage_request);
+      rusage_request_alloc(Z_RPC_CTX_REQ(struct rusage_request, ctx));
+      rusage_response_alloc(Z_RPC_CTX_RESP(struct rusage_response, ctx));
+      break;
+    }
+
+    case MEMUSAGE_ID: {
+      ctx = z_rpc_ctx_alloc(struct memusage_request, struct memusage_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context memusage");
+        return(NULL);
+      }
+
+      /* TODO: CHECK ME! */
+      z_rpc_ctx_init(ctx, struct memusage_request);
+      memusage_request_alloc(Z_RPC_CTX_REQ(struct memusage_request, ctx));
+      memusage_response_alloc(Z_RPC_CTX_RESP(struct memusage_response, ctx));
+      break;
+    }
+
+    case IOPOLL_ID: {
+      ctx = z_rpc_ctx_alloc(struct iopoll_request, struct iopoll_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context iopoll");
+        return(NULL);
+      }
+
+      /* TODO: CHECK ME! */
+      z_rpc_ctx_init(ctx, struct iopoll_request);
+      iopoll_request_alloc(Z_RPC_CTX_REQ(struct iopoll_request, ctx));
+      iopoll_response_alloc(Z_RPC_CTX_RESP(struct iopoll_response, ctx));
+      break;
+    }
+
+    default:
+      Z_LOG_FATAL("Unknown type %"PRIu64" for request\n", msg_type);
+      return(NULL);
+  }
+
+  ctx->client   = client;
+  ctx->req_id   = req_id;
+  ctx->req_time = z_time_micros();
+  ctx->msg_type = msg_type;
+  return(ctx);
+}
+
+int stats_rpc_client_push_request (z_iopoll_t *iopoll,
+                                       z_rpc_ctx_t *ctx,
+                                       z_ipc_msgbuf_t *msgbuf,
+                                       z_rpc_map_t *rpc_map,
+                                       void *sys_callback,
+                                       void *ucallback,
+                                       void *udata)
+{
+  z_rpc_call_t *call;
+  z_buffer_t buffer;
+  int r = -1;
+
+  call = z_rpc_map_add(rpc_map, ctx, sys_callback, ucallback, udata);
+  if (Z_MALLOC_IS_NULL(call)) {
+    return(-1);
+  }
+
+  if (Z_UNLIKELY(z_buffer_alloc(&buffer) == NULL)) {
+    Z_LOG_FATAL("TODO unable to allocate buffer (free req/resp)\n");
+    return(-1);
+  }
+
+  if (Z_UNLIKELY(z_buffer_reserve(&buffer, 128))) {
+    Z_LOG_FATAL("TODO unable to reserve buffer space (free req/resp)\n");
+    return(-1);
+  }
+
+  /* Write the RPC header */
+  buffer.size = z_rpc_write_head(buffer.block, ctx->msg_type, ctx->req_id, 1);
+
+  /* Write the Response */
+  switch (ctx->msg_type) {
+
+    case RUSAGE_ID: {
+      r = rusage_request_write(Z_RPC_CTX_REQ(struct rusage_request, ctx), &buffer);
+      break;
+    }
+
+    case MEMUSAGE_ID: {
+      r = memusage_request_write(Z_RPC_CTX_REQ(struct memusage_request, ctx), &buffer);
+      break;
+    }
+
+    case IOPOLL_ID: {
+      r = iopoll_request_write(Z_RPC_CTX_REQ(struct iopoll_request, ctx), &buffer);
+      break;
+    }
+
+    default:
+      Z_LOG_FATAL("Unknown type %"PRIu64" for request\n", ctx->msg_type);
+      break;
+  }
+
+  if (Z_UNLIKELY(r == 0)) {
+    r = z_ipc_msgbuf_push(msgbuf, buffer.block, buffer.size);
+    z_iopoll_set_writable(iopoll, ctx->client, 1);
+    Z_LOG_TRACE("Send request of size=%zu time=%.5fsec",
+                buffer.size, (z_time_micros() - ctx->req_time) / 1000000.0f);
+
+    z_buffer_release(&buffer);
+  }
+
+  z_buffer_free(&buffer);
+  return(r);
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+
+/* File autogenerated, do not edit */
+#ifndef _STATS_CLIENT_H_
+#define _STATS_CLIENT_H_
+
+#include <zcl/debug.h>
+#include <zcl/ipc.h>
+#include <zcl/rpc.h>
+
+#include "stats.h"
+
+
+#define RUSAGE_ID 0
+#define MEMUSAGE_ID 1
+#define IOPOLL_ID 2
+
+z_rpc_ctx_t *stats_rpc_client_build_request (z_iopoll_entity_t *client,
+                                                 uint64_t msg_type,
+                                                 uint64_t req_id);
+
+int  stats_rpc_client_parse (z_iopoll_entity_t *client,
+                                 z_rpc_map_t *rpc_map,
+                                 const struct iovec iov[2]);
+int  stats_rpc_client_push_request (z_iopoll_t *iopoll,
+                                        z_rpc_ctx_t *ctx,
+                                        z_ipc_msgbuf_t *msgbuf,
+                                        z_rpc_map_t *rpc_map,
+                                        void *sys_callback,
+                                        void *ucallback,
+                                        void *udata);
+
+#endif /* !_STATS_CLIENT_H_ */
\ No newline at end of file
@@ -0,0 +1,272 @@
+
+/* File autogenerated, do not edit */
+#include <zcl/string.h>
+#include <zcl/global.h>
+#include <zcl/iovec.h>
+#include <zcl/debug.h>
+#include <zcl/time.h>
+
+#include "stats_server.h"
+
+
+/* Every ctx of the calls fits the rpc ctx pool */
+typedef char __stats_rpc_server_ctx_check[
+  (STATS_RPC_SERVER_CTX_ISIZE <= Z_MEMORY_SLAB_MAX_ISIZE) ? 1 : -1];
+
+int stats_rpc_server_parse (const struct stats_rpc_server *proto,
+                                z_ipc_client_t *client,
+                                const struct iovec iov[2])
+{
+  z_iovec_reader_t reader;
+  uint64_t req_st_time;
+  uint64_t msg_type;
+  uint64_t req_id;
+  uint64_t size;
+  int r = -1;
+
+  req_st_time = z_time_micros();
+
+  z_iovec_reader_open(&reader, iov, 2);
+  size = z_reader_available(&reader);
+
+  /* Parse the RPC header */
+  if (z_rpc_parse_head(&reader, &msg_type, &req_id, &r)) {
+    Z_LOG_FATAL("Unable to read the Request-Head from the RPC header");
+    return(-1);
+  }
+
+  if (Z_UNLIKELY(!r)) {
+    Z_LOG_FATAL("The request has the response flag");
+    return(-1);
+  }
+
+  switch (msg_type) {
+
+    case 0: { /* 0 rusage */
+      z_rpc_ctx_t *ctx;
+      struct rusage_response *resp;
+      struct rusage_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu rusage from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct rusage_request, struct rusage_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context rusage");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct rusage_request);
+      req  = Z_RPC_CTX_REQ(struct rusage_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct rusage_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 0;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = rusage_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request rusage_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (rusage_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request rusage_request");
+        rusage_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = rusage_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response rusage_response");
+        rusage_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->rusage(ctx, req, resp))) {
+        rusage_response_free(resp);
+        rusage_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 1: { /* 1 memusage */
+      z_rpc_ctx_t *ctx;
+      struct memusage_response *resp;
+      struct memusage_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu memusage from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct memusage_request, struct memusage_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context memusage");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct memusage_request);
+      req  = Z_RPC_CTX_REQ(struct memusage_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct memusage_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 1;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = memusage_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request memusage_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (memusage_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request memusage_request");
+        memusage_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = memusage_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response memusage_response");
+        memusage_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->memusage(ctx, req, resp))) {
+        memusage_response_free(resp);
+        memusage_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    case 2: { /* 2 iopoll */
+      z_rpc_ctx_t *ctx;
+      struct iopoll_response *resp;
+      struct iopoll_request *req;
+
+      Z_LOG_TRACE("Handling RPC Request %lu Type %lu iopoll from client %d",
+                  req_id, msg_type, Z_IOPOLL_ENTITY_FD(client));
+
+      ctx = z_rpc_ctx_alloc(struct iopoll_request, struct iopoll_response);
+      if (Z_MALLOC_IS_NULL(ctx)) {
+        Z_LOG_FATAL("Unable to allocate rpc context iopoll");
+        break;
+      }
+
+      z_rpc_ctx_init(ctx, struct iopoll_request);
+      req  = Z_RPC_CTX_REQ(struct iopoll_request, ctx);
+      resp = Z_RPC_CTX_RESP(struct iopoll_response, ctx);
+
+      ctx->client   = Z_IOPOLL_ENTITY(client);
+      ctx->msg_type = 2;
+      ctx->req_id   = req_id;
+      ctx->req_time = req_st_time;
+
+      req = iopoll_request_alloc(req);
+      if (Z_MALLOC_IS_NULL(req)) {
+        Z_LOG_FATAL("Unable to allocate request iopoll_request");
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if (iopoll_request_parse(req, &reader, size)) {
+        Z_LOG_FATAL("Unable to parse request iopoll_request");
+        iopoll_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      resp = iopoll_response_alloc(resp);
+      if (Z_MALLOC_IS_NULL(resp)) {
+        Z_LOG_FATAL("Unable to allocate response iopoll_response");
+        iopoll_request_free(req);
+        z_rpc_ctx_free(ctx);
+        break;
+      }
+
+      if ((r = proto->iopoll(ctx, req, resp))) {
+        iopoll_response_free(resp);
+        iopoll_request_free(req);
+        z_rpc_ctx_free(ctx);
+      }
+      break;
+    }
+
+    default:
+      Z_LOG_FATAL("Unknown type %u for request %u", msg_type, req_id);
+      break;
+  }
+
+  z_iovec_reader_close(&reader);
+  return(r);
+}
+
+int  stats_rpc_server_push_response (z_rpc_ctx_t *ctx,
+                                         z_ipc_msgbuf_t *msgbuf)
+{
+  z_buffer_t buffer;
+  int pushed = 0;
+  int r = -1;
+
+  if (Z_UNLIKELY(z_buffer_alloc(&buffer) == NULL)) {
+    Z_LOG_FATAL("TODO unable to allocate buffer (free req/resp)\n");
+    return(-1);
+  }
+
+  if (Z_UNLIKELY(z_buffer_reserve(&buffer, 128))) {
+    Z_LOG_FATAL("TODO unable to reserve buffer space (free req/resp)\n");
+    return(-1);
+  }
+
+  /* Write the RPC header */
+  buffer.size = z_rpc_write_head(buffer.block, ctx->msg_type, ctx->req_id, 0);
+
+  /* Write the Response */
+  switch (ctx->msg_type) {
+
+    case 0: { /* 0 rusage */
+      rusage_request_free((struct rusage_request *)ctx->req);
+      r = rusage_response_write((struct rusage_response *)ctx->resp, &buffer);
+      rusage_response_free((struct rusage_response *)ctx->resp);
+      break;
+    }
+
+    case 1: { /* 1 memusage */
+      memusage_request_free((struct memusage_request *)ctx->req);
+      r = memusage_response_write((struct memusage_response *)ctx->resp, &buffer);
+      memusage_response_free((struct memusage_response *)ctx->resp);
+      break;
+    }
+
+    case 2: { /* 2 iopoll */
+      iopoll_request_free((struct iopoll_request *)ctx->req);
+      r = iopoll_response_write((struct iopoll_response *)ctx->resp, &buffer);
+      iopoll_response_free((struct iopoll_response *)ctx->resp);
+      break;
+    }
+
+    default:
+      Z_LOG_FATAL("Unknown type %"PRIu64" for request\n", ctx->msg_type);
+      break;
+  }
+
+  if (!pushed)
+    z_ipc_msgbuf_push(msgbuf, buffer.block, buffer.size);
+  z_ipc_client_set_writable(ctx->client, 1);
+  Z_LOG_TRACE("Send response of size=%zu time=%.5fsec",
+              buffer.size, (z_time_micros() - ctx->req_time) / 1000000.0f);
+
+  z_rpc_ctx_free(ctx);
+  z_buffer_release(&buffer);
+  z_buffer_free(&buffer);
+  return(r);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+
+/* File autogenerated, do not edit */
+#ifndef _STATS_SERVER_H_
+#define _STATS_SERVER_H_
+
+#include <zcl/debug.h>
+#include <zcl/ipc.h>
+#include <zcl/rpc.h>
+
+#include "stats.h"
+
+
+struct stats_rpc_server {
+  int (*rusage) (z_rpc_ctx_t *ctx,
+                 struct rusage_request *req,
+                 struct rusage_response *resp);
+  int (*memusage) (z_rpc_ctx_t *ctx,
+                   struct memusage_request *req,
+                   struct memusage_response *resp);
+  int (*iopoll) (z_rpc_ctx_t *ctx,
+                 struct iopoll_request *req,
+                 struct iopoll_response *resp);
+};
+
+/* Reserve the rpc ctx pool for the largest ctx of the calls */
+union stats_rpc_server_ctx {
+  char rusage[z_rpc_ctx_size(struct rusage_request, struct rusage_response)];
+  char memusage[z_rpc_ctx_size(struct memusage_request, struct memusage_response)];
+  char iopoll[z_rpc_ctx_size(struct iopoll_request, struct iopoll_response)];
+};
+
+#define STATS_RPC_SERVER_CTX_ISIZE    sizeof(union stats_rpc_server_ctx)
+
+#define RUSAGE_ID 0
+#define MEMUSAGE_ID 1
+#define IOPOLL_ID 2
+
+int  stats_rpc_server_parse (const struct stats_rpc_server *proto,
+                                 z_ipc_client_t *client,
+                                 const struct iovec iov[2]);
+int  stats_rpc_server_push_response (z_rpc_ctx_t *ctx,
+                                         z_ipc_msgbuf_t *msgbuf);
+
+#endif /* !_STATS_SERVER_H_ */
\ No newline at end of file
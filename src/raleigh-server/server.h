@@ -21,7 +21,9 @@
 
 #include <raleighsl/raleighsl.h>
 
+#include <zcl/threading.h>
 #include <zcl/ringbuf.h>
+#include <zcl/dlink.h>
 #include <zcl/ipc.h>
 
 #define SERVER_CONTEXT(x)           Z_CAST(struct server_context, x)
@@ -30,11 +32,39 @@
 #define RALEIGHSL_CLIENT(x)         Z_CAST(struct raleighsl_client, x)
 #define STATS_CLIENT(x)             Z_CAST(struct stats_client, x)
 
+typedef void (*server_timer_func_t) (void *udata, uint64_t arg);
+
+/*
+ * Calls the entries func once the deadline (z_time_micros) is past, from
+ * the timer thread. The funcs should only schedule the work.
+ * The entries are owned by the caller, a cancelled or fired entry is out
+ * of the heap and can be freed.
+ */
+struct server_timer_entry {
+  server_timer_func_t func;
+  void *udata;
+  uint64_t deadline;
+  uint64_t arg;
+  size_t index;                   /* Heap slot, 0 if not queued */
+};
+
+struct server_timer {
+  z_mutex_t lock;
+  z_wait_cond_t wcond;
+  struct server_timer_entry **heap;  /* Min-heap by deadline, from 1 */
+  size_t nentries;
+  size_t size;
+  z_thread_t thread;
+  int is_running;
+};
+
 struct server_context {
   int is_running;
   raleighsl_t fs;
+  raleighsl_file_device_t device;
   z_allocator_t allocator;
   z_iopoll_t iopoll;
+  struct server_timer timer;
 };
 
 struct echo_client {
@@ -48,9 +78,22 @@ struct redis_client {
   z_ringbuf_t obuffer;
 };
 
+/*
+ * Outlives the client, the requests parked on an object (flow_subscribe,
+ * deque_pop with a timeout) look at it before replying: client is NULL
+ * once disconnected.
+ */
+struct raleighsl_session {
+  z_spinlock_t lock;
+  z_ipc_client_t *client;
+  z_dlink_node_t subscribers;     /* Parked flow_subscribe requests */
+  unsigned int refs;
+};
+
 struct raleighsl_client {
   __Z_IPC_CLIENT__
   z_ipc_msgbuf_t msgbuf;
+  struct raleighsl_session *session;
 };
 
 struct stats_client {
@@ -59,6 +102,13 @@ struct stats_client {
   uint64_t id;
 };
 
+int  server_timer_open   (struct server_timer *timer);
+void server_timer_close  (struct server_timer *timer);
+int  server_timer_add    (struct server_timer *timer,
+                          struct server_timer_entry *entry);
+void server_timer_cancel (struct server_timer *timer,
+                          struct server_timer_entry *entry);
+
 extern const z_ipc_protocol_t echo_tcp_protocol;
 extern const z_ipc_protocol_t redis_tcp_protocol;
 extern const z_ipc_protocol_t stats_tcp_protocol;
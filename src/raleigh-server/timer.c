@@ -0,0 +1,206 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/global.h>
+#include <zcl/debug.h>
+#include <zcl/time.h>
+
+#include "server.h"
+
+/* ============================================================================
+ *  PRIVATE Timer Heap methods
+ */
+/*
+ * Binary min-heap by deadline, slot 0 is unused so the entry index is
+ * never 0 while queued. Add, cancel and pop are O(log n).
+ */
+#define __heap_entry(timer, i)      ((timer)->heap[i])
+#define __heap_before(timer, a, b)                                        \
+  (__heap_entry(timer, a)->deadline < __heap_entry(timer, b)->deadline)
+
+static void __heap_set (struct server_timer *timer,
+                        size_t index,
+                        struct server_timer_entry *entry)
+{
+  timer->heap[index] = entry;
+  entry->index = index;
+}
+
+static void __heap_swap (struct server_timer *timer, size_t a, size_t b) {
+  struct server_timer_entry *entry = __heap_entry(timer, a);
+  __heap_set(timer, a, __heap_entry(timer, b));
+  __heap_set(timer, b, entry);
+}
+
+static void __heap_sift_up (struct server_timer *timer, size_t index) {
+  while (index > 1 && __heap_before(timer, index, index >> 1)) {
+    __heap_swap(timer, index, index >> 1);
+    index >>= 1;
+  }
+}
+
+static void __heap_sift_down (struct server_timer *timer, size_t index) {
+  while ((index << 1) <= timer->nentries) {
+    size_t child = index << 1;
+    if (child < timer->nentries && __heap_before(timer, child + 1, child))
+      child++;
+    if (!__heap_before(timer, child, index))
+      break;
+    __heap_swap(timer, index, child);
+    index = child;
+  }
+}
+
+static int __heap_push (struct server_timer *timer, struct server_timer_entry *entry) {
+  if (Z_UNLIKELY(timer->nentries + 1 >= timer->size)) {
+    size_t size = z_max(64, timer->size << 1);
+    struct server_timer_entry **heap;
+
+    heap = z_memory_realloc(z_global_memory(), struct server_timer_entry *, timer->heap,
+                            size * sizeof(struct server_timer_entry *));
+    if (Z_MALLOC_IS_NULL(heap))
+      return(1);
+
+    timer->heap = heap;
+    timer->size = size;
+  }
+
+  __heap_set(timer, ++timer->nentries, entry);
+  __heap_sift_up(timer, entry->index);
+  return(0);
+}
+
+static void __heap_remove (struct server_timer *timer, struct server_timer_entry *entry) {
+  struct server_timer_entry *last = __heap_entry(timer, timer->nentries--);
+  size_t index = entry->index;
+
+  entry->index = 0;
+  if (last == entry)
+    return;
+
+  /* The last entry takes the slot, it may go either way */
+  __heap_set(timer, index, last);
+  __heap_sift_up(timer, index);
+  __heap_sift_down(timer, last->index);
+}
+
+/* ============================================================================
+ *  PRIVATE Timer methods
+ */
+static void *__timer_loop (void *udata) {
+  struct server_timer *timer = (struct server_timer *)udata;
+
+  z_mutex_lock(&(timer->lock));
+  while (timer->is_running) {
+    struct server_timer_entry *entry;
+    server_timer_func_t func;
+    uint64_t now, arg;
+    void *fudata;
+
+    if (timer->nentries == 0) {
+      z_wait_cond_wait(&(timer->wcond), &(timer->lock), 0);
+      continue;
+    }
+
+    /*
+     * The funcs only schedule work, they are called without the lock.
+     * Once out of the heap the entry may be freed by its owner.
+     */
+    now = z_time_micros();
+    entry = __heap_entry(timer, 1);
+    if (entry->deadline <= now) {
+      func = entry->func;
+      fudata = entry->udata;
+      arg = entry->arg;
+      __heap_remove(timer, entry);
+      z_mutex_unlock(&(timer->lock));
+      func(fudata, arg);
+      z_mutex_lock(&(timer->lock));
+      continue;
+    }
+
+    z_wait_cond_wait(&(timer->wcond), &(timer->lock),
+                     (entry->deadline - now + 999) / 1000);
+  }
+  z_mutex_unlock(&(timer->lock));
+  return(NULL);
+}
+
+/* ============================================================================
+ *  PUBLIC Timer methods
+ */
+int server_timer_open (struct server_timer *timer) {
+  timer->heap = NULL;
+  timer->nentries = 0;
+  timer->size = 0;
+  timer->is_running = 1;
+
+  if (z_mutex_alloc(&(timer->lock)))
+    return(1);
+
+  if (z_wait_cond_alloc(&(timer->wcond))) {
+    z_mutex_free(&(timer->lock));
+    return(2);
+  }
+
+  if (z_thread_start(&(timer->thread), __timer_loop, timer)) {
+    z_wait_cond_free(&(timer->wcond));
+    z_mutex_free(&(timer->lock));
+    return(3);
+  }
+  return(0);
+}
+
+/* The entries not yet fired are dropped, their owners free them */
+void server_timer_close (struct server_timer *timer) {
+  z_lock(&(timer->lock), z_mutex, {
+    timer->is_running = 0;
+    z_wait_cond_signal(&(timer->wcond));
+  });
+  z_thread_join(&(timer->thread));
+
+  while (timer->nentries > 0) {
+    __heap_entry(timer, timer->nentries--)->index = 0;
+  }
+  z_memory_free(z_global_memory(), timer->heap);
+
+  z_wait_cond_free(&(timer->wcond));
+  z_mutex_free(&(timer->lock));
+}
+
+int server_timer_add (struct server_timer *timer, struct server_timer_entry *entry) {
+  int res;
+
+  /* The loop is woken up if this is the first one */
+  z_lock(&(timer->lock), z_mutex, {
+    if (!(res = __heap_push(timer, entry)) && entry->index == 1)
+      z_wait_cond_signal(&(timer->wcond));
+  });
+  return(res);
+}
+
+/*
+ * Nothing is done if the entry is fired or was never added. Only the owner
+ * adds the entry, so an index of 0 can't change meanwhile: the requests
+ * released after server_timer_close() don't touch the timer.
+ */
+void server_timer_cancel (struct server_timer *timer, struct server_timer_entry *entry) {
+  if (entry->index == 0)
+    return;
+
+  z_lock(&(timer->lock), z_mutex, {
+    if (entry->index > 0)
+      __heap_remove(timer, entry);
+  });
+}
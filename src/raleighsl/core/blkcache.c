@@ -12,8 +12,13 @@
  *   limitations under the License.
  */
 
+#include <raleighsl/blkcache.h>
 #include <raleighsl/errno.h>
 
+#include <zcl/global.h>
+#include <zcl/string.h>
+#include <zcl/debug.h>
+
 #include "private.h"
 
 /*
@@ -26,21 +31,294 @@
  * |  - refs       ( 4 bytes) |
  * |  - state      ( 4 bytes) |
  * +--------------------------+
- * | block         (72 bytes) |
+ * | block         (40 bytes) |
  * +--------------------------+
- * |  - block hash (32 bytes) |
- * |  - hash node  (24 bytes) |
+ * |  - dirty node (24 bytes) |
  * |  - length     ( 4 bytes) |
- * |  - pad        ( 4 bytes) |
+ * |  - flags      ( 4 bytes) |
  * |  - data-ptr   ( 8 bytes) |
  * +--------------------------+
- * |              (112 bytes) |
+ * | data        (4096 bytes) |
  * +--------------------------+
+ *
+ * The cache holds one reference to the block, every reader holds one more
+ * and a dirty block holds one until it is written back. Only the blocks
+ * referenced by the cache alone can be evicted.
  */
 
-struct blk_page {
-  struct blk_group *next;
-  unsigned int x;
-  unsigned int y;
-  raleighsl_block_t block[73];
+#define __BLOCK_DIRTY             (1 << 0)
+#define __BLOCK_FLUSH             (1 << 1)
+
+#define __block_from_cache_entry(entry)                       \
+  z_container_of(entry, raleighsl_block_t, cache_entry)
+
+#define __block_from_dirty_node(node)                         \
+  z_container_of(node, raleighsl_block_t, dirty_node)
+
+#define __blkcache_shard(fs, blkno)                           \
+  (&((fs)->blkcache.shards[(blkno) % RALEIGHSL_BLKCACHE_SHARDS]))
+
+/* ============================================================================
+ *  PRIVATE Block methods
+ */
+static raleighsl_block_t *__block_alloc (uint64_t blkno) {
+  raleighsl_block_t *block;
+
+  block = (raleighsl_block_t *) z_memory_alloc(z_global_memory(), uint8_t,
+                        sizeof(raleighsl_block_t) + RALEIGHSL_BLKCACHE_BLOCK_SIZE);
+  if (Z_MALLOC_IS_NULL(block))
+    return(NULL);
+
+  z_cache_entry_init(&(block->cache_entry), blkno);
+  block->length = RALEIGHSL_BLKCACHE_BLOCK_SIZE;
+  block->flags = 0;
+  block->data = (uint8_t *)(block + 1);
+  return(block);
+}
+
+static void __block_free (raleighsl_block_t *block) {
+  z_memory_free(z_global_memory(), block);
+}
+
+static int __block_compare (void *udata, const void *a, const void *b) {
+  const raleighsl_block_t *ba = __block_from_dirty_node(a);
+  const raleighsl_block_t *bb = __block_from_dirty_node(b);
+  return(z_cmp(ba->cache_entry.oid, bb->cache_entry.oid));
+}
+
+/* The dirty blocks are owned by the cache */
+static const z_tree_info_t __block_dirty_tree_info = {
+  .plug         = &z_tree_avl,
+  .node_compare = __block_compare,
+  .key_compare  = __block_compare,
+  .node_free    = NULL,
 };
+
+/* ============================================================================
+ *  PRIVATE Block-Cache methods
+ */
+static void __blkcache_entry_free (void *udata, void *entry) {
+  __block_free(__block_from_cache_entry(entry));
+}
+
+static unsigned int __blkcache_shard_capacity (uint64_t budget) {
+  uint64_t capacity;
+  capacity = budget / (RALEIGHSL_BLKCACHE_SHARDS * RALEIGHSL_BLKCACHE_BLOCK_SIZE);
+  return(z_max(capacity, 1));
+}
+
+static raleighsl_errno_t __blkcache_get (raleighsl_t *fs,
+                                         uint64_t offset,
+                                         int read,
+                                         raleighsl_block_t **block)
+{
+  uint64_t blkno = offset / RALEIGHSL_BLKCACHE_BLOCK_SIZE;
+  struct raleighsl_blkcache_shard *shard;
+  raleighsl_block_t *blk;
+  z_cache_entry_t *entry;
+
+  Z_ASSERT((offset % RALEIGHSL_BLKCACHE_BLOCK_SIZE) == 0,
+           "Block offset %"PRIu64" is not aligned", offset);
+
+  shard = __blkcache_shard(fs, blkno);
+  if ((entry = z_cache_lookup(shard->cache, blkno)) != NULL) {
+    *block = __block_from_cache_entry(entry);
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  /* Allocate the new block */
+  blk = __block_alloc(blkno);
+  if (Z_MALLOC_IS_NULL(blk))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  if (read) {
+    raleighsl_errno_t errno;
+    errno = __device_call_required(fs, read, offset, blk->data, blk->length);
+    if (Z_UNLIKELY(errno)) {
+      __block_free(blk);
+      return(errno);
+    }
+  } else {
+    z_memzero(blk->data, blk->length);
+  }
+
+  entry = z_cache_try_insert(shard->cache, &(blk->cache_entry));
+  if (entry != NULL) {
+    /* The block was already inserted */
+    __block_free(blk);
+    blk = __block_from_cache_entry(entry);
+  }
+
+  *block = blk;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * A block marked dirty while is being written is put back
+ * on the dirty tree once the write is done.
+ */
+static int __blkcache_flush_done (struct raleighsl_blkcache_shard *shard,
+                                  raleighsl_block_t *block,
+                                  raleighsl_errno_t errno)
+{
+  int release;
+  z_spin_lock(&(shard->lock));
+  block->flags &= ~__BLOCK_FLUSH;
+  if (Z_UNLIKELY(errno))
+    block->flags |= __BLOCK_DIRTY;
+  if ((release = !(block->flags & __BLOCK_DIRTY)) == 0) {
+    z_tree_node_attach(&__block_dirty_tree_info, &(shard->dirty),
+                       &(block->dirty_node), NULL);
+    shard->ndirty++;
+  }
+  z_spin_unlock(&(shard->lock));
+  return(release);
+}
+
+/* ============================================================================
+ *  PUBLIC Block-Cache methods
+ */
+raleighsl_errno_t raleighsl_blkcache_read (raleighsl_t *fs,
+                                           uint64_t offset,
+                                           raleighsl_block_t **block)
+{
+  return(__blkcache_get(fs, offset, 1, block));
+}
+
+raleighsl_errno_t raleighsl_blkcache_new (raleighsl_t *fs,
+                                          uint64_t offset,
+                                          raleighsl_block_t **block)
+{
+  return(__blkcache_get(fs, offset, 0, block));
+}
+
+void raleighsl_blkcache_dirty (raleighsl_t *fs, raleighsl_block_t *block) {
+  struct raleighsl_blkcache_shard *shard;
+
+  shard = __blkcache_shard(fs, block->cache_entry.oid);
+  z_spin_lock(&(shard->lock));
+  if (!(block->flags & __BLOCK_DIRTY)) {
+    block->flags |= __BLOCK_DIRTY;
+    if (!(block->flags & __BLOCK_FLUSH)) {
+      /* The dirty tree holds a reference until the write-back */
+      z_atomic_inc(&(block->cache_entry.refs));
+      z_tree_node_attach(&__block_dirty_tree_info, &(shard->dirty),
+                         &(block->dirty_node), NULL);
+      shard->ndirty++;
+    }
+  }
+  z_spin_unlock(&(shard->lock));
+}
+
+void raleighsl_blkcache_release (raleighsl_t *fs, raleighsl_block_t *block) {
+  struct raleighsl_blkcache_shard *shard;
+  shard = __blkcache_shard(fs, block->cache_entry.oid);
+  z_cache_release(shard->cache, &(block->cache_entry));
+}
+
+void raleighsl_blkcache_budget (raleighsl_t *fs, uint64_t bytes) {
+  unsigned int capacity;
+  int i;
+
+  fs->blkcache.budget = bytes;
+  capacity = __blkcache_shard_capacity(bytes);
+  for (i = 0; i < RALEIGHSL_BLKCACHE_SHARDS; ++i) {
+    z_cache_reclaim(fs->blkcache.shards[i].cache, capacity);
+  }
+}
+
+/* ============================================================================
+ *  PRIVATE Block-Cache methods
+ */
+int raleighsl_blkcache_alloc (raleighsl_t *fs) {
+  raleighsl_blkcache_t *blkcache = &(fs->blkcache);
+  unsigned int capacity;
+  int i;
+
+  blkcache->budget = RALEIGHSL_BLKCACHE_BUDGET;
+  capacity = __blkcache_shard_capacity(blkcache->budget);
+  for (i = 0; i < RALEIGHSL_BLKCACHE_SHARDS; ++i) {
+    struct raleighsl_blkcache_shard *shard = &(blkcache->shards[i]);
+
+    /* The blocks pinned by a reader or dirty hold a reference, never evicted */
+    shard->cache = z_cache_alloc(Z_CACHE_TINYLFU, capacity,
+                                 __blkcache_entry_free, NULL, fs);
+    if (Z_MALLOC_IS_NULL(shard->cache)) {
+      while (--i >= 0) {
+        z_spin_free(&(blkcache->shards[i].lock));
+        z_cache_free(blkcache->shards[i].cache);
+      }
+      return(1);
+    }
+
+    z_spin_alloc(&(shard->lock));
+    shard->dirty = NULL;
+    shard->ndirty = 0;
+  }
+  return(0);
+}
+
+void raleighsl_blkcache_free (raleighsl_t *fs) {
+  raleighsl_blkcache_t *blkcache = &(fs->blkcache);
+  int i;
+
+  for (i = 0; i < RALEIGHSL_BLKCACHE_SHARDS; ++i) {
+    struct raleighsl_blkcache_shard *shard = &(blkcache->shards[i]);
+    z_tree_node_t *node;
+
+    /* Drop the dirty references, the last sync has written them */
+    while (shard->dirty != NULL) {
+      node = z_tree_node_detach_min(&__block_dirty_tree_info, &(shard->dirty));
+      z_cache_release(shard->cache, &(__block_from_dirty_node(node)->cache_entry));
+    }
+
+    z_spin_free(&(shard->lock));
+    z_cache_free(shard->cache);
+  }
+}
+
+/*
+ * The dirty blocks of all the shards are collected in a single tree
+ * and written back in block order, the caller syncs the device.
+ */
+raleighsl_errno_t raleighsl_blkcache_flush (raleighsl_t *fs) {
+  raleighsl_blkcache_t *blkcache = &(fs->blkcache);
+  raleighsl_errno_t errno = RALEIGHSL_ERRNO_NONE;
+  z_tree_node_t *flush = NULL;
+  z_tree_node_t *node;
+  int i;
+
+  for (i = 0; i < RALEIGHSL_BLKCACHE_SHARDS; ++i) {
+    struct raleighsl_blkcache_shard *shard = &(blkcache->shards[i]);
+
+    z_spin_lock(&(shard->lock));
+    while (shard->dirty != NULL) {
+      raleighsl_block_t *block;
+      node = z_tree_node_detach_min(&__block_dirty_tree_info, &(shard->dirty));
+      block = __block_from_dirty_node(node);
+      block->flags = (block->flags & ~__BLOCK_DIRTY) | __BLOCK_FLUSH;
+      z_tree_node_attach(&__block_dirty_tree_info, &flush, node, NULL);
+    }
+    shard->ndirty = 0;
+    z_spin_unlock(&(shard->lock));
+  }
+
+  while (flush != NULL) {
+    struct raleighsl_blkcache_shard *shard;
+    raleighsl_block_t *block;
+
+    node = z_tree_node_detach_min(&__block_dirty_tree_info, &flush);
+    block = __block_from_dirty_node(node);
+
+    if (!errno) {
+      errno = __device_call_required(fs, write, raleighsl_block_offset(block),
+                                     block->data, block->length);
+    }
+
+    shard = __blkcache_shard(fs, block->cache_entry.oid);
+    if (__blkcache_flush_done(shard, block, errno))
+      z_cache_release(shard->cache, &(block->cache_entry));
+  }
+
+  return(errno);
+}
@@ -0,0 +1,46 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _RALEIGHSL_BLKCACHE_H_
+#define _RALEIGHSL_BLKCACHE_H_
+
+#include <raleighsl/types.h>
+
+#define RALEIGHSL_BLKCACHE_BLOCK_SIZE     (4 << 10)
+#define RALEIGHSL_BLKCACHE_BUDGET         (64 << 20)
+
+/*
+ * Device blocks are cached by block number and spread over the shards,
+ * each shard is a W-TinyLFU cache so a scan does not push out the hot blocks.
+ * The returned block is pinned until raleighsl_blkcache_release().
+ * Dirty blocks stay pinned until the next checkpoint writes them back.
+ */
+raleighsl_errno_t raleighsl_blkcache_read    (raleighsl_t *fs,
+                                              uint64_t offset,
+                                              raleighsl_block_t **block);
+raleighsl_errno_t raleighsl_blkcache_new     (raleighsl_t *fs,
+                                              uint64_t offset,
+                                              raleighsl_block_t **block);
+void              raleighsl_blkcache_dirty   (raleighsl_t *fs,
+                                              raleighsl_block_t *block);
+void              raleighsl_blkcache_release (raleighsl_t *fs,
+                                              raleighsl_block_t *block);
+
+void              raleighsl_blkcache_budget  (raleighsl_t *fs,
+                                              uint64_t bytes);
+
+#define raleighsl_block_offset(block)                                       \
+  ((block)->cache_entry.oid * RALEIGHSL_BLKCACHE_BLOCK_SIZE)
+
+#endif /* !_RALEIGHSL_BLKCACHE_H_ */
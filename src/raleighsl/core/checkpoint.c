@@ -0,0 +1,967 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/threading.h>
+#include <zcl/checksum.h>
+#include <zcl/string.h>
+#include <zcl/tree.h>
+#include <zcl/global.h>
+#include <zcl/debug.h>
+
+#include <raleighsl/checkpoint.h>
+#include <raleighsl/journal.h>
+#include <raleighsl/object.h>
+#include <raleighsl/exec.h>
+
+#include <string.h>
+
+#include "private.h"
+
+#define __CHECKPOINT_MAGIC              (0x54504b43)
+#define __CHECKPOINT_BUFFER_SIZE        (1 << 20)
+#define __CHECKPOINT_SLOT_ALIGN         (64 << 10)
+#define __CHECKPOINT_LABEL_SIZE         (16)
+
+/*
+ * The two heads are written alternately, each one describes the checkpoint
+ * stored in its slot. A head is written only once the object extents and
+ * the object table are on disk, the valid head with the highest generation
+ * is the one loaded on open.
+ */
+struct checkpoint_head {
+  uint32_t crc;                           /* crc32c of the head */
+  uint32_t magic;                         /* Checkpoint head magic */
+  uint64_t generation;                    /* Checkpoint generation */
+  uint64_t area_offset;                   /* Device offset of the slots */
+  uint64_t slot_size;                     /* Device size of each slot */
+  uint64_t journal_base_lsn;              /* LSN stored at the log offset */
+  uint64_t journal_lsn;                   /* Journal replay starts here */
+  uint64_t next_oid;                      /* Next Object-ID */
+  uint64_t table_offset;                  /* Device offset of the table */
+  uint64_t nobjects;                      /* Object table entries */
+  uint64_t space_offset;                  /* Device offset of the space map */
+  uint64_t space_length;                  /* Space map length */
+  uint32_t table_crc;                     /* crc32c of the object table */
+  uint32_t slot;                          /* Slot of this checkpoint */
+} __attribute__((__packed__));
+
+struct checkpoint_entry {
+  uint64_t oid;                           /* Object-Id */
+  uint64_t lsn;                           /* Journal LSN at sync time */
+  uint64_t offset;                        /* Device offset of the extent */
+  uint64_t length;                        /* Extent length */
+  uint8_t  label[__CHECKPOINT_LABEL_SIZE];/* Object plugin label */
+} __attribute__((__packed__));
+
+/*
+ * Every live object has an entry with the extent of the last checkpoint,
+ * so a clean object evicted by the cache is loaded again from there.
+ */
+struct checkpoint_object {
+  z_tree_node_t __node__;
+  uint64_t oid;                           /* Object-Id */
+  const raleighsl_object_plug_t *plug;    /* Object plugin */
+  uint64_t lsn;                           /* Journal LSN at sync time */
+  uint64_t offset;                        /* Device offset of the extent */
+  uint64_t length;                        /* Extent length */
+};
+
+struct checkpoint_run {
+  raleighsl_t *fs;
+
+  raleighsl_object_t **objects;           /* Live objects snapshot */
+  size_t nobjects;
+  size_t next;                            /* Next object to sync */
+
+  struct checkpoint_entry *table;         /* Synced objects */
+  raleighsl_object_t **synced;            /* Object of each table entry */
+  size_t nentries;
+
+  uint64_t start_lsn;                     /* Journal LSN at the start */
+  uint64_t offset;                        /* Device offset of the buffer */
+  uint64_t limit;                         /* Device end of the slot */
+  uint8_t *buffer;                        /* Extent write buffer */
+  size_t   size;
+  int      slot;
+};
+
+#define __checkpoint_head_crc(head)                                         \
+  z_csum32_crcc(0, &((head)->magic), sizeof(struct checkpoint_head) - 4)
+
+#define __checkpoint_run_position(run)                                      \
+  ((run)->offset + (run)->size)
+
+/* ============================================================================
+ *  PRIVATE Checkpoint helpers
+ */
+/*
+ * Without a space allocator the slots take the whole area after the journal,
+ * otherwise they take half of it and the rest is left to the allocator.
+ */
+static raleighsl_errno_t __checkpoint_geometry (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  uint64_t capacity = 0;
+  raleighsl_errno_t errno;
+  uint64_t offset, size;
+
+  if (__device_has_method(fs, used) && __device_has_method(fs, free))
+    capacity = __device_call(fs, used) + __device_call(fs, free);
+
+  checkpoint->area_offset = RALEIGHSL_CHECKPOINT_OFFSET;
+  checkpoint->slot_size = 0;
+  if (capacity <= checkpoint->area_offset)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if (!__plug_has_method(fs, space, allocate)) {
+    checkpoint->slot_size = z_align_down((capacity - checkpoint->area_offset) >> 1,
+                                         __CHECKPOINT_SLOT_ALIGN);
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  checkpoint->slot_size = z_align_down((capacity - checkpoint->area_offset) >> 2,
+                                       __CHECKPOINT_SLOT_ALIGN);
+  if (checkpoint->slot_size == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if ((errno = __space_call(fs, allocate, 2 * checkpoint->slot_size, &offset, &size))) {
+    checkpoint->slot_size = 0;
+    return(errno);
+  }
+
+  if (Z_UNLIKELY(size < 2 * checkpoint->slot_size)) {
+    __space_call_unrequired(fs, available, offset, size);
+    checkpoint->slot_size = 0;
+    return(RALEIGHSL_ERRNO_DEVICE_NO_SPACE);
+  }
+
+  checkpoint->area_offset = offset;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static int __checkpoint_object_compare (void *udata, const void *a, const void *b) {
+  const struct checkpoint_object *ea = z_container_of(a, const struct checkpoint_object, __node__);
+  const struct checkpoint_object *eb = z_container_of(b, const struct checkpoint_object, __node__);
+  return(z_cmp(ea->oid, eb->oid));
+}
+
+static int __checkpoint_object_key_compare (void *udata, const void *a, const void *key) {
+  const struct checkpoint_object *ea = z_container_of(a, const struct checkpoint_object, __node__);
+  return(z_cmp(ea->oid, *((const uint64_t *)key)));
+}
+
+static void __checkpoint_object_free (void *udata, void *obj) {
+  struct checkpoint_object *entry = z_container_of(obj, struct checkpoint_object, __node__);
+  z_memory_struct_free(z_global_memory(), struct checkpoint_object, entry);
+}
+
+static const z_tree_info_t __checkpoint_object_tree_info = {
+  .plug         = &z_tree_avl,
+  .node_compare = __checkpoint_object_compare,
+  .key_compare  = __checkpoint_object_key_compare,
+  .node_free    = __checkpoint_object_free,
+};
+
+#define __checkpoint_object_lookup(checkpoint, oid)                         \
+  ((struct checkpoint_object *)                                             \
+    z_tree_node_lookup((checkpoint)->objects,                               \
+                       __checkpoint_object_key_compare, &(oid), NULL))
+
+static int __checkpoint_is_registered (raleighsl_t *fs, raleighsl_object_t *object) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  uint64_t oid = raleighsl_oid(object);
+  int is_registered;
+  z_spin_lock(&(checkpoint->lock));
+  is_registered = (__checkpoint_object_lookup(checkpoint, oid) != NULL);
+  z_spin_unlock(&(checkpoint->lock));
+  return(is_registered);
+}
+
+/* ============================================================================
+ *  PRIVATE Checkpoint Run methods
+ */
+static raleighsl_errno_t __checkpoint_run_flush (struct checkpoint_run *run) {
+  raleighsl_errno_t errno = RALEIGHSL_ERRNO_NONE;
+  if (run->size > 0) {
+    errno = __device_call_required(run->fs, write, run->offset, run->buffer, run->size);
+    run->offset += run->size;
+    run->size = 0;
+  }
+  return(errno);
+}
+
+static raleighsl_errno_t __checkpoint_run_append (struct checkpoint_run *run,
+                                                  const void *data,
+                                                  size_t size)
+{
+  const uint8_t *p = (const uint8_t *)data;
+  raleighsl_errno_t errno;
+
+  if (Z_UNLIKELY(__checkpoint_run_position(run) + size > run->limit))
+    return(RALEIGHSL_ERRNO_DEVICE_NO_SPACE);
+
+  while (size > 0) {
+    size_t n = z_min(size, __CHECKPOINT_BUFFER_SIZE - run->size);
+    z_memcpy(run->buffer + run->size, p, n);
+    run->size += n;
+    size -= n;
+    p += n;
+
+    if (run->size == __CHECKPOINT_BUFFER_SIZE) {
+      if ((errno = __checkpoint_run_flush(run)))
+        return(errno);
+    }
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static void __checkpoint_run_free (struct checkpoint_run *run);
+
+static struct checkpoint_run *__checkpoint_run_alloc (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  z_memory_t *memory = z_global_memory();
+  struct checkpoint_run *run;
+  const z_tree_node_t *node;
+  z_tree_iter_t iter;
+  size_t i, count;
+
+  run = z_memory_struct_alloc(memory, struct checkpoint_run);
+  if (Z_MALLOC_IS_NULL(run))
+    return(NULL);
+
+  z_memzero(run, sizeof(struct checkpoint_run));
+  run->fs = fs;
+  run->buffer = z_memory_alloc(memory, uint8_t, __CHECKPOINT_BUFFER_SIZE);
+  if (Z_MALLOC_IS_NULL(run->buffer)) {
+    z_memory_struct_free(memory, struct checkpoint_run, run);
+    return(NULL);
+  }
+
+  /* Objects registered after the start lsn have their create logged */
+  run->start_lsn = raleighsl_journal_lsn(fs);
+
+  /* The oids are taken under the lock, the table holds them meanwhile */
+  z_spin_lock(&(checkpoint->lock));
+  count = z_max(1, checkpoint->nobjects);
+  run->objects = z_memory_alloc(memory, raleighsl_object_t *,
+                                count * sizeof(raleighsl_object_t *));
+  run->synced = z_memory_alloc(memory, raleighsl_object_t *,
+                               count * sizeof(raleighsl_object_t *));
+  run->table = z_memory_alloc(memory, struct checkpoint_entry,
+                              count * sizeof(struct checkpoint_entry));
+  count = 0;
+  if (run->objects != NULL && run->synced != NULL && run->table != NULL) {
+    z_tree_iter_open(&iter, checkpoint->objects);
+    node = z_tree_iter_begin(&iter);
+    while (node != NULL) {
+      run->table[count++].oid = z_container_of(node, const struct checkpoint_object, __node__)->oid;
+      node = z_tree_iter_next(&iter);
+    }
+    z_tree_iter_close(&iter);
+  }
+  z_spin_unlock(&(checkpoint->lock));
+
+  if (Z_MALLOC_IS_NULL(run->objects) || Z_MALLOC_IS_NULL(run->synced) ||
+      Z_MALLOC_IS_NULL(run->table))
+  {
+    __checkpoint_run_free(run);
+    return(NULL);
+  }
+
+  /* The snapshot keeps a reference until the run is done, the evicted ones are loaded again */
+  for (i = 0; i < count; ++i) {
+    run->objects[i] = raleighsl_obj_cache_get(fs, run->table[i].oid);
+    if (Z_MALLOC_IS_NULL(run->objects[i])) {
+      __checkpoint_run_free(run);
+      return(NULL);
+    }
+    run->nobjects++;
+  }
+
+  run->slot = (checkpoint->generation > 0) ? (checkpoint->slot ^ 1) : 0;
+  run->offset = checkpoint->area_offset + run->slot * checkpoint->slot_size;
+  run->limit = run->offset + checkpoint->slot_size;
+  return(run);
+}
+
+static void __checkpoint_run_free (struct checkpoint_run *run) {
+  z_memory_t *memory = z_global_memory();
+  size_t i;
+  for (i = 0; i < run->nobjects; ++i) {
+    raleighsl_obj_cache_release(run->fs, run->objects[i]);
+  }
+  z_memory_free(memory, run->objects);
+  z_memory_free(memory, run->synced);
+  z_memory_free(memory, run->table);
+  z_memory_free(memory, run->buffer);
+  z_memory_struct_free(memory, struct checkpoint_run, run);
+}
+
+/*
+ * The new extents replace the old ones, the synced objects are clean up to
+ * their entry lsn and the journal drops its reference, unless they were
+ * written again meanwhile. The read-ahead may hold data of the reused slot.
+ */
+static void __checkpoint_run_publish (struct checkpoint_run *run) {
+  raleighsl_checkpoint_t *checkpoint = &(run->fs->checkpoint);
+  struct checkpoint_object *entry;
+  size_t i;
+
+  z_mutex_lock(&(checkpoint->rlock));
+  checkpoint->rbuf.size = 0;
+  z_mutex_unlock(&(checkpoint->rlock));
+
+  z_spin_lock(&(checkpoint->lock));
+  for (i = 0; i < run->nentries; ++i) {
+    const struct checkpoint_entry *item = &(run->table[i]);
+    if ((entry = __checkpoint_object_lookup(checkpoint, item->oid)) != NULL) {
+      entry->lsn = item->lsn;
+      entry->offset = item->offset;
+      entry->length = item->length;
+    }
+  }
+  z_spin_unlock(&(checkpoint->lock));
+
+  for (i = 0; i < run->nentries; ++i) {
+    raleighsl_journal_remove(run->fs, run->synced[i], run->table[i].lsn);
+  }
+}
+
+/*
+ * The object extents are on disk, write back the dirty cached blocks,
+ * the object table and then the head.
+ * Once the head is durable the journal before the start lsn is released.
+ */
+static raleighsl_errno_t __checkpoint_run_commit (struct checkpoint_run *run) {
+  raleighsl_checkpoint_t *checkpoint = &(run->fs->checkpoint);
+  raleighsl_journal_t *journal = &(run->fs->journal);
+  raleighsl_t *fs = run->fs;
+  struct checkpoint_head *head;
+  raleighsl_errno_t errno;
+  uint64_t space_offset;
+  uint64_t table_offset;
+  size_t table_size;
+
+  if ((errno = raleighsl_blkcache_flush(fs)))
+    return(errno);
+
+  space_offset = __checkpoint_run_position(run);
+  if ((errno = __space_call_unrequired(fs, sync)))
+    return(errno);
+
+  table_offset = __checkpoint_run_position(run);
+  table_size = run->nentries * sizeof(struct checkpoint_entry);
+  if ((errno = __checkpoint_run_append(run, run->table, table_size)))
+    return(errno);
+
+  if ((errno = __checkpoint_run_flush(run)))
+    return(errno);
+
+  if ((errno = __device_call_required(fs, sync)))
+    return(errno);
+
+  head = (struct checkpoint_head *)run->buffer;
+  z_memzero(run->buffer, RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+  head->magic = __CHECKPOINT_MAGIC;
+  head->generation = checkpoint->generation + 1;
+  head->area_offset = checkpoint->area_offset;
+  head->slot_size = checkpoint->slot_size;
+  head->journal_base_lsn = journal->base_lsn;
+  head->journal_lsn = run->start_lsn;
+  head->next_oid = fs->semantic.next_oid;
+  head->table_offset = table_offset;
+  head->nobjects = run->nentries;
+  head->space_offset = space_offset;
+  head->space_length = table_offset - space_offset;
+  head->table_crc = z_csum32_crcc(0, run->table, table_size);
+  head->slot = run->slot;
+  head->crc = __checkpoint_head_crc(head);
+
+  errno = __device_call_required(fs, write,
+                                 RALEIGHSL_CHECKPOINT_HEAD_OFFSET +
+                                 run->slot * RALEIGHSL_CHECKPOINT_HEAD_SIZE,
+                                 run->buffer, RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+  if (!errno) errno = __device_call_required(fs, sync);
+  if (Z_UNLIKELY(errno))
+    return(errno);
+
+  checkpoint->generation = head->generation;
+  checkpoint->journal_lsn = run->start_lsn;
+  checkpoint->slot = run->slot;
+
+  /* The format points to the new head before the journal is released */
+  if ((errno = __format_call_unrequired(fs, sync)))
+    return(errno);
+
+  z_spin_lock(&(journal->wlock));
+  journal->tail_lsn = run->start_lsn;
+  z_spin_unlock(&(journal->wlock));
+
+  __checkpoint_run_publish(run);
+
+  Z_LOG_INFO("checkpoint %"PRIu64": %zu objects, %"PRIu64" bytes, journal from lsn %"PRIu64,
+             checkpoint->generation, run->nentries,
+             __checkpoint_run_position(run) - (checkpoint->area_offset +
+                                               run->slot * checkpoint->slot_size),
+             run->start_lsn);
+
+  /* The extents released before the space sync can be reused */
+  return(__space_call_unrequired(fs, commit));
+}
+
+static void __checkpoint_run_done (struct checkpoint_run *run, raleighsl_errno_t errno) {
+  raleighsl_checkpoint_t *checkpoint = &(run->fs->checkpoint);
+  raleighsl_t *fs = run->fs;
+
+  if (Z_UNLIKELY(errno)) {
+    Z_LOG_ERROR("checkpoint failed: %s", raleighsl_errno_string(errno));
+  }
+
+  checkpoint->run = NULL;
+  __checkpoint_run_free(run);
+
+  /* The flushes waiting for a full journal retry with the new tail */
+  raleighsl_journal_resume(fs, errno);
+
+  z_mutex_lock(&(checkpoint->wlock));
+  checkpoint->is_running = 0;
+  checkpoint->error = errno;
+  z_wait_cond_broadcast(&(checkpoint->wcond));
+  z_mutex_unlock(&(checkpoint->wlock));
+}
+
+/*
+ * Executed by the object scheduler as a read, the commits are held off so
+ * the object state is the committed one. The writers are not stopped and
+ * the sync doesn't wait for the journal.
+ */
+static raleighsl_errno_t __checkpoint_sync_func (raleighsl_t *fs,
+                                                 const raleighsl_transaction_t *transaction,
+                                                 raleighsl_object_t *object,
+                                                 void *udata)
+{
+  struct checkpoint_run *run = (struct checkpoint_run *)udata;
+  struct checkpoint_entry *entry;
+  raleighsl_errno_t errno;
+  size_t label_size;
+
+  /* Unlinked after the snapshot, or not persistent */
+  if (!__checkpoint_is_registered(fs, object) || object->plug->sync == NULL)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  entry = &(run->table[run->nentries]);
+  entry->oid = raleighsl_oid(object);
+  entry->lsn = raleighsl_journal_lsn(fs);
+  entry->offset = __checkpoint_run_position(run);
+
+  label_size = z_min(z_strlen(object->plug->info.label), __CHECKPOINT_LABEL_SIZE);
+  z_memzero(entry->label, __CHECKPOINT_LABEL_SIZE);
+  z_memcpy(entry->label, object->plug->info.label, label_size);
+
+  if ((errno = raleighsl_object_sync(fs, object)))
+    return(errno);
+
+  entry->length = __checkpoint_run_position(run) - entry->offset;
+  run->synced[run->nentries++] = object;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static void __checkpoint_run_next (struct checkpoint_run *run);
+
+static void __checkpoint_notify_func (raleighsl_t *fs,
+                                      uint64_t oid, raleighsl_errno_t errno,
+                                      void *udata, void *err_data)
+{
+  struct checkpoint_run *run = (struct checkpoint_run *)udata;
+
+  run->next++;
+  if (Z_UNLIKELY(errno)) {
+    Z_LOG_ERROR("checkpoint of object %"PRIu64" failed: %s",
+                oid, raleighsl_errno_string(errno));
+    __checkpoint_run_done(run, errno);
+    return;
+  }
+
+  __checkpoint_run_next(run);
+}
+
+/*
+ * Objects are synced one at a time, each one through the object scheduler,
+ * the extents are streamed one after the other in the slot.
+ */
+static void __checkpoint_run_next (struct checkpoint_run *run) {
+  if (run->next < run->nobjects) {
+    raleighsl_object_t *object = run->objects[run->next];
+    if (raleighsl_exec_read(run->fs, 0, raleighsl_oid(object),
+                            __checkpoint_sync_func, __checkpoint_notify_func,
+                            run, NULL))
+    {
+      __checkpoint_run_done(run, RALEIGHSL_ERRNO_NO_MEMORY);
+    }
+    return;
+  }
+
+  __checkpoint_run_done(run, __checkpoint_run_commit(run));
+}
+
+/* ============================================================================
+ *  PRIVATE Checkpoint Load helpers
+ */
+/*
+ * Sequential read of an extent of the loaded checkpoint.
+ * The extents of a checkpoint are contiguous, so a large read-ahead
+ * buffer is shared by all the objects loaded. Once the load is done
+ * there's no limit and an object reloaded reads just its own extent.
+ */
+static raleighsl_errno_t __checkpoint_read (raleighsl_t *fs,
+                                            uint64_t *ckpt_offset,
+                                            uint64_t *ckpt_length,
+                                            void *buffer,
+                                            size_t size)
+{
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  uint8_t *p = (uint8_t *)buffer;
+  raleighsl_errno_t errno;
+
+  if (Z_UNLIKELY(size > *ckpt_length))
+    return(RALEIGHSL_ERRNO_DEVICE_CORRUPTED);
+
+  z_mutex_lock(&(checkpoint->rlock));
+  while (size > 0) {
+    uint64_t offset = *ckpt_offset;
+    size_t n;
+
+    if (offset < checkpoint->rbuf.offset ||
+        offset >= checkpoint->rbuf.offset + checkpoint->rbuf.size)
+    {
+      if (checkpoint->rbuf.data == NULL) {
+        checkpoint->rbuf.data = z_memory_alloc(z_global_memory(), uint8_t,
+                                               __CHECKPOINT_BUFFER_SIZE);
+        if (Z_MALLOC_IS_NULL(checkpoint->rbuf.data)) {
+          z_mutex_unlock(&(checkpoint->rlock));
+          return(RALEIGHSL_ERRNO_NO_MEMORY);
+        }
+      }
+
+      n = (checkpoint->rbuf.limit > offset) ? checkpoint->rbuf.limit - offset : *ckpt_length;
+      n = z_min(__CHECKPOINT_BUFFER_SIZE, n);
+      checkpoint->rbuf.size = 0;
+      if ((errno = __device_call_required(fs, read, offset, checkpoint->rbuf.data, n))) {
+        z_mutex_unlock(&(checkpoint->rlock));
+        return(errno);
+      }
+      checkpoint->rbuf.offset = offset;
+      checkpoint->rbuf.size = n;
+    }
+
+    n = z_min(size, checkpoint->rbuf.offset + checkpoint->rbuf.size - offset);
+    z_memcpy(p, checkpoint->rbuf.data + (offset - checkpoint->rbuf.offset), n);
+    *ckpt_offset += n;
+    *ckpt_length -= n;
+    size -= n;
+    p += n;
+  }
+  z_mutex_unlock(&(checkpoint->rlock));
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* ============================================================================
+ *  PUBLIC Checkpoint methods
+ */
+raleighsl_errno_t raleighsl_checkpoint_write (raleighsl_t *fs,
+                                              const struct iovec *iov,
+                                              int iovcnt)
+{
+  struct checkpoint_run *run = (struct checkpoint_run *)fs->checkpoint.run;
+  raleighsl_errno_t errno;
+  int i;
+
+  for (i = 0; i < iovcnt; ++i) {
+    if ((errno = __checkpoint_run_append(run, iov[i].iov_base, iov[i].iov_len)))
+      return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+raleighsl_errno_t raleighsl_checkpoint_read (raleighsl_t *fs,
+                                             raleighsl_object_t *object,
+                                             void *buffer,
+                                             size_t size)
+{
+  return(__checkpoint_read(fs, &(object->ckpt_offset), &(object->ckpt_length),
+                           buffer, size));
+}
+
+uint64_t raleighsl_checkpoint_space_size (raleighsl_t *fs) {
+  return(fs->checkpoint.space.length);
+}
+
+raleighsl_errno_t raleighsl_checkpoint_space_read (raleighsl_t *fs,
+                                                   void *buffer,
+                                                   size_t size)
+{
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  return(__checkpoint_read(fs, &(checkpoint->space.offset), &(checkpoint->space.length),
+                           buffer, size));
+}
+
+/*
+ * Start a checkpoint in background, nothing is done if one is running.
+ */
+raleighsl_errno_t raleighsl_checkpoint_start (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  struct checkpoint_run *run;
+
+  if (fs->device == NULL || checkpoint->slot_size == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  z_mutex_lock(&(checkpoint->wlock));
+  if (checkpoint->is_running) {
+    z_mutex_unlock(&(checkpoint->wlock));
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+  checkpoint->is_running = 1;
+  z_mutex_unlock(&(checkpoint->wlock));
+
+  if ((run = __checkpoint_run_alloc(fs)) == NULL) {
+    z_mutex_lock(&(checkpoint->wlock));
+    checkpoint->is_running = 0;
+    checkpoint->error = RALEIGHSL_ERRNO_NO_MEMORY;
+    z_wait_cond_broadcast(&(checkpoint->wcond));
+    z_mutex_unlock(&(checkpoint->wlock));
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  }
+
+  Z_LOG_DEBUG("checkpoint of %zu objects from lsn %"PRIu64" to slot %d",
+              run->nobjects, run->start_lsn, run->slot);
+  checkpoint->run = run;
+  __checkpoint_run_next(run);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Run a full checkpoint and wait for it.
+ * Must not be called from a task, the objects are synced by the workers.
+ */
+raleighsl_errno_t raleighsl_checkpoint_sync (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  raleighsl_errno_t errno;
+
+  if (fs->device == NULL || checkpoint->slot_size == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  /* Wait for the one in progress, it may miss the latest updates */
+  z_mutex_lock(&(checkpoint->wlock));
+  while (checkpoint->is_running) {
+    z_wait_cond_wait(&(checkpoint->wcond), &(checkpoint->wlock), 0);
+  }
+  z_mutex_unlock(&(checkpoint->wlock));
+
+  if ((errno = raleighsl_checkpoint_start(fs)))
+    return(errno);
+
+  z_mutex_lock(&(checkpoint->wlock));
+  while (checkpoint->is_running) {
+    z_wait_cond_wait(&(checkpoint->wcond), &(checkpoint->wlock), 0);
+  }
+  errno = checkpoint->error;
+  z_mutex_unlock(&(checkpoint->wlock));
+  return(errno);
+}
+
+/* ============================================================================
+ *  PRIVATE Checkpoint methods
+ */
+int raleighsl_checkpoint_alloc (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  z_spin_alloc(&(checkpoint->lock));
+  checkpoint->objects = NULL;
+  checkpoint->nobjects = 0;
+
+  z_mutex_alloc(&(checkpoint->wlock));
+  z_wait_cond_alloc(&(checkpoint->wcond));
+  checkpoint->is_running = 0;
+  checkpoint->error = RALEIGHSL_ERRNO_NONE;
+  checkpoint->run = NULL;
+
+  checkpoint->area_offset = RALEIGHSL_CHECKPOINT_OFFSET;
+  checkpoint->slot_size = 0;
+  checkpoint->generation = 0;
+  checkpoint->journal_lsn = 0;
+  checkpoint->slot = 0;
+  z_mutex_alloc(&(checkpoint->rlock));
+  z_memzero(&(checkpoint->rbuf), sizeof(checkpoint->rbuf));
+  checkpoint->space.offset = 0;
+  checkpoint->space.length = 0;
+  return(0);
+}
+
+void raleighsl_checkpoint_free (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+
+  z_tree_node_clear(&__checkpoint_object_tree_info, checkpoint->objects, NULL);
+  checkpoint->objects = NULL;
+  checkpoint->nobjects = 0;
+
+  z_memory_free(z_global_memory(), checkpoint->rbuf.data);
+  z_mutex_free(&(checkpoint->rlock));
+  z_wait_cond_free(&(checkpoint->wcond));
+  z_mutex_free(&(checkpoint->wlock));
+  z_spin_free(&(checkpoint->lock));
+}
+
+/*
+ * The registered objects are the ones written by a checkpoint, the entry
+ * takes the plugin and the extent the object was loaded from, if any.
+ * The cache is free to evict them once the journal has no dirty records.
+ */
+raleighsl_errno_t raleighsl_checkpoint_add (raleighsl_t *fs, raleighsl_object_t *object) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  struct checkpoint_object *entry;
+
+  entry = z_memory_struct_alloc(z_global_memory(), struct checkpoint_object);
+  if (Z_MALLOC_IS_NULL(entry))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  entry->oid = raleighsl_oid(object);
+  entry->plug = object->plug;
+  entry->lsn = object->ckpt_lsn;
+  entry->offset = object->ckpt_offset;
+  entry->length = object->ckpt_length;
+
+  z_spin_lock(&(checkpoint->lock));
+  if (z_tree_node_attach(&__checkpoint_object_tree_info, &(checkpoint->objects),
+                         &(entry->__node__), NULL))
+  {
+    /* Already registered */
+    z_spin_unlock(&(checkpoint->lock));
+    __checkpoint_object_free(NULL, &(entry->__node__));
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+  checkpoint->nobjects++;
+  z_spin_unlock(&(checkpoint->lock));
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+void raleighsl_checkpoint_remove (raleighsl_t *fs, raleighsl_object_t *object) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  uint64_t oid = raleighsl_oid(object);
+  z_tree_node_t *node;
+
+  z_spin_lock(&(checkpoint->lock));
+  node = z_tree_node_detach(&__checkpoint_object_tree_info, &(checkpoint->objects), &oid, NULL);
+  if (node != NULL)
+    checkpoint->nobjects--;
+  z_spin_unlock(&(checkpoint->lock));
+
+  if (node != NULL)
+    __checkpoint_object_free(NULL, node);
+}
+
+/*
+ * An object not in the cache takes the plugin and the last checkpoint
+ * extent of its entry, the open loads it from there.
+ */
+void raleighsl_checkpoint_lookup (raleighsl_t *fs, raleighsl_object_t *object) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  uint64_t oid = raleighsl_oid(object);
+  struct checkpoint_object *entry;
+
+  z_spin_lock(&(checkpoint->lock));
+  if ((entry = __checkpoint_object_lookup(checkpoint, oid)) != NULL) {
+    object->plug = entry->plug;
+    object->ckpt_lsn = entry->lsn;
+    object->ckpt_offset = entry->offset;
+    object->ckpt_length = entry->length;
+  }
+  z_spin_unlock(&(checkpoint->lock));
+}
+
+/*
+ * A new file-system drops the heads left on the device,
+ * the first checkpoint goes to the first slot.
+ */
+raleighsl_errno_t raleighsl_checkpoint_create (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  raleighsl_errno_t errno;
+  uint8_t *heads;
+
+  checkpoint->generation = 0;
+  checkpoint->journal_lsn = 0;
+  checkpoint->slot = 0;
+  if (fs->device == NULL)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if ((errno = __checkpoint_geometry(fs)))
+    return(errno);
+
+  heads = z_memory_alloc(z_global_memory(), uint8_t, 2 * RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+  if (Z_MALLOC_IS_NULL(heads))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  z_memzero(heads, 2 * RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+  errno = __device_call_required(fs, write, RALEIGHSL_CHECKPOINT_HEAD_OFFSET,
+                                 heads, 2 * RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+  z_memory_free(z_global_memory(), heads);
+  return(errno);
+}
+
+static raleighsl_errno_t __checkpoint_load_object (raleighsl_t *fs,
+                                                   const struct checkpoint_entry *entry)
+{
+  const raleighsl_object_plug_t *plug;
+  raleighsl_object_t *object;
+  raleighsl_errno_t errno;
+  z_byte_slice_t label;
+
+  z_byte_slice_set(&label, entry->label,
+                   strnlen((const char *)entry->label, __CHECKPOINT_LABEL_SIZE));
+  plug = RALEIGHSL_OBJECT_PLUG(__plugin_lookup_by_label(fs, &label));
+  if (Z_UNLIKELY(plug == NULL || plug->info.type != RALEIGHSL_PLUG_TYPE_OBJECT)) {
+    Z_LOG_WARN("checkpoint object %"PRIu64" has no plugin", entry->oid);
+    return(RALEIGHSL_ERRNO_PLUGIN_NOT_LOADED);
+  }
+
+  if ((object = raleighsl_obj_cache_get(fs, entry->oid)) == NULL)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  object->plug = plug;
+  object->ckpt_lsn = entry->lsn;
+  object->ckpt_offset = entry->offset;
+  object->ckpt_length = entry->length;
+  if ((errno = raleighsl_checkpoint_add(fs, object))) {
+    raleighsl_obj_cache_release(fs, object);
+    return(errno);
+  }
+
+  if ((errno = raleighsl_object_open(fs, object))) {
+    Z_LOG_ERROR("checkpoint load of object %"PRIu64" failed: %s",
+                entry->oid, raleighsl_errno_string(errno));
+    raleighsl_obj_cache_release(fs, object);
+    return(errno);
+  }
+
+  /* Clean until the journal replay, the cache can evict it */
+  raleighsl_obj_cache_release(fs, object);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Load the objects of the latest checkpoint, the journal is replayed
+ * on top of them starting from the checkpoint lsn.
+ * The space allocator is loaded from the checkpoint too.
+ * A head older than the one recorded by the format means a lost checkpoint.
+ */
+raleighsl_errno_t raleighsl_checkpoint_load (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  const struct checkpoint_head *head = NULL;
+  struct checkpoint_entry *table = NULL;
+  z_memory_t *memory = z_global_memory();
+  raleighsl_errno_t errno;
+  size_t table_size;
+  uint8_t *heads;
+  uint64_t i;
+
+  checkpoint->generation = 0;
+  checkpoint->journal_lsn = 0;
+  checkpoint->slot = 0;
+  checkpoint->space.offset = 0;
+  checkpoint->space.length = 0;
+  if (fs->device == NULL)
+    return(__space_call_unrequired(fs, load));
+
+  heads = z_memory_alloc(memory, uint8_t, 2 * RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+  if (Z_MALLOC_IS_NULL(heads))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  errno = __device_call_required(fs, read, RALEIGHSL_CHECKPOINT_HEAD_OFFSET,
+                                 heads, 2 * RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+  if (Z_UNLIKELY(errno)) {
+    z_memory_free(memory, heads);
+    return(errno);
+  }
+
+  for (i = 0; i < 2; ++i) {
+    const struct checkpoint_head *h;
+    h = (const struct checkpoint_head *)(heads + i * RALEIGHSL_CHECKPOINT_HEAD_SIZE);
+    if (h->magic != __CHECKPOINT_MAGIC || h->crc != __checkpoint_head_crc(h))
+      continue;
+    if (head == NULL || h->generation > head->generation)
+      head = h;
+  }
+
+  if (Z_UNLIKELY((head != NULL ? head->generation : 0) < fs->master.mb_ckpt_generation)) {
+    Z_LOG_ERROR("checkpoint %"PRIu64" recorded by the format is missing",
+                fs->master.mb_ckpt_generation);
+    z_memory_free(memory, heads);
+    return(RALEIGHSL_ERRNO_DEVICE_CORRUPTED);
+  }
+
+  /* Never checkpointed, the whole state is in the journal */
+  if (head == NULL) {
+    z_memory_free(memory, heads);
+    if ((errno = __space_call_unrequired(fs, load)))
+      return(errno);
+    return(__checkpoint_geometry(fs));
+  }
+
+  table_size = head->nobjects * sizeof(struct checkpoint_entry);
+  table = z_memory_alloc(memory, struct checkpoint_entry, z_max(1, table_size));
+  if (Z_MALLOC_IS_NULL(table)) {
+    z_memory_free(memory, heads);
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  }
+
+  errno = __device_call_required(fs, read, head->table_offset, table, table_size);
+  if (!errno && head->table_crc != z_csum32_crcc(0, table, table_size)) {
+    errno = RALEIGHSL_ERRNO_DEVICE_CORRUPTED;
+  }
+
+  checkpoint->rbuf.offset = 0;
+  checkpoint->rbuf.size = 0;
+  checkpoint->rbuf.limit = head->table_offset;
+  for (i = 0; !errno && i < head->nobjects; ++i) {
+    errno = __checkpoint_load_object(fs, &(table[i]));
+  }
+
+  /* The space map is stored after the objects */
+  if (!errno) {
+    checkpoint->space.offset = head->space_offset;
+    checkpoint->space.length = head->space_length;
+    errno = __space_call_unrequired(fs, load);
+  }
+
+  if (!errno) {
+    checkpoint->area_offset = head->area_offset;
+    checkpoint->slot_size = head->slot_size;
+    checkpoint->generation = head->generation;
+    checkpoint->journal_lsn = head->journal_lsn;
+    checkpoint->slot = head->slot;
+
+    fs->semantic.next_oid = z_max(fs->semantic.next_oid, head->next_oid);
+    fs->journal.base_lsn = head->journal_base_lsn;
+    fs->journal.tail_lsn = head->journal_lsn;
+
+    Z_LOG_INFO("checkpoint %"PRIu64": loaded %"PRIu64" objects, journal from lsn %"PRIu64,
+               head->generation, head->nobjects, head->journal_lsn);
+  }
+
+  /* The reloads of the evicted objects read just their extent */
+  z_memory_free(memory, checkpoint->rbuf.data);
+  checkpoint->rbuf.data = NULL;
+  checkpoint->rbuf.size = 0;
+  checkpoint->rbuf.limit = 0;
+  z_memory_free(memory, table);
+  z_memory_free(memory, heads);
+  return(errno);
+}
@@ -0,0 +1,51 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _RALEIGHSL_CHECKPOINT_H_
+#define _RALEIGHSL_CHECKPOINT_H_
+
+#include <raleighsl/journal.h>
+#include <raleighsl/types.h>
+
+#include <sys/uio.h>
+
+#define RALEIGHSL_CHECKPOINT_HEAD_SIZE    (4 << 10)
+#define RALEIGHSL_CHECKPOINT_HEAD_OFFSET  (RALEIGHSL_JOURNAL_OFFSET - 2 * RALEIGHSL_CHECKPOINT_HEAD_SIZE)
+#define RALEIGHSL_CHECKPOINT_OFFSET       (RALEIGHSL_JOURNAL_OFFSET + RALEIGHSL_JOURNAL_SIZE)
+
+/*
+ * Called by the object sync() to stream the committed object state,
+ * and by the object open() to read it back.
+ */
+raleighsl_errno_t raleighsl_checkpoint_write (raleighsl_t *fs,
+                                              const struct iovec *iov,
+                                              int iovcnt);
+raleighsl_errno_t raleighsl_checkpoint_read  (raleighsl_t *fs,
+                                              raleighsl_object_t *object,
+                                              void *buffer,
+                                              size_t size);
+
+/*
+ * The space allocator map is written by the space sync(),
+ * and read back by the space load().
+ */
+uint64_t          raleighsl_checkpoint_space_size (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_checkpoint_space_read (raleighsl_t *fs,
+                                                   void *buffer,
+                                                   size_t size);
+
+raleighsl_errno_t raleighsl_checkpoint_start (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_checkpoint_sync  (raleighsl_t *fs);
+
+#endif /* !_RALEIGHSL_CHECKPOINT_H_ */
@@ -27,6 +27,9 @@
 #define __ERR_NUMBER(x, msg)     __ERR(NUMBER_ ## x, msg)
 #define __ERR_DATA(x, msg)       __ERR(DATA_ ## x, msg)
 #define __ERR_TXN(x, msg)        __ERR(TXN_ ## x, msg)
+#define __ERR_DEVICE(x, msg)     __ERR(DEVICE_ ## x, msg)
+#define __ERR_FORMAT(x, msg)     __ERR(FORMAT_ ## x, msg)
+#define __ERR_SPACE(x, msg)      __ERR(SPACE_ ## x, msg)
 
 const char *raleighsl_errno_byte_slice (raleighsl_errno_t errno,
                                         z_byte_slice_t *slice)
@@ -36,6 +39,7 @@ const char *raleighsl_errno_byte_slice (raleighsl_errno_t errno,
     __ERR(NOT_IMPLEMENTED, "not implmented");
 
     __ERR(SCHED_YIELD, "retry");
+    __ERR(SCHED_WAIT, "wait for the next commit");
 
     /* System related */
     __ERR(NO_MEMORY, "no memory available");
@@ -62,13 +66,22 @@ const char *raleighsl_errno_byte_slice (raleighsl_errno_t errno,
     __ERR_DATA(KEY_EXISTS, "key already exists");
     __ERR_DATA(KEY_NOT_FOUND, "key not found");
     __ERR_DATA(NO_ITEMS, "no items available");
+    __ERR_DATA(OUT_OF_RANGE, "offset out of range");
 
     /* Number related */
     __ERR_NUMBER(DIVMOD_BYZERO, "division or modulo by zero");
 
     /* Device related */
+    __ERR_DEVICE(IO, "device I/O error");
+    __ERR_DEVICE(NO_SPACE, "no space left on device");
+    __ERR_DEVICE(CORRUPTED, "corrupted data on device");
+
     /* Format related */
+    __ERR_FORMAT(NOT_FOUND, "no file-system format on device");
+    __ERR_FORMAT(VERSION, "unsupported file-system format version");
+
     /* Space related */
+    __ERR_SPACE(OUT_OF_RANGE, "extent out of the allocator range");
     /* Key related */
     default:
       __SET_MSG("unknown error");
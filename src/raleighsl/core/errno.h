@@ -22,6 +22,7 @@ typedef enum raleighsl_errno {
   RALEIGHSL_ERRNO_NONE,
   RALEIGHSL_ERRNO_NOT_IMPLEMENTED,
   RALEIGHSL_ERRNO_SCHED_YIELD,
+  RALEIGHSL_ERRNO_SCHED_WAIT,
 
   /* System related */
   RALEIGHSL_ERRNO_NO_MEMORY,
@@ -48,16 +49,23 @@ typedef enum raleighsl_errno {
   RALEIGHSL_ERRNO_DATA_KEY_EXISTS,
   RALEIGHSL_ERRNO_DATA_KEY_NOT_FOUND,
   RALEIGHSL_ERRNO_DATA_NO_ITEMS,
+  RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE,
 
   /* Number related */
   RALEIGHSL_ERRNO_NUMBER_DIVMOD_BYZERO,
   RALEIGHSL_ERRNO_NUMBER_DIVMOD_OVERFLOW,
 
   /* Device related */
+  RALEIGHSL_ERRNO_DEVICE_IO,
+  RALEIGHSL_ERRNO_DEVICE_NO_SPACE,
+  RALEIGHSL_ERRNO_DEVICE_CORRUPTED,
 
   /* Format related */
+  RALEIGHSL_ERRNO_FORMAT_NOT_FOUND,
+  RALEIGHSL_ERRNO_FORMAT_VERSION,
 
   /* Space related */
+  RALEIGHSL_ERRNO_SPACE_OUT_OF_RANGE,
 
   /* Key related */
 } raleighsl_errno_t;
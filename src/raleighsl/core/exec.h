@@ -53,11 +53,30 @@ int raleighsl_exec_lookup (raleighsl_t *fs,
                            raleighsl_lookup_func_t lookup_func,
                            raleighsl_notify_func_t notify_func,
                            void *udata, void *err_data);
+/*
+ * A read_func returning RALEIGHSL_ERRNO_SCHED_WAIT is parked on the object
+ * and called again after the next commit.
+ */
 int raleighsl_exec_read   (raleighsl_t *fs,
                            uint64_t txn_id, uint64_t oid,
                            raleighsl_read_func_t read_func,
                            raleighsl_notify_func_t notify_func,
                            void *udata, void *err_data);
+/*
+ * Reads the last committed version of the object without waiting for the
+ * writers or the pending transactions. The read_func is called without a
+ * transaction, may be called more than once and must only look at the
+ * state that the object changes in apply() and commit().
+ */
+int raleighsl_exec_snapshot (raleighsl_t *fs, uint64_t oid,
+                             raleighsl_read_func_t read_func,
+                             raleighsl_notify_func_t notify_func,
+                             void *udata, void *err_data);
+/*
+ * A write_func returning RALEIGHSL_ERRNO_SCHED_WAIT has parked the request
+ * on the object (e.g. a deque waiter), the object notifies it later on.
+ * The notify_func is called with the errno and must not touch udata.
+ */
 int raleighsl_exec_write  (raleighsl_t *fs,
                            uint64_t txn_id, uint64_t oid,
                            raleighsl_write_func_t write_func,
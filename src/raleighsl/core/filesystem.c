@@ -13,6 +13,7 @@
  */
 
 #include <zcl/global.h>
+#include <zcl/string.h>
 
 #include <raleighsl/raleighsl.h>
 #include "private.h"
@@ -22,6 +23,9 @@ raleighsl_t *raleighsl_alloc (raleighsl_t *fs) {
     return(NULL);
   }
 
+  z_memzero(&(fs->master), sizeof(raleighsl_master_t));
+  fs->affinity = 0;
+
   if (raleighsl_obj_cache_alloc(fs)) {
     __plugin_table_free(fs);
     return(NULL);
@@ -32,8 +36,35 @@ raleighsl_t *raleighsl_alloc (raleighsl_t *fs) {
     return(NULL);
   }
 
+  if (raleighsl_journal_alloc(fs)) {
+    __plugin_table_free(fs);
+    raleighsl_txn_mgr_free(fs);
+    raleighsl_obj_cache_free(fs);
+    return(NULL);
+  }
+
+  if (raleighsl_checkpoint_alloc(fs)) {
+    __plugin_table_free(fs);
+    raleighsl_journal_free(fs);
+    raleighsl_txn_mgr_free(fs);
+    raleighsl_obj_cache_free(fs);
+    return(NULL);
+  }
+
+  if (raleighsl_blkcache_alloc(fs)) {
+    __plugin_table_free(fs);
+    raleighsl_checkpoint_free(fs);
+    raleighsl_journal_free(fs);
+    raleighsl_txn_mgr_free(fs);
+    raleighsl_obj_cache_free(fs);
+    return(NULL);
+  }
+
   if (raleighsl_semantic_alloc(fs)) {
     __plugin_table_free(fs);
+    raleighsl_blkcache_free(fs);
+    raleighsl_checkpoint_free(fs);
+    raleighsl_journal_free(fs);
     raleighsl_txn_mgr_free(fs);
     raleighsl_obj_cache_free(fs);
     return(NULL);
@@ -44,8 +75,13 @@ raleighsl_t *raleighsl_alloc (raleighsl_t *fs) {
 
 void raleighsl_free (raleighsl_t *fs) {
   raleighsl_semantic_free(fs);
-  raleighsl_txn_mgr_free(fs);
+  raleighsl_blkcache_free(fs);
+  /* The dirty objects are unpinned, then the cache frees all of them */
+  raleighsl_journal_clear(fs);
+  raleighsl_checkpoint_free(fs);
   raleighsl_obj_cache_free(fs);
+  raleighsl_journal_free(fs);
+  raleighsl_txn_mgr_free(fs);
   __plugin_table_free(fs);
 }
 
@@ -74,6 +110,20 @@ raleighsl_errno_t raleighsl_create (raleighsl_t *fs,
     return(errno);
   }
 
+  /* Create new journal */
+  if ((errno = raleighsl_journal_create(fs))) {
+    __space_call_unrequired(fs, unload);
+    __format_call_unrequired(fs, unload);
+    return(errno);
+  }
+
+  /* Drop the old checkpoints */
+  if ((errno = raleighsl_checkpoint_create(fs))) {
+    __space_call_unrequired(fs, unload);
+    __format_call_unrequired(fs, unload);
+    return(errno);
+  }
+
   /* Create new semantic layer */
   if ((errno = __semantic_call_unrequired(fs, init))) {
     __space_call_unrequired(fs, unload);
@@ -81,24 +131,39 @@ raleighsl_errno_t raleighsl_create (raleighsl_t *fs,
     return(errno);
   }
 
+  /* The file-system is mountable once the format is on disk */
+  if ((errno = __format_call_unrequired(fs, sync))) {
+    __semantic_call_unrequired(fs, unload);
+    __space_call_unrequired(fs, unload);
+    __format_call_unrequired(fs, unload);
+    return(errno);
+  }
+
   return(RALEIGHSL_ERRNO_NONE);
 }
 
 raleighsl_errno_t raleighsl_open (raleighsl_t *fs,
-                                  raleighsl_device_t *device)
+                                  raleighsl_device_t *device,
+                                  const raleighsl_format_plug_t *format,
+                                  const raleighsl_space_plug_t *space,
+                                  const raleighsl_semantic_plug_t *semantic)
 {
   raleighsl_errno_t errno;
 
   /* Initialize file-system struct */
   fs->device = device;
+  fs->space.plug = space;
+  fs->format.plug = format;
+  fs->semantic.plug = semantic;
 
-  /* Load File-system format */
+  /* Load File-system format, it may resolve the missing plugins */
   if ((errno = __format_call_unrequired(fs, load))) {
     return(errno);
   }
 
-  /* Load space allocator */
-  if ((errno = __space_call_unrequired(fs, load))) {
+  /* Load the space allocator and the objects of the last checkpoint */
+  if ((errno = raleighsl_checkpoint_load(fs))) {
+    __space_call_unrequired(fs, unload);
     __format_call_unrequired(fs, unload);
     return(errno);
   }
@@ -110,12 +175,23 @@ raleighsl_errno_t raleighsl_open (raleighsl_t *fs,
     return(errno);
   }
 
+  /* Replay the journal on top of the loaded state */
+  if ((errno = raleighsl_journal_replay(fs))) {
+    __semantic_call_unrequired(fs, unload);
+    __space_call_unrequired(fs, unload);
+    __format_call_unrequired(fs, unload);
+    return(errno);
+  }
+
   return(RALEIGHSL_ERRNO_NONE);
 }
 
 raleighsl_errno_t raleighsl_close (raleighsl_t *fs) {
   raleighsl_errno_t errno;
 
+  /* Nothing commits anymore, the parked reads would never run again */
+  raleighsl_object_expire_parked(fs);
+
   if ((errno = raleighsl_sync(fs)))
     return(errno);
 
@@ -126,20 +202,13 @@ raleighsl_errno_t raleighsl_close (raleighsl_t *fs) {
 }
 
 raleighsl_errno_t raleighsl_sync (raleighsl_t *fs) {
-#if 0
   raleighsl_errno_t errno;
 
-  if ((errno = __semantic_call_unrequired(fs, sync)))
+  /* A full journal is released by the checkpoint below */
+  errno = raleighsl_journal_flush(fs);
+  if (errno && errno != RALEIGHSL_ERRNO_DEVICE_NO_SPACE)
     return(errno);
 
-  if ((errno = __space_call_unrequired(fs, sync)))
-    return(errno);
-
-  if ((errno = __format_call_unrequired(fs, sync)))
-    return(errno);
-
-  if ((errno = __device_call_unrequired(fs, sync)))
-    return(errno);
-#endif
-  return(RALEIGHSL_ERRNO_NONE);
+  /* The objects are written by a checkpoint, the journal is released */
+  return(raleighsl_checkpoint_sync(fs));
 }
@@ -29,7 +29,10 @@ raleighsl_errno_t   raleighsl_create    (raleighsl_t *fs,
                                          const raleighsl_space_plug_t *space,
                                          const raleighsl_semantic_plug_t *semantic);
 raleighsl_errno_t   raleighsl_open      (raleighsl_t *fs,
-                                         raleighsl_device_t *device);
+                                         raleighsl_device_t *device,
+                                         const raleighsl_format_plug_t *format,
+                                         const raleighsl_space_plug_t *space,
+                                         const raleighsl_semantic_plug_t *semantic);
 
 raleighsl_errno_t   raleighsl_close     (raleighsl_t *fs);
 raleighsl_errno_t   raleighsl_sync      (raleighsl_t *fs);
@@ -12,44 +12,791 @@
  *   limitations under the License.
  */
 
+#include <zcl/threading.h>
+#include <zcl/checksum.h>
+#include <zcl/string.h>
 #include <zcl/global.h>
+#include <zcl/atomic.h>
 #include <zcl/debug.h>
 #include <zcl/time.h>
 
+#include <raleighsl/checkpoint.h>
+#include <raleighsl/journal.h>
+#include <raleighsl/object.h>
+
+#include <stdlib.h>
+
 #include "private.h"
 
+#define __JOURNAL_BUFFER_MIN_SIZE       (64 << 10)
+#define __JOURNAL_REPLAY_CHUNK          (4 << 20)
+
+#define __journal_active_buffer(journal)                                    \
+  (&((journal)->buffers[(journal)->active]))
+
+/* The log area is circular, the lsn is mapped on it from the base lsn */
+#define __journal_position(journal, lsn)                                    \
+  (((lsn) - (journal)->base_lsn) % (journal)->size)
+
+/* ============================================================================
+ *  PRIVATE Journal Buffer methods
+ */
+static int __journal_buffer_grow (raleighsl_journal_t *journal,
+                                  int index, size_t size)
+{
+  uint8_t *data;
+
+  if (Z_LIKELY(journal->buffers[index].size + size <= journal->buffers[index].capacity))
+    return(0);
+
+  size = z_max(__JOURNAL_BUFFER_MIN_SIZE, (journal->buffers[index].size + size) << 1);
+  data = z_memory_realloc(z_global_memory(), uint8_t, journal->buffers[index].data, size);
+  if (Z_MALLOC_IS_NULL(data))
+    return(1);
+
+  journal->buffers[index].data = data;
+  journal->buffers[index].capacity = size;
+  return(0);
+}
+
+#define __journal_buffer_reserve(journal, size)                             \
+  __journal_buffer_grow(journal, (journal)->active, size)
+
+/*
+ * The flush of buffer 'index' was not written, the records appended since
+ * the swap are moved behind it and it becomes the active buffer again.
+ * Called with the wlock held.
+ */
+static int __journal_buffer_restore (raleighsl_journal_t *journal, int index) {
+  size_t size = __journal_active_buffer(journal)->size;
+
+  if (Z_UNLIKELY(__journal_buffer_grow(journal, index, size)))
+    return(1);
+
+  z_memcpy(journal->buffers[index].data + journal->buffers[index].size,
+           __journal_active_buffer(journal)->data, size);
+  journal->buffers[index].size += size;
+  __journal_active_buffer(journal)->size = 0;
+  journal->active = index;
+  return(0);
+}
+
+static raleighsl_errno_t __journal_write (raleighsl_t *fs,
+                                          uint64_t lsn,
+                                          const uint8_t *data,
+                                          size_t size)
+{
+  raleighsl_journal_t *journal = &(fs->journal);
+  raleighsl_errno_t errno;
+  uint64_t position;
+  size_t n;
+
+  /* The batch may wrap around the end of the log area */
+  position = __journal_position(journal, lsn);
+  n = z_min(size, journal->size - position);
+  errno = __device_call_required(fs, write, journal->offset + position, data, n);
+  if (!errno && n < size) {
+    errno = __device_call_required(fs, write, journal->offset, data + n, size - n);
+  }
+  return(errno);
+}
+
+/*
+ * Group-commit flush: the caller owns the 'is_flushing' flag.
+ * The active buffer is swapped out, so other commits can keep appending
+ * records while this one is written and synced to the device.
+ * Every task that was waiting for the flush is woken up at the end.
+ * Once half of the log area is in use a checkpoint is started, so the
+ * records before the checkpoint lsn can be overwritten.
+ * A full log is not an I/O error: the records are kept in the buffer, the
+ * flush stays owned and the waiters (and 'task') stay parked on the syncq
+ * until the checkpoint has moved the tail, see raleighsl_journal_resume().
+ * RALEIGHSL_ERRNO_SCHED_WAIT is returned once 'task' is parked, without a
+ * task the caller gets RALEIGHSL_ERRNO_DEVICE_NO_SPACE.
+ * The records before the tail are in the checkpoint and are skipped.
+ */
+static raleighsl_errno_t __journal_flush (raleighsl_t *fs, z_task_t *task) {
+  raleighsl_journal_t *journal = &(fs->journal);
+  raleighsl_errno_t errno;
+  uint64_t start_lsn, end_lsn, tail_lsn;
+  z_task_t *waiters;
+  uint8_t *data;
+  int is_full;
+  size_t size;
+  int index;
+
+  while (1) {
+    errno = RALEIGHSL_ERRNO_NONE;
+
+    z_spin_lock(&(journal->wlock));
+    index = journal->active;
+    journal->active ^= 1;
+    start_lsn = journal->sync_lsn;
+    end_lsn = journal->next_lsn;
+    tail_lsn = journal->tail_lsn;
+    z_spin_unlock(&(journal->wlock));
+
+    data = journal->buffers[index].data;
+    size = journal->buffers[index].size;
+    if (size > 0) {
+      Z_ASSERT(end_lsn - start_lsn == size, "journal buffer does not match the lsn");
+      if (Z_UNLIKELY(end_lsn - tail_lsn > journal->size)) {
+        errno = RALEIGHSL_ERRNO_DEVICE_NO_SPACE;
+      } else {
+        if (start_lsn < tail_lsn) {
+          data += tail_lsn - start_lsn;
+          size -= tail_lsn - start_lsn;
+          start_lsn = tail_lsn;
+        }
+        if (size > 0 && !(errno = __journal_write(fs, start_lsn, data, size))) {
+          errno = __device_call_required(fs, sync);
+        }
+      }
+    }
+
+    z_spin_lock(&(journal->wlock));
+    if (errno == RALEIGHSL_ERRNO_DEVICE_NO_SPACE) {
+      if (Z_UNLIKELY(__journal_buffer_restore(journal, index))) {
+        journal->flush_error = errno = RALEIGHSL_ERRNO_NO_MEMORY;
+      } else if (journal->tail_lsn != tail_lsn) {
+        /* The checkpoint moved the tail meanwhile, try again */
+        z_spin_unlock(&(journal->wlock));
+        continue;
+      } else if (journal->full_error) {
+        /* The checkpoint that was expected to free the log failed */
+        errno = journal->full_error;
+        journal->full_error = RALEIGHSL_ERRNO_NONE;
+      } else {
+        journal->is_full = 1;
+        if (task != NULL) {
+          z_task_queue_push(&(journal->syncq), task);
+          errno = RALEIGHSL_ERRNO_SCHED_WAIT;
+        }
+      }
+    } else {
+      journal->buffers[index].size = 0;
+      if (Z_UNLIKELY(errno)) {
+        journal->flush_error = errno;
+      } else {
+        z_atomic_set(&(journal->sync_lsn), end_lsn);
+        journal->full_error = RALEIGHSL_ERRNO_NONE;
+      }
+    }
+
+    waiters = NULL;
+    is_full = journal->is_full;
+    if (!is_full) {
+      journal->is_flushing = 0;
+      waiters = z_task_queue_drain(&(journal->syncq));
+    }
+    z_spin_unlock(&(journal->wlock));
+    break;
+  }
+
+  if (waiters != NULL)
+    z_global_add_pending_tasks(waiters);
+
+  if (is_full) {
+    raleighsl_errno_t ckpt_errno = RALEIGHSL_ERRNO_DEVICE_NO_SPACE;
+    Z_LOG_WARN("journal is full, waiting for a checkpoint");
+    if (fs->checkpoint.slot_size == 0 || (ckpt_errno = raleighsl_checkpoint_start(fs)))
+      raleighsl_journal_resume(fs, ckpt_errno);
+  } else if (!errno && (end_lsn - tail_lsn) > (journal->size >> 1)) {
+    raleighsl_checkpoint_start(fs);
+  }
+  return(errno);
+}
+
 /* ============================================================================
  *  PUBLIC Journal methods
  */
+/*
+ * The dirty objects have records not yet in a checkpoint, the list keeps
+ * a cache reference so they are never evicted. The caller holds one too.
+ */
 void raleighsl_journal_add (raleighsl_t *fs, raleighsl_object_t *object) {
   raleighsl_journal_t *journal = &(fs->journal);
-  if (z_dlink_is_not_linked(&(object->journal))) {
-    z_spin_lock(&(journal->lock));
+  z_spin_lock(&(journal->lock));
+  if (z_dlink_is_empty(&(object->journal))) {
+    raleighsl_obj_cache_get(fs, raleighsl_oid(object));
     z_dlink_add(&(journal->objects), &(object->journal));
     if (!journal->otime) journal->otime = z_time_micros();
-    z_spin_unlock(&(journal->lock));
   }
+  z_spin_unlock(&(journal->lock));
 }
 
-void raleighsl_journal_remove (raleighsl_t *fs, raleighsl_object_t *object) {
+/*
+ * The object is clean up to 'lsn', the cache can evict it unless
+ * a record was appended after it.
+ */
+void raleighsl_journal_remove (raleighsl_t *fs,
+                               raleighsl_object_t *object,
+                               uint64_t lsn)
+{
   raleighsl_journal_t *journal = &(fs->journal);
-  if (z_dlink_is_not_linked(&(object->journal))) {
-    z_spin_lock(&(journal->lock));
+  int is_clean;
+
+  z_spin_lock(&(journal->lock));
+  is_clean = z_dlink_is_not_empty(&(object->journal)) && object->journal_lsn <= lsn;
+  if (is_clean)
     z_dlink_del(&(object->journal));
-    z_spin_unlock(&(journal->lock));
+  z_spin_unlock(&(journal->lock));
+
+  if (is_clean)
+    raleighsl_obj_cache_release(fs, object);
+}
+
+raleighsl_errno_t raleighsl_journal_write (raleighsl_t *fs,
+                                           raleighsl_journal_type_t type,
+                                           uint16_t op,
+                                           uint64_t txn_id,
+                                           uint64_t oid,
+                                           const struct iovec *iov,
+                                           int iovcnt,
+                                           uint64_t *lsn)
+{
+  raleighsl_journal_t *journal = &(fs->journal);
+  raleighsl_journal_record_t *record;
+  size_t length, rsize;
+  uint8_t *p;
+  int i;
+
+  *lsn = 0;
+  if (!journal->enabled)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  length = 0;
+  for (i = 0; i < iovcnt; ++i) {
+    length += iov[i].iov_len;
+  }
+  rsize = raleighsl_journal_record_size(length);
+
+  /* No checkpoint can make room for it */
+  if (Z_UNLIKELY(rsize > journal->size))
+    return(RALEIGHSL_ERRNO_DEVICE_NO_SPACE);
+
+  z_spin_lock(&(journal->wlock));
+  if (Z_UNLIKELY(__journal_buffer_reserve(journal, rsize))) {
+    z_spin_unlock(&(journal->wlock));
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  }
+
+  p = __journal_active_buffer(journal)->data;
+  p += __journal_active_buffer(journal)->size;
+  record = RALEIGHSL_JOURNAL_RECORD(p);
+  record->length = length;
+  record->lsn = journal->next_lsn;
+  record->txn_id = txn_id;
+  record->oid = oid;
+  record->type = type;
+  record->op = op;
+  record->pad = 0;
+
+  p += sizeof(raleighsl_journal_record_t);
+  for (i = 0; i < iovcnt; ++i) {
+    z_memcpy(p, iov[i].iov_base, iov[i].iov_len);
+    p += iov[i].iov_len;
+  }
+  z_memzero(p, rsize - (sizeof(raleighsl_journal_record_t) + length));
+
+  record->crc = z_csum32_crcc(0, &(record->length),
+                              sizeof(raleighsl_journal_record_t) - 4 + length);
+
+  __journal_active_buffer(journal)->size += rsize;
+  journal->next_lsn += rsize;
+  *lsn = journal->next_lsn;
+  z_spin_unlock(&(journal->wlock));
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+raleighsl_errno_t raleighsl_journal_append (raleighsl_t *fs,
+                                            raleighsl_object_t *object,
+                                            uint16_t op,
+                                            const struct iovec *iov,
+                                            int iovcnt)
+{
+  raleighsl_errno_t errno;
+  uint64_t lsn;
+
+  errno = raleighsl_journal_write(fs, RALEIGHSL_JOURNAL_OBJECT, op,
+                                  object->journal_txn_id, raleighsl_oid(object),
+                                  iov, iovcnt, &lsn);
+  if (Z_LIKELY(!errno && lsn > 0)) {
+    object->journal_lsn = lsn;
+    raleighsl_journal_add(fs, object);
   }
+  return(errno);
 }
 
-#if 0
-void raleighsl_journal_sync (raleighsl_t *fs) {
+uint64_t raleighsl_journal_lsn (raleighsl_t *fs) {
   raleighsl_journal_t *journal = &(fs->journal);
-  raleighsl_object_t *object;
-  z_dlink_del_for_each_entry(&(journal->objects), object, raleighsl_object_t, journal, {
-    raleighsl_object_journal_sync(object);
+  uint64_t lsn;
+  z_spin_lock(&(journal->wlock));
+  lsn = journal->next_lsn;
+  z_spin_unlock(&(journal->wlock));
+  return(lsn);
+}
+
+/*
+ * Returns 1 if the task was parked waiting for a flush that covers 'lsn',
+ * the task is rescheduled once the flush is completed.
+ * Returns 0 if the lsn is durable, the first task that finds no flush
+ * running becomes the group-commit leader and flushes for everyone.
+ * The leader that finds the log full is parked too.
+ */
+int raleighsl_journal_wait (raleighsl_t *fs,
+                            uint64_t lsn,
+                            z_task_t *task,
+                            raleighsl_errno_t *error)
+{
+  raleighsl_journal_t *journal = &(fs->journal);
+
+  *error = RALEIGHSL_ERRNO_NONE;
+  if (lsn <= z_atomic_load(&(journal->sync_lsn)))
+    return(0);
+
+  z_spin_lock(&(journal->wlock));
+  if (Z_UNLIKELY(journal->flush_error)) {
+    *error = journal->flush_error;
+    z_spin_unlock(&(journal->wlock));
+    return(0);
+  }
+
+  if (lsn <= journal->sync_lsn) {
+    z_spin_unlock(&(journal->wlock));
+    return(0);
+  }
+
+  if (journal->is_flushing) {
+    z_task_queue_push(&(journal->syncq), task);
+    z_spin_unlock(&(journal->wlock));
+    return(1);
+  }
+
+  journal->is_flushing = 1;
+  z_spin_unlock(&(journal->wlock));
+
+  if ((*error = __journal_flush(fs, task)) == RALEIGHSL_ERRNO_SCHED_WAIT)
+    return(1);
+  return(0);
+}
+
+/*
+ * Called once a checkpoint is done, the flushes parked on a full log are
+ * run again. If the checkpoint failed the next flush that still finds the
+ * log full returns 'error' instead of waiting for another checkpoint.
+ */
+void raleighsl_journal_resume (raleighsl_t *fs, raleighsl_errno_t error) {
+  raleighsl_journal_t *journal = &(fs->journal);
+  z_task_t *waiters = NULL;
+
+  z_spin_lock(&(journal->wlock));
+  if (journal->is_full) {
+    journal->is_full = 0;
+    journal->is_flushing = 0;
+    journal->full_error = error;
+    waiters = z_task_queue_drain(&(journal->syncq));
+  }
+  z_spin_unlock(&(journal->wlock));
+
+  if (waiters != NULL)
+    z_global_add_pending_tasks(waiters);
+}
+
+struct journal_flush_wait {
+  z_mutex_t lock;
+  z_wait_cond_t wcond;
+  int is_woken;
+};
+
+static void __journal_flush_wake (z_task_t *task) {
+  struct journal_flush_wait *wait = (struct journal_flush_wait *)task->udata;
+  z_lock(&(wait->lock), z_mutex, {
+    wait->is_woken = 1;
+    z_wait_cond_signal(&(wait->wcond));
   });
-  journal->otime = 0;
 }
-#endif
+
+/*
+ * Called outside the tasks (sync, close). While another flush is running
+ * the caller parks a wake-up task on the syncq and sleeps until the flush
+ * reschedules it. A full log returns RALEIGHSL_ERRNO_DEVICE_NO_SPACE, the
+ * records are flushed once the checkpoint has moved the tail.
+ */
+raleighsl_errno_t raleighsl_journal_flush (raleighsl_t *fs) {
+  raleighsl_journal_t *journal = &(fs->journal);
+  struct journal_flush_wait wait;
+  z_task_t *task = NULL;
+
+  if (!journal->enabled)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if (Z_UNLIKELY(journal->flush_error))
+    return(journal->flush_error);
+
+  while (1) {
+    z_spin_lock(&(journal->wlock));
+    if (!journal->is_flushing) {
+      journal->is_flushing = 1;
+      z_spin_unlock(&(journal->wlock));
+      break;
+    }
+
+    if (task == NULL) {
+      z_spin_unlock(&(journal->wlock));
+      if (Z_MALLOC_IS_NULL(task = z_task_alloc(__journal_flush_wake)))
+        return(RALEIGHSL_ERRNO_NO_MEMORY);
+      task->udata = &wait;
+      z_mutex_alloc(&(wait.lock));
+      z_wait_cond_alloc(&(wait.wcond));
+      continue;
+    }
+
+    wait.is_woken = 0;
+    z_task_queue_push(&(journal->syncq), task);
+    z_spin_unlock(&(journal->wlock));
+
+    z_lock(&(wait.lock), z_mutex, {
+      while (!wait.is_woken)
+        z_wait_cond_wait(&(wait.wcond), &(wait.lock), 0);
+    });
+  }
+
+  if (task != NULL) {
+    z_wait_cond_free(&(wait.wcond));
+    z_mutex_free(&(wait.lock));
+    z_task_free(task);
+  }
+
+  return(__journal_flush(fs, NULL));
+}
+
+/* ============================================================================
+ *  PRIVATE Journal Replay
+ */
+struct replay_vec {
+  uint64_t *items;
+  size_t    count;
+  size_t    capacity;
+};
+
+struct journal_replay {
+  raleighsl_t *fs;
+
+  uint8_t *data;                          /* Log area loaded so far */
+  size_t   size;
+  size_t   end;                           /* End of the valid records */
+  uint64_t start_lsn;                     /* LSN of the first record */
+
+  struct replay_vec committed;            /* Committed Transaction-Ids */
+  struct replay_vec unlinked;             /* Unlinked Object-Ids */
+  struct replay_vec *parts;               /* Object records by OID */
+  int nparts;
+
+  z_mutex_t lock;
+  z_wait_cond_t wcond;
+  int running;
+  raleighsl_errno_t error;
+};
+
+#define __journal_record_data(record)                                       \
+  (((const uint8_t *)(record)) + sizeof(raleighsl_journal_record_t))
+
+#define __journal_new_base_lsn()                                            \
+  z_align_down(z_time_micros(), 8)
+
+static int __replay_vec_push (struct replay_vec *vec, uint64_t value) {
+  if (Z_UNLIKELY(vec->count == vec->capacity)) {
+    size_t capacity = z_max(64, vec->capacity << 1);
+    uint64_t *items;
+
+    items = z_memory_realloc(z_global_memory(), uint64_t, vec->items,
+                             capacity * sizeof(uint64_t));
+    if (Z_MALLOC_IS_NULL(items))
+      return(1);
+
+    vec->items = items;
+    vec->capacity = capacity;
+  }
+  vec->items[vec->count++] = value;
+  return(0);
+}
+
+static int __replay_u64_compare (const void *a, const void *b) {
+  return(z_cmp(*((const uint64_t *)a), *((const uint64_t *)b)));
+}
+
+static int __journal_replay_is_committed (const struct journal_replay *replay,
+                                          uint64_t txn_id)
+{
+  return(bsearch(&txn_id, replay->committed.items, replay->committed.count,
+                 sizeof(uint64_t), __replay_u64_compare) != NULL);
+}
+
+/*
+ * Make sure that the log up to 'size' bytes from the start lsn is loaded.
+ * The log is read sequentially in large chunks, growing geometrically,
+ * and unrolled in memory when it wraps around the end of the log area.
+ * Returns 1 if 'size' is outside the log area, -1 on read error.
+ */
+static int __journal_replay_fetch (struct journal_replay *replay, size_t size) {
+  raleighsl_journal_t *journal = &(replay->fs->journal);
+  size_t next_size;
+  uint8_t *data;
+
+  if (Z_LIKELY(size <= replay->size))
+    return(0);
+
+  if (Z_UNLIKELY(size > journal->size))
+    return(1);
+
+  next_size = z_max(size, replay->size << 1);
+  next_size = z_align_up(next_size, __JOURNAL_REPLAY_CHUNK);
+  next_size = z_min(next_size, journal->size);
+
+  data = z_memory_realloc(z_global_memory(), uint8_t, replay->data, next_size);
+  if (Z_MALLOC_IS_NULL(data)) {
+    replay->error = RALEIGHSL_ERRNO_NO_MEMORY;
+    return(-1);
+  }
+  replay->data = data;
+
+  while (replay->size < next_size) {
+    uint64_t position = __journal_position(journal, replay->start_lsn + replay->size);
+    size_t n = z_min(next_size - replay->size, journal->size - position);
+
+    replay->error = __device_call_required(replay->fs, read,
+                                           journal->offset + position,
+                                           data + replay->size, n);
+    if (Z_UNLIKELY(replay->error))
+      return(-1);
+
+    replay->size += n;
+  }
+
+  return(0);
+}
+
+static raleighsl_errno_t __journal_replay_semantic (struct journal_replay *replay,
+                                                    const raleighsl_journal_record_t *record)
+{
+  const uint8_t *data = __journal_record_data(record);
+  raleighsl_t *fs = replay->fs;
+
+  switch (record->op) {
+    case RALEIGHSL_JOURNAL_SEMANTIC_CREATE: {
+      const raleighsl_object_plug_t *plug;
+      raleighsl_object_t *object;
+      raleighsl_errno_t errno;
+      z_byte_slice_t label;
+      uint16_t label_size;
+
+      z_memcpy(&label_size, data, sizeof(uint16_t));
+      z_byte_slice_set(&label, data + sizeof(uint16_t), label_size);
+      plug = RALEIGHSL_OBJECT_PLUG(__plugin_lookup_by_label(fs, &label));
+      if (Z_UNLIKELY(plug == NULL || plug->info.type != RALEIGHSL_PLUG_TYPE_OBJECT)) {
+        Z_LOG_WARN("journal object %"PRIu64" has no plugin", record->oid);
+        return(RALEIGHSL_ERRNO_PLUGIN_NOT_LOADED);
+      }
+
+      fs->semantic.next_oid = z_max(fs->semantic.next_oid, record->oid + 1);
+
+      /* The name is restored by the semantic layer object records */
+      if ((object = raleighsl_obj_cache_get(fs, record->oid)) == NULL)
+        return(RALEIGHSL_ERRNO_NO_MEMORY);
+      errno = RALEIGHSL_ERRNO_NONE;
+      if (object->plug == NULL)
+        errno = raleighsl_object_create(fs, plug, record->oid);
+      raleighsl_obj_cache_release(fs, object);
+      return(errno);
+    }
+    case RALEIGHSL_JOURNAL_SEMANTIC_UNLINK:
+      if (__replay_vec_push(&(replay->unlinked), record->oid))
+        return(RALEIGHSL_ERRNO_NO_MEMORY);
+      break;
+    case RALEIGHSL_JOURNAL_SEMANTIC_RENAME:
+      /* The name is restored by the semantic layer object records */
+      break;
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Sequential pass over the log: verify the records, collect the committed
+ * transactions, create the objects and split the object records by OID.
+ * The log ends at the first record with a bad checksum or a wrong lsn.
+ */
+static raleighsl_errno_t __journal_replay_scan (struct journal_replay *replay) {
+  const raleighsl_journal_record_t *record;
+  raleighsl_errno_t errno;
+  size_t offset = 0;
+  int res;
+
+  while (!(res = __journal_replay_fetch(replay, offset + sizeof(raleighsl_journal_record_t)))) {
+    size_t rsize;
+
+    record = RALEIGHSL_JOURNAL_RECORD(replay->data + offset);
+    rsize = raleighsl_journal_record_size(record->length);
+    if ((res = __journal_replay_fetch(replay, offset + rsize)))
+      break;
+
+    record = RALEIGHSL_JOURNAL_RECORD(replay->data + offset);
+    if (record->crc != z_csum32_crcc(0, &(record->length),
+                                     sizeof(raleighsl_journal_record_t) - 4 + record->length))
+      break;
+
+    if (record->lsn != replay->start_lsn + offset)
+      break;
+
+    switch (record->type) {
+      case RALEIGHSL_JOURNAL_OBJECT:
+        raleighsl_txn_mgr_reserve(replay->fs, record->txn_id);
+        if (__replay_vec_push(&(replay->parts[record->oid % replay->nparts]), offset))
+          return(RALEIGHSL_ERRNO_NO_MEMORY);
+        break;
+      case RALEIGHSL_JOURNAL_COMMIT:
+        raleighsl_txn_mgr_reserve(replay->fs, record->txn_id);
+        if (__replay_vec_push(&(replay->committed), record->txn_id))
+          return(RALEIGHSL_ERRNO_NO_MEMORY);
+        break;
+      case RALEIGHSL_JOURNAL_SEMANTIC:
+        if ((errno = __journal_replay_semantic(replay, record)))
+          return(errno);
+        break;
+    }
+
+    offset += rsize;
+  }
+
+  if (Z_UNLIKELY(res < 0))
+    return(replay->error);
+
+  replay->end = offset;
+  qsort(replay->committed.items, replay->committed.count,
+        sizeof(uint64_t), __replay_u64_compare);
+  Z_LOG_INFO("journal replay: %zu bytes, %zu committed transactions",
+             offset, replay->committed.count);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Each worker owns a disjoint set of OIDs, the records are applied
+ * in lsn order through the object plug and committed one by one.
+ */
+static void __journal_replay_task_exec (z_task_t *task) {
+  struct journal_replay *replay = (struct journal_replay *)task->object.ptr;
+  const struct replay_vec *part = &(replay->parts[task->args[0].u64]);
+  raleighsl_errno_t errno = RALEIGHSL_ERRNO_NONE;
+  raleighsl_t *fs = replay->fs;
+  raleighsl_object_t *object = NULL;
+  size_t i;
+
+  for (i = 0; i < part->count; ++i) {
+    const raleighsl_journal_record_t *record;
+
+    record = RALEIGHSL_JOURNAL_RECORD(replay->data + part->items[i]);
+    if (record->txn_id > 0 && !__journal_replay_is_committed(replay, record->txn_id))
+      continue;
+
+    if (object == NULL || raleighsl_oid(object) != record->oid) {
+      if (object != NULL)
+        raleighsl_obj_cache_release(fs, object);
+
+      if ((object = raleighsl_obj_cache_get(fs, record->oid)) == NULL) {
+        errno = RALEIGHSL_ERRNO_NO_MEMORY;
+        break;
+      }
+    }
+
+    /* The object create was not logged */
+    if (Z_UNLIKELY(object->plug == NULL))
+      continue;
+
+    /* Already part of the object checkpoint */
+    if (record->lsn < object->ckpt_lsn)
+      continue;
+
+    /* The clean objects loaded may have been evicted meanwhile */
+    errno = raleighsl_object_open(fs, object);
+    if (!errno) errno = raleighsl_object_replay(fs, object, record->op,
+                                                __journal_record_data(record),
+                                                record->length);
+    if (!errno) errno = raleighsl_object_commit(fs, object);
+    if (Z_UNLIKELY(errno)) {
+      Z_LOG_ERROR("journal replay of object %"PRIu64" failed: %s",
+                  record->oid, raleighsl_errno_string(errno));
+      break;
+    }
+
+    /* Dirty until the next checkpoint */
+    raleighsl_journal_add(fs, object);
+  }
+
+  if (object != NULL)
+    raleighsl_obj_cache_release(fs, object);
+
+  z_mutex_lock(&(replay->lock));
+  if (errno && !replay->error)
+    replay->error = errno;
+  if (--replay->running == 0)
+    z_wait_cond_broadcast(&(replay->wcond));
+  z_mutex_unlock(&(replay->lock));
+
+  z_task_free(task);
+}
+
+static raleighsl_errno_t __journal_replay_apply (struct journal_replay *replay) {
+  raleighsl_errno_t errno;
+  size_t i;
+  int n;
+
+  replay->error = RALEIGHSL_ERRNO_NONE;
+  replay->running = replay->nparts;
+  for (n = 0; n < replay->nparts; ++n) {
+    z_task_t *task;
+
+    task = z_task_alloc(__journal_replay_task_exec);
+    if (Z_MALLOC_IS_NULL(task)) {
+      z_mutex_lock(&(replay->lock));
+      replay->error = RALEIGHSL_ERRNO_NO_MEMORY;
+      replay->running -= replay->nparts - n;
+      z_mutex_unlock(&(replay->lock));
+      break;
+    }
+
+    task->object.ptr = replay;
+    task->args[0].u64 = n;
+    z_global_add_task(task);
+  }
+
+  z_mutex_lock(&(replay->lock));
+  while (replay->running > 0) {
+    z_wait_cond_wait(&(replay->wcond), &(replay->lock), 0);
+  }
+  errno = replay->error;
+  z_mutex_unlock(&(replay->lock));
+
+  if (Z_UNLIKELY(errno))
+    return(errno);
+
+  /* Unlinks are applied last, OIDs are never reused */
+  for (i = 0; i < replay->unlinked.count; ++i) {
+    raleighsl_object_t *object;
+
+    if ((object = raleighsl_obj_cache_get(replay->fs, replay->unlinked.items[i])) == NULL)
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    errno = RALEIGHSL_ERRNO_NONE;
+    if (object->plug != NULL)
+      errno = raleighsl_object_unlink(replay->fs, object);
+    raleighsl_obj_cache_release(replay->fs, object);
+    if (Z_UNLIKELY(errno))
+      return(errno);
+  }
+
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
 /* ============================================================================
  *  PRIVATE Journal methods
  */
@@ -58,10 +805,124 @@ int raleighsl_journal_alloc (raleighsl_t *fs) {
   z_spin_alloc(&(journal->lock));
   z_dlink_init(&(journal->objects));
   journal->otime = 0;
+
+  z_spin_alloc(&(journal->wlock));
+  z_task_queue_open(&(journal->syncq));
+  z_memzero(journal->buffers, sizeof(journal->buffers));
+  journal->active = 0;
+  journal->is_flushing = 0;
+  journal->is_full = 0;
+  journal->enabled = 0;
+  journal->flush_error = RALEIGHSL_ERRNO_NONE;
+  journal->full_error = RALEIGHSL_ERRNO_NONE;
+
+  journal->offset = RALEIGHSL_JOURNAL_OFFSET;
+  journal->size = RALEIGHSL_JOURNAL_SIZE;
+  journal->base_lsn = 0;
+  journal->next_lsn = 0;
+  journal->sync_lsn = 0;
+  journal->tail_lsn = 0;
   return(0);
 }
 
 void raleighsl_journal_free (raleighsl_t *fs) {
   raleighsl_journal_t *journal = &(fs->journal);
+  Z_ASSERT(z_dlink_is_empty(&(journal->objects)), "dirty objects still pinned");
+  z_memory_free(z_global_memory(), journal->buffers[0].data);
+  z_memory_free(z_global_memory(), journal->buffers[1].data);
+  z_task_queue_close(&(journal->syncq));
+  z_spin_free(&(journal->wlock));
   z_spin_free(&(journal->lock));
 }
+
+/*
+ * Drop the references of the dirty objects, the cache frees them.
+ */
+void raleighsl_journal_clear (raleighsl_t *fs) {
+  raleighsl_journal_t *journal = &(fs->journal);
+  raleighsl_object_t *object;
+
+  z_dlink_del_for_each_entry(&(journal->objects), object, raleighsl_object_t, journal, {
+    raleighsl_obj_cache_release(fs, object);
+  });
+}
+
+/*
+ * Every new log starts from a different base lsn,
+ * so the records left on the device by an old log are never replayed.
+ */
+raleighsl_errno_t raleighsl_journal_create (raleighsl_t *fs) {
+  raleighsl_journal_t *journal = &(fs->journal);
+  journal->base_lsn = __journal_new_base_lsn();
+  journal->next_lsn = journal->base_lsn;
+  journal->sync_lsn = journal->base_lsn;
+  journal->tail_lsn = journal->base_lsn;
+  journal->enabled = (fs->device != NULL);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+raleighsl_errno_t raleighsl_journal_replay (raleighsl_t *fs) {
+  raleighsl_journal_t *journal = &(fs->journal);
+  struct journal_replay replay;
+  raleighsl_errno_t errno;
+  int i;
+
+  if (fs->device == NULL)
+    return(raleighsl_journal_create(fs));
+
+  z_memzero(&replay, sizeof(struct journal_replay));
+  replay.fs = fs;
+
+  if (fs->checkpoint.generation > 0) {
+    /* The checkpoint load has restored the base and the tail lsn */
+    replay.start_lsn = journal->tail_lsn;
+  } else {
+    raleighsl_journal_record_t record;
+
+    /* Never checkpointed, the log has not wrapped yet */
+    errno = __device_call_required(fs, read, journal->offset,
+                                   &record, sizeof(raleighsl_journal_record_t));
+    if (Z_UNLIKELY(errno))
+      return(errno);
+
+    journal->base_lsn = record.lsn;
+    replay.start_lsn = record.lsn;
+  }
+
+  replay.nparts = z_max(1, z_global_context_ncpus());
+  replay.parts = z_memory_alloc(z_global_memory(), struct replay_vec,
+                                replay.nparts * sizeof(struct replay_vec));
+  if (Z_MALLOC_IS_NULL(replay.parts))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  z_memzero(replay.parts, replay.nparts * sizeof(struct replay_vec));
+  z_mutex_alloc(&(replay.lock));
+  z_wait_cond_alloc(&(replay.wcond));
+
+  /* The replayed records must not be logged again */
+  journal->enabled = 0;
+  if (!(errno = __journal_replay_scan(&replay))) {
+    errno = __journal_replay_apply(&replay);
+  }
+
+  if (!errno) {
+    if (replay.end > 0 || fs->checkpoint.generation > 0) {
+      journal->next_lsn = replay.start_lsn + replay.end;
+      journal->sync_lsn = journal->next_lsn;
+      journal->tail_lsn = replay.start_lsn;
+      journal->enabled = 1;
+    } else {
+      errno = raleighsl_journal_create(fs);
+    }
+  }
+
+  z_wait_cond_free(&(replay.wcond));
+  z_mutex_free(&(replay.lock));
+  for (i = 0; i < replay.nparts; ++i) {
+    z_memory_free(z_global_memory(), replay.parts[i].items);
+  }
+  z_memory_free(z_global_memory(), replay.parts);
+  z_memory_free(z_global_memory(), replay.unlinked.items);
+  z_memory_free(z_global_memory(), replay.committed.items);
+  z_memory_free(z_global_memory(), replay.data);
+  return(errno);
+}
@@ -17,7 +17,72 @@
 
 #include <raleighsl/types.h>
 
+#include <sys/uio.h>
+
+#define RALEIGHSL_JOURNAL_OFFSET          (64 << 10)
+#define RALEIGHSL_JOURNAL_SIZE            (64 << 20)
+
+#define RALEIGHSL_JOURNAL_RECORD(x)       Z_CAST(raleighsl_journal_record_t, x)
+
+Z_TYPEDEF_STRUCT(raleighsl_journal_record)
+
+typedef enum raleighsl_journal_type {
+  RALEIGHSL_JOURNAL_OBJECT   = 1,         /* Object redo record */
+  RALEIGHSL_JOURNAL_COMMIT   = 2,         /* Transaction commit mark */
+  RALEIGHSL_JOURNAL_SEMANTIC = 3,         /* Semantic layer update */
+} raleighsl_journal_type_t;
+
+typedef enum raleighsl_journal_semantic_op {
+  RALEIGHSL_JOURNAL_SEMANTIC_CREATE = 1,  /* [u16 label-size][label][name] */
+  RALEIGHSL_JOURNAL_SEMANTIC_UNLINK = 2,  /* [name] */
+  RALEIGHSL_JOURNAL_SEMANTIC_RENAME = 3,  /* [u32 old-size][old][new] */
+} raleighsl_journal_semantic_op_t;
+
+/*
+ * Records are 8 byte aligned on the log. The lsn is the log offset of the
+ * record, the crc covers everything after the crc field (payload included).
+ * The log area is circular, records older than the last checkpoint lsn
+ * are overwritten.
+ */
+struct raleighsl_journal_record {
+  uint32_t crc;                           /* crc32c of the record */
+  uint32_t length;                        /* Payload length */
+  uint64_t lsn;                           /* Record Log-Sequence-Number */
+  uint64_t txn_id;                        /* Transaction-Id (0 auto-commit) */
+  uint64_t oid;                           /* Object-Id */
+  uint16_t type;                          /* Record type */
+  uint16_t op;                            /* Object/Semantic operation */
+  uint32_t pad;
+} __attribute__((__packed__));
+
+#define raleighsl_journal_record_size(length)                             \
+  z_align_up(sizeof(raleighsl_journal_record_t) + (length), 8)
+
 void raleighsl_journal_add    (raleighsl_t *fs, raleighsl_object_t *object);
-void raleighsl_journal_remove (raleighsl_t *fs, raleighsl_object_t *object);
+void raleighsl_journal_remove (raleighsl_t *fs, raleighsl_object_t *object,
+                               uint64_t lsn);
+
+raleighsl_errno_t raleighsl_journal_append  (raleighsl_t *fs,
+                                             raleighsl_object_t *object,
+                                             uint16_t op,
+                                             const struct iovec *iov,
+                                             int iovcnt);
+raleighsl_errno_t raleighsl_journal_write   (raleighsl_t *fs,
+                                             raleighsl_journal_type_t type,
+                                             uint16_t op,
+                                             uint64_t txn_id,
+                                             uint64_t oid,
+                                             const struct iovec *iov,
+                                             int iovcnt,
+                                             uint64_t *lsn);
+
+uint64_t          raleighsl_journal_lsn     (raleighsl_t *fs);
+int               raleighsl_journal_wait    (raleighsl_t *fs,
+                                             uint64_t lsn,
+                                             z_task_t *task,
+                                             raleighsl_errno_t *error);
+raleighsl_errno_t raleighsl_journal_flush   (raleighsl_t *fs);
+void              raleighsl_journal_resume  (raleighsl_t *fs,
+                                             raleighsl_errno_t error);
 
 #endif /* !_RALEIGHSL_JOURNAL_H_ */
@@ -12,6 +12,7 @@
  *   limitations under the License.
  */
 
+#include <raleighsl/journal.h>
 #include <raleighsl/object.h>
 
 #include <zcl/global.h>
@@ -40,17 +41,36 @@ raleighsl_object_t *raleighsl_object_alloc (raleighsl_t *fs, uint64_t oid) {
 
   /* Initialize object attributes */
   z_task_rwcsem_open(&(object->rwcsem));
+  object->version = 0;
   object->pending_txn_id = 0;
+  z_task_queue_open(&(object->txnq));
+  z_task_queue_open(&(object->waitq));
+  object->journal_txn_id = 0;
+  object->journal_lsn = 0;
+  object->ckpt_lsn = 0;
+  object->ckpt_offset = 0;
+  object->ckpt_length = 0;
+  object->balancing = 0;
+  object->footprint = sizeof(raleighsl_object_t);
 
   object->plug = NULL;
   object->devbufs = NULL;
   object->membufs = NULL;
 
   z_dlink_init(&(object->journal));
+  z_dlink_init(&(object->parked));
   return(object);
 }
 
 void raleighsl_object_free (raleighsl_t *fs, raleighsl_object_t *object) {
+  /* Linked by a parked read, the close may be unlinking it */
+  if (z_dlink_is_not_empty(&(object->parked))) {
+    z_lock(&(fs->parked_lock), z_spin, {
+      z_dlink_del(&(object->parked));
+    });
+  }
+  z_task_queue_close(&(object->txnq));
+  z_task_queue_close(&(object->waitq));
   z_task_rwcsem_close(&(object->rwcsem));
   z_memory_struct_free(z_global_memory(), raleighsl_object_t, object);
 }
@@ -61,22 +81,50 @@ void raleighsl_object_free (raleighsl_t *fs, raleighsl_object_t *object) {
 static void __obj_cache_entry_free (void *udata, void *entry) {
   raleighsl_object_t *object = __obj_from_cache_entry(entry);
   raleighsl_t *fs = RALEIGHSL(udata);
-  raleighsl_object_sync(fs, object);
-  raleighsl_object_close(fs, object);
+  /* The dirty objects are pinned, an evicted one is clean or unlinked */
+  /* A lookup of a missing oid leaves an object never opened */
+  if (raleighsl_object_is_open(fs, object))
+    raleighsl_object_close(fs, object);
   raleighsl_object_free(fs, object);
 }
 
 int raleighsl_obj_cache_alloc (raleighsl_t *fs) {
-  fs->obj_cache = z_cache_alloc(Z_CACHE_2Q, 100000,
-                                __obj_cache_entry_free,
-                                NULL, fs);
+  /* Dirty and in-use objects hold a reference, the cache keeps them */
+  fs->obj_cache = z_cache_alloc(Z_CACHE_CLOCK_PRO, 100000,
+                                __obj_cache_entry_free, NULL, fs);
   if (Z_MALLOC_IS_NULL(fs->obj_cache))
     return(1);
+
+  z_cache_budget(fs->obj_cache, RALEIGHSL_OBJ_CACHE_BUDGET);
+  z_spin_alloc(&(fs->parked_lock));
+  z_dlink_init(&(fs->parked));
   return(0);
 }
 
+/*
+ * Called by the object owner (create, open, commit) with the membufs
+ * stable, the footprint is the object itself plus the membufs footprint
+ * reported by the plug.
+ */
+void raleighsl_obj_cache_footprint (raleighsl_t *fs, raleighsl_object_t *object) {
+  uint64_t footprint = sizeof(raleighsl_object_t);
+  if (object->membufs != NULL && object->plug->footprint != NULL)
+    footprint += object->plug->footprint(fs, object);
+  z_atomic_set(&(object->footprint), footprint);
+}
+
+/*
+ * The last footprint becomes the cache weight, may evict the unused
+ * objects so it must not be called with an object lock held.
+ */
+void raleighsl_obj_cache_weight (raleighsl_t *fs, raleighsl_object_t *object) {
+  uint64_t weight = z_atomic_load(&(object->footprint));
+  z_cache_entry_set_weight(fs->obj_cache, &(object->cache_entry), weight);
+}
+
 void raleighsl_obj_cache_free (raleighsl_t *fs) {
   z_cache_free(fs->obj_cache);
+  z_spin_free(&(fs->parked_lock));
 }
 
 raleighsl_object_t *raleighsl_obj_cache_get (raleighsl_t *fs, uint64_t oid) {
@@ -86,10 +134,11 @@ raleighsl_object_t *raleighsl_obj_cache_get (raleighsl_t *fs, uint64_t oid) {
   if (entry == NULL) {
     raleighsl_object_t *obj;
 
-    /* Allocate the new object */
+    /* Allocate the new object, an evicted one is loaded again on open */
     obj = raleighsl_object_alloc(fs, oid);
     if (Z_MALLOC_IS_NULL(obj))
       return(NULL);
+    raleighsl_checkpoint_lookup(fs, obj);
 
     entry = z_cache_try_insert(fs->obj_cache, &(obj->cache_entry));
     if (entry == NULL)
@@ -104,4 +153,12 @@ raleighsl_object_t *raleighsl_obj_cache_get (raleighsl_t *fs, uint64_t oid) {
 
 void raleighsl_obj_cache_release (raleighsl_t *fs, raleighsl_object_t *object) {
   z_cache_release(fs->obj_cache, &(object->cache_entry));
+}
+
+void raleighsl_obj_cache_budget (raleighsl_t *fs, uint64_t bytes) {
+  z_cache_budget(fs->obj_cache, bytes);
+}
+
+uint64_t raleighsl_obj_cache_usage (raleighsl_t *fs) {
+  return(z_cache_weight(fs->obj_cache));
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 #include <raleighsl/transaction.h>
 #include <raleighsl/object.h>
+#include <raleighsl/journal.h>
 #include <raleighsl/exec.h>
 
 #include <zcl/locking.h>
@@ -43,13 +44,24 @@ raleighsl_errno_t raleighsl_object_create (raleighsl_t *fs,
   object->plug = plug;
   Z_LOG_TRACE("create new %s object with oid %"PRIu64, plug->info.label, oid);
 
+  if ((errno = raleighsl_checkpoint_add(fs, object))) {
+    raleighsl_obj_cache_release(fs, object);
+    return(errno);
+  }
+
   /* Object create */
   if ((errno = __object_call_required(fs, object, create))) {
+    raleighsl_checkpoint_remove(fs, object);
+    raleighsl_obj_cache_release(fs, object);
     return(errno);
   }
 
-  raleighsl_obj_cache_release(fs, object);
+  /* Dirty until the first checkpoint, the journal keeps it cached */
+  raleighsl_journal_add(fs, object);
+  raleighsl_obj_cache_footprint(fs, object);
+  raleighsl_obj_cache_weight(fs, object);
   object->requires_balancing = 0;
+  raleighsl_obj_cache_release(fs, object);
   return(RALEIGHSL_ERRNO_NONE);
 }
 
@@ -58,20 +70,25 @@ raleighsl_errno_t raleighsl_object_open (raleighsl_t *fs,
 {
   raleighsl_errno_t errno;
 
+  if (raleighsl_object_is_open(fs, object))
+    return(RALEIGHSL_ERRNO_NONE);
+
+  /* An evicted object is loaded from the extent of the last checkpoint */
+  raleighsl_checkpoint_lookup(fs, object);
+
   /* TODO */
   if (object->plug == NULL) {
     Z_LOG_WARN("TODO: Implement open, missing plugin for object %"PRIu64, raleighsl_oid(object));
     return(RALEIGHSL_ERRNO_PLUGIN_NOT_LOADED);
   }
 
-  if (raleighsl_object_is_open(fs, object))
-    return(RALEIGHSL_ERRNO_NONE);
-
   /* Object open */
   if ((errno = __object_call_required(fs, object, open))) {
     return(errno);
   }
 
+  raleighsl_obj_cache_footprint(fs, object);
+  raleighsl_obj_cache_weight(fs, object);
   object->requires_balancing = 0;
   return(RALEIGHSL_ERRNO_NONE);
 }
@@ -82,12 +99,49 @@ raleighsl_errno_t raleighsl_object_close (raleighsl_t *fs,
   return(__object_call_required(fs, object, close));
 }
 
+raleighsl_errno_t raleighsl_object_unlink (raleighsl_t *fs,
+                                           raleighsl_object_t *object)
+{
+  raleighsl_errno_t errno;
+
+  if ((errno = __object_call_unrequired(fs, object, unlink))) {
+    return(errno);
+  }
+
+  /* Not part of the next checkpoint, the cache can evict it */
+  raleighsl_checkpoint_remove(fs, object);
+  raleighsl_journal_remove(fs, object, object->journal_lsn);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
 raleighsl_errno_t raleighsl_object_sync (raleighsl_t *fs,
                                          raleighsl_object_t *object)
 {
   return(__object_call_required(fs, object, sync));
 }
 
+/*
+ * The committed membufs may have grown, the new footprint is applied to
+ * the cache weight by the scheduler once the commit lock is released.
+ * The reads parked by RALEIGHSL_ERRNO_SCHED_WAIT are run again.
+ */
+raleighsl_errno_t raleighsl_object_commit (raleighsl_t *fs,
+                                           raleighsl_object_t *object)
+{
+  raleighsl_errno_t errno;
+  z_task_t *waiting;
+
+  errno = __object_call_required(fs, object, commit);
+  raleighsl_obj_cache_footprint(fs, object);
+
+  z_lock(&(object->rwcsem.wlock), z_spin, {
+    waiting = z_task_queue_drain(&(object->waitq));
+  });
+  if (waiting != NULL)
+    z_global_add_pending_tasks(waiting);
+  return(errno);
+}
+
 /* ============================================================================
  *  PRIVATE Object sched
  */
@@ -96,6 +150,9 @@ enum object_sched_state {
   OBJECT_SCHED_READ    = 1,
   OBJECT_SCHED_WRITE   = 2,
   OBJECT_SCHED_COMMIT  = 3,
+  OBJECT_SCHED_SYNC    = 4,
+  OBJECT_SCHED_SNAPSHOT = 5,
+  OBJECT_SCHED_BALANCE = 6,
 };
 
 static z_rwcsem_op_t __sched_state_rwc_op[] = {
@@ -103,8 +160,45 @@ static z_rwcsem_op_t __sched_state_rwc_op[] = {
   [OBJECT_SCHED_READ]    = Z_RWCSEM_READ,
   [OBJECT_SCHED_WRITE]   = Z_RWCSEM_WRITE,
   [OBJECT_SCHED_COMMIT]  = Z_RWCSEM_COMMIT,
+  [OBJECT_SCHED_BALANCE] = Z_RWCSEM_READ,
 };
 
+/*
+ * With fs->affinity set, every task of an object runs on the oid home cpu
+ * so the object buffers stay in that cpu cache and the object locks are
+ * not contended. The tasks created or woken up elsewhere are handed off.
+ */
+#define __sched_home_cpu(oid)       ((oid) % z_global_context_ncpus())
+
+static void __sched_add_task (raleighsl_t *fs, uint64_t oid, z_task_t *task) {
+  if (fs->affinity) {
+    z_global_add_cpu_task(__sched_home_cpu(oid), task);
+  } else {
+    z_global_add_task(task);
+  }
+}
+
+static int __sched_task_handoff (raleighsl_t *fs, z_task_t *task) {
+  uint64_t oid;
+  int home;
+
+  if (!fs->affinity)
+    return(0);
+
+  if (task->state == OBJECT_SCHED_OPEN || task->state == OBJECT_SCHED_SNAPSHOT) {
+    oid = task->object.u64;
+  } else {
+    oid = raleighsl_oid(RALEIGHSL_OBJECT(task->object.ptr));
+  }
+
+  home = __sched_home_cpu(oid);
+  if (z_global_cpu_id() == home)
+    return(0);
+
+  z_global_add_cpu_task(home, task);
+  return(1);
+}
+
 /* ============================================================================
  *  PRIVATE RaleighSL Object Balancing
  */
@@ -133,22 +227,27 @@ static void __balance_notify_func (raleighsl_t *fs,
   }
 }
 
+/*
+ * One balance task per object. With a prepare() method the new membufs
+ * are built under the read lock, so the other writers are not stopped,
+ * and the write-commit step just swaps them in.
+ */
 static void __object_sched_balance (z_task_t *task,
                                     raleighsl_t *fs,
-                                    raleighsl_object_t *object)
+                                    uint64_t oid,
+                                    int has_prepare)
 {
-  Z_LOG_DEBUG("sched %s balancing for object %"PRIu64,
-              object->plug->info.label, raleighsl_oid(object));
+  Z_LOG_DEBUG("sched balancing for object %"PRIu64, oid);
   task->state = OBJECT_SCHED_OPEN;
-  task->flags = OBJECT_SCHED_WRITE;
+  task->flags = has_prepare ? OBJECT_SCHED_BALANCE : OBJECT_SCHED_WRITE;
   task->context = fs;
-  task->object.u64 = raleighsl_oid(object);
+  task->object.u64 = oid;
   task->udata = NULL;
   task->args[0].ptr = __balance_notify_func;
   task->args[1].ptr = NULL;
   task->args[2].ptr = __balance_func;
   task->args[3].ptr = NULL;
-  z_global_add_task(task);
+  __sched_add_task(fs, oid, task);
 }
 
 /* ============================================================================
@@ -166,6 +265,81 @@ static void __object_sched_balance (z_task_t *task,
   ((raleighsl_notify_func_t)((task)->args[0].ptr))                        \
     (fs, oid, errno, (task)->udata, ((task)->args[1].ptr))
 
+#define __SNAPSHOT_READ_RETRIES       (3)
+
+/*
+ * The read is resolved against the last published version without taking
+ * the object lock. If a commit publishes a new version meanwhile the read
+ * is retried, and after a few attempts the locked read path is used.
+ */
+static int __sched_snapshot_read (z_task_t *task,
+                                  raleighsl_t *fs,
+                                  raleighsl_object_t *object,
+                                  raleighsl_errno_t *errno)
+{
+  int retries;
+
+  if (!raleighsl_object_is_open(fs, object))
+    return(0);
+
+  for (retries = 0; retries < __SNAPSHOT_READ_RETRIES; ++retries) {
+    uint64_t version = z_atomic_load(&(object->version));
+    if (version & 1)
+      break;
+
+    z_atomic_synchronize();
+    *errno = __sched_task_read_func_exec(fs, NULL, object, task);
+    z_atomic_synchronize();
+
+    /* The parked reads are taking the locked path */
+    if (z_atomic_load(&(object->version)) == version)
+      return(*errno != RALEIGHSL_ERRNO_SCHED_YIELD &&
+             *errno != RALEIGHSL_ERRNO_SCHED_WAIT);
+  }
+  return(0);
+}
+
+/*
+ * The object and the transaction are released before the notify, once the
+ * caller is notified the file-system may be closed. A commit updates the
+ * object weight here, out of the commit lock, since the budget reclaim
+ * may evict other objects.
+ */
+static void __sched_object_task_complete (z_task_t *task,
+                                          raleighsl_t *fs,
+                                          raleighsl_transaction_t *txn,
+                                          raleighsl_object_t *object,
+                                          raleighsl_errno_t errno)
+{
+  uint64_t oid = raleighsl_oid(object);
+  int has_prepare = 0;
+  int balance = 0;
+
+  if (task->args[0].ptr == __balance_notify_func)
+    z_atomic_set(&(object->balancing), 0);
+
+  if (task->state == OBJECT_SCHED_COMMIT || task->state == OBJECT_SCHED_SYNC) {
+    raleighsl_obj_cache_weight(fs, object);
+    if (__object_requires_balancing(fs, object) &&
+        z_atomic_cas(&(object->balancing), 0, 1))
+    {
+      has_prepare = __object_has_method(object, prepare);
+      balance = 1;
+    }
+  }
+
+  raleighsl_obj_cache_release(fs, object);
+  raleighsl_transaction_release(fs, txn);
+
+  __sched_task_notify_func_exec(fs, oid, errno, task);
+
+  if (balance) {
+    __object_sched_balance(task, fs, oid, has_prepare);
+  } else {
+    z_task_free(task);
+  }
+}
+
 static void __sched_object_task_exec (z_task_t *task) {
   raleighsl_t *fs = RALEIGHSL(task->context);
   raleighsl_transaction_t *txn;
@@ -174,8 +348,37 @@ static void __sched_object_task_exec (z_task_t *task) {
   z_rwcsem_op_t op_type;
   int keep_running = 0;
   int is_complete = 1;
+  int is_parked = 0;
 
   txn = RALEIGHSL_TRANSACTION(task->args[3].ptr);
+
+  /* Woken up by the journal group-commit */
+  if (task->state == OBJECT_SCHED_SYNC) {
+    object = RALEIGHSL_OBJECT(task->object.ptr);
+    errno = RALEIGHSL_ERRNO_NONE;
+    if (raleighsl_journal_wait(fs, task->args[2].u64, task, &errno))
+      return;
+    __sched_object_task_complete(task, fs, txn, object, errno);
+    return;
+  }
+
+  if (__sched_task_handoff(fs, task))
+    return;
+
+  /* Snapshot reads don't wait for the writers, if the object is open */
+  if (task->state == OBJECT_SCHED_SNAPSHOT) {
+    object = raleighsl_obj_cache_get(fs, task->object.u64);
+    Z_ASSERT(raleighsl_oid(object) == task->object.u64, "wrong object ID");
+    errno = RALEIGHSL_ERRNO_NONE;
+    task->state = OBJECT_SCHED_READ;
+    if (__sched_snapshot_read(task, fs, object, &errno)) {
+      __sched_object_task_complete(task, fs, NULL, object, errno);
+      return;
+    }
+    raleighsl_obj_cache_release(fs, object);
+    task->state = OBJECT_SCHED_OPEN;
+  }
+
   if (task->state == OBJECT_SCHED_OPEN) {
     object = raleighsl_obj_cache_get(fs, task->object.u64);
     Z_ASSERT(raleighsl_oid(object) == task->object.u64, "wrong object ID");
@@ -189,10 +392,14 @@ static void __sched_object_task_exec (z_task_t *task) {
 
   /* let a commit finish before a transaction will begin */
   if (task->state != OBJECT_SCHED_COMMIT && object->pending_txn_id != 0) {
-    Z_LOG_TRACE("Stuck with pending TXN-ID %"PRIu64, object->pending_txn_id);
-    /* TODO: Use a task sem? */
-    z_global_add_pending_tasks(task);
-    return;
+    /* Still opening, the task looks up the object again once woken */
+    int keep_ref = (task->state != OBJECT_SCHED_OPEN);
+    if (raleighsl_txn_mgr_wait(fs, object, task)) {
+      /* The pending txn keeps the object pinned */
+      if (!keep_ref)
+        raleighsl_obj_cache_release(fs, object);
+      return;
+    }
   }
 
   op_type = __sched_state_rwc_op[task->state];
@@ -220,6 +427,16 @@ static void __sched_object_task_exec (z_task_t *task) {
         errno = __sched_task_read_func_exec(fs, txn, object, task);
         if (errno == RALEIGHSL_ERRNO_SCHED_YIELD) {
           is_complete = 0;
+        } else if (errno == RALEIGHSL_ERRNO_SCHED_WAIT) {
+          /* Parked under the read lock, the next commit can't be missed */
+          z_lock(&(fs->parked_lock), z_spin, {
+            if (z_dlink_is_empty(&(object->parked)))
+              z_dlink_add_tail(&(fs->parked), &(object->parked));
+            z_lock(&(object->rwcsem.wlock), z_spin, {
+              z_task_queue_push(&(object->waitq), task);
+            });
+          });
+          is_parked = 1;
         }
         break;
       case OBJECT_SCHED_WRITE:
@@ -235,29 +452,64 @@ static void __sched_object_task_exec (z_task_t *task) {
           keep_running = z_rwcsem_try_switch(&(object->rwcsem.lock), op_type, __sched_state_rwc_op[task->state]);
         }
         break;
+      case OBJECT_SCHED_BALANCE:
+        errno = __object_call_required(fs, object, prepare);
+        if (!errno) {
+          is_complete = 0;
+          task->state = OBJECT_SCHED_WRITE;
+          keep_running = z_rwcsem_try_switch(&(object->rwcsem.lock), op_type, __sched_state_rwc_op[task->state]);
+        }
+        break;
       case OBJECT_SCHED_COMMIT:
+        raleighsl_object_publish_begin(object);
         errno = raleighsl_object_commit(fs, object);
+        raleighsl_object_publish_end(object);
+        task->args[2].u64 = object->journal_lsn;
         break;
     }
   } while (keep_running);
   z_task_rwcsem_release(&(object->rwcsem), op_type, task, is_complete);
 
-  if (is_complete) {
-    __sched_task_notify_func_exec(fs, raleighsl_oid(object), errno, task);
+  if (is_complete && !is_parked) {
+    /* Auto-commit writes are notified once the journal is on disk */
+    if (task->state == OBJECT_SCHED_COMMIT && txn == NULL && !errno) {
+      task->state = OBJECT_SCHED_SYNC;
+      if (raleighsl_journal_wait(fs, task->args[2].u64, task, &errno))
+        return;
+    }
+    __sched_object_task_complete(task, fs, txn, object, errno);
+  }
+}
 
-    if (task->state == OBJECT_SCHED_COMMIT &&
-        __object_requires_balancing(fs, object))
-    {
-      __object_sched_balance(task, fs, object);
-    } else {
-      z_task_free(task);
+/*
+ * The reads still parked are notified with RALEIGHSL_ERRNO_DATA_NO_ITEMS,
+ * as the deque close does with its waiters. The list lock is taken before
+ * the object wlock (as the park does) and keeps the objects from being
+ * freed, the drained tasks hold their object reference.
+ */
+void raleighsl_object_expire_parked (raleighsl_t *fs) {
+  raleighsl_object_t *object;
+  z_task_queue_t expired;
+  z_task_t *task;
+
+  z_task_queue_open(&expired);
+  z_lock(&(fs->parked_lock), z_spin, {
+    while (z_dlink_is_not_empty(&(fs->parked))) {
+      object = z_dlink_front_entry(&(fs->parked), raleighsl_object_t, parked);
+      z_dlink_del(&(object->parked));
+      z_lock(&(object->rwcsem.wlock), z_spin, {
+        z_task_queue_concat(&expired, &(object->waitq));
+      });
     }
+  });
 
-    raleighsl_obj_cache_release(fs, object);
-    raleighsl_transaction_release(fs, txn);
+  while ((task = z_task_queue_pop(&expired)) != NULL) {
+    __sched_object_task_complete(task, fs,
+                                 RALEIGHSL_TRANSACTION(task->args[3].ptr),
+                                 RALEIGHSL_OBJECT(task->object.ptr),
+                                 RALEIGHSL_ERRNO_DATA_NO_ITEMS);
   }
-
-  /* TODO: Verify memory pressure */
+  z_task_queue_close(&expired);
 }
 
 /* ============================================================================
@@ -294,7 +546,32 @@ int raleighsl_exec_read (raleighsl_t *fs,
   task->args[2].ptr = read_func;
   task->args[3].ptr = txn;
 
-  z_global_add_task(task);
+  __sched_add_task(fs, oid, task);
+  return(0);
+}
+
+int raleighsl_exec_snapshot (raleighsl_t *fs, uint64_t oid,
+                             raleighsl_read_func_t read_func,
+                             raleighsl_notify_func_t notify_func,
+                             void *udata, void *err_data)
+{
+  z_task_t *task;
+
+  task = z_task_alloc(__sched_object_task_exec);
+  if (Z_MALLOC_IS_NULL(task))
+    return(-1);
+
+  task->state = OBJECT_SCHED_SNAPSHOT;
+  task->flags = OBJECT_SCHED_READ;
+  task->context = fs;
+  task->object.u64 = oid;
+  task->udata = udata;
+  task->args[0].ptr = notify_func;
+  task->args[1].ptr = err_data;
+  task->args[2].ptr = read_func;
+  task->args[3].ptr = NULL;
+
+  __sched_add_task(fs, oid, task);
   return(0);
 }
 
@@ -329,6 +606,6 @@ int raleighsl_exec_write (raleighsl_t *fs,
   task->args[2].ptr = write_func;
   task->args[3].ptr = txn;
 
-  z_global_add_task(task);
+  __sched_add_task(fs, oid, task);
   return(0);
 }
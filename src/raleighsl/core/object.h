@@ -17,6 +17,8 @@
 
 #include <raleighsl/types.h>
 
+#define RALEIGHSL_OBJ_CACHE_BUDGET        (1ULL << 30)
+
 raleighsl_errno_t raleighsl_object_create (raleighsl_t *fs,
                                            const raleighsl_object_plug_t *plug,
                                            uint64_t oid);
@@ -24,6 +26,8 @@ raleighsl_errno_t raleighsl_object_open   (raleighsl_t *fs,
                                            raleighsl_object_t *object);
 raleighsl_errno_t raleighsl_object_close  (raleighsl_t *fs,
                                            raleighsl_object_t *object);
+raleighsl_errno_t raleighsl_object_unlink (raleighsl_t *fs,
+                                           raleighsl_object_t *object);
 raleighsl_errno_t raleighsl_object_sync   (raleighsl_t *fs,
                                            raleighsl_object_t *object);
 
@@ -35,4 +39,14 @@ raleighsl_object_t *raleighsl_obj_cache_get     (raleighsl_t *fs,
 void                raleighsl_obj_cache_release (raleighsl_t *fs,
                                                  raleighsl_object_t *object);
 
+/*
+ * The cached objects are weighted by their membufs footprint, the unused
+ * ones are evicted to keep the total under the budget (0 means no budget).
+ * The dirty objects are pinned until a checkpoint and only counted,
+ * the clean ones evicted are loaded again from their checkpoint extent.
+ */
+void                raleighsl_obj_cache_budget  (raleighsl_t *fs,
+                                                 uint64_t bytes);
+uint64_t            raleighsl_obj_cache_usage   (raleighsl_t *fs);
+
 #endif /* !_RALEIGHSL_OBJECT_H_ */
@@ -54,11 +54,13 @@ Z_TYPEDEF_STRUCT(raleighsl_plug)
 Z_TYPEDEF_STRUCT(raleighsl_transaction)
 Z_TYPEDEF_STRUCT(raleighsl_txn_atom)
 Z_TYPEDEF_STRUCT(raleighsl_journal)
+Z_TYPEDEF_STRUCT(raleighsl_checkpoint)
 Z_TYPEDEF_STRUCT(raleighsl_semantic)
 Z_TYPEDEF_STRUCT(raleighsl_txn_mgr)
 Z_TYPEDEF_STRUCT(raleighsl_object)
 Z_TYPEDEF_STRUCT(raleighsl_master)
 Z_TYPEDEF_STRUCT(raleighsl_device)
+Z_TYPEDEF_STRUCT(raleighsl_blkcache)
 Z_TYPEDEF_STRUCT(raleighsl_block)
 Z_TYPEDEF_STRUCT(raleighsl_key)
 Z_TYPEDEF_STRUCT(raleighsl)
@@ -126,11 +128,23 @@ struct raleighsl_object_plug {
                                        raleighsl_txn_atom_t *atom);
   raleighsl_errno_t   (*commit)       (raleighsl_t *fs,
                                        raleighsl_object_t *object);
+  raleighsl_errno_t   (*replay)       (raleighsl_t *fs,
+                                       raleighsl_object_t *object,
+                                       uint16_t op,
+                                       const uint8_t *data,
+                                       uint32_t size);
 
+  /* Builds the balanced membufs under the read lock, balance() swaps them in */
+  raleighsl_errno_t   (*prepare)      (raleighsl_t *fs,
+                                       raleighsl_object_t *object);
   raleighsl_errno_t   (*balance)      (raleighsl_t *fs,
                                        raleighsl_object_t *object);
   raleighsl_errno_t   (*sync)         (raleighsl_t *fs,
                                        raleighsl_object_t *object);
+
+  /* Bytes held by the membufs, weights the object in the cache */
+  uint64_t            (*footprint)    (raleighsl_t *fs,
+                                       raleighsl_object_t *object);
 };
 
 struct raleighsl_key_plug {
@@ -168,6 +182,12 @@ struct raleighsl_device_plug {
                                        unsigned int size);
 };
 
+/*
+ * The format describes the file-system on the device. load() resolves the
+ * semantic and space plugins not given to raleighsl_open() through the
+ * plugin table, sync() is called once a checkpoint is durable and before
+ * the journal is released. The getters return the stored plugin labels.
+ */
 struct raleighsl_format_plug {
   __RALEIGHSL_PLUGIN_OBJECT__
 
@@ -176,11 +196,17 @@ struct raleighsl_format_plug {
   raleighsl_errno_t   (*unload)       (raleighsl_t *fs);
   raleighsl_errno_t   (*sync)         (raleighsl_t *fs);
 
-  const uint8_t *     (*semantic)     (raleighsl_t *fs);
-  const uint8_t *     (*space)        (raleighsl_t *fs);
-  const uint8_t *     (*key)          (raleighsl_t *fs);
+  const char *        (*semantic)     (raleighsl_t *fs);
+  const char *        (*space)        (raleighsl_t *fs);
+  const char *        (*key)          (raleighsl_t *fs);
 };
 
+/*
+ * Extents are expressed as device offset and length in bytes.
+ * The space map is stored by the checkpoint: sync() writes it and commit()
+ * is called once the checkpoint is durable, so the extents released
+ * before the sync can be reused.
+ */
 struct raleighsl_space_plug {
   __RALEIGHSL_PLUGIN_OBJECT__
 
@@ -188,6 +214,7 @@ struct raleighsl_space_plug {
   raleighsl_errno_t   (*load)         (raleighsl_t *fs);
   raleighsl_errno_t   (*unload)       (raleighsl_t *fs);
   raleighsl_errno_t   (*sync)         (raleighsl_t *fs);
+  raleighsl_errno_t   (*commit)       (raleighsl_t *fs);
 
   raleighsl_errno_t   (*allocate)     (raleighsl_t *fs,
                                        uint64_t request,
@@ -126,7 +126,7 @@ raleighsl_errno_t   __plugin_unregister         (raleighsl_t *fs,
 const raleighsl_plug_t *__plugin_lookup_by_uuid  (raleighsl_t *fs,
                                                   const uint8_t uuid[16]);
 const raleighsl_plug_t *__plugin_lookup_by_label (raleighsl_t *fs,
-                                                  const char *label);
+                                                  const z_byte_slice_t *label);
 
 #define __semantic_plugin_lookup(fs, uuid)                                  \
   RALEIGHSL_SEMANTIC_PLUG(__plugin_lookup_by_uuid(fs, uuid))
@@ -146,14 +146,42 @@ const raleighsl_plug_t *__plugin_lookup_by_label (raleighsl_t *fs,
 /* ============================================================================
  *  Transaction related
  */
-int  raleighsl_txn_mgr_alloc (raleighsl_t *fs);
-void raleighsl_txn_mgr_free  (raleighsl_t *fs);
+int  raleighsl_txn_mgr_alloc   (raleighsl_t *fs);
+void raleighsl_txn_mgr_free    (raleighsl_t *fs);
+void raleighsl_txn_mgr_reserve (raleighsl_t *fs, uint64_t txn_id);
+int  raleighsl_txn_mgr_wait    (raleighsl_t *fs,
+                                raleighsl_object_t *object,
+                                z_task_t *task);
 
 /* ============================================================================
  *  Journal related
  */
-int  raleighsl_journal_alloc (raleighsl_t *fs);
-void raleighsl_journal_free  (raleighsl_t *fs);
+int               raleighsl_journal_alloc  (raleighsl_t *fs);
+void              raleighsl_journal_free   (raleighsl_t *fs);
+void              raleighsl_journal_clear  (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_journal_create (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_journal_replay (raleighsl_t *fs);
+
+/* ============================================================================
+ *  Checkpoint related
+ */
+int               raleighsl_checkpoint_alloc  (raleighsl_t *fs);
+void              raleighsl_checkpoint_free   (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_checkpoint_create (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_checkpoint_load   (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_checkpoint_add    (raleighsl_t *fs,
+                                               raleighsl_object_t *object);
+void              raleighsl_checkpoint_remove (raleighsl_t *fs,
+                                               raleighsl_object_t *object);
+void              raleighsl_checkpoint_lookup (raleighsl_t *fs,
+                                               raleighsl_object_t *object);
+
+/* ============================================================================
+ *  Block Cache related
+ */
+int               raleighsl_blkcache_alloc (raleighsl_t *fs);
+void              raleighsl_blkcache_free  (raleighsl_t *fs);
+raleighsl_errno_t raleighsl_blkcache_flush (raleighsl_t *fs);
 
 /* ============================================================================
  *  Semantic related
@@ -166,8 +194,9 @@ void  raleighsl_semantic_free     (raleighsl_t *fs);
 /* ============================================================================
  *  Object related
  */
-#define raleighsl_object_commit(fs, object)       \
-  __object_call_required(fs, object, commit)
+raleighsl_errno_t raleighsl_object_commit (raleighsl_t *fs,
+                                           raleighsl_object_t *object);
+void              raleighsl_object_expire_parked (raleighsl_t *fs);
 
 #define raleighsl_object_apply(fs, object, mutation)     \
   __object_call_required(fs, object, apply, mutation)
@@ -175,10 +204,27 @@ void  raleighsl_semantic_free     (raleighsl_t *fs);
 #define raleighsl_object_revert(fs, object, mutation)     \
   __object_call_required(fs, object, revert, mutation)
 
+#define raleighsl_object_replay(fs, object, op, data, size)     \
+  __object_call_required(fs, object, replay, op, data, size)
+
+/*
+ * The committed state is changed between publish_begin() and publish_end(),
+ * the version is odd in between. Snapshot readers retry on a version change.
+ */
+#define raleighsl_object_publish_begin(object)                  \
+  z_atomic_inc(&((object)->version))
+
+#define raleighsl_object_publish_end(object)                    \
+  z_atomic_inc(&((object)->version))
+
 /* ============================================================================
  *  Object Cache related
  */
 int                 raleighsl_obj_cache_alloc   (raleighsl_t *fs);
 void                raleighsl_obj_cache_free    (raleighsl_t *fs);
+void                raleighsl_obj_cache_footprint (raleighsl_t *fs,
+                                                   raleighsl_object_t *object);
+void                raleighsl_obj_cache_weight  (raleighsl_t *fs,
+                                                 raleighsl_object_t *object);
 
 #endif /* !_RALEIGHSL_PRIVATE_H_ */
@@ -26,13 +26,21 @@
 #include <raleighsl/filesystem.h>
 #include <raleighsl/transaction.h>
 #include <raleighsl/semantic.h>
+#include <raleighsl/checkpoint.h>
+#include <raleighsl/blkcache.h>
+#include <raleighsl/journal.h>
 #include <raleighsl/object.h>
 #include <raleighsl/exec.h>
 
 #include <raleighsl/devices/memory.h>
+#include <raleighsl/devices/file.h>
 
 #include <raleighsl/semantics/flat.h>
 
+#include <raleighsl/space/extent.h>
+
+#include <raleighsl/formats/master.h>
+
 #include <raleighsl/objects/number.h>
 #include <raleighsl/objects/deque.h>
 #include <raleighsl/objects/sset.h>
@@ -13,12 +13,15 @@
  */
 
 #include <raleighsl/semantic.h>
+#include <raleighsl/journal.h>
 #include <raleighsl/object.h>
 #include <raleighsl/exec.h>
 
 #include <zcl/global.h>
 #include <zcl/debug.h>
 
+#include <string.h>
+
 #include "private.h"
 
 /* ============================================================================
@@ -36,6 +39,62 @@ void raleighsl_semantic_free (raleighsl_t *fs) {
   z_task_rwcsem_close(&(semantic->rwcsem));
 }
 
+/* ============================================================================
+ *  PRIVATE Semantic Journal methods
+ */
+#define __iov_set(iov, base, len)                                          \
+  do {                                                                     \
+    (iov)->iov_base = (void *)(base);                                      \
+    (iov)->iov_len = (len);                                                \
+  } while (0)
+
+static raleighsl_errno_t __semantic_journal_create (raleighsl_t *fs,
+                                                    const raleighsl_object_plug_t *plug,
+                                                    const z_bytes_ref_t *name,
+                                                    uint64_t oid)
+{
+  uint16_t label_size = strlen(plug->info.label);
+  struct iovec iov[3];
+  uint64_t lsn;
+
+  __iov_set(&(iov[0]), &label_size, sizeof(uint16_t));
+  __iov_set(&(iov[1]), plug->info.label, label_size);
+  __iov_set(&(iov[2]), name->slice.data, name->slice.size);
+  return(raleighsl_journal_write(fs, RALEIGHSL_JOURNAL_SEMANTIC,
+                                 RALEIGHSL_JOURNAL_SEMANTIC_CREATE,
+                                 0, oid, iov, 3, &lsn));
+}
+
+static raleighsl_errno_t __semantic_journal_unlink (raleighsl_t *fs,
+                                                    const z_bytes_ref_t *name,
+                                                    uint64_t oid)
+{
+  struct iovec iov[1];
+  uint64_t lsn;
+
+  __iov_set(&(iov[0]), name->slice.data, name->slice.size);
+  return(raleighsl_journal_write(fs, RALEIGHSL_JOURNAL_SEMANTIC,
+                                 RALEIGHSL_JOURNAL_SEMANTIC_UNLINK,
+                                 0, oid, iov, 1, &lsn));
+}
+
+static raleighsl_errno_t __semantic_journal_rename (raleighsl_t *fs,
+                                                    const z_bytes_ref_t *old_name,
+                                                    const z_bytes_ref_t *new_name,
+                                                    uint64_t oid)
+{
+  uint32_t old_size = old_name->slice.size;
+  struct iovec iov[3];
+  uint64_t lsn;
+
+  __iov_set(&(iov[0]), &old_size, sizeof(uint32_t));
+  __iov_set(&(iov[1]), old_name->slice.data, old_size);
+  __iov_set(&(iov[2]), new_name->slice.data, new_name->slice.size);
+  return(raleighsl_journal_write(fs, RALEIGHSL_JOURNAL_SEMANTIC,
+                                 RALEIGHSL_JOURNAL_SEMANTIC_RENAME,
+                                 0, oid, iov, 3, &lsn));
+}
+
 /* ============================================================================
  *  PUBLIC Semantic methods
  */
@@ -66,6 +125,10 @@ raleighsl_errno_t raleighsl_semantic_create (raleighsl_t *fs,
     return(errno);
   }
 
+  if ((errno = __semantic_journal_create(fs, plug, name, *oid))) {
+    return(errno);
+  }
+
   /* __observer_notify_create(fs, name); */
   return(RALEIGHSL_ERRNO_NONE);
 }
@@ -112,13 +175,17 @@ raleighsl_errno_t raleighsl_semantic_unlink (raleighsl_t *fs,
     return(RALEIGHSL_ERRNO_NO_MEMORY);
   }
 
-  if ((errno = __object_call_unrequired(fs, object, unlink))) {
+  if ((errno = raleighsl_object_unlink(fs, object))) {
     raleighsl_obj_cache_release(fs, object);
     return(errno);
   }
 
   raleighsl_obj_cache_release(fs, object);
 
+  if ((errno = __semantic_journal_unlink(fs, name, oid))) {
+    return(errno);
+  }
+
   /* __observer_notify_unlink(fs, object->name); */
   return(RALEIGHSL_ERRNO_NONE);
 }
@@ -151,6 +218,10 @@ raleighsl_errno_t raleighsl_semantic_rename (raleighsl_t *fs,
     return(errno);
   }
 
+  if ((errno = __semantic_journal_rename(fs, old_name, new_name, oid))) {
+    return(errno);
+  }
+
   /* __observer_notify_rename(fs, old_name, new_name); */
   return(RALEIGHSL_ERRNO_NONE);
 }
@@ -164,6 +235,7 @@ enum semantic_sched_state {
   SEMANTIC_SCHED_UNLINK = 2,
   SEMANTIC_SCHED_RENAME = 3,
   SEMANTIC_SCHED_COMMIT = 4,
+  SEMANTIC_SCHED_SYNC   = 5,
 };
 
 static z_rwcsem_op_t __sched_state_rwc_op[] = {
@@ -197,6 +269,16 @@ static void __sched_semantic_task_exec (z_task_t *task) {
   int keep_running = 0;
   int is_complete = 1;
 
+  /* Woken up by the journal group-commit */
+  if (task->state == SEMANTIC_SCHED_SYNC) {
+    errno = RALEIGHSL_ERRNO_NONE;
+    if (raleighsl_journal_wait(fs, task->args[3].u64, task, &errno))
+      return;
+    __sched_task_notify_func_exec(fs, 0, errno, task);
+    z_task_free(task);
+    return;
+  }
+
   op_type = __sched_state_rwc_op[task->state];
   if (z_task_rwcsem_acquire(&(fs->semantic.rwcsem), op_type, task))
     return;
@@ -231,12 +313,19 @@ static void __sched_semantic_task_exec (z_task_t *task) {
         break;
       case SEMANTIC_SCHED_COMMIT:
         errno = raleighsl_semantic_commit(fs);
+        task->args[3].u64 = raleighsl_journal_lsn(fs);
         break;
     }
   } while (keep_running);
   z_task_rwcsem_release(&(fs->semantic.rwcsem), op_type, task, is_complete);
 
   if (is_complete) {
+    /* Notify the user once the semantic update is on disk */
+    if (task->state == SEMANTIC_SCHED_COMMIT && !errno) {
+      task->state = SEMANTIC_SCHED_SYNC;
+      if (raleighsl_journal_wait(fs, task->args[3].u64, task, &errno))
+        return;
+    }
     __sched_task_notify_func_exec(fs, 0, errno, task);
     z_task_free(task);
   }
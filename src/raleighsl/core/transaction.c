@@ -13,6 +13,7 @@
  */
 
 #include <raleighsl/transaction.h>
+#include <raleighsl/journal.h>
 #include <raleighsl/exec.h>
 
 #include <zcl/global.h>
@@ -34,7 +35,7 @@ enum txn_sched_state {
   TXN_SCHED_LOCK,
   TXN_SCHED_WRITE,
   TXN_SCHED_COMMIT,
-  TXN_SCHED_COMPLETE,
+  TXN_SCHED_SYNC,
 };
 
 enum txn_commit_type {
@@ -156,7 +157,14 @@ void raleighsl_transaction_free (raleighsl_t *fs, raleighsl_transaction_t *txn)
 /* ============================================================================
  *  RaleighSL Transaction Scheduler
  */
-static int __txn_mgr_acquire_barrier (raleighsl_t *fs, raleighsl_transaction_t *txn) {
+/*
+ * Tasks that find an object behind a txn barrier are parked on the object
+ * txn-queue, and woken once the barrier is released.
+ */
+static int __txn_mgr_acquire_barrier (raleighsl_t *fs,
+                                      raleighsl_transaction_t *txn,
+                                      z_task_t *task)
+{
   struct txn_obj_group *group;
   int is_available = 1;
 
@@ -164,6 +172,7 @@ static int __txn_mgr_acquire_barrier (raleighsl_t *fs, raleighsl_transaction_t *
 
   for (group = (struct txn_obj_group *)txn->objects; group != NULL; group = group->next) {
     if (group->object->pending_txn_id != 0) {
+      z_task_queue_push(&(group->object->txnq), task);
       is_available = 0;
       break;
     }
@@ -183,16 +192,35 @@ static int __txn_mgr_acquire_barrier (raleighsl_t *fs, raleighsl_transaction_t *
 
 static void __txn_mgr_release_locks (raleighsl_t *fs, raleighsl_transaction_t *txn) {
   struct txn_obj_group *group;
+  z_task_queue_t wake;
+
+  z_task_queue_open(&wake);
   z_ticket_acquire(&(fs->txn_mgr->lock));
   for (group = (struct txn_obj_group *)txn->objects; group != NULL; group = group->next) {
     raleighsl_object_t *object = group->object;
+
     Z_ASSERT(object->pending_txn_id == raleighsl_txn_id(txn),
              "unlocking the wrong transaction current=%"PRIu64" expected=%"PRIu64" oid=%"PRIu64"",
              object->pending_txn_id, raleighsl_txn_id(txn), raleighsl_oid(object));
     z_task_rwcsem_release(&(object->rwcsem), Z_RWCSEM_LOCK, NULL, 1);
     object->pending_txn_id = 0;
+
+    /* Chain the parked tasks, they are dispatched once */
+    z_task_queue_concat(&wake, &(object->txnq));
   }
   z_ticket_release(&(fs->txn_mgr->lock));
+
+  if (wake.head != NULL)
+    z_global_add_pending_tasks(z_task_queue_drain(&wake));
+  z_task_queue_close(&wake);
+}
+
+/* Called before the apply and once the commit is done */
+static void __txn_objects_publish (raleighsl_transaction_t *txn) {
+  struct txn_obj_group *group;
+  for (group = (struct txn_obj_group *)txn->objects; group != NULL; group = group->next) {
+    z_atomic_inc(&(group->object->version));
+  }
 }
 
 /* ============================================================================
@@ -202,6 +230,16 @@ static void __txn_mgr_release_locks (raleighsl_t *fs, raleighsl_transaction_t *t
   ((raleighsl_notify_func_t)((task)->args[0].ptr))                      \
     (fs, oid, errno, (task)->udata, ((task)->args[1].ptr))
 
+static void __sched_txn_task_complete (z_task_t *task,
+                                       raleighsl_t *fs,
+                                       raleighsl_transaction_t *txn,
+                                       raleighsl_errno_t errno)
+{
+  __sched_task_notify_func_exec(fs, 0, errno, task);
+  z_cache_release(fs->txn_mgr->cache, &(txn->cache_entry));
+  z_task_free(task);
+}
+
 static void __sched_txn_task_exec (z_task_t *task) {
   raleighsl_transaction_t *txn = RALEIGHSL_TRANSACTION(task->object.ptr);
   enum txn_commit_type commit_type = task->args[2].fd;
@@ -209,6 +247,14 @@ static void __sched_txn_task_exec (z_task_t *task) {
   raleighsl_t *fs = RALEIGHSL(task->context);
   int is_complete = 0;
 
+  /* Woken up by the journal group-commit */
+  if (task->state == TXN_SCHED_SYNC) {
+    if (raleighsl_journal_wait(fs, task->args[3].u64, task, &errno))
+      return;
+    __sched_txn_task_complete(task, fs, txn, errno);
+    return;
+  }
+
   /* Acquire the transaction lock */
   if (task->state == TXN_SCHED_ACQUIRE) {
     Z_LOG_TRACE("Try acquire commit on TXN-ID %"PRIu64, raleighsl_txn_id(txn));
@@ -221,11 +267,8 @@ static void __sched_txn_task_exec (z_task_t *task) {
   /* Acquire the objects transaction lock */
   if (task->state == TXN_SCHED_BARRIER) {
     Z_LOG_TRACE("Try acquire object lock flags on TXN-ID %"PRIu64, raleighsl_txn_id(txn));
-    if (!__txn_mgr_acquire_barrier(fs, txn)) {
-      /* TODO: Use a task sem? */
-      z_global_add_pending_tasks(task);
+    if (!__txn_mgr_acquire_barrier(fs, txn, task))
       return;
-    }
     task->state = TXN_SCHED_LOCK;
     task->args[3].ptr = txn->objects;
   }
@@ -250,6 +293,9 @@ static void __sched_txn_task_exec (z_task_t *task) {
   if (task->state == TXN_SCHED_WRITE) {
     struct txn_obj_group *group;
 
+    /* Snapshot readers see the previous version until the txn is committed */
+    __txn_objects_publish(txn);
+
     /* Revert instead of committing, if an error occurred */
     if (commit_type == TXN_APPLY && txn->state == RALEIGHSL_TXN_DONT_COMMIT) {
       Z_LOG_TRACE("TXN-ID %"PRIu64" COMMIT reverted to ROLLBACK", raleighsl_txn_id(txn));
@@ -296,17 +342,28 @@ static void __sched_txn_task_exec (z_task_t *task) {
   /* Execute the transaction commit */
   if (task->state == TXN_SCHED_COMMIT) {
     struct txn_obj_group *group;
+    uint64_t lsn = 0;
 
     Z_LOG_TRACE("Commit TXN-ID %"PRIu64, raleighsl_txn_id(txn));
     for (group = (struct txn_obj_group *)txn->objects; group != NULL; group = group->next) {
       raleighsl_object_t *object = group->object;
 
+      /* Journal records written by the commit belong to this txn */
+      object->journal_txn_id = raleighsl_txn_id(txn);
       errno = raleighsl_object_commit(fs, object);
+      object->journal_txn_id = 0;
       /* TODO: How to handle commit error? */
     }
 
+    /* Replay will apply the txn records only if the commit mark is there */
+    if (!errno && commit_type == TXN_APPLY) {
+      errno = raleighsl_journal_write(fs, RALEIGHSL_JOURNAL_COMMIT, 0,
+                                      raleighsl_txn_id(txn), 0, NULL, 0, &lsn);
+    }
+
     is_complete = 1;
-    task->state = TXN_SCHED_COMPLETE;
+    task->state = TXN_SCHED_SYNC;
+    task->args[3].u64 = lsn;
   }
 
   Z_ASSERT(is_complete == 1, "TXN not completed");
@@ -322,11 +379,16 @@ static void __sched_txn_task_exec (z_task_t *task) {
   }
 
   Z_LOG_TRACE("Completed %d TXN-ID %"PRIu64" - %s", is_complete, raleighsl_txn_id(txn), raleighsl_errno_string(errno));
+  __txn_objects_publish(txn);
   __txn_mgr_release_locks(fs, txn);
   z_task_rwcsem_release(&(txn->rwcsem), Z_RWCSEM_COMMIT, task, is_complete);
-  __sched_task_notify_func_exec(fs, 0, errno, task);
-  z_cache_release(fs->txn_mgr->cache, &(txn->cache_entry));
-  z_task_free(task);
+
+  /* Locks are released, notify the user once the commit is durable */
+  if (txn->state == RALEIGHSL_TXN_COMMITTED) {
+    if (raleighsl_journal_wait(fs, task->args[3].u64, task, &errno))
+      return;
+  }
+  __sched_txn_task_complete(task, fs, txn, errno);
 }
 
 static int __txn_commit_task (raleighsl_t *fs,
@@ -420,6 +482,28 @@ void raleighsl_txn_mgr_free (raleighsl_t *fs) {
   z_memory_struct_free(z_global_memory(), raleighsl_txn_mgr_t, txn_mgr);
 }
 
+void raleighsl_txn_mgr_reserve (raleighsl_t *fs, uint64_t txn_id) {
+  raleighsl_txn_mgr_t *txn_mgr = fs->txn_mgr;
+  /* next_txn_id is pre-incremented on begin */
+  if (txn_mgr->next_txn_id < txn_id)
+    txn_mgr->next_txn_id = txn_id;
+}
+
+/* Parks the task until the object txn barrier is released */
+int raleighsl_txn_mgr_wait (raleighsl_t *fs,
+                            raleighsl_object_t *object,
+                            z_task_t *task)
+{
+  int is_waiting;
+  z_ticket_acquire(&(fs->txn_mgr->lock));
+  if ((is_waiting = (object->pending_txn_id != 0))) {
+    Z_LOG_TRACE("Wait for pending TXN-ID %"PRIu64, object->pending_txn_id);
+    z_task_queue_push(&(object->txnq), task);
+  }
+  z_ticket_release(&(fs->txn_mgr->lock));
+  return(is_waiting);
+}
+
 raleighsl_errno_t raleighsl_transaction_add (raleighsl_t *fs,
                                              raleighsl_transaction_t *transaction,
                                              raleighsl_object_t *object,
@@ -551,9 +635,12 @@ raleighsl_errno_t raleighsl_transaction_acquire (raleighsl_t *fs,
     if (entry == NULL)
       return(RALEIGHSL_ERRNO_TXN_NOT_FOUND);
 
+    /* The lookup may still find a txn removed by the commit */
     txn_ctx = __txn_from_cache_entry(entry);
-    if (!z_rwcsem_try_acquire_read(&(txn_ctx->rwcsem.lock)))
+    if (!z_rwcsem_try_acquire_read(&(txn_ctx->rwcsem.lock))) {
+      z_cache_release(fs->txn_mgr->cache, entry);
       return(RALEIGHSL_ERRNO_TXN_CLOSED);
+    }
 
     *txn = txn_ctx;
   }
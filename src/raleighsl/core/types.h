@@ -20,9 +20,11 @@ __Z_BEGIN_DECLS__
 
 #include <zcl/hashmap.h>
 #include <zcl/object.h>
+#include <zcl/threading.h>
 #include <zcl/opaque.h>
 #include <zcl/ticket.h>
 #include <zcl/cache.h>
+#include <zcl/tree.h>
 #include <zcl/dlink.h>
 #include <zcl/task.h>
 
@@ -35,14 +37,25 @@ __Z_BEGIN_DECLS__
 #define raleighsl_txn_id(txn)           z_cache_entry_oid(&((txn)->cache_entry))
 
 struct raleighsl_master {
+  uint32_t mb_crc;                        /* crc32c of the master block */
   uint8_t  mb_magic[12];                  /* Master block magic */
 
   uint32_t mb_format;                     /* File-system format in use */
+  uint32_t mb_version;                    /* Version of the last writer */
   uint64_t mb_ctime;                      /* File-system creation time */
 
   uint8_t  mb_uuid[16];                   /* File-system 128-bit uuid in use */
   uint8_t  mb_label[16];                  /* Files-ystem label in use */
 
+  uint8_t  mb_semantic[16];               /* Semantic plugin label */
+  uint8_t  mb_space[16];                  /* Space plugin label */
+  uint8_t  mb_key[16];                    /* Key plugin label */
+
+  uint64_t mb_ckpt_generation;            /* Last checkpoint generation */
+  uint64_t mb_ckpt_offset;                /* Device offset of its head */
+  uint64_t mb_journal_base_lsn;           /* LSN stored at the log offset */
+  uint64_t mb_journal_lsn;                /* Journal replay starts here */
+
   uint64_t mb_qmagic;                     /* Master block end-magic */
 } __attribute__((__packed__));
 
@@ -62,15 +75,14 @@ struct raleighsl_txn_atom {
 };
 
 struct raleighsl_block {
-  z_cache_entry_t cache_entry;
+  z_cache_entry_t cache_entry;            /* Block Cache Entry (oid = blkno) */
 
-  z_tree_node_t hash_node;
-  uint64_t hash[4];
+  z_tree_node_t dirty_node;               /* Shard dirty tree node */
 
-  uint32_t length;
-  uint32_t pad;
+  uint32_t length;                        /* Data length */
+  uint32_t flags;                         /* Block state flags */
 
-  uint8_t *data;
+  uint8_t *data;                          /* Block data */
 };
 
 struct raleighsl_transaction {
@@ -88,13 +100,24 @@ struct raleighsl_transaction {
 struct raleighsl_object {
   z_cache_entry_t cache_entry;            /* Object Cache Entry */
   z_dlink_node_t journal;                 /* Object Journal Node */
+  z_dlink_node_t parked;                  /* Object Parked-reads Node */
 
   z_task_rwcsem_t rwcsem;                 /* Object RWC-Task-Lock */
+  uint64_t version;                       /* Committed version, odd on publish */
   uint64_t pending_txn_id;                /* Pending Transaction Id */
+  z_task_queue_t txnq;                    /* Tasks waiting for the pending txn */
+  z_task_queue_t waitq;                   /* Reads waiting for the next commit */
+  uint64_t journal_txn_id;                /* Committing Transaction Id */
+  uint64_t journal_lsn;                   /* Last journal record end-LSN */
+  uint64_t ckpt_lsn;                      /* Records below are checkpointed */
+  uint64_t ckpt_offset;                   /* Checkpoint extent to load */
+  uint64_t ckpt_length;
 
   const raleighsl_object_plug_t *plug;    /* Object plugin */
 
   int requires_balancing; /* TODO: REMOVE ME! */
+  int balancing;                          /* Balance task in flight */
+  uint64_t footprint;                     /* Cache weight, in bytes */
 
   void *devbufs;                          /* Object Device buffers */
   void *membufs;                          /* Object Memory buffers */
@@ -111,13 +134,75 @@ struct raleighsl_semantic {
 };
 
 struct raleighsl_journal {
-  z_spinlock_t   lock;                    /* Object list lock */
-  z_dlink_node_t objects;                 /* Dirty Objects */
-  uint64_t       otime;                   /* Oldest entry Time */
+  z_spinlock_t      lock;                 /* Object list lock */
+  z_dlink_node_t    objects;              /* Dirty Objects */
+  uint64_t          otime;                /* Oldest entry Time */
+
+  z_spinlock_t      wlock;                /* Log buffers lock */
+  z_task_queue_t    syncq;                /* Tasks waiting for a flush */
+  struct {
+    uint8_t *       data;
+    size_t          size;
+    size_t          capacity;
+  } buffers[2];                           /* Active/Flushing log buffers */
+  int               active;               /* Buffer receiving new records */
+  int               is_flushing;          /* A group-commit flush is running */
+  int               is_full;              /* Flushes wait for a checkpoint */
+  raleighsl_errno_t full_error;           /* Failed checkpoint of a full log */
+  int               enabled;              /* Records are logged */
+  raleighsl_errno_t flush_error;          /* Sticky I/O error */
+
+  uint64_t          offset;               /* Device offset of the log area */
+  uint64_t          size;                 /* Device size of the log area */
+  uint64_t          base_lsn;             /* LSN stored at the area offset */
+  uint64_t          next_lsn;             /* LSN of the next record */
+  uint64_t          sync_lsn;             /* Durable LSN */
+  uint64_t          tail_lsn;             /* Oldest LSN still required */
+};
+
+struct raleighsl_checkpoint {
+  z_spinlock_t      lock;                 /* Object tree lock */
+  z_tree_node_t *   objects;              /* Live Objects by oid */
+  uint64_t          nobjects;
+
+  z_mutex_t         wlock;                /* Checkpoint run lock */
+  z_wait_cond_t     wcond;                /* Signaled at the end of a run */
+  int               is_running;           /* A checkpoint is running */
+  raleighsl_errno_t error;                /* Last run error */
+  void *            run;                  /* Checkpoint in progress */
+
+  uint64_t          area_offset;          /* Device offset of the slots */
+  uint64_t          slot_size;            /* Device size of each slot */
+  uint64_t          generation;           /* Last checkpoint generation */
+  uint64_t          journal_lsn;          /* Journal lsn of the last checkpoint */
+  int               slot;                 /* Slot of the last checkpoint */
+
+  z_mutex_t         rlock;                /* Read-ahead buffer lock */
+  struct {
+    uint8_t *       data;
+    uint64_t        offset;
+    uint64_t        limit;
+    size_t          size;
+  } rbuf;                                 /* Extents read-ahead buffer */
+
+  struct {
+    uint64_t        offset;
+    uint64_t        length;
+  } space;                                /* Space map of the loaded checkpoint */
+};
+
+#define RALEIGHSL_BLKCACHE_SHARDS         16
+
+struct raleighsl_blkcache_shard {
+  z_cache_t *     cache;                  /* Shard W-TinyLFU cache */
+  z_spinlock_t    lock;                   /* Dirty tree lock */
+  z_tree_node_t * dirty;                  /* Dirty blocks sorted by blkno */
+  unsigned int    ndirty;                 /* Number of dirty blocks */
 };
 
 struct raleighsl_blkcache {
-  z_cache_t *cache;
+  struct raleighsl_blkcache_shard shards[RALEIGHSL_BLKCACHE_SHARDS];
+  uint64_t        budget;                 /* Memory budget in bytes */
 };
 
 struct raleighsl_device {
@@ -140,8 +225,13 @@ struct raleighsl {
   raleighsl_semantic_t  semantic;         /* Semantic Layer */
   raleighsl_txn_mgr_t * txn_mgr;          /* Transaction Manager */
   raleighsl_journal_t   journal;          /* Journal Layer */
+  raleighsl_checkpoint_t checkpoint;      /* Checkpoint Layer */
+  raleighsl_blkcache_t  blkcache;         /* Block Cache */
 
   z_cache_t *           obj_cache;
+  z_spinlock_t          parked_lock;      /* Objects with parked reads */
+  z_dlink_node_t        parked;
+  int                   affinity;         /* Object tasks run on a home cpu */
   raleighsl_device_t *  device;
   z_hash_map_t          plugins;
   raleighsl_master_t    master;
@@ -0,0 +1,342 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__linux__)
+  #include <linux/fs.h>
+#endif
+
+#include <zcl/string.h>
+#include <zcl/atomic.h>
+#include <zcl/debug.h>
+
+#include "file.h"
+
+#define __file_device(fs)         RALEIGHSL_FILE_DEVICE((fs)->device)
+
+/* ============================================================================
+ *  PRIVATE File Device I/O helpers
+ */
+static raleighsl_errno_t __file_pread (int fd, uint64_t offset,
+                                       uint8_t *buffer, size_t size)
+{
+  while (size > 0) {
+    ssize_t rd = pread(fd, buffer, size, offset);
+    if (Z_UNLIKELY(rd < 0)) {
+      if (errno == EINTR)
+        continue;
+      Z_LOG_WARN("file-device pread(%"PRIu64", %zu): %s",
+                 offset, size, strerror(errno));
+      return(RALEIGHSL_ERRNO_DEVICE_IO);
+    }
+
+    if (rd == 0) {
+      /* Reading past the end of a sparse file */
+      z_memzero(buffer, size);
+      break;
+    }
+
+    buffer += rd;
+    offset += rd;
+    size -= rd;
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __file_pwrite (int fd, uint64_t offset,
+                                        const uint8_t *buffer, size_t size)
+{
+  while (size > 0) {
+    ssize_t wr = pwrite(fd, buffer, size, offset);
+    if (Z_UNLIKELY(wr < 0)) {
+      if (errno == EINTR)
+        continue;
+      Z_LOG_WARN("file-device pwrite(%"PRIu64", %zu): %s",
+                 offset, size, strerror(errno));
+      return((errno == ENOSPC) ? RALEIGHSL_ERRNO_DEVICE_NO_SPACE :
+                                 RALEIGHSL_ERRNO_DEVICE_IO);
+    }
+
+    buffer += wr;
+    offset += wr;
+    size -= wr;
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static int __file_is_aligned (const raleighsl_file_device_t *device,
+                              uint64_t offset,
+                              const void *buffer,
+                              unsigned int size)
+{
+  const uint64_t mask = device->align - 1;
+  return(((offset | size | (uintptr_t)buffer) & mask) == 0);
+}
+
+/*
+ * O_DIRECT requires offset, size and memory to be aligned to the
+ * device block size. Unaligned requests go through an aligned bounce buffer,
+ * callers that care about the extra copy should use
+ * raleighsl_file_device_buffer_alloc() and block-aligned offsets.
+ * The alignment is widened to 64bit, to not mask out the high offset bits.
+ */
+static raleighsl_errno_t __file_direct_read (raleighsl_file_device_t *device,
+                                             uint64_t offset,
+                                             void *buffer,
+                                             unsigned int size)
+{
+  const uint64_t align = device->align;
+  uint64_t astart, aend;
+  raleighsl_errno_t res;
+  uint8_t *bounce;
+
+  astart = z_align_down(offset, align);
+  aend = z_align_up(offset + size, align);
+  bounce = raleighsl_file_device_buffer_alloc(device, aend - astart);
+  if (Z_MALLOC_IS_NULL(bounce))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  res = __file_pread(device->fd, astart, bounce, aend - astart);
+  if (Z_LIKELY(res == RALEIGHSL_ERRNO_NONE)) {
+    z_memcpy(buffer, bounce + (offset - astart), size);
+  }
+
+  raleighsl_file_device_buffer_free(bounce);
+  return(res);
+}
+
+static raleighsl_errno_t __file_direct_write (raleighsl_file_device_t *device,
+                                              uint64_t offset,
+                                              const void *buffer,
+                                              unsigned int size)
+{
+  const uint64_t align = device->align;
+  uint64_t astart, aend;
+  raleighsl_errno_t res;
+  uint8_t *bounce;
+
+  astart = z_align_down(offset, align);
+  aend = z_align_up(offset + size, align);
+  bounce = raleighsl_file_device_buffer_alloc(device, aend - astart);
+  if (Z_MALLOC_IS_NULL(bounce))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  /* Read-modify-write the partial head and tail blocks */
+  res = RALEIGHSL_ERRNO_NONE;
+  if (astart != offset) {
+    res = __file_pread(device->fd, astart, bounce, device->align);
+  }
+  if (res == RALEIGHSL_ERRNO_NONE && aend != (offset + size) &&
+      (astart == offset || (aend - device->align) != astart))
+  {
+    res = __file_pread(device->fd, aend - device->align,
+                       bounce + (aend - astart - device->align), device->align);
+  }
+
+  if (Z_LIKELY(res == RALEIGHSL_ERRNO_NONE)) {
+    z_memcpy(bounce + (offset - astart), buffer, size);
+    res = __file_pwrite(device->fd, astart, bounce, aend - astart);
+  }
+
+  raleighsl_file_device_buffer_free(bounce);
+  return(res);
+}
+
+static uint64_t __file_capacity (int fd, const struct stat *st, uint64_t size) {
+#if defined(BLKGETSIZE64)
+  if (S_ISBLK(st->st_mode)) {
+    uint64_t bdev_size;
+    if (!ioctl(fd, BLKGETSIZE64, &bdev_size))
+      return(bdev_size);
+  }
+#endif
+
+  if (size == 0) {
+    struct statvfs vfs;
+    /* Unbounded file, the limit is the underlying file-system */
+    if (!fstatvfs(fd, &vfs))
+      return(st->st_size + ((uint64_t)vfs.f_bavail * vfs.f_frsize));
+    return(st->st_size);
+  }
+
+  return(z_max(size, (uint64_t)st->st_size));
+}
+
+/* ============================================================================
+ *  File Device plugin
+ */
+static uint64_t __file_used (raleighsl_t *fs) {
+  raleighsl_file_device_t *device = __file_device(fs);
+  return(z_atomic_load(&(device->used)));
+}
+
+static uint64_t __file_free (raleighsl_t *fs) {
+  raleighsl_file_device_t *device = __file_device(fs);
+  uint64_t used = z_atomic_load(&(device->used));
+  return((device->size > used) ? (device->size - used) : 0);
+}
+
+static raleighsl_errno_t __file_sync (raleighsl_t *fs) {
+  raleighsl_file_device_t *device = __file_device(fs);
+  int res;
+
+#if defined(_POSIX_SYNCHRONIZED_IO) && (_POSIX_SYNCHRONIZED_IO > 0)
+  res = fdatasync(device->fd);
+#else
+  res = fsync(device->fd);
+#endif
+
+  if (Z_UNLIKELY(res < 0)) {
+    Z_LOG_WARN("file-device sync failed: %s", strerror(errno));
+    return(RALEIGHSL_ERRNO_DEVICE_IO);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __file_read (raleighsl_t *fs,
+                                      uint64_t offset,
+                                      void *buffer,
+                                      unsigned int size)
+{
+  raleighsl_file_device_t *device = __file_device(fs);
+
+  if (Z_UNLIKELY(offset + size > device->size))
+    return(RALEIGHSL_ERRNO_DEVICE_IO);
+
+  if ((device->flags & RALEIGHSL_FILE_DEVICE_DIRECT) &&
+      !__file_is_aligned(device, offset, buffer, size))
+  {
+    return(__file_direct_read(device, offset, buffer, size));
+  }
+
+  return(__file_pread(device->fd, offset, buffer, size));
+}
+
+static raleighsl_errno_t __file_write (raleighsl_t *fs,
+                                       uint64_t offset,
+                                       const void *buffer,
+                                       unsigned int size)
+{
+  raleighsl_file_device_t *device = __file_device(fs);
+  raleighsl_errno_t res;
+  uint64_t end;
+
+  end = offset + size;
+  if (Z_UNLIKELY(end > device->size))
+    return(RALEIGHSL_ERRNO_DEVICE_NO_SPACE);
+
+  if ((device->flags & RALEIGHSL_FILE_DEVICE_DIRECT) &&
+      !__file_is_aligned(device, offset, buffer, size))
+  {
+    res = __file_direct_write(device, offset, buffer, size);
+  } else {
+    res = __file_pwrite(device->fd, offset, buffer, size);
+  }
+
+  if (Z_LIKELY(res == RALEIGHSL_ERRNO_NONE)) {
+    uint64_t used = z_atomic_load(&(device->used));
+    while (used < end && !z_atomic_cas(&(device->used), used, end))
+      used = z_atomic_load(&(device->used));
+  }
+  return(res);
+}
+
+const raleighsl_device_plug_t raleighsl_device_file = {
+  .info = {
+    .type = RALEIGHSL_PLUG_TYPE_DEVICE,
+    .description = "File/Block Device",
+    .label       = "device-file",
+  },
+
+  .used    = __file_used,
+  .free    = __file_free,
+  .sync    = __file_sync,
+  .read    = __file_read,
+  .write   = __file_write,
+};
+
+/* ============================================================================
+ *  PUBLIC File Device methods
+ */
+raleighsl_errno_t raleighsl_file_device_open (raleighsl_file_device_t *device,
+                                              const char *path,
+                                              uint64_t size,
+                                              uint32_t flags)
+{
+  struct stat st;
+  int oflags;
+
+  oflags = O_RDWR | O_CREAT;
+#if defined(O_DIRECT)
+  if (flags & RALEIGHSL_FILE_DEVICE_DIRECT)
+    oflags |= O_DIRECT;
+#endif
+
+  if ((device->fd = open(path, oflags, 0644)) < 0) {
+    Z_LOG_WARN("file-device unable to open %s: %s", path, strerror(errno));
+    return(RALEIGHSL_ERRNO_DEVICE_IO);
+  }
+
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+  if (flags & RALEIGHSL_FILE_DEVICE_DIRECT)
+    fcntl(device->fd, F_NOCACHE, 1);
+#endif
+
+  if (fstat(device->fd, &st) < 0) {
+    Z_LOG_WARN("file-device unable to stat %s: %s", path, strerror(errno));
+    close(device->fd);
+    return(RALEIGHSL_ERRNO_DEVICE_IO);
+  }
+
+  device->__base__.plug = &raleighsl_device_file;
+  device->flags = flags;
+  device->align = RALEIGHSL_FILE_DEVICE_ALIGN;
+#if defined(BLKSSZGET)
+  if (S_ISBLK(st.st_mode)) {
+    int bsize;
+    if (!ioctl(device->fd, BLKSSZGET, &bsize) && bsize > 0)
+      device->align = z_max((uint32_t)bsize, device->align);
+  }
+#endif
+  device->size = __file_capacity(device->fd, &st, size);
+  device->used = S_ISREG(st.st_mode) ? st.st_size : 0;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+void raleighsl_file_device_close (raleighsl_file_device_t *device) {
+  close(device->fd);
+  device->fd = -1;
+}
+
+void *raleighsl_file_device_buffer_alloc (const raleighsl_file_device_t *device,
+                                          unsigned int size)
+{
+  void *buffer;
+  if (posix_memalign(&buffer, device->align, z_align_up(size, device->align)))
+    return(NULL);
+  return(buffer);
+}
+
+void raleighsl_file_device_buffer_free (void *buffer) {
+  free(buffer);
+}
@@ -0,0 +1,254 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/checksum.h>
+#include <zcl/global.h>
+#include <zcl/string.h>
+#include <zcl/debug.h>
+#include <zcl/math.h>
+#include <zcl/time.h>
+
+#include <string.h>
+
+#include "master.h"
+
+/*
+ * The master block identifies the file-system: format and version, uuid,
+ * and the labels of the semantic and space plugins used to create it.
+ * It also points to the last durable checkpoint head and to the journal
+ * position the replay starts from, it is rewritten by every checkpoint
+ * before the journal is released.
+ */
+#define __MASTER_FORMAT             (1)
+#define __MASTER_LABEL_SIZE         (16)
+
+#define __master_crc(master)                                                 \
+  z_csum32_crcc(0, (master)->mb_magic, sizeof(raleighsl_master_t) - 4)
+
+#define __version_major(version)    ((version) >> 16)
+
+/* ============================================================================
+ *  PRIVATE Master helpers
+ */
+static void __master_set_label (uint8_t label[__MASTER_LABEL_SIZE],
+                                const raleighsl_plug_t *plug)
+{
+  z_memzero(label, __MASTER_LABEL_SIZE);
+  if (plug != NULL) {
+    /* Keep the label NUL terminated */
+    size_t size = z_min(z_strlen(plug->label), __MASTER_LABEL_SIZE - 1);
+    z_memcpy(label, plug->label, size);
+  }
+}
+
+static int __master_label_match (const uint8_t label[__MASTER_LABEL_SIZE],
+                                 const raleighsl_plug_t *plug)
+{
+  uint8_t plabel[__MASTER_LABEL_SIZE];
+  __master_set_label(plabel, plug);
+  return(!z_memcmp(label, plabel, __MASTER_LABEL_SIZE));
+}
+
+static void __master_label_slice (z_byte_slice_t *slice,
+                                  const uint8_t label[__MASTER_LABEL_SIZE])
+{
+  z_byte_slice_set(slice, label, strnlen((const char *)label, __MASTER_LABEL_SIZE));
+}
+
+static void __master_uuid_generate (uint8_t uuid[16]) {
+  unsigned int seed = z_time_nanos();
+  int i;
+
+  for (i = 0; i < 16; i += 2) {
+    unsigned int r = z_rand(&seed);
+    uuid[i + 0] = r & 0xff;
+    uuid[i + 1] = (r >> 8) & 0xff;
+  }
+
+  /* Random UUID (version 4, variant 1) */
+  uuid[6] = (uuid[6] & 0x0f) | 0x40;
+  uuid[8] = (uuid[8] & 0x3f) | 0x80;
+}
+
+/*
+ * The plugins passed to raleighsl_open() must match the ones stored,
+ * the missing ones are looked up by label in the plugin table.
+ */
+static raleighsl_errno_t __master_resolve (raleighsl_t *fs) {
+  raleighsl_master_t *master = &(fs->master);
+  z_byte_slice_t label;
+
+  if (fs->semantic.plug == NULL) {
+    __master_label_slice(&label, master->mb_semantic);
+    if (label.size > 0 && (fs->semantic.plug = raleighsl_semantic_plug_lookup(fs, &label)) == NULL) {
+      Z_LOG_ERROR("master: semantic plugin %.16s is not loaded", master->mb_semantic);
+      return(RALEIGHSL_ERRNO_PLUGIN_NOT_LOADED);
+    }
+  } else if (!__master_label_match(master->mb_semantic, &(fs->semantic.plug->info))) {
+    Z_LOG_ERROR("master: created with the semantic plugin %.16s", master->mb_semantic);
+    return(RALEIGHSL_ERRNO_PLUGIN_NOT_LOADED);
+  }
+
+  if (fs->space.plug == NULL) {
+    __master_label_slice(&label, master->mb_space);
+    if (label.size > 0 && (fs->space.plug = raleighsl_space_plug_lookup(fs, &label)) == NULL) {
+      Z_LOG_ERROR("master: space plugin %.16s is not loaded", master->mb_space);
+      return(RALEIGHSL_ERRNO_PLUGIN_NOT_LOADED);
+    }
+  } else if (!__master_label_match(master->mb_space, &(fs->space.plug->info))) {
+    Z_LOG_ERROR("master: created with the space plugin %.16s", master->mb_space);
+    return(RALEIGHSL_ERRNO_PLUGIN_NOT_LOADED);
+  }
+
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* ============================================================================
+ *  Master Format Plugin
+ */
+static raleighsl_errno_t __format_init (raleighsl_t *fs) {
+  raleighsl_master_t *master = &(fs->master);
+
+  z_memzero(master, sizeof(raleighsl_master_t));
+  z_memcpy(master->mb_magic, RALEIGHSL_MASTER_MAGIC, sizeof(master->mb_magic));
+  master->mb_format = __MASTER_FORMAT;
+  master->mb_version = RALEIGHSL_VERSION;
+  master->mb_ctime = z_time_micros();
+  __master_uuid_generate(master->mb_uuid);
+
+  if (fs->semantic.plug != NULL)
+    __master_set_label(master->mb_semantic, &(fs->semantic.plug->info));
+  if (fs->space.plug != NULL)
+    __master_set_label(master->mb_space, &(fs->space.plug->info));
+
+  master->mb_qmagic = RALEIGHSL_MASTER_QMAGIC;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __format_load (raleighsl_t *fs) {
+  raleighsl_master_t *master = &(fs->master);
+  raleighsl_errno_t errno;
+  uint8_t *block;
+
+  if (fs->device == NULL)
+    return(RALEIGHSL_ERRNO_FORMAT_NOT_FOUND);
+
+  block = z_memory_alloc(z_global_memory(), uint8_t, RALEIGHSL_MASTER_SIZE);
+  if (Z_MALLOC_IS_NULL(block))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  errno = fs->device->plug->read(fs, RALEIGHSL_MASTER_OFFSET, block, RALEIGHSL_MASTER_SIZE);
+  z_memcpy(master, block, sizeof(raleighsl_master_t));
+  z_memory_free(z_global_memory(), block);
+  if (Z_UNLIKELY(errno))
+    return(errno);
+
+  if (z_memcmp(master->mb_magic, RALEIGHSL_MASTER_MAGIC, sizeof(master->mb_magic)) ||
+      master->mb_qmagic != RALEIGHSL_MASTER_QMAGIC)
+  {
+    z_memzero(master, sizeof(raleighsl_master_t));
+    return(RALEIGHSL_ERRNO_FORMAT_NOT_FOUND);
+  }
+
+  if (master->mb_crc != __master_crc(master)) {
+    Z_LOG_ERROR("master: block checksum mismatch");
+    z_memzero(master, sizeof(raleighsl_master_t));
+    return(RALEIGHSL_ERRNO_DEVICE_CORRUPTED);
+  }
+
+  /* A newer major version may have changed the layout */
+  if (master->mb_format != __MASTER_FORMAT ||
+      __version_major(master->mb_version) > __version_major(RALEIGHSL_VERSION))
+  {
+    Z_LOG_ERROR("master: format %"PRIu32" version %"PRIx32" is not supported",
+                master->mb_format, master->mb_version);
+    return(RALEIGHSL_ERRNO_FORMAT_VERSION);
+  }
+
+  if ((errno = __master_resolve(fs)))
+    return(errno);
+
+  Z_LOG_INFO("master: format %"PRIu32" version %"PRIx32", checkpoint %"PRIu64
+             " journal from lsn %"PRIu64, master->mb_format, master->mb_version,
+             master->mb_ckpt_generation, master->mb_journal_lsn);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __format_unload (raleighsl_t *fs) {
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __format_sync (raleighsl_t *fs) {
+  raleighsl_checkpoint_t *checkpoint = &(fs->checkpoint);
+  raleighsl_master_t *master = &(fs->master);
+  raleighsl_errno_t errno;
+  uint8_t *block;
+
+  if (fs->device == NULL)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  /* Rolling upgrades: the last writer version is recorded */
+  master->mb_version = RALEIGHSL_VERSION;
+  master->mb_ckpt_generation = checkpoint->generation;
+  master->mb_ckpt_offset = 0;
+  if (checkpoint->generation > 0) {
+    master->mb_ckpt_offset = RALEIGHSL_CHECKPOINT_HEAD_OFFSET +
+                             checkpoint->slot * RALEIGHSL_CHECKPOINT_HEAD_SIZE;
+  }
+  master->mb_journal_base_lsn = fs->journal.base_lsn;
+  master->mb_journal_lsn = checkpoint->journal_lsn;
+  master->mb_crc = __master_crc(master);
+
+  block = z_memory_alloc(z_global_memory(), uint8_t, RALEIGHSL_MASTER_SIZE);
+  if (Z_MALLOC_IS_NULL(block))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  z_memzero(block, RALEIGHSL_MASTER_SIZE);
+  z_memcpy(block, master, sizeof(raleighsl_master_t));
+  errno = fs->device->plug->write(fs, RALEIGHSL_MASTER_OFFSET, block, RALEIGHSL_MASTER_SIZE);
+  z_memory_free(z_global_memory(), block);
+  if (Z_UNLIKELY(errno))
+    return(errno);
+
+  return(fs->device->plug->sync(fs));
+}
+
+static const char *__format_semantic (raleighsl_t *fs) {
+  return((const char *)fs->master.mb_semantic);
+}
+
+static const char *__format_space (raleighsl_t *fs) {
+  return((const char *)fs->master.mb_space);
+}
+
+static const char *__format_key (raleighsl_t *fs) {
+  return((const char *)fs->master.mb_key);
+}
+
+const raleighsl_format_plug_t raleighsl_format_master = {
+  .info = {
+    .type = RALEIGHSL_PLUG_TYPE_FORMAT,
+    .description = "Master Block Format",
+    .label       = "format-master",
+  },
+
+  .init     = __format_init,
+  .load     = __format_load,
+  .unload   = __format_unload,
+  .sync     = __format_sync,
+
+  .semantic = __format_semantic,
+  .space    = __format_space,
+  .key      = __format_key,
+};
@@ -140,6 +140,7 @@ const raleighsl_object_plug_t raleighsl_object_bitmap = {
   .apply    = __object_apply,
   .revert   = __object_revert,
   .commit   = __object_commit,
+  .replay   = NULL,
 
   .balance  = NULL,
   .sync     = NULL,
@@ -13,189 +13,700 @@
  */
 
 #include <zcl/global.h>
+#include <zcl/string.h>
 #include <zcl/debug.h>
 #include <zcl/dlink.h>
+#include <zcl/bytes.h>
+
+#include <raleighsl/checkpoint.h>
+#include <raleighsl/journal.h>
 
 #include "deque.h"
 
 #define RALEIGHSL_DEQUE(x)                 Z_CAST(raleighsl_deque_t, x)
 
-struct deque_entry {
-  z_dlink_node_t node;
-  z_bytes_ref_t  data;
+/*
+ * Items are packed in fixed-size chunks, the chunk map is a ring that
+ * grows by doubling. 'head' is the slot of the first item in the first
+ * chunk, an emptied chunk is kept as spare for the next one.
+ */
+#define __DEQUE_CHUNK_ITEMS               (32)
+
+#define __ring_chunk(ring, index)                                     \
+  ((ring)->map[((ring)->first + (index)) & ((ring)->nmap - 1)])
+
+struct deque_chunk {
+  z_bytes_ref_t items[__DEQUE_CHUNK_ITEMS];
 };
 
-struct deque_txn {
+struct deque_ring {
+  struct deque_chunk **map;
+  struct deque_chunk *spare;
+  uint32_t nmap;
+  uint32_t first;
+  uint32_t nchunks;
+  uint32_t head;
+  uint64_t count;
+  uint64_t bytes;                 /* Items data size */
+};
+
+/*
+ * The pushes of a side are pending until the commit, the pops from the
+ * committed data are counted and removed by the commit.
+ */
+struct deque_side {
   raleighsl_txn_atom_t __txn_atom__;
   uint64_t txn_id;
+  uint64_t removed;               /* Uncommitted pops from the data */
+  struct deque_ring pending;      /* Uncommitted pushes, oldest first */
 };
 
 typedef struct raleighsl_deque {
-  z_dlink_node_t data;
-  z_dlink_node_t pending_front;
-  z_dlink_node_t pending_back;
-  z_dlink_node_t *removed_front;
-  z_dlink_node_t *removed_back;
-  struct deque_txn txn_id_front;
-  struct deque_txn txn_id_back;
+  struct deque_ring data;
+  struct deque_side front;
+  struct deque_side back;
+  z_dlink_node_t waiters;         /* Parked pops, oldest first */
 } raleighsl_deque_t;
 
+enum deque_pop_source {
+  DEQUE_POP_NONE,
+  DEQUE_POP_PENDING,              /* Same side pending pushes */
+  DEQUE_POP_DATA,                 /* Committed data */
+  DEQUE_POP_OTHER,                /* Other side pending pushes */
+};
+
 /* ============================================================================
- *  PRIVATE Deque Entry methods
+ *  PRIVATE Deque Ring methods
  */
-static void __deque_entry_free (void *udata, void *obj) {
-  struct deque_entry *entry = (struct deque_entry *)obj;
-  z_bytes_ref_release(&(entry->data));
-  z_memory_struct_free(z_global_memory(), struct deque_entry, entry);
+static void __ring_open (struct deque_ring *ring) {
+  z_memzero(ring, sizeof(struct deque_ring));
+}
+
+static z_bytes_ref_t *__ring_item (const struct deque_ring *ring, uint64_t index) {
+  uint64_t slot = ring->head + index;
+  struct deque_chunk *chunk = __ring_chunk(ring, slot / __DEQUE_CHUNK_ITEMS);
+  return(&(chunk->items[slot % __DEQUE_CHUNK_ITEMS]));
+}
+
+static struct deque_chunk *__ring_chunk_alloc (struct deque_ring *ring) {
+  struct deque_chunk *chunk = ring->spare;
+  if (chunk != NULL) {
+    ring->spare = NULL;
+    return(chunk);
+  }
+  return(z_memory_struct_alloc(z_global_memory(), struct deque_chunk));
+}
+
+static void __ring_chunk_free (struct deque_ring *ring, struct deque_chunk *chunk) {
+  if (ring->spare == NULL) {
+    ring->spare = chunk;
+    return;
+  }
+  z_memory_struct_free(z_global_memory(), struct deque_chunk, chunk);
+}
+
+static int __ring_grow (struct deque_ring *ring) {
+  struct deque_chunk **map;
+  uint32_t i, nmap;
+
+  if (ring->nchunks < ring->nmap)
+    return(0);
+
+  nmap = (ring->nmap > 0) ? (ring->nmap << 1) : 2;
+  map = z_memory_array_alloc(z_global_memory(), struct deque_chunk *, nmap);
+  if (Z_MALLOC_IS_NULL(map))
+    return(1);
+
+  for (i = 0; i < ring->nchunks; ++i)
+    map[i] = __ring_chunk(ring, i);
+
+  if (ring->map != NULL)
+    z_memory_array_free(z_global_memory(), ring->map);
+  ring->map = map;
+  ring->nmap = nmap;
+  ring->first = 0;
+  return(0);
+}
+
+/* Makes room for one item, the put that follows cannot fail */
+static raleighsl_errno_t __ring_reserve_front (struct deque_ring *ring) {
+  struct deque_chunk *chunk;
+
+  if (ring->head > 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if (__ring_grow(ring) || (chunk = __ring_chunk_alloc(ring)) == NULL)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  ring->first = (ring->first - 1) & (ring->nmap - 1);
+  ring->map[ring->first] = chunk;
+  ring->head = __DEQUE_CHUNK_ITEMS;
+  ring->nchunks++;
+  return(RALEIGHSL_ERRNO_NONE);
 }
 
-static struct deque_entry *__deque_entry_alloc (raleighsl_deque_t *deque,
-                                                const z_bytes_ref_t *data)
+static raleighsl_errno_t __ring_reserve_back (struct deque_ring *ring) {
+  struct deque_chunk *chunk;
+
+  if (ring->head + ring->count < (uint64_t)ring->nchunks * __DEQUE_CHUNK_ITEMS)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if (__ring_grow(ring) || (chunk = __ring_chunk_alloc(ring)) == NULL)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  __ring_chunk(ring, ring->nchunks) = chunk;
+  ring->nchunks++;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* The put and take methods move the reference ownership */
+static void __ring_put_front (struct deque_ring *ring, const z_bytes_ref_t *ref) {
+  ring->head--;
+  ring->count++;
+  ring->bytes += ref->slice.size;
+  *__ring_item(ring, 0) = *ref;
+}
+
+static void __ring_put_back (struct deque_ring *ring, const z_bytes_ref_t *ref) {
+  *__ring_item(ring, ring->count) = *ref;
+  ring->count++;
+  ring->bytes += ref->slice.size;
+}
+
+/* Releases the chunks left empty by the takes */
+static void __ring_trim (struct deque_ring *ring) {
+  if (ring->count == 0) {
+    while (ring->nchunks > 0) {
+      __ring_chunk_free(ring, __ring_chunk(ring, --ring->nchunks));
+    }
+    ring->first = 0;
+    ring->head = 0;
+    return;
+  }
+
+  while (ring->head >= __DEQUE_CHUNK_ITEMS) {
+    __ring_chunk_free(ring, __ring_chunk(ring, 0));
+    ring->first = (ring->first + 1) & (ring->nmap - 1);
+    ring->head -= __DEQUE_CHUNK_ITEMS;
+    ring->nchunks--;
+  }
+
+  while ((uint64_t)ring->nchunks * __DEQUE_CHUNK_ITEMS - (ring->head + ring->count) >= __DEQUE_CHUNK_ITEMS) {
+    __ring_chunk_free(ring, __ring_chunk(ring, --ring->nchunks));
+  }
+}
+
+static void __ring_take_front (struct deque_ring *ring, z_bytes_ref_t *ref) {
+  *ref = *__ring_item(ring, 0);
+  ring->head++;
+  ring->count--;
+  ring->bytes -= ref->slice.size;
+  __ring_trim(ring);
+}
+
+static void __ring_take_back (struct deque_ring *ring, z_bytes_ref_t *ref) {
+  *ref = *__ring_item(ring, ring->count - 1);
+  ring->count--;
+  ring->bytes -= ref->slice.size;
+  __ring_trim(ring);
+}
+
+static raleighsl_errno_t __ring_push_back (struct deque_ring *ring,
+                                           const z_bytes_ref_t *data)
 {
-  z_memory_t *memory = z_global_memory();
-  struct deque_entry *entry;
+  z_bytes_ref_t ref;
 
-  entry = z_memory_struct_alloc(memory, struct deque_entry);
-  if (Z_MALLOC_IS_NULL(entry))
-    return(NULL);
+  if (Z_UNLIKELY(__ring_reserve_back(ring)))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  z_bytes_ref_acquire(&ref, data);
+  __ring_put_back(ring, &ref);
+  return(RALEIGHSL_ERRNO_NONE);
+}
 
-  z_dlink_init(&(entry->node));
-  z_bytes_ref_acquire(&(entry->data), data);
-  return(entry);
+static void __ring_clear (struct deque_ring *ring) {
+  z_bytes_ref_t ref;
+  while (ring->count > 0) {
+    __ring_take_back(ring, &ref);
+    z_bytes_ref_release(&ref);
+  }
+}
+
+static void __ring_close (struct deque_ring *ring) {
+  __ring_clear(ring);
+  if (ring->spare != NULL)
+    z_memory_struct_free(z_global_memory(), struct deque_chunk, ring->spare);
+  if (ring->map != NULL)
+    z_memory_array_free(z_global_memory(), ring->map);
+}
+
+static uint64_t __ring_footprint (const struct deque_ring *ring) {
+  uint64_t nchunks = ring->nchunks + (ring->spare != NULL);
+  return(ring->nmap * sizeof(struct deque_chunk *) +
+         nchunks * sizeof(struct deque_chunk) + ring->bytes);
 }
 
 /* ============================================================================
- *  PUBLIC Deque WRITE methods
+ *  PRIVATE Deque Journal methods
  */
-raleighsl_errno_t raleighsl_deque_push (raleighsl_t *fs,
-                                        raleighsl_transaction_t *transaction,
-                                        raleighsl_object_t *object,
-                                        int push_front,
-                                        const z_bytes_ref_t *data)
+enum deque_journal_op {
+  DEQUE_JOURNAL_PUSH_FRONT  = 1,  /* [data] */
+  DEQUE_JOURNAL_PUSH_BACK   = 2,  /* [data] */
+  DEQUE_JOURNAL_POP_FRONT   = 3,  /* No payload */
+  DEQUE_JOURNAL_POP_BACK    = 4,  /* No payload */
+  DEQUE_JOURNAL_POP_FRONT_N = 5,  /* [u64 count] */
+  DEQUE_JOURNAL_POP_BACK_N  = 6,  /* [u64 count] */
+};
+
+static raleighsl_errno_t __deque_journal_push (raleighsl_t *fs,
+                                               raleighsl_object_t *object,
+                                               int front,
+                                               const z_bytes_ref_t *data)
 {
-  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
-  z_dlink_node_t *pending_deque;
-  struct deque_txn *txn_atom;
-  struct deque_entry *entry;
-  uint64_t txn_id;
+  struct iovec iov;
+  iov.iov_base = data->slice.data;
+  iov.iov_len  = data->slice.size;
+  return(raleighsl_journal_append(fs, object,
+                                  front ? DEQUE_JOURNAL_PUSH_FRONT : DEQUE_JOURNAL_PUSH_BACK,
+                                  &iov, 1));
+}
 
-  if (push_front) {
-    pending_deque = &(deque->pending_front);
-    txn_atom = &(deque->txn_id_front);
-  } else {
-    pending_deque = &(deque->pending_back);
-    txn_atom = &(deque->txn_id_back);
+static raleighsl_errno_t __deque_journal_pop (raleighsl_t *fs,
+                                              raleighsl_object_t *object,
+                                              int front,
+                                              uint64_t count)
+{
+  struct iovec iov;
+
+  if (count == 1) {
+    return(raleighsl_journal_append(fs, object,
+                                    front ? DEQUE_JOURNAL_POP_FRONT : DEQUE_JOURNAL_POP_BACK,
+                                    NULL, 0));
   }
 
-  /* Verify that no other transaction is holding the operation-lock */
-  txn_id = (transaction != NULL) ? raleighsl_txn_id(transaction) : 0;
-  if (txn_atom->txn_id > 0 && txn_atom->txn_id != txn_id)
-    return(RALEIGHSL_ERRNO_TXN_LOCKED_OPERATION);
+  iov.iov_base = &count;
+  iov.iov_len  = sizeof(uint64_t);
+  return(raleighsl_journal_append(fs, object,
+                                  front ? DEQUE_JOURNAL_POP_FRONT_N : DEQUE_JOURNAL_POP_BACK_N,
+                                  &iov, 1));
+}
 
-  /* Allocate the new entry */
-  entry = __deque_entry_alloc(deque, data);
-  if (Z_MALLOC_IS_NULL(entry))
-    return(RALEIGHSL_ERRNO_NO_MEMORY);
+/* ============================================================================
+ *  PRIVATE Deque Checkpoint methods
+ *  [u64 count] [u32 size][data] ...
+ */
+static raleighsl_errno_t __deque_load (raleighsl_t *fs,
+                                       raleighsl_object_t *object,
+                                       raleighsl_deque_t *deque)
+{
+  raleighsl_errno_t errno;
+  z_bytes_ref_t value;
+  z_bytes_t *bytes;
+  uint64_t count;
+  uint32_t size;
 
-  /* Add only a single element to the transaction */
-  if (transaction != NULL && txn_id != txn_atom->txn_id) {
-    raleighsl_errno_t errno;
-    if ((errno = raleighsl_transaction_add(fs, transaction, object, &(txn_atom->__txn_atom__)))) {
-      __deque_entry_free(deque, entry);
+  if ((errno = raleighsl_checkpoint_read(fs, object, &count, sizeof(uint64_t))))
+    return(errno);
+
+  while (count--) {
+    if ((errno = raleighsl_checkpoint_read(fs, object, &size, sizeof(uint32_t))))
       return(errno);
-    }
-  }
 
-  Z_LOG_TRACE("Push current_txn_id=%"PRIu64" txn_id=%"PRIu64, txn_atom->txn_id = txn_id);
+    bytes = z_bytes_alloc(size);
+    if (Z_MALLOC_IS_NULL(bytes))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    if ((errno = raleighsl_checkpoint_read(fs, object, z_bytes_data(bytes), size))) {
+      z_bytes_free(bytes);
+      return(errno);
+    }
 
-  /* Push entry to the pending deque */
-  txn_atom->txn_id = txn_id;
-  z_dlink_add(pending_deque, &(entry->node));
+    z_bytes_ref_set_data(&value, z_bytes_data(bytes), size, &z_vtable_bytes_refs, bytes);
+    errno = __ring_push_back(&(deque->data), &value);
+    z_bytes_free(bytes);
+    if (Z_UNLIKELY(errno))
+      return(errno);
+  }
   return(RALEIGHSL_ERRNO_NONE);
 }
 
-raleighsl_errno_t raleighsl_deque_pop (raleighsl_t *fs,
-                                       raleighsl_transaction_t *transaction,
+static raleighsl_errno_t __deque_sync (raleighsl_t *fs,
                                        raleighsl_object_t *object,
-                                       int pop_front,
-                                       z_bytes_ref_t *data)
+                                       raleighsl_deque_t *deque)
 {
-  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
-  z_dlink_node_t **removed_entry;
-  z_dlink_node_t *pending_deque;
-  struct deque_txn *txn_atom;
-  z_dlink_node_t *node;
-  uint64_t txn_id;
+  raleighsl_errno_t errno;
+  struct iovec iov[2];
+  uint64_t count;
+  uint64_t i;
+  uint32_t size;
+
+  /* The pending pushes and pops belong to open transactions */
+  count = deque->data.count;
+  iov[0].iov_base = &count;
+  iov[0].iov_len  = sizeof(uint64_t);
+  if ((errno = raleighsl_checkpoint_write(fs, iov, 1)))
+    return(errno);
+
+  iov[0].iov_base = &size;
+  iov[0].iov_len  = sizeof(uint32_t);
+  for (i = 0; i < count; ++i) {
+    const z_bytes_ref_t *item = __ring_item(&(deque->data), i);
+    size = item->slice.size;
+    iov[1].iov_base = item->slice.data;
+    iov[1].iov_len  = size;
+    if ((errno = raleighsl_checkpoint_write(fs, iov, 2)))
+      return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* ============================================================================
+ *  PRIVATE Deque methods
+ */
+static uint64_t __deque_txn_id (const raleighsl_transaction_t *transaction) {
+  return((transaction != NULL) ? raleighsl_txn_id(transaction) : 0);
+}
+
+/* Takes the side operation-lock, the side joins the transaction once */
+static raleighsl_errno_t __deque_txn_acquire (raleighsl_t *fs,
+                                              raleighsl_transaction_t *transaction,
+                                              raleighsl_object_t *object,
+                                              struct deque_side *side)
+{
+  uint64_t txn_id = __deque_txn_id(transaction);
+
+  if (side->txn_id > 0 && side->txn_id != txn_id)
+    return(RALEIGHSL_ERRNO_TXN_LOCKED_OPERATION);
 
-  if (pop_front) {
-    removed_entry = &(deque->removed_front);
-    pending_deque = &(deque->pending_front);
-    txn_atom = &(deque->txn_id_front);
-  } else {
-    removed_entry = &(deque->removed_back);
-    pending_deque = &(deque->pending_back);
-    txn_atom = &(deque->txn_id_back);
+  if (transaction != NULL && side->txn_id != txn_id) {
+    raleighsl_errno_t errno;
+    if ((errno = raleighsl_transaction_add(fs, transaction, object, &(side->__txn_atom__))))
+      return(errno);
+    side->txn_id = txn_id;
   }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Pops look at the side pending pushes first, then at the committed data
+ * not yet popped by either side, and last at the oldest pushes of the
+ * other side when no other transaction holds them.
+ */
+static raleighsl_errno_t __deque_pop_prepare (raleighsl_t *fs,
+                                              raleighsl_transaction_t *transaction,
+                                              raleighsl_object_t *object,
+                                              int pop_front,
+                                              enum deque_pop_source *source)
+{
+  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
+  struct deque_side *side = pop_front ? &(deque->front) : &(deque->back);
+  struct deque_side *other = pop_front ? &(deque->back) : &(deque->front);
+  uint64_t txn_id = __deque_txn_id(transaction);
 
   /* Verify that no other transaction is holding the operation-lock */
-  txn_id = (transaction != NULL) ? raleighsl_txn_id(transaction) : 0;
-  if (txn_atom->txn_id > 0 && txn_atom->txn_id != txn_id)
+  if (side->txn_id > 0 && side->txn_id != txn_id)
     return(RALEIGHSL_ERRNO_TXN_LOCKED_OPERATION);
 
-  if (z_dlink_is_not_empty(pending_deque)) {
-    struct deque_entry *entry;
-    node = z_dlink_front(pending_deque);
-    entry = z_dlink_entry(node, struct deque_entry, node);
-    z_bytes_ref_acquire(data, &(entry->data));
-    z_dlink_del(node);
-    __deque_entry_free(deque, node);
+  if (side->pending.count > 0) {
+    *source = DEQUE_POP_PENDING;
     return(RALEIGHSL_ERRNO_NONE);
   }
 
-  if (*removed_entry != &(deque->data) && z_dlink_is_not_empty(&(deque->data))) {
-    struct deque_entry *entry;
+  if (deque->data.count > deque->front.removed + deque->back.removed) {
+    *source = DEQUE_POP_DATA;
+    return(__deque_txn_acquire(fs, transaction, object, side));
+  }
 
-    if (*removed_entry == NULL) {
-      if (pop_front) {
-        *removed_entry = z_dlink_front(&(deque->data));
-      } else {
-        *removed_entry = z_dlink_back(&(deque->data));
-      }
+  if (other->pending.count > 0 && (other->txn_id == 0 || other->txn_id == txn_id)) {
+    *source = DEQUE_POP_OTHER;
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  *source = DEQUE_POP_NONE;
+  return(RALEIGHSL_ERRNO_DATA_NO_ITEMS);
+}
+
+static const z_bytes_ref_t *__deque_pop_peek (const raleighsl_deque_t *deque,
+                                              int pop_front,
+                                              enum deque_pop_source source)
+{
+  const struct deque_side *side = pop_front ? &(deque->front) : &(deque->back);
+  const struct deque_side *other = pop_front ? &(deque->back) : &(deque->front);
+
+  switch (source) {
+    case DEQUE_POP_PENDING:
+      return(__ring_item(&(side->pending), side->pending.count - 1));
+    case DEQUE_POP_DATA:
+      return(__ring_item(&(deque->data), pop_front ? side->removed :
+                                         (deque->data.count - 1 - side->removed)));
+    case DEQUE_POP_OTHER:
+      return(__ring_item(&(other->pending), 0));
+    case DEQUE_POP_NONE:
+      break;
+  }
+  return(NULL);
+}
+
+static void __deque_pop_take (raleighsl_deque_t *deque,
+                              int pop_front,
+                              enum deque_pop_source source,
+                              z_bytes_ref_t *data)
+{
+  struct deque_side *side = pop_front ? &(deque->front) : &(deque->back);
+  struct deque_side *other = pop_front ? &(deque->back) : &(deque->front);
+
+  switch (source) {
+    case DEQUE_POP_PENDING:
+      __ring_take_back(&(side->pending), data);
+      break;
+    case DEQUE_POP_DATA:
+      z_bytes_ref_acquire(data, __deque_pop_peek(deque, pop_front, source));
+      side->removed++;
+      break;
+    case DEQUE_POP_OTHER:
+      __ring_take_front(&(other->pending), data);
+      break;
+    case DEQUE_POP_NONE:
+      break;
+  }
+}
+
+/*
+ * Called once the commit has journaled and applied the pushes, the oldest
+ * waiter pops the committed item with its own record, so a waiter never
+ * gets an item that a failed commit may drop. A waiter found gone gives
+ * the item back to the same end. Stops on the first journal error, the
+ * waiters left are served by the next commit.
+ */
+static raleighsl_errno_t __deque_handoff (raleighsl_t *fs,
+                                          raleighsl_object_t *object,
+                                          raleighsl_deque_t *deque)
+{
+  while (z_dlink_is_not_empty(&(deque->waiters))) {
+    raleighsl_deque_waiter_t *waiter;
+    struct deque_side *side;
+    raleighsl_errno_t errno;
+    z_bytes_ref_t data;
+    int front;
+
+    waiter = z_dlink_front_entry(&(deque->waiters), raleighsl_deque_waiter_t, node);
+    front = waiter->pop_front;
+    side = front ? &(deque->front) : &(deque->back);
+
+    /* The side is locked by a transaction or the committed data is reserved */
+    if (side->txn_id > 0 || deque->data.count <= deque->front.removed + deque->back.removed)
+      break;
+
+    if ((errno = __deque_journal_pop(fs, object, front, 1)))
+      return(errno);
+
+    if (front) {
+      __ring_take_front(&(deque->data), &data);
+    } else {
+      __ring_take_back(&(deque->data), &data);
+    }
+
+    z_dlink_del(&(waiter->node));
+    if (!waiter->notify(waiter, RALEIGHSL_ERRNO_NONE, &data)) {
+      z_bytes_ref_release(&data);
+      continue;
     }
 
-    entry = z_dlink_entry(*removed_entry, struct deque_entry, node);
-    z_bytes_ref_acquire(data, &(entry->data));
+    /* The waiter is gone, the item goes to the next one */
+    errno = front ? __ring_reserve_front(&(deque->data)) :
+                    __ring_reserve_back(&(deque->data));
+    if (!errno) errno = __deque_journal_push(fs, object, front, &data);
+    if (Z_UNLIKELY(errno)) {
+      z_bytes_ref_release(&data);
+      return(errno);
+    }
 
-    if (pop_front) {
-      *removed_entry = (*removed_entry)->next;
+    if (front) {
+      __ring_put_front(&(deque->data), &data);
     } else {
-      *removed_entry = (*removed_entry)->prev;
+      __ring_put_back(&(deque->data), &data);
+    }
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static void __deque_waiters_expire (raleighsl_deque_t *deque, uint64_t now) {
+  raleighsl_deque_waiter_t *waiter;
+  z_dlink_for_each_safe_entry(&(deque->waiters), waiter, raleighsl_deque_waiter_t, node, {
+    if (waiter->deadline <= now) {
+      z_dlink_del(&(waiter->node));
+      waiter->notify(waiter, RALEIGHSL_ERRNO_DATA_NO_ITEMS, NULL);
     }
+  });
+}
+
+static raleighsl_errno_t __deque_commit_side (raleighsl_t *fs,
+                                              raleighsl_object_t *object,
+                                              raleighsl_deque_t *deque,
+                                              int front)
+{
+  struct deque_side *side = front ? &(deque->front) : &(deque->back);
+  raleighsl_errno_t errno;
+  z_bytes_ref_t ref;
 
-    txn_atom->txn_id = txn_id;
+  if (side->txn_id > 0)
     return(RALEIGHSL_ERRNO_NONE);
+
+  /* Records are written before each move, a failed commit can be resumed */
+  if (side->removed > 0) {
+    if ((errno = __deque_journal_pop(fs, object, front, side->removed)))
+      return(errno);
+
+    for (; side->removed > 0; --side->removed) {
+      if (front) {
+        __ring_take_front(&(deque->data), &ref);
+      } else {
+        __ring_take_back(&(deque->data), &ref);
+      }
+      z_bytes_ref_release(&ref);
+    }
   }
 
-  /* Remove from the other side */
-  if (pop_front) {
-    pending_deque = &(deque->pending_back);
-    txn_atom = &(deque->txn_id_back);
-  } else {
-    pending_deque = &(deque->pending_front);
-    txn_atom = &(deque->txn_id_front);
+  while (side->pending.count > 0) {
+    errno = front ? __ring_reserve_front(&(deque->data)) :
+                    __ring_reserve_back(&(deque->data));
+    if (Z_UNLIKELY(errno))
+      return(errno);
+
+    if ((errno = __deque_journal_push(fs, object, front, __ring_item(&(side->pending), 0))))
+      return(errno);
+
+    __ring_take_front(&(side->pending), &ref);
+    if (front) {
+      __ring_put_front(&(deque->data), &ref);
+    } else {
+      __ring_put_back(&(deque->data), &ref);
+    }
   }
+  return(RALEIGHSL_ERRNO_NONE);
+}
 
-  if (z_dlink_is_not_empty(pending_deque)) {
-    struct deque_entry *entry;
-    node = z_dlink_back(pending_deque);
-    entry = z_dlink_entry(node, struct deque_entry, node);
-    z_bytes_ref_acquire(data, &(entry->data));
-    z_dlink_del(node);
-    __deque_entry_free(deque, node);
-    return(RALEIGHSL_ERRNO_NONE);
+/* ============================================================================
+ *  PUBLIC Deque WRITE methods
+ */
+raleighsl_errno_t raleighsl_deque_push (raleighsl_t *fs,
+                                        raleighsl_transaction_t *transaction,
+                                        raleighsl_object_t *object,
+                                        int push_front,
+                                        const z_bytes_ref_t *data)
+{
+  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
+  struct deque_side *side = push_front ? &(deque->front) : &(deque->back);
+  raleighsl_errno_t errno;
+
+  if ((errno = __deque_txn_acquire(fs, transaction, object, side)))
+    return(errno);
+
+  return(__ring_push_back(&(side->pending), data));
+}
+
+raleighsl_errno_t raleighsl_deque_push_n (raleighsl_t *fs,
+                                          raleighsl_transaction_t *transaction,
+                                          raleighsl_object_t *object,
+                                          int push_front,
+                                          const z_array_t *items)
+{
+  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
+  struct deque_side *side = push_front ? &(deque->front) : &(deque->back);
+  raleighsl_errno_t errno;
+  z_bytes_ref_t ref;
+  size_t i;
+
+  if ((errno = __deque_txn_acquire(fs, transaction, object, side)))
+    return(errno);
+
+  for (i = 0; i < items->count; ++i) {
+    errno = __ring_push_back(&(side->pending), z_array_get(items, z_bytes_ref_t, i));
+    if (Z_UNLIKELY(errno)) {
+      /* All or nothing, drop the items already pushed */
+      while (i--) {
+        __ring_take_back(&(side->pending), &ref);
+        z_bytes_ref_release(&ref);
+      }
+      return(errno);
+    }
   }
+  return(RALEIGHSL_ERRNO_NONE);
+}
 
-  return(RALEIGHSL_ERRNO_DATA_NO_ITEMS);
+raleighsl_errno_t raleighsl_deque_pop (raleighsl_t *fs,
+                                       raleighsl_transaction_t *transaction,
+                                       raleighsl_object_t *object,
+                                       int pop_front,
+                                       z_bytes_ref_t *data)
+{
+  enum deque_pop_source source;
+  raleighsl_errno_t errno;
+
+  if ((errno = __deque_pop_prepare(fs, transaction, object, pop_front, &source)))
+    return(errno);
+
+  __deque_pop_take(RALEIGHSL_DEQUE(object->membufs), pop_front, source, data);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+raleighsl_errno_t raleighsl_deque_pop_n (raleighsl_t *fs,
+                                         raleighsl_transaction_t *transaction,
+                                         raleighsl_object_t *object,
+                                         int pop_front,
+                                         size_t count,
+                                         z_array_t *items)
+{
+  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
+  enum deque_pop_source source;
+  raleighsl_errno_t errno;
+  size_t n;
+
+  for (n = 0; n < count; ++n) {
+    z_bytes_ref_t *data;
+
+    if ((errno = __deque_pop_prepare(fs, transaction, object, pop_front, &source)))
+      return((n > 0 && errno == RALEIGHSL_ERRNO_DATA_NO_ITEMS) ? RALEIGHSL_ERRNO_NONE : errno);
+
+    data = z_array_push_back(items);
+    if (Z_MALLOC_IS_NULL(data))
+      return((n > 0) ? RALEIGHSL_ERRNO_NONE : RALEIGHSL_ERRNO_NO_MEMORY);
+
+    __deque_pop_take(deque, pop_front, source, data);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+raleighsl_errno_t raleighsl_deque_pop_wait (raleighsl_t *fs,
+                                            raleighsl_transaction_t *transaction,
+                                            raleighsl_object_t *object,
+                                            raleighsl_deque_waiter_t *waiter,
+                                            z_bytes_ref_t *data)
+{
+  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
+  raleighsl_errno_t errno;
+
+  errno = raleighsl_deque_pop(fs, transaction, object, waiter->pop_front, data);
+  /* A transaction can't wait holding the deque operation-locks */
+  if (errno != RALEIGHSL_ERRNO_DATA_NO_ITEMS || transaction != NULL)
+    return(errno);
+
+  z_dlink_add_tail(&(deque->waiters), &(waiter->node));
+  return(RALEIGHSL_ERRNO_SCHED_WAIT);
+}
+
+void raleighsl_deque_cancel (raleighsl_t *fs,
+                             raleighsl_object_t *object,
+                             raleighsl_deque_waiter_t *waiter)
+{
+  z_dlink_del(&(waiter->node));
+}
+
+void raleighsl_deque_expire (raleighsl_t *fs,
+                             raleighsl_object_t *object,
+                             uint64_t now)
+{
+  __deque_waiters_expire(RALEIGHSL_DEQUE(object->membufs), now);
 }
 
 /* ============================================================================
@@ -214,13 +725,14 @@ static raleighsl_errno_t __object_create (raleighsl_t *fs,
   if (Z_MALLOC_IS_NULL(deque))
     return(RALEIGHSL_ERRNO_NO_MEMORY);
 
-  z_dlink_init(&(deque->data));
-  z_dlink_init(&(deque->pending_front));
-  z_dlink_init(&(deque->pending_back));
-  deque->removed_front = NULL;
-  deque->removed_back = NULL;
-  deque->txn_id_front.txn_id = 0;
-  deque->txn_id_back.txn_id = 0;
+  __ring_open(&(deque->data));
+  __ring_open(&(deque->front.pending));
+  __ring_open(&(deque->back.pending));
+  deque->front.txn_id = 0;
+  deque->front.removed = 0;
+  deque->back.txn_id = 0;
+  deque->back.removed = 0;
+  z_dlink_init(&(deque->waiters));
 
   object->membufs = deque;
   return(RALEIGHSL_ERRNO_NONE);
@@ -230,92 +742,121 @@ static raleighsl_errno_t __object_close (raleighsl_t *fs,
                                          raleighsl_object_t *object)
 {
   raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
-  /* TODO: Clear */
+  /* The parked pops are notified as expired */
+  __deque_waiters_expire(deque, UINT64_MAX);
+  __ring_close(&(deque->front.pending));
+  __ring_close(&(deque->back.pending));
+  __ring_close(&(deque->data));
   z_memory_struct_free(z_global_memory(), raleighsl_deque_t, deque);
   return(RALEIGHSL_ERRNO_NONE);
 }
 
+static raleighsl_errno_t __object_open (raleighsl_t *fs,
+                                        raleighsl_object_t *object)
+{
+  raleighsl_errno_t errno;
+
+  if ((errno = __object_create(fs, object)))
+    return(errno);
+
+  if ((errno = __deque_load(fs, object, RALEIGHSL_DEQUE(object->membufs)))) {
+    __object_close(fs, object);
+    object->membufs = NULL;
+    return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
 static void __object_apply (raleighsl_t *fs,
                             raleighsl_object_t *object,
                             raleighsl_txn_atom_t *atom)
 {
-  struct deque_txn *txn = z_container_of(atom, struct deque_txn, __txn_atom__);
-  txn->txn_id = 0;
+  struct deque_side *side = z_container_of(atom, struct deque_side, __txn_atom__);
+  side->txn_id = 0;
 }
 
 static void __object_revert (raleighsl_t *fs,
                              raleighsl_object_t *object,
                              raleighsl_txn_atom_t *atom)
 {
-  struct deque_txn *txn = z_container_of(atom, struct deque_txn, __txn_atom__);
-  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
-  struct deque_entry *entry;
-
-  if (txn->txn_id == deque->txn_id_front.txn_id) {
-    z_dlink_for_each_safe_entry(&(deque->pending_front), entry, struct deque_entry, node, {
-      __deque_entry_free(deque, entry);
-    });
-    z_dlink_init(&(deque->pending_front));
-    deque->removed_front = NULL;
-    txn->txn_id = 0;
-  } else if (txn->txn_id == deque->txn_id_back.txn_id) {
-    z_dlink_for_each_safe_entry(&(deque->pending_back), entry, struct deque_entry, node, {
-      __deque_entry_free(deque, entry);
-    });
-    z_dlink_init(&(deque->pending_back));
-    deque->removed_back = NULL;
-    txn->txn_id = 0;
-  }
+  struct deque_side *side = z_container_of(atom, struct deque_side, __txn_atom__);
+  __ring_clear(&(side->pending));
+  side->removed = 0;
+  side->txn_id = 0;
 }
 
 static raleighsl_errno_t __object_commit (raleighsl_t *fs,
                                           raleighsl_object_t *object)
 {
   raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
-  struct deque_entry *entry;
-  z_dlink_node_t *node;
-
-  if (deque->txn_id_front.txn_id == 0) {
-    /* Remove front */
-    if (deque->removed_front != NULL) {
-      node = z_dlink_front(&(deque->data));
-      while (node != deque->removed_front) {
-        entry = z_dlink_entry(node, struct deque_entry, node);
-        z_dlink_del(node);
-        __deque_entry_free(deque, entry);
-        node = z_dlink_front(&(deque->data));
-      }
-      deque->removed_front = NULL;
-    }
+  raleighsl_errno_t errno;
 
-    /* Add front */
-    while (z_dlink_is_not_empty(&(deque->pending_front))) {
-      node = z_dlink_back(&(deque->pending_front));
-      z_dlink_move(&(deque->data), node);
-    }
-  }
+  if ((errno = __deque_commit_side(fs, object, deque, 1)))
+    return(errno);
+  if ((errno = __deque_commit_side(fs, object, deque, 0)))
+    return(errno);
+  return(__deque_handoff(fs, object, deque));
+}
 
-  if (deque->txn_id_back.txn_id == 0) {
-    /* Remove back */
-    if (deque->removed_back != NULL) {
-      node = z_dlink_back(&(deque->data));
-      while (node != deque->removed_back) {
-        z_dlink_del(node);
-        entry = z_dlink_entry(node, struct deque_entry, node);
-        __deque_entry_free(deque, entry);
-        node = z_dlink_back(&(deque->data));
+static raleighsl_errno_t __object_replay (raleighsl_t *fs,
+                                          raleighsl_object_t *object,
+                                          uint16_t op,
+                                          const uint8_t *data,
+                                          uint32_t size)
+{
+  raleighsl_errno_t errno;
+  z_bytes_ref_t value;
+  z_bytes_t *bytes;
+  uint64_t count;
+
+  switch (op) {
+    case DEQUE_JOURNAL_PUSH_FRONT:
+    case DEQUE_JOURNAL_PUSH_BACK:
+      bytes = z_bytes_from_data(data, size);
+      if (Z_MALLOC_IS_NULL(bytes))
+        return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+      z_bytes_ref_set_data(&value, z_bytes_data(bytes), size, &z_vtable_bytes_refs, bytes);
+      errno = raleighsl_deque_push(fs, NULL, object, op == DEQUE_JOURNAL_PUSH_FRONT, &value);
+      z_bytes_free(bytes);
+      break;
+    case DEQUE_JOURNAL_POP_FRONT:
+    case DEQUE_JOURNAL_POP_BACK:
+      errno = raleighsl_deque_pop(fs, NULL, object, op == DEQUE_JOURNAL_POP_FRONT, &value);
+      if (!errno) z_bytes_ref_release(&value);
+      break;
+    case DEQUE_JOURNAL_POP_FRONT_N:
+    case DEQUE_JOURNAL_POP_BACK_N:
+      if (Z_UNLIKELY(size != sizeof(uint64_t)))
+        return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+      z_memcpy(&count, data, sizeof(uint64_t));
+      errno = RALEIGHSL_ERRNO_NONE;
+      while (count-- > 0 && !errno) {
+        errno = raleighsl_deque_pop(fs, NULL, object, op == DEQUE_JOURNAL_POP_FRONT_N, &value);
+        if (!errno) z_bytes_ref_release(&value);
       }
-      deque->removed_back = NULL;
-    }
-
-    /* Add back */
-    while (z_dlink_is_not_empty(&(deque->pending_back))) {
-      node = z_dlink_back(&(deque->pending_back));
-      z_dlink_move_tail(&(deque->data), node);
-    }
+      break;
+    default:
+      errno = RALEIGHSL_ERRNO_NOT_IMPLEMENTED;
+      break;
   }
+  return(errno);
+}
 
-  return(RALEIGHSL_ERRNO_NONE);
+static uint64_t __object_footprint (raleighsl_t *fs,
+                                    raleighsl_object_t *object)
+{
+  raleighsl_deque_t *deque = RALEIGHSL_DEQUE(object->membufs);
+  return(sizeof(raleighsl_deque_t) +
+         __ring_footprint(&(deque->data)) +
+         __ring_footprint(&(deque->front.pending)) +
+         __ring_footprint(&(deque->back.pending)));
+}
+
+static raleighsl_errno_t __object_sync (raleighsl_t *fs,
+                                        raleighsl_object_t *object)
+{
+  return(__deque_sync(fs, object, RALEIGHSL_DEQUE(object->membufs)));
 }
 
 const raleighsl_object_plug_t raleighsl_object_deque = {
@@ -326,14 +867,16 @@ const raleighsl_object_plug_t raleighsl_object_deque = {
   },
 
   .create   = __object_create,
-  .open     = NULL,
+  .open     = __object_open,
   .close    = __object_close,
   .unlink   = NULL,
 
   .apply    = __object_apply,
   .revert   = __object_revert,
   .commit   = __object_commit,
+  .replay   = __object_replay,
 
   .balance  = NULL,
-  .sync     = NULL,
+  .sync     = __object_sync,
+  .footprint = __object_footprint,
 };
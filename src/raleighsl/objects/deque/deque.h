@@ -19,19 +19,61 @@
 
 #include <raleighsl/raleighsl.h>
 #include <zcl/bytesref.h>
+#include <zcl/array.h>
+#include <zcl/dlink.h>
 
 extern const raleighsl_object_plug_t raleighsl_object_deque;
 
+Z_TYPEDEF_STRUCT(raleighsl_deque_waiter)
 
-raleighsl_errno_t raleighsl_deque_push (raleighsl_t *fs,
-                                        raleighsl_transaction_t *transaction,
-                                        raleighsl_object_t *object,
-                                        int push_front,
-                                        const z_bytes_ref_t *data);
-raleighsl_errno_t raleighsl_deque_pop (raleighsl_t *fs,
-                                       raleighsl_transaction_t *transaction,
-                                       raleighsl_object_t *object,
-                                       int pop_front,
-                                       z_bytes_ref_t *data);
+/*
+ * A pop parked on the empty deque, once a commit has journaled the pushes
+ * the oldest waiter pops the item. The waiter is unlinked before notify()
+ * is called, notify() returns 0 if the item was taken or 1 if the waiter
+ * is gone.
+ * Expired waiters are notified with RALEIGHSL_ERRNO_DATA_NO_ITEMS.
+ */
+struct raleighsl_deque_waiter {
+  z_dlink_node_t node;
+  int (*notify) (raleighsl_deque_waiter_t *waiter,
+                 raleighsl_errno_t errno,
+                 const z_bytes_ref_t *data);
+  uint64_t deadline;              /* z_time_micros() */
+  int pop_front;
+};
+
+
+raleighsl_errno_t raleighsl_deque_push   (raleighsl_t *fs,
+                                          raleighsl_transaction_t *transaction,
+                                          raleighsl_object_t *object,
+                                          int push_front,
+                                          const z_bytes_ref_t *data);
+raleighsl_errno_t raleighsl_deque_push_n (raleighsl_t *fs,
+                                          raleighsl_transaction_t *transaction,
+                                          raleighsl_object_t *object,
+                                          int push_front,
+                                          const z_array_t *items);
+raleighsl_errno_t raleighsl_deque_pop    (raleighsl_t *fs,
+                                          raleighsl_transaction_t *transaction,
+                                          raleighsl_object_t *object,
+                                          int pop_front,
+                                          z_bytes_ref_t *data);
+raleighsl_errno_t raleighsl_deque_pop_n  (raleighsl_t *fs,
+                                          raleighsl_transaction_t *transaction,
+                                          raleighsl_object_t *object,
+                                          int pop_front,
+                                          size_t count,
+                                          z_array_t *items);
+raleighsl_errno_t raleighsl_deque_pop_wait (raleighsl_t *fs,
+                                            raleighsl_transaction_t *transaction,
+                                            raleighsl_object_t *object,
+                                            raleighsl_deque_waiter_t *waiter,
+                                            z_bytes_ref_t *data);
+void              raleighsl_deque_cancel   (raleighsl_t *fs,
+                                            raleighsl_object_t *object,
+                                            raleighsl_deque_waiter_t *waiter);
+void              raleighsl_deque_expire   (raleighsl_t *fs,
+                                            raleighsl_object_t *object,
+                                            uint64_t now);
 
 #endif /* !_RALEIGHSL_DEQUE_H_ */
@@ -14,31 +14,81 @@
 
 #include <zcl/global.h>
 #include <zcl/debug.h>
-#include <zcl/tree.h>
+#include <zcl/bytes.h>
+
+#include <raleighsl/checkpoint.h>
+#include <raleighsl/journal.h>
 
 #include "flow.h"
 
 #define RALEIGHSL_FLOW(x)                 Z_CAST(raleighsl_flow_t, x)
-#define __FLOW_NODE(x)                    Z_CAST(struct flow_node, x)
 
+#define __FLOW_LOAD_CHUNK                 (64 << 10)
+#define __FLOW_COALESCE_SIZE              (4 << 10)
+#define __FLOW_ZERO_CHUNK                 (4 << 10)
+#define __FLOW_EXTEND_MAX                 (64 << 20)
+
+/*
+ * The flow is a rope: an AVL of data chunks ordered by position, each node
+ * keeps the size of its subtree so an offset is resolved in O(log n).
+ * The chunks are z_bytes_ref_t slices, a split shares the same bytes.
+ */
 struct flow_node {
-  z_tree_node_t __node__;
+  struct flow_node *child[2];
+  uint64_t size;                  /* Subtree bytes */
+  int height;
+  z_bytes_ref_t data;
+};
 
+/*
+ * The edits are queued by WRITE, while the readers are still running,
+ * and moved to the rope by the commit. A revert just drops them.
+ */
+struct flow_edit {
+  struct flow_edit *next;
+  uint16_t op;                    /* flow_journal_op */
   uint64_t offset;
+  uint64_t size;                  /* Remove and Truncate size */
   z_bytes_ref_t data;
 };
 
 typedef struct raleighsl_flow {
-  z_tree_node_t *root;
+  raleighsl_txn_atom_t __txn_atom__;
+  uint64_t txn_id;
+
+  struct flow_node *root;
   uint64_t size;
+
+  struct flow_edit *pending;      /* Uncommitted edits, oldest first */
+  struct flow_edit **pending_tail;
+  uint64_t pending_size;          /* Flow size with the pending edits */
+  uint64_t pending_bytes;         /* Pending edits data size */
+
+  z_bytes_t *tail;                /* Last appended chunk, filled up to 'tail_used' */
+  uint32_t tail_used;
 } raleighsl_flow_t;
 
+enum flow_journal_op {
+  FLOW_JOURNAL_APPEND   = 1,    /* [data] */
+  FLOW_JOURNAL_INJECT   = 2,    /* [u64 offset][data] */
+  FLOW_JOURNAL_WRITE    = 3,    /* [u64 offset][data] */
+  FLOW_JOURNAL_REMOVE   = 4,    /* [u64 offset][u64 size] */
+  FLOW_JOURNAL_TRUNCATE = 5,    /* [u64 size] */
+};
+
+/* Shared by the zero-filled chunks of a truncate extension */
+static const uint8_t __flow_zeros[__FLOW_ZERO_CHUNK];
+
 /* ============================================================================
  *  PRIVATE Flow Node methods
  */
-static struct flow_node *__flow_node_alloc (raleighsl_flow_t *flow,
+#define __flow_node_size(node)          ((node) != NULL ? (node)->size : 0)
+#define __flow_node_height(node)        ((node) != NULL ? (node)->height : 0)
+#define __flow_node_length(node)        ((node)->data.slice.size)
+
+static struct flow_node *__flow_node_alloc (const z_bytes_ref_t *data,
                                             uint64_t offset,
-                                            const z_bytes_ref_t *data)
+                                            uint64_t length)
 {
   struct flow_node *node;
 
@@ -46,44 +96,650 @@ static struct flow_node *__flow_node_alloc (raleighsl_flow_t *flow,
   if (Z_MALLOC_IS_NULL(node))
     return(NULL);
 
-  node->offset = offset;
-  if (data != NULL) {
-    z_bytes_ref_acquire(&(node->data), data);
-  } else {
-    z_bytes_ref_reset(&(node->data));
-  }
+  node->child[0] = NULL;
+  node->child[1] = NULL;
+  node->size = length;
+  node->height = 1;
+
+  /* The chunk shares the data, just the slice is moved */
+  z_bytes_ref_acquire(&(node->data), data);
+  node->data.slice.data += offset;
+  node->data.slice.size = length;
   return(node);
 }
 
-static void __flow_node_free (void *udata, void *obj) {
-  struct flow_node *node = z_container_of(obj, struct flow_node, __node__);
+static void __flow_node_free (struct flow_node *node) {
   z_bytes_ref_release(&(node->data));
   z_memory_struct_free(z_global_memory(), struct flow_node, node);
 }
 
-static int __flow_node_compare (void *udata, const void *a, const void *b) {
-  const struct flow_node *ea = z_container_of(a, const struct flow_node, __node__);
-  const struct flow_node *eb = z_container_of(b, const struct flow_node, __node__);
-  return((ea == eb) ? 0 : z_cmp(ea->offset, eb->offset));
+static void __flow_node_clear (struct flow_node *node) {
+  while (node != NULL) {
+    struct flow_node *next = node->child[1];
+    __flow_node_clear(node->child[0]);
+    __flow_node_free(node);
+    node = next;
+  }
+}
+
+static void __flow_node_update (struct flow_node *node) {
+  int lheight = __flow_node_height(node->child[0]);
+  int rheight = __flow_node_height(node->child[1]);
+  node->height = 1 + z_max(lheight, rheight);
+  node->size = __flow_node_size(node->child[0]) + __flow_node_length(node) +
+               __flow_node_size(node->child[1]);
+}
+
+static struct flow_node *__flow_node_rotate (struct flow_node *node, int dir) {
+  struct flow_node *top = node->child[!dir];
+  node->child[!dir] = top->child[dir];
+  top->child[dir] = node;
+  __flow_node_update(node);
+  __flow_node_update(top);
+  return(top);
+}
+
+static struct flow_node *__flow_node_balance (struct flow_node *node) {
+  int diff;
+
+  __flow_node_update(node);
+  diff = __flow_node_height(node->child[0]) - __flow_node_height(node->child[1]);
+  if (diff > 1) {
+    struct flow_node *left = node->child[0];
+    if (__flow_node_height(left->child[0]) < __flow_node_height(left->child[1]))
+      node->child[0] = __flow_node_rotate(left, 0);
+    return(__flow_node_rotate(node, 1));
+  }
+  if (diff < -1) {
+    struct flow_node *right = node->child[1];
+    if (__flow_node_height(right->child[1]) < __flow_node_height(right->child[0]))
+      node->child[1] = __flow_node_rotate(right, 1);
+    return(__flow_node_rotate(node, 0));
+  }
+  return(node);
 }
 
-static int __flow_node_key_compare (void *udata, const void *a, const void *key) {
-  const struct flow_node *ea = z_container_of(a, const struct flow_node, __node__);
-  return(z_cmp(ea->offset, Z_UINT64_PTR_VALUE(key)));
+/* Insert the chunk at offset, the offset is a chunk boundary */
+static struct flow_node *__flow_node_insert (struct flow_node *node,
+                                             uint64_t offset,
+                                             struct flow_node *chunk)
+{
+  uint64_t lsize;
+
+  if (node == NULL)
+    return(chunk);
+
+  lsize = __flow_node_size(node->child[0]);
+  if (offset <= lsize) {
+    node->child[0] = __flow_node_insert(node->child[0], offset, chunk);
+  } else {
+    Z_ASSERT(offset >= lsize + __flow_node_length(node), "offset is not a chunk boundary");
+    offset -= lsize + __flow_node_length(node);
+    node->child[1] = __flow_node_insert(node->child[1], offset, chunk);
+  }
+  return(__flow_node_balance(node));
+}
+
+static struct flow_node *__flow_node_detach_min (struct flow_node *node,
+                                                 struct flow_node **min)
+{
+  if (node->child[0] == NULL) {
+    *min = node;
+    return(node->child[1]);
+  }
+  node->child[0] = __flow_node_detach_min(node->child[0], min);
+  return(__flow_node_balance(node));
+}
+
+/* Detach the chunk starting at offset, the offset is a chunk boundary */
+static struct flow_node *__flow_node_detach (struct flow_node *node,
+                                             uint64_t offset,
+                                             struct flow_node **chunk)
+{
+  uint64_t lsize = __flow_node_size(node->child[0]);
+
+  if (offset < lsize) {
+    node->child[0] = __flow_node_detach(node->child[0], offset, chunk);
+  } else if (offset > lsize) {
+    offset -= lsize + __flow_node_length(node);
+    node->child[1] = __flow_node_detach(node->child[1], offset, chunk);
+  } else {
+    struct flow_node *min;
+
+    *chunk = node;
+    if (node->child[1] == NULL)
+      return(node->child[0]);
+
+    node->child[1] = __flow_node_detach_min(node->child[1], &min);
+    min->child[0] = node->child[0];
+    min->child[1] = node->child[1];
+    node = min;
+  }
+  return(__flow_node_balance(node));
+}
+
+/* Lookup the chunk containing the offset, the inner offset is returned */
+static struct flow_node *__flow_node_lookup (struct flow_node *node,
+                                             uint64_t offset,
+                                             uint64_t *inner)
+{
+  while (node != NULL) {
+    uint64_t lsize = __flow_node_size(node->child[0]);
+    if (offset < lsize) {
+      node = node->child[0];
+    } else if ((offset -= lsize) < __flow_node_length(node)) {
+      *inner = offset;
+      return(node);
+    } else {
+      offset -= __flow_node_length(node);
+      node = node->child[1];
+    }
+  }
+  return(NULL);
 }
 
 /* ============================================================================
- *  PRIVATE Flow Tree methods
+ *  PRIVATE Flow Rope methods
  */
-static struct z_tree_info __flow_tree_info = {
-  .plug         = &z_tree_avl,
-  .node_compare = __flow_node_compare,
-  .key_compare  = __flow_node_key_compare,
-  .node_free    = __flow_node_free,
-};
+static void __flow_attach (raleighsl_flow_t *flow, uint64_t offset, struct flow_node *chunk) {
+  flow->root = __flow_node_insert(flow->root, offset, chunk);
+  flow->size += __flow_node_length(chunk);
+}
+
+static struct flow_node *__flow_detach (raleighsl_flow_t *flow, uint64_t offset) {
+  struct flow_node *chunk = NULL;
+  flow->root = __flow_node_detach(flow->root, offset, &chunk);
+  flow->size -= __flow_node_length(chunk);
+  chunk->child[0] = NULL;
+  chunk->child[1] = NULL;
+  return(chunk);
+}
+
+/* Make the offset a chunk boundary, the two halves share the chunk data */
+static raleighsl_errno_t __flow_split (raleighsl_flow_t *flow, uint64_t offset) {
+  struct flow_node *node, *head, *tail;
+  uint64_t inner;
+
+  node = __flow_node_lookup(flow->root, offset, &inner);
+  if (node == NULL || inner == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  head = __flow_node_alloc(&(node->data), 0, inner);
+  if (Z_MALLOC_IS_NULL(head))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  tail = __flow_node_alloc(&(node->data), inner, __flow_node_length(node) - inner);
+  if (Z_MALLOC_IS_NULL(tail)) {
+    __flow_node_free(head);
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  }
+
+  offset -= inner;
+  __flow_node_free(__flow_detach(flow, offset));
+  __flow_attach(flow, offset, head);
+  __flow_attach(flow, offset + inner, tail);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* Grow the last chunk in place, the subtree sizes on the right spine follow */
+static void __flow_extend_last (raleighsl_flow_t *flow, uint32_t length) {
+  struct flow_node *node = flow->root;
+  while (1) {
+    node->size += length;
+    if (node->child[1] == NULL)
+      break;
+    node = node->child[1];
+  }
+  node->data.slice.size += length;
+  flow->size += length;
+}
+
+/*
+ * The small appends are copied in the spare capacity of the tail chunk,
+ * the bytes past 'tail_used' are not referenced by any slice yet.
+ */
+static raleighsl_errno_t __flow_append (raleighsl_flow_t *flow,
+                                        const z_bytes_ref_t *data)
+{
+  uint32_t length = data->slice.size;
+  struct flow_node *last, *chunk;
+  z_bytes_ref_t value;
+  z_bytes_t *bytes;
+  uint64_t inner;
+
+  if (flow->tail != NULL && flow->size > 0 &&
+      (flow->tail_used + length) <= z_bytes_size(flow->tail))
+  {
+    last = __flow_node_lookup(flow->root, flow->size - 1, &inner);
+    if ((last->data.slice.data + last->data.slice.size) ==
+        (z_bytes_data(flow->tail) + flow->tail_used))
+    {
+      z_memcpy(z_bytes_data(flow->tail) + flow->tail_used, data->slice.data, length);
+      flow->tail_used += length;
+      __flow_extend_last(flow, length);
+      return(RALEIGHSL_ERRNO_NONE);
+    }
+  }
+
+  bytes = z_bytes_alloc(__FLOW_COALESCE_SIZE);
+  if (Z_MALLOC_IS_NULL(bytes))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  z_memcpy(z_bytes_data(bytes), data->slice.data, length);
+  z_bytes_ref_set_data(&value, z_bytes_data(bytes), length, &z_vtable_bytes_refs, bytes);
+  chunk = __flow_node_alloc(&value, 0, length);
+  if (Z_MALLOC_IS_NULL(chunk)) {
+    z_bytes_free(bytes);
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  }
+
+  __flow_attach(flow, flow->size, chunk);
+  if (flow->tail != NULL)
+    z_bytes_free(flow->tail);
+  flow->tail = bytes;
+  flow->tail_used = length;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * The small data is copied together with the small chunks around the
+ * offset, so many small injects don't end up as tiny nodes.
+ * The offset is a chunk boundary. Nothing is changed on failure.
+ */
+static raleighsl_errno_t __flow_insert (raleighsl_flow_t *flow,
+                                        uint64_t offset,
+                                        const z_bytes_ref_t *data)
+{
+  struct flow_node *prev, *next, *chunk;
+  uint64_t length, inner;
+  z_bytes_ref_t value;
+  z_bytes_t *bytes;
+  uint8_t *pbuf;
+
+  if (data->slice.size == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  length = data->slice.size;
+  if (offset == flow->size && length < __FLOW_COALESCE_SIZE)
+    return(__flow_append(flow, data));
+
+  prev = next = NULL;
+  if (length < __FLOW_COALESCE_SIZE) {
+    if (offset > 0) {
+      prev = __flow_node_lookup(flow->root, offset - 1, &inner);
+      if ((length + __flow_node_length(prev)) > __FLOW_COALESCE_SIZE)
+        prev = NULL;
+      else
+        length += __flow_node_length(prev);
+    }
+    next = __flow_node_lookup(flow->root, offset, &inner);
+    if (next != NULL && (length + __flow_node_length(next)) > __FLOW_COALESCE_SIZE)
+      next = NULL;
+    else if (next != NULL)
+      length += __flow_node_length(next);
+  }
+
+  if (prev == NULL && next == NULL) {
+    chunk = __flow_node_alloc(data, 0, data->slice.size);
+    if (Z_MALLOC_IS_NULL(chunk))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+    __flow_attach(flow, offset, chunk);
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  bytes = z_bytes_alloc(length);
+  if (Z_MALLOC_IS_NULL(bytes))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  pbuf = z_bytes_data(bytes);
+  if (prev != NULL) {
+    z_memcpy(pbuf, prev->data.slice.data, __flow_node_length(prev));
+    pbuf += __flow_node_length(prev);
+  }
+  z_memcpy(pbuf, data->slice.data, data->slice.size);
+  pbuf += data->slice.size;
+  if (next != NULL) {
+    z_memcpy(pbuf, next->data.slice.data, __flow_node_length(next));
+  }
+
+  z_bytes_ref_set_data(&value, z_bytes_data(bytes), length, &z_vtable_bytes_refs, bytes);
+  chunk = __flow_node_alloc(&value, 0, length);
+  z_bytes_free(bytes);
+  if (Z_MALLOC_IS_NULL(chunk))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  if (prev != NULL) {
+    offset -= __flow_node_length(prev);
+    __flow_node_free(__flow_detach(flow, offset));
+  }
+  if (next != NULL) {
+    __flow_node_free(__flow_detach(flow, offset));
+  }
+  __flow_attach(flow, offset, chunk);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* The range is split first, the detach of the chunks can't fail */
+static raleighsl_errno_t __flow_remove (raleighsl_flow_t *flow,
+                                        uint64_t offset,
+                                        uint64_t size)
+{
+  raleighsl_errno_t errno;
+  uint64_t end;
+
+  end = offset + z_min(size, flow->size - offset);
+  if ((errno = __flow_split(flow, offset)) || (errno = __flow_split(flow, end)))
+    return(errno);
+
+  while (end > offset) {
+    struct flow_node *chunk = __flow_detach(flow, offset);
+    end -= __flow_node_length(chunk);
+    __flow_node_free(chunk);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __flow_inject (raleighsl_flow_t *flow,
+                                        uint64_t offset,
+                                        const z_bytes_ref_t *data)
+{
+  raleighsl_errno_t errno;
+  if ((errno = __flow_split(flow, offset)))
+    return(errno);
+  return(__flow_insert(flow, offset, data));
+}
+
+/*
+ * The chunk is allocated before the old range is removed, if the
+ * coalescing insert fails the data is attached as it is.
+ */
+static raleighsl_errno_t __flow_write (raleighsl_flow_t *flow,
+                                       uint64_t offset,
+                                       const z_bytes_ref_t *data)
+{
+  uint64_t end = offset + data->slice.size;
+  raleighsl_errno_t errno;
+  struct flow_node *chunk;
+
+  if (data->slice.size == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if ((errno = __flow_split(flow, offset)) || (errno = __flow_split(flow, end)))
+    return(errno);
+
+  chunk = __flow_node_alloc(data, 0, data->slice.size);
+  if (Z_MALLOC_IS_NULL(chunk))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  __flow_remove(flow, offset, data->slice.size);
+  if (data->slice.size < __FLOW_COALESCE_SIZE && !__flow_insert(flow, offset, data)) {
+    __flow_node_free(chunk);
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+  __flow_attach(flow, offset, chunk);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* The extension points to the shared zero chunk, only the nodes are allocated */
+static raleighsl_errno_t __flow_truncate (raleighsl_flow_t *flow, uint64_t size) {
+  z_bytes_ref_t zeros;
+
+  if (size <= flow->size)
+    return(__flow_remove(flow, size, flow->size - size));
+
+  z_bytes_ref_set_data(&zeros, __flow_zeros, __FLOW_ZERO_CHUNK, NULL, NULL);
+  while (flow->size < size) {
+    struct flow_node *chunk;
+
+    chunk = __flow_node_alloc(&zeros, 0, z_min(size - flow->size, __FLOW_ZERO_CHUNK));
+    if (Z_MALLOC_IS_NULL(chunk))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    __flow_attach(flow, flow->size, chunk);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* ============================================================================
+ *  PRIVATE Flow Checkpoint methods
+ *  [u64 size] [data]
+ */
+static raleighsl_errno_t __flow_load (raleighsl_t *fs,
+                                      raleighsl_object_t *object,
+                                      raleighsl_flow_t *flow)
+{
+  raleighsl_errno_t errno;
+  struct flow_node *node;
+  z_bytes_ref_t value;
+  z_bytes_t *bytes;
+  uint64_t size;
+
+  if ((errno = raleighsl_checkpoint_read(fs, object, &size, sizeof(uint64_t))))
+    return(errno);
+
+  /* The data is loaded back in fixed size chunks */
+  while (flow->size < size) {
+    size_t n = z_min(size - flow->size, __FLOW_LOAD_CHUNK);
+
+    bytes = z_bytes_alloc(n);
+    if (Z_MALLOC_IS_NULL(bytes))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    if ((errno = raleighsl_checkpoint_read(fs, object, z_bytes_data(bytes), n))) {
+      z_bytes_free(bytes);
+      return(errno);
+    }
+
+    z_bytes_ref_set_data(&value, z_bytes_data(bytes), n, &z_vtable_bytes_refs, bytes);
+    node = __flow_node_alloc(&value, 0, n);
+    z_bytes_free(bytes);
+    if (Z_MALLOC_IS_NULL(node))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    __flow_attach(flow, flow->size, node);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __flow_sync_node (raleighsl_t *fs,
+                                           const struct flow_node *node)
+{
+  raleighsl_errno_t errno;
+  struct iovec iov;
+
+  while (node != NULL) {
+    if ((errno = __flow_sync_node(fs, node->child[0])))
+      return(errno);
+
+    iov.iov_base = node->data.slice.data;
+    iov.iov_len  = node->data.slice.size;
+    if ((errno = raleighsl_checkpoint_write(fs, &iov, 1)))
+      return(errno);
+
+    node = node->child[1];
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __flow_sync (raleighsl_t *fs,
+                                      raleighsl_object_t *object,
+                                      raleighsl_flow_t *flow)
+{
+  raleighsl_errno_t errno;
+  struct iovec iov;
+
+  iov.iov_base = &(flow->size);
+  iov.iov_len  = sizeof(uint64_t);
+  if ((errno = raleighsl_checkpoint_write(fs, &iov, 1)))
+    return(errno);
+
+  return(__flow_sync_node(fs, flow->root));
+}
+
+/* ============================================================================
+ *  PRIVATE Flow Journal methods
+ */
+static raleighsl_errno_t __flow_journal (raleighsl_t *fs,
+                                         raleighsl_object_t *object,
+                                         const struct flow_edit *edit)
+{
+  struct iovec iov[2];
+  uint64_t args[2];
+
+  args[0] = edit->offset;
+  args[1] = edit->size;
+  switch (edit->op) {
+    case FLOW_JOURNAL_APPEND:
+      iov[0].iov_base = edit->data.slice.data;
+      iov[0].iov_len  = edit->data.slice.size;
+      return(raleighsl_journal_append(fs, object, edit->op, iov, 1));
+    case FLOW_JOURNAL_INJECT:
+    case FLOW_JOURNAL_WRITE:
+      iov[0].iov_base = &(args[0]);
+      iov[0].iov_len  = sizeof(uint64_t);
+      iov[1].iov_base = edit->data.slice.data;
+      iov[1].iov_len  = edit->data.slice.size;
+      return(raleighsl_journal_append(fs, object, edit->op, iov, 2));
+    case FLOW_JOURNAL_REMOVE:
+      iov[0].iov_base = args;
+      iov[0].iov_len  = sizeof(args);
+      return(raleighsl_journal_append(fs, object, edit->op, iov, 1));
+    case FLOW_JOURNAL_TRUNCATE:
+      iov[0].iov_base = &(args[1]);
+      iov[0].iov_len  = sizeof(uint64_t);
+      return(raleighsl_journal_append(fs, object, edit->op, iov, 1));
+  }
+  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+}
+
+/* ============================================================================
+ *  PRIVATE Flow Pending methods
+ */
+static uint64_t __flow_txn_id (const raleighsl_transaction_t *transaction) {
+  return((transaction != NULL) ? raleighsl_txn_id(transaction) : 0);
+}
+
+/* Takes the flow operation-lock, the flow joins the transaction once */
+static raleighsl_errno_t __flow_txn_acquire (raleighsl_t *fs,
+                                             raleighsl_transaction_t *transaction,
+                                             raleighsl_object_t *object,
+                                             raleighsl_flow_t *flow)
+{
+  uint64_t txn_id = __flow_txn_id(transaction);
+
+  if (flow->txn_id > 0 && flow->txn_id != txn_id)
+    return(RALEIGHSL_ERRNO_TXN_LOCKED_OPERATION);
+
+  if (transaction != NULL && flow->txn_id != txn_id) {
+    raleighsl_errno_t errno;
+    if ((errno = raleighsl_transaction_add(fs, transaction, object, &(flow->__txn_atom__))))
+      return(errno);
+    flow->txn_id = txn_id;
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __flow_pending_add (raleighsl_flow_t *flow,
+                                             uint16_t op,
+                                             uint64_t offset,
+                                             uint64_t size,
+                                             const z_bytes_ref_t *data,
+                                             uint64_t pending_size)
+{
+  struct flow_edit *edit;
+
+  edit = z_memory_struct_alloc(z_global_memory(), struct flow_edit);
+  if (Z_MALLOC_IS_NULL(edit))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  edit->next = NULL;
+  edit->op = op;
+  edit->offset = offset;
+  edit->size = size;
+  if (data != NULL) {
+    z_bytes_ref_acquire(&(edit->data), data);
+    flow->pending_bytes += data->slice.size;
+  } else {
+    z_bytes_ref_reset(&(edit->data));
+  }
+
+  *(flow->pending_tail) = edit;
+  flow->pending_tail = &(edit->next);
+  flow->pending_size = pending_size;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static struct flow_edit *__flow_pending_pop (raleighsl_flow_t *flow) {
+  struct flow_edit *edit = flow->pending;
+  if ((flow->pending = edit->next) == NULL)
+    flow->pending_tail = &(flow->pending);
+  return(edit);
+}
+
+static void __flow_pending_free (raleighsl_flow_t *flow, struct flow_edit *edit) {
+  flow->pending_bytes -= edit->data.slice.size;
+  z_bytes_ref_release(&(edit->data));
+  z_memory_struct_free(z_global_memory(), struct flow_edit, edit);
+}
+
+static void __flow_pending_clear (raleighsl_flow_t *flow) {
+  while (flow->pending != NULL) {
+    __flow_pending_free(flow, __flow_pending_pop(flow));
+  }
+  flow->pending_size = flow->size;
+}
+
+static raleighsl_errno_t __flow_pending_apply (raleighsl_flow_t *flow,
+                                               const struct flow_edit *edit)
+{
+  switch (edit->op) {
+    case FLOW_JOURNAL_APPEND:
+      return(__flow_insert(flow, flow->size, &(edit->data)));
+    case FLOW_JOURNAL_INJECT:
+      return(__flow_inject(flow, edit->offset, &(edit->data)));
+    case FLOW_JOURNAL_WRITE:
+      return(__flow_write(flow, edit->offset, &(edit->data)));
+    case FLOW_JOURNAL_REMOVE:
+      return(__flow_remove(flow, edit->offset, edit->size));
+    case FLOW_JOURNAL_TRUNCATE:
+      return(__flow_truncate(flow, edit->size));
+  }
+  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+}
+
+/*
+ * The edits are moved to the rope in order, each record is written once
+ * its edit is applied. A failed apply leaves the edit (and the rest)
+ * pending, the commit can be resumed.
+ */
+static raleighsl_errno_t __flow_commit (raleighsl_t *fs,
+                                        raleighsl_object_t *object,
+                                        raleighsl_flow_t *flow)
+{
+  raleighsl_errno_t errno;
+
+  if (flow->txn_id > 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  while (flow->pending != NULL) {
+    struct flow_edit *edit;
+
+    if ((errno = __flow_pending_apply(flow, flow->pending)))
+      return(errno);
+
+    edit = __flow_pending_pop(flow);
+    errno = __flow_journal(fs, object, edit);
+    __flow_pending_free(flow, edit);
+    if (Z_UNLIKELY(errno))
+      return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
 
 /* ============================================================================
  *  PUBLIC Flow WRITE methods
+ *  The edits are pending until the commit, the size returned is the
+ *  flow size once they are applied.
  */
 raleighsl_errno_t raleighsl_flow_append (raleighsl_t *fs,
                                          raleighsl_transaction_t *transaction,
@@ -92,15 +748,15 @@ raleighsl_errno_t raleighsl_flow_append (raleighsl_t *fs,
                                          uint64_t *res_size)
 {
   raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
-  struct flow_node *node;
+  raleighsl_errno_t errno;
 
-  node = __flow_node_alloc(flow, flow->size, data);
-  if (Z_MALLOC_IS_NULL(node))
-    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  if ((errno = __flow_txn_acquire(fs, transaction, object, flow)))
+    return(errno);
 
-  /* TODO: Add to staging */
-  z_tree_node_attach(&__flow_tree_info, &(flow->root), &(node->__node__), NULL);
-  return(RALEIGHSL_ERRNO_NONE);
+  errno = __flow_pending_add(flow, FLOW_JOURNAL_APPEND, flow->pending_size, 0, data,
+                             flow->pending_size + data->slice.size);
+  *res_size = flow->pending_size;
+  return(errno);
 }
 
 raleighsl_errno_t raleighsl_flow_inject (raleighsl_t *fs,
@@ -110,7 +766,19 @@ raleighsl_errno_t raleighsl_flow_inject (raleighsl_t *fs,
                                          const z_bytes_ref_t *data,
                                          uint64_t *res_size)
 {
-  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+  raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
+  raleighsl_errno_t errno;
+
+  if ((errno = __flow_txn_acquire(fs, transaction, object, flow)))
+    return(errno);
+
+  if (Z_UNLIKELY(offset > flow->pending_size))
+    return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+
+  errno = __flow_pending_add(flow, FLOW_JOURNAL_INJECT, offset, 0, data,
+                             flow->pending_size + data->slice.size);
+  *res_size = flow->pending_size;
+  return(errno);
 }
 
 raleighsl_errno_t raleighsl_flow_write (raleighsl_t *fs,
@@ -120,7 +788,19 @@ raleighsl_errno_t raleighsl_flow_write (raleighsl_t *fs,
                                         const z_bytes_ref_t *data,
                                         uint64_t *res_size)
 {
-  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+  raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
+  raleighsl_errno_t errno;
+
+  if ((errno = __flow_txn_acquire(fs, transaction, object, flow)))
+    return(errno);
+
+  if (Z_UNLIKELY(offset > flow->pending_size))
+    return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+
+  errno = __flow_pending_add(flow, FLOW_JOURNAL_WRITE, offset, 0, data,
+                             z_max(flow->pending_size, offset + data->slice.size));
+  *res_size = flow->pending_size;
+  return(errno);
 }
 
 raleighsl_errno_t raleighsl_flow_remove (raleighsl_t *fs,
@@ -130,30 +810,105 @@ raleighsl_errno_t raleighsl_flow_remove (raleighsl_t *fs,
                                          uint64_t size,
                                          uint64_t *res_size)
 {
-  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+  raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
+  raleighsl_errno_t errno;
+
+  if ((errno = __flow_txn_acquire(fs, transaction, object, flow)))
+    return(errno);
+
+  if (Z_UNLIKELY(offset > flow->pending_size))
+    return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+
+  errno = __flow_pending_add(flow, FLOW_JOURNAL_REMOVE, offset, size, NULL,
+                             flow->pending_size - z_min(size, flow->pending_size - offset));
+  *res_size = flow->pending_size;
+  return(errno);
 }
 
+/* The flow can be extended by up to __FLOW_EXTEND_MAX bytes of zeros */
 raleighsl_errno_t raleighsl_flow_truncate (raleighsl_t *fs,
                                            raleighsl_transaction_t *transaction,
                                            raleighsl_object_t *object,
                                            uint64_t size,
                                            uint64_t *res_size)
 {
-  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+  raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
+  raleighsl_errno_t errno;
+
+  if ((errno = __flow_txn_acquire(fs, transaction, object, flow)))
+    return(errno);
+
+  if (Z_UNLIKELY(size > flow->pending_size && (size - flow->pending_size) > __FLOW_EXTEND_MAX))
+    return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+
+  errno = __flow_pending_add(flow, FLOW_JOURNAL_TRUNCATE, 0, size, NULL, size);
+  *res_size = flow->pending_size;
+  return(errno);
 }
 
 /* ============================================================================
  *  PUBLIC Flow READ methods
  */
+/*
+ * The chunks array (of z_bytes_ref_t) is filled with the refs to
+ * the flow chunks covering the range, the data is not copied.
+ */
 raleighsl_errno_t raleighsl_flow_read (raleighsl_t *fs,
                                        const raleighsl_transaction_t *transaction,
                                        raleighsl_object_t *object,
                                        uint64_t offset,
                                        uint64_t size,
-                                       z_bytes_ref_t *data)
+                                       z_array_t *chunks)
 {
-  __flow_node_key_compare(NULL, NULL, &offset);
-  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+  raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
+  struct flow_node *node;
+  uint64_t inner;
+
+  if (Z_UNLIKELY(offset >= flow->size))
+    return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+
+  size = z_min(size, flow->size - offset);
+  while (size > 0) {
+    z_bytes_ref_t *chunk;
+    uint64_t n;
+
+    node = __flow_node_lookup(flow->root, offset, &inner);
+    n = z_min(size, __flow_node_length(node) - inner);
+
+    chunk = z_array_push_back(chunks);
+    if (Z_MALLOC_IS_NULL(chunk))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    z_bytes_ref_acquire(chunk, &(node->data));
+    chunk->slice.data += inner;
+    chunk->slice.size = n;
+
+    offset += n;
+    size -= n;
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Used by the log consumers: the data past the offset is returned as soon
+ * as it is committed, up to size bytes. With no data past the offset the
+ * read is parked until the next commit of the flow.
+ */
+raleighsl_errno_t raleighsl_flow_subscribe (raleighsl_t *fs,
+                                            const raleighsl_transaction_t *transaction,
+                                            raleighsl_object_t *object,
+                                            uint64_t offset,
+                                            uint64_t size,
+                                            uint64_t *res_size,
+                                            z_array_t *chunks)
+{
+  raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
+
+  if (offset >= flow->size)
+    return(RALEIGHSL_ERRNO_SCHED_WAIT);
+
+  *res_size = flow->size;
+  return(raleighsl_flow_read(fs, transaction, object, offset, size, chunks));
 }
 
 /* ============================================================================
@@ -168,8 +923,15 @@ static raleighsl_errno_t __object_create (raleighsl_t *fs,
   if (Z_MALLOC_IS_NULL(flow))
     return(RALEIGHSL_ERRNO_NO_MEMORY);
 
-  /* TODO */
+  flow->txn_id = 0;
+  flow->root = NULL;
   flow->size = 0;
+  flow->pending = NULL;
+  flow->pending_tail = &(flow->pending);
+  flow->pending_size = 0;
+  flow->pending_bytes = 0;
+  flow->tail = NULL;
+  flow->tail_used = 0;
 
   object->membufs = flow;
   return(RALEIGHSL_ERRNO_NONE);
@@ -179,27 +941,121 @@ static raleighsl_errno_t __object_close (raleighsl_t *fs,
                                          raleighsl_object_t *object)
 {
   raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
-  /* TODO: Clear */
+  __flow_pending_clear(flow);
+  __flow_node_clear(flow->root);
+  if (flow->tail != NULL)
+    z_bytes_free(flow->tail);
   z_memory_struct_free(z_global_memory(), raleighsl_flow_t, flow);
   return(RALEIGHSL_ERRNO_NONE);
 }
 
+static raleighsl_errno_t __object_open (raleighsl_t *fs,
+                                        raleighsl_object_t *object)
+{
+  raleighsl_flow_t *flow;
+  raleighsl_errno_t errno;
+
+  if ((errno = __object_create(fs, object)))
+    return(errno);
+
+  flow = RALEIGHSL_FLOW(object->membufs);
+  if ((errno = __flow_load(fs, object, flow))) {
+    __object_close(fs, object);
+    object->membufs = NULL;
+    return(errno);
+  }
+  flow->pending_size = flow->size;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
 static void __object_apply (raleighsl_t *fs,
                             raleighsl_object_t *object,
                             raleighsl_txn_atom_t *atom)
 {
+  raleighsl_flow_t *flow = z_container_of(atom, raleighsl_flow_t, __txn_atom__);
+  flow->txn_id = 0;
 }
 
 static void __object_revert (raleighsl_t *fs,
                              raleighsl_object_t *object,
                              raleighsl_txn_atom_t *atom)
 {
+  raleighsl_flow_t *flow = z_container_of(atom, raleighsl_flow_t, __txn_atom__);
+  __flow_pending_clear(flow);
+  flow->txn_id = 0;
 }
 
 static raleighsl_errno_t __object_commit (raleighsl_t *fs,
                                           raleighsl_object_t *object)
 {
-  return(RALEIGHSL_ERRNO_NONE);
+  return(__flow_commit(fs, object, RALEIGHSL_FLOW(object->membufs)));
+}
+
+/* The records are queued as the edits, the replay commits each of them */
+static raleighsl_errno_t __object_replay (raleighsl_t *fs,
+                                          raleighsl_object_t *object,
+                                          uint16_t op,
+                                          const uint8_t *data,
+                                          uint32_t size)
+{
+  raleighsl_errno_t errno;
+  z_bytes_ref_t value;
+  z_bytes_t *bytes;
+  uint64_t args[2];
+  uint64_t res_size;
+
+  switch (op) {
+    case FLOW_JOURNAL_APPEND:
+    case FLOW_JOURNAL_INJECT:
+    case FLOW_JOURNAL_WRITE:
+      args[0] = 0;
+      if (op != FLOW_JOURNAL_APPEND) {
+        if (Z_UNLIKELY(size < sizeof(uint64_t)))
+          return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+        z_memcpy(&(args[0]), data, sizeof(uint64_t));
+        data += sizeof(uint64_t);
+        size -= sizeof(uint64_t);
+      }
+
+      bytes = z_bytes_from_data(data, size);
+      if (Z_MALLOC_IS_NULL(bytes))
+        return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+      z_bytes_ref_set_data(&value, z_bytes_data(bytes), size, &z_vtable_bytes_refs, bytes);
+      if (op == FLOW_JOURNAL_APPEND) {
+        errno = raleighsl_flow_append(fs, NULL, object, &value, &res_size);
+      } else if (op == FLOW_JOURNAL_INJECT) {
+        errno = raleighsl_flow_inject(fs, NULL, object, args[0], &value, &res_size);
+      } else {
+        errno = raleighsl_flow_write(fs, NULL, object, args[0], &value, &res_size);
+      }
+      z_bytes_free(bytes);
+      return(errno);
+    case FLOW_JOURNAL_REMOVE:
+      if (Z_UNLIKELY(size != sizeof(args)))
+        return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+      z_memcpy(args, data, sizeof(args));
+      return(raleighsl_flow_remove(fs, NULL, object, args[0], args[1], &res_size));
+    case FLOW_JOURNAL_TRUNCATE:
+      if (Z_UNLIKELY(size != sizeof(uint64_t)))
+        return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+      z_memcpy(&(args[0]), data, sizeof(uint64_t));
+      return(raleighsl_flow_truncate(fs, NULL, object, args[0], &res_size));
+  }
+  return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+}
+
+static raleighsl_errno_t __object_sync (raleighsl_t *fs,
+                                        raleighsl_object_t *object)
+{
+  return(__flow_sync(fs, object, RALEIGHSL_FLOW(object->membufs)));
+}
+
+static uint64_t __object_footprint (raleighsl_t *fs,
+                                    raleighsl_object_t *object)
+{
+  raleighsl_flow_t *flow = RALEIGHSL_FLOW(object->membufs);
+  return(sizeof(raleighsl_flow_t) + flow->size + flow->pending_bytes);
 }
 
 const raleighsl_object_plug_t raleighsl_object_flow = {
@@ -210,14 +1066,16 @@ const raleighsl_object_plug_t raleighsl_object_flow = {
   },
 
   .create   = __object_create,
-  .open     = NULL,
+  .open     = __object_open,
   .close    = __object_close,
   .unlink   = NULL,
 
   .apply    = __object_apply,
   .revert   = __object_revert,
   .commit   = __object_commit,
+  .replay   = __object_replay,
 
   .balance  = NULL,
-  .sync     = NULL,
+  .sync     = __object_sync,
+  .footprint = __object_footprint,
 };
@@ -19,6 +19,7 @@
 
 #include <raleighsl/raleighsl.h>
 #include <zcl/bytesref.h>
+#include <zcl/array.h>
 
 extern const raleighsl_object_plug_t raleighsl_object_flow;
 
@@ -56,6 +57,13 @@ raleighsl_errno_t raleighsl_flow_read     (raleighsl_t *fs,
                                            raleighsl_object_t *object,
                                            uint64_t offset,
                                            uint64_t size,
-                                           z_bytes_ref_t *data);
+                                           z_array_t *chunks);
+raleighsl_errno_t raleighsl_flow_subscribe (raleighsl_t *fs,
+                                            const raleighsl_transaction_t *transaction,
+                                            raleighsl_object_t *object,
+                                            uint64_t offset,
+                                            uint64_t size,
+                                            uint64_t *res_size,
+                                            z_array_t *chunks);
 
 #endif /* !_RALEIGHSL_FLOW_H_ */
@@ -15,8 +15,15 @@
 #include <zcl/global.h>
 #include <zcl/debug.h>
 
+#include <raleighsl/checkpoint.h>
+#include <raleighsl/journal.h>
+
 #include "number.h"
 
+enum number_journal_op {
+  NUMBER_JOURNAL_SET = 1,     /* [i64 value] */
+};
+
 #define RALEIGHSL_NUMBER(x)            Z_CAST(raleighsl_number_t, x)
 
 typedef struct raleighsl_number {
@@ -206,6 +213,25 @@ static raleighsl_errno_t __object_create (raleighsl_t *fs,
   return(RALEIGHSL_ERRNO_NONE);
 }
 
+static raleighsl_errno_t __object_open (raleighsl_t *fs,
+                                        raleighsl_object_t *object)
+{
+  raleighsl_number_t *number;
+  raleighsl_errno_t errno;
+  int64_t value;
+
+  if ((errno = raleighsl_checkpoint_read(fs, object, &value, sizeof(int64_t))))
+    return(errno);
+
+  if ((errno = __object_create(fs, object)))
+    return(errno);
+
+  number = RALEIGHSL_NUMBER(object->membufs);
+  number->read_value = value;
+  number->write_value = value;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
 static raleighsl_errno_t __object_close (raleighsl_t *fs,
                                          raleighsl_object_t *object)
 {
@@ -238,12 +264,57 @@ static raleighsl_errno_t __object_commit (raleighsl_t *fs,
                                           raleighsl_object_t *object)
 {
   raleighsl_number_t *number = RALEIGHSL_NUMBER(object->membufs);
-  if (number->txn_id == 0) {
+  /* A committing transaction has already applied the new value */
+  if (number->txn_id == 0 && (number->read_value != number->write_value ||
+                              object->journal_txn_id > 0))
+  {
+    struct iovec iov;
+    raleighsl_errno_t errno;
+
+    iov.iov_base = &(number->write_value);
+    iov.iov_len  = sizeof(int64_t);
+    if ((errno = raleighsl_journal_append(fs, object, NUMBER_JOURNAL_SET, &iov, 1)))
+      return(errno);
+
     number->read_value = number->write_value;
   }
   return(RALEIGHSL_ERRNO_NONE);
 }
 
+static raleighsl_errno_t __object_replay (raleighsl_t *fs,
+                                          raleighsl_object_t *object,
+                                          uint16_t op,
+                                          const uint8_t *data,
+                                          uint32_t size)
+{
+  raleighsl_number_t *number = RALEIGHSL_NUMBER(object->membufs);
+
+  if (Z_UNLIKELY(op != NUMBER_JOURNAL_SET || size != sizeof(int64_t)))
+    return(RALEIGHSL_ERRNO_NOT_IMPLEMENTED);
+
+  z_memcpy(&(number->write_value), data, sizeof(int64_t));
+  number->read_value = number->write_value;
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __object_sync (raleighsl_t *fs,
+                                        raleighsl_object_t *object)
+{
+  raleighsl_number_t *number = RALEIGHSL_NUMBER(object->membufs);
+  struct iovec iov;
+
+  /* A value locked by a transaction is not committed yet */
+  iov.iov_base = &(number->read_value);
+  iov.iov_len  = sizeof(int64_t);
+  return(raleighsl_checkpoint_write(fs, &iov, 1));
+}
+
+static uint64_t __object_footprint (raleighsl_t *fs,
+                                    raleighsl_object_t *object)
+{
+  return(sizeof(raleighsl_number_t));
+}
+
 const raleighsl_object_plug_t raleighsl_object_number = {
   .info = {
     .type = RALEIGHSL_PLUG_TYPE_OBJECT,
@@ -252,14 +323,16 @@ const raleighsl_object_plug_t raleighsl_object_number = {
   },
 
   .create   = __object_create,
-  .open     = NULL,
+  .open     = __object_open,
   .close    = __object_close,
   .unlink   = NULL,
 
   .apply    = __object_apply,
   .revert   = __object_revert,
   .commit   = __object_commit,
+  .replay   = __object_replay,
 
   .balance  = NULL,
-  .sync     = NULL,
+  .sync     = __object_sync,
+  .footprint = __object_footprint,
 };
@@ -17,8 +17,12 @@
 #include <zcl/debug.h>
 #include <zcl/dlink.h>
 #include <zcl/bytes.h>
+#include <zcl/hash.h>
 #include <zcl/time.h>
 
+#include <raleighsl/checkpoint.h>
+#include <raleighsl/journal.h>
+
 #include "sset.h"
 
 #define RALEIGHSL_SSET(x)                 Z_CAST(raleighsl_sset_t, x)
@@ -62,11 +66,23 @@ struct sset_txn {
 #define __SSET_BLOCK_SIZE         (8 << 10)
 #define __SSET_SYNC_SIZE          (4 << 10)
 #define __SSET_BLOCK_MERGE_SIZE   (__SSET_BLOCK_SIZE - (__SSET_BLOCK_SIZE >> 2))
+#define __SSET_BALANCE_STEP_USEC  (1000)
+#define __SSET_REBUILD_MAX_NODES  (16)
+#define __SSET_KEY_MAX_SIZE       (128)
+
+/*
+ * Blocked bloom filter of the block keys, rebuilt when the block is
+ * finalized or loaded. A key maps to one 512-bit line, all probes in it.
+ */
+#define __SSET_BLOOM_LINE_BITS    (3)
+#define __SSET_BLOOM_LINES        (1 << __SSET_BLOOM_LINE_BITS)
+#define __SSET_BLOOM_PROBES       (4)
 
 struct sset_block {
   z_dlink_node_t blkseq;
 
   uint32_t refs;
+  uint64_t bloom[__SSET_BLOOM_LINES * 8];
   uint8_t data[__SSET_BLOCK_SIZE];
 };
 
@@ -81,7 +97,9 @@ struct sset_node {
   struct sset_block *block;
 
   /* Node Stats */
+  unsigned int version;           /* Bumped when the mem_data changes */
   unsigned int bufsize;
+  unsigned int rmsize;            /* Block entries hidden by delete markers */
   unsigned int min_ksize;
   unsigned int max_ksize;
   unsigned int min_vsize;
@@ -102,8 +120,28 @@ typedef struct raleighsl_sset {
   z_dlink_node_t dirtyq;          /* Pending txn-apply (node->dirtyq) */
   z_dlink_node_t rm_nodes;
   z_dlink_node_t add_nodes;
+  z_dlink_node_t rebuilds;        /* Prepared by the balance (rebuild->rebuilds) */
+  uint64_t memsize;               /* Attached nodes footprint in bytes */
+
+  /* Incremental balance, the next step resumes from the cursor node */
+  uint8_t balance_key[__SSET_KEY_MAX_SIZE];
+  uint32_t balance_ksize;
+  int balance_more;
 } raleighsl_sset_t;
 
+/*
+ * A run of adjacent nodes encoded into new blocks by the prepare step.
+ * The nodes are only read, the balance step swaps in the blocks if the
+ * nodes are still at the version seen.
+ */
+struct sset_rebuild {
+  z_dlink_node_t rebuilds;
+  z_dlink_node_t blkseq;
+  uint64_t version;
+  unsigned int nnodes;
+  struct sset_node *nodes[__SSET_REBUILD_MAX_NODES];
+};
+
 struct sset_txn_iter {
   __Z_MAP_ITERABLE__
   z_map_entry_t entry;
@@ -491,8 +529,66 @@ static struct sset_block *__sset_block_create (void) {
   return(block);
 }
 
+static uint64_t *__sset_block_bloom_line (struct sset_block *self,
+                                           const z_byte_slice_t *key,
+                                           uint32_t *hash)
+{
+  *hash = z_hash32_murmur3(key->data, key->size, 0);
+  return(self->bloom + ((*hash >> (32 - __SSET_BLOOM_LINE_BITS)) << 3));
+}
+
+static void __sset_block_bloom_add (struct sset_block *self,
+                                    const z_byte_slice_t *key)
+{
+  uint64_t *line;
+  uint32_t delta;
+  uint32_t hash;
+  int i;
+
+  line = __sset_block_bloom_line(self, key, &hash);
+  delta = (hash >> 17) | (hash << 15);
+  for (i = 0; i < __SSET_BLOOM_PROBES; ++i) {
+    line[(hash >> 6) & 7] |= (1ull << (hash & 63));
+    hash += delta;
+  }
+}
+
+static int __sset_block_bloom_contains (struct sset_block *self,
+                                        const z_byte_slice_t *key)
+{
+  uint64_t *line;
+  uint32_t delta;
+  uint32_t hash;
+  int i;
+
+  line = __sset_block_bloom_line(self, key, &hash);
+  delta = (hash >> 17) | (hash << 15);
+  for (i = 0; i < __SSET_BLOOM_PROBES; ++i) {
+    if (!(line[(hash >> 6) & 7] & (1ull << (hash & 63))))
+      return(0);
+    hash += delta;
+  }
+  return(1);
+}
+
+static void __sset_block_bloom_build (struct sset_block *self) {
+  z_bucket_iterator_t iter;
+  z_map_iterator_t *map_iter = Z_MAP_ITERATOR(&iter);
+  int has_data;
+
+  z_memzero(self->bloom, sizeof(self->bloom));
+  z_bucket_iterator_open(&iter, __sset_block_type(self), self->data,
+                         &__sset_block_vtable_refs, self);
+  has_data = z_map_iterator_begin(map_iter);
+  while (has_data) {
+    __sset_block_bloom_add(self, &(z_map_iterator_current(map_iter)->key));
+    has_data = z_map_iterator_next(map_iter);
+  }
+}
+
 static void __sset_block_finalize (struct sset_block *self) {
   __sset_block_type(self)->finalize(self->data);
+  __sset_block_bloom_build(self);
 }
 
 static int __sset_block_add (struct sset_block *self,
@@ -512,7 +608,13 @@ static int __sset_block_lookup (struct sset_block *self,
                                 z_bytes_ref_t *value)
 {
   z_byte_slice_t val;
-  int cmp = z_bucket_search(__sset_block_type(self), self->data, z_bytes_ref_slice(key), &val);
+  int cmp;
+
+  /* Most of the misses skip the bucket scan */
+  if (!__sset_block_bloom_contains(self, z_bytes_ref_slice(key)))
+    return(1);
+
+  cmp = z_bucket_search(__sset_block_type(self), self->data, z_bytes_ref_slice(key), &val);
   if (!cmp && value != NULL) {
     z_bytes_ref_set(value, &val, &__sset_block_vtable_refs, self);
   }
@@ -589,7 +691,9 @@ static struct sset_node *__sset_node_alloc (struct sset_block *block) {
   node->txn_locks = NULL;
   node->block = block;
 
+  node->version = 0;
   node->bufsize = 0;
+  node->rmsize = 0;
   node->min_ksize = ~0;
   node->max_ksize = 0;
   node->min_vsize = ~0;
@@ -598,7 +702,16 @@ static struct sset_node *__sset_node_alloc (struct sset_block *block) {
 }
 
 #define __sset_node_requires_balance(node)  \
-  ((node)->bufsize >= __SSET_SYNC_SIZE)
+  (((node)->bufsize + (node)->rmsize) >= __SSET_SYNC_SIZE)
+
+#define __sset_node_size(node)                                      \
+  (sizeof(struct sset_node) + (node)->bufsize +                     \
+   (((node)->block != NULL) ? sizeof(struct sset_block) : 0))
+
+/* Estimate of the node data once rewritten, without the deleted entries */
+#define __sset_node_used(node)                                      \
+  ((node)->bufsize - (node)->rmsize + (((node)->block != NULL) ?    \
+    (__SSET_BLOCK_SIZE - __sset_block_type((node)->block)->available((node)->block->data)) : 0))
 
 #include <zcl/writer.h>
 static int __sset_node_mem_search (struct sset_node *node,
@@ -710,7 +823,7 @@ static const z_map_entry_t *__sset_node_iter_next (struct sset_node_iter *iter)
  */
 
 struct kprefix {
-  uint8_t buffer[128];
+  uint8_t buffer[__SSET_KEY_MAX_SIZE];
   size_t  size;
 };
 
@@ -719,7 +832,7 @@ size_t __kprefix_shared (struct kprefix *self,
                          z_byte_slice_t *prefix_key)
 {
   size_t shared = z_memshared(self->buffer, self->size, key->data, key->size);
-  Z_ASSERT(key->size <= 128, "Keys > 128 not supported yet");
+  Z_ASSERT(key->size <= __SSET_KEY_MAX_SIZE, "Keys > 128 not supported yet");
   z_byte_slice_set(prefix_key, key->data + shared, key->size - shared);
   z_memcpy(self->buffer + shared, prefix_key->data, prefix_key->size);
   self->size = key->size;
@@ -728,13 +841,19 @@ size_t __kprefix_shared (struct kprefix *self,
 
 /*
  * A B C D [data] E F G
+ * The nodes are adjacent, their entries are already sorted
+ * so the blocks are filled in order.
  */
-static int __sset_node_balance (struct sset_node *node, z_dlink_node_t *blkseq) {
+static int __sset_node_balance (struct sset_node **nodes,
+                                unsigned int nnodes,
+                                z_dlink_node_t *blkseq)
+{
   struct sset_node_iter iter;
   z_dlink_node_t node_blkseq;
   const z_map_entry_t *entry;
   struct sset_block *block;
   struct kprefix kprefix;
+  unsigned int i;
 
   z_dlink_init(&node_blkseq);
 
@@ -742,27 +861,43 @@ static int __sset_node_balance (struct sset_node *node, z_dlink_node_t *blkseq)
    * Generate the new blocks from the in-memory data
    * TODO: Verify if the current block overlaps
    */
-  __sset_node_iter_open(&iter, node, 0, NULL, 0);
-  entry = __sset_node_iter_next(&iter);
-  while (entry != NULL) {
-    z_byte_slice_t prefix_key;
-    kprefix.size = 0;
-
-    block = __sset_block_create();
-    if (Z_MALLOC_IS_NULL(block))
-      break;
+  block = NULL;
+  entry = NULL;
+  for (i = 0; i < nnodes; ++i) {
+    __sset_node_iter_open(&iter, nodes[i], 0, NULL, 0);
+    entry = __sset_node_iter_next(&iter);
+    while (entry != NULL) {
+      z_byte_slice_t prefix_key;
+      size_t shared;
+
+      if (block == NULL) {
+        block = __sset_block_create();
+        if (Z_MALLOC_IS_NULL(block))
+          break;
+        kprefix.size = 0;
+      }
 
-    do {
-      size_t shared = __kprefix_shared(&kprefix, &(entry->key), &prefix_key);
-      if (__sset_block_add(block, shared, &prefix_key, &(entry->value)))
-        break;
+      shared = __kprefix_shared(&kprefix, &(entry->key), &prefix_key);
+      if (__sset_block_add(block, shared, &prefix_key, &(entry->value))) {
+        /* The block is full, retry the entry on a new one */
+        __sset_block_finalize(block);
+        z_dlink_add_tail(&node_blkseq, &(block->blkseq));
+        block = NULL;
+        continue;
+      }
 
       entry = __sset_node_iter_next(&iter);
-    } while (entry != NULL);
+    }
+    __sset_node_iter_close(&iter);
+
+    if (Z_UNLIKELY(entry != NULL))
+      break;
+  }
+
+  if (block != NULL) {
     __sset_block_finalize(block);
     z_dlink_add_tail(&node_blkseq, &(block->blkseq));
   }
-  __sset_node_iter_close(&iter);
 
   /* handle memory error during block creation */
   if (Z_UNLIKELY(entry != NULL)) {
@@ -779,6 +914,80 @@ static int __sset_node_balance (struct sset_node *node, z_dlink_node_t *blkseq)
   return(1);
 }
 
+/* ============================================================================
+ *  PRIVATE SSet Rebuild methods
+ */
+static struct sset_rebuild *__sset_rebuild_alloc (void) {
+  struct sset_rebuild *rebuild;
+
+  rebuild = z_memory_struct_alloc(z_global_memory(), struct sset_rebuild);
+  if (Z_MALLOC_IS_NULL(rebuild))
+    return(NULL);
+
+  z_dlink_init(&(rebuild->rebuilds));
+  z_dlink_init(&(rebuild->blkseq));
+  rebuild->version = 0;
+  rebuild->nnodes = 0;
+  return(rebuild);
+}
+
+static void __sset_rebuild_free (struct sset_rebuild *rebuild) {
+  struct sset_block *block;
+  z_dlink_del_for_each_entry(&(rebuild->blkseq), block, struct sset_block, blkseq, {
+    __sset_block_free(block);
+  });
+  z_memory_struct_free(z_global_memory(), struct sset_rebuild, rebuild);
+}
+
+static void __sset_rebuild_add (struct sset_rebuild *rebuild, struct sset_node *node) {
+  rebuild->nodes[rebuild->nnodes++] = node;
+  rebuild->version += node->version;
+}
+
+/* The node versions only grow, a different sum means a changed node */
+static int __sset_rebuild_is_valid (const struct sset_rebuild *rebuild) {
+  uint64_t version = 0;
+  unsigned int i;
+  for (i = 0; i < rebuild->nnodes; ++i) {
+    if (rebuild->nodes[i]->txn_locks != NULL)
+      return(0);
+    version += rebuild->nodes[i]->version;
+  }
+  return(version == rebuild->version);
+}
+
+static int __sset_rebuild_swap (raleighsl_sset_t *sset, struct sset_rebuild *rebuild) {
+  struct sset_block *block;
+  struct sset_node *node;
+  z_dlink_node_t nodes;
+  unsigned int i;
+
+  /* Allocate the new nodes first, the blocks are moved once all are in */
+  z_dlink_init(&nodes);
+  z_dlink_for_each_entry(&(rebuild->blkseq), block, struct sset_block, blkseq, {
+    node = __sset_node_alloc(NULL);
+    if (Z_MALLOC_IS_NULL(node)) {
+      z_dlink_del_for_each_entry(&nodes, node, struct sset_node, commitq, {
+        __sset_node_free(sset, node);
+      });
+      return(0);
+    }
+    z_dlink_add_tail(&nodes, &(node->commitq));
+  });
+
+  z_dlink_del_for_each_entry(&nodes, node, struct sset_node, commitq, {
+    block = z_dlink_front_entry(&(rebuild->blkseq), struct sset_block, blkseq);
+    z_dlink_del(&(block->blkseq));
+    node->block = block;
+    z_dlink_add_tail(&(sset->add_nodes), &(node->commitq));
+  });
+
+  for (i = 0; i < rebuild->nnodes; ++i) {
+    z_dlink_add_tail(&(sset->rm_nodes), &(rebuild->nodes[i]->commitq));
+  }
+  return(1);
+}
+
 /* ============================================================================
  *  PRIVATE SSet WRITE methods
  */
@@ -919,23 +1128,39 @@ static void __sset_txn_apply (raleighsl_sset_t *sset, struct sset_txn *txn) {
     case SSET_TXN_UPDATE:
       /* Update node stats */
       txn->node->bufsize += __sset_item_size(txn->item);
-      z_min(txn->node->min_ksize, txn->item->key.slice.size);
-      z_max(txn->node->max_ksize, txn->item->key.slice.size);
-      z_min(txn->node->min_vsize, txn->item->value.slice.size);
-      z_max(txn->node->max_vsize, txn->item->value.slice.size);
+      sset->memsize += __sset_item_size(txn->item);
+      txn->node->min_ksize = z_min(txn->node->min_ksize, txn->item->key.slice.size);
+      txn->node->max_ksize = z_max(txn->node->max_ksize, txn->item->key.slice.size);
+      txn->node->min_vsize = z_min(txn->node->min_vsize, txn->item->value.slice.size);
+      txn->node->max_vsize = z_max(txn->node->max_vsize, txn->item->value.slice.size);
 
       /* Attach item */
       __sset_item_attach(&(txn->node->mem_data), txn->item);
+      txn->node->version++;
       break;
     case SSET_TXN_REMOVE: {
+      z_byte_slice_t value;
       z_tree_node_t *node;
       if ((node = __sset_item_detach(&(txn->node->mem_data), &(txn->item->key))) != NULL) {
+        struct sset_item *item = z_container_of(node, struct sset_item, __node__);
+        txn->node->bufsize -= __sset_item_size(item);
+        sset->memsize -= __sset_item_size(item);
         __sset_item_node_free(sset, node);
-        __sset_item_free(txn->item);
-      } else {
-        /* Attach item (replaces the old one) */
+      }
+
+      /* The delete marker hides the key stored in the block */
+      if (txn->node->block != NULL &&
+          !z_bucket_search(__sset_block_type(txn->node->block), txn->node->block->data,
+                           z_bytes_ref_slice(&(txn->item->key)), &value))
+      {
+        txn->node->rmsize += txn->item->key.slice.size + value.size;
+        txn->node->bufsize += __sset_item_size(txn->item);
+        sset->memsize += __sset_item_size(txn->item);
         __sset_item_attach(&(txn->node->mem_data), txn->item);
+      } else {
+        __sset_item_free(txn->item);
       }
+      txn->node->version++;
       break;
     }
   }
@@ -963,6 +1188,47 @@ static void __sset_txn_commit (raleighsl_sset_t *sset, struct sset_txn *txn) {
   }
 }
 
+/* ============================================================================
+ *  PRIVATE SSet Journal
+ */
+enum sset_journal_op {
+  SSET_JOURNAL_INSERT = 1,    /* [u32 ksize][u32 vsize][key][value] */
+  SSET_JOURNAL_UPDATE = 2,    /* [u32 ksize][u32 vsize][key][value] */
+  SSET_JOURNAL_REMOVE = 3,    /* [u32 ksize][key] */
+};
+
+static raleighsl_errno_t __sset_txn_journal (raleighsl_t *fs,
+                                             raleighsl_object_t *object,
+                                             const struct sset_txn *txn)
+{
+  const struct sset_item *item = txn->item;
+  uint32_t size[2];
+  struct iovec iov[4];
+
+  size[0] = item->key.slice.size;
+  size[1] = item->value.slice.size;
+
+  iov[0].iov_base = &(size[0]);
+  iov[0].iov_len  = sizeof(uint32_t);
+  iov[1].iov_base = &(size[1]);
+  iov[1].iov_len  = sizeof(uint32_t);
+  iov[2].iov_base = item->key.slice.data;
+  iov[2].iov_len  = size[0];
+  iov[3].iov_base = item->value.slice.data;
+  iov[3].iov_len  = size[1];
+
+  switch (txn->type) {
+    case SSET_TXN_INSERT:
+      return(raleighsl_journal_append(fs, object, SSET_JOURNAL_INSERT, iov, 4));
+    case SSET_TXN_UPDATE:
+      return(raleighsl_journal_append(fs, object, SSET_JOURNAL_UPDATE, iov, 4));
+    case SSET_TXN_REMOVE:
+      iov[1] = iov[2];
+      return(raleighsl_journal_append(fs, object, SSET_JOURNAL_REMOVE, iov, 2));
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
 /* ============================================================================
  *  PUBLIC SSet WRITE methods
  */
@@ -1002,7 +1268,8 @@ raleighsl_errno_t raleighsl_sset_insert (raleighsl_t *fs,
     return(RALEIGHSL_ERRNO_NO_MEMORY);
 
   /* Add to the transaction */
-  object->requires_balancing = __sset_node_requires_balance(node);
+  if (__sset_node_requires_balance(node))
+    object->requires_balancing = 1;
   return(__sset_txn_add(fs, transaction, object, node, SSET_TXN_INSERT, entry.item));
 }
 
@@ -1066,7 +1333,9 @@ raleighsl_errno_t raleighsl_sset_remove (raleighsl_t *fs,
   if (Z_MALLOC_IS_NULL(entry.item))
     return(RALEIGHSL_ERRNO_NO_MEMORY);
 
-  /* Add to the transaction */
+  /* Add to the transaction, the delete markers are compacted by the balance */
+  if (__sset_node_requires_balance(node))
+    object->requires_balancing = 1;
   return(__sset_txn_add(fs, transaction, object, node, SSET_TXN_REMOVE, entry.item));
 }
 
@@ -1184,6 +1453,191 @@ void __sset_dump(raleighsl_sset_t *sset, const struct sset_node *node) {
 }
 #endif
 
+/* ============================================================================
+ *  PRIVATE SSet Checkpoint methods
+ *  [u64 nnodes] { [u32 has-block][u32 nitems] [block] { [u32 ksize][u32 vsize] [key][value] } }
+ */
+#define __SSET_CKPT_DELETE_MARKER       (1U << 31)
+
+struct sset_ckpt_node {
+  uint32_t has_block;
+  uint32_t nitems;
+} __attribute__((__packed__));
+
+struct sset_ckpt_item {
+  uint32_t ksize;
+  uint32_t vsize;
+} __attribute__((__packed__));
+
+static raleighsl_errno_t __sset_node_load (raleighsl_t *fs,
+                                           raleighsl_object_t *object,
+                                           struct sset_node *node,
+                                           uint32_t nitems)
+{
+  struct sset_ckpt_item hitem;
+  raleighsl_errno_t errno;
+  struct sset_item *item;
+  z_bytes_ref_t value;
+  z_bytes_ref_t key;
+  z_bytes_t *bytes;
+  uint32_t vsize;
+
+  while (nitems--) {
+    if ((errno = raleighsl_checkpoint_read(fs, object, &hitem, sizeof(hitem))))
+      return(errno);
+
+    vsize = hitem.vsize & ~__SSET_CKPT_DELETE_MARKER;
+    bytes = z_bytes_alloc(hitem.ksize + vsize);
+    if (Z_MALLOC_IS_NULL(bytes))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    errno = raleighsl_checkpoint_read(fs, object, z_bytes_data(bytes), hitem.ksize + vsize);
+    if (errno) {
+      z_bytes_free(bytes);
+      return(errno);
+    }
+
+    /* Key and value share the same buffer */
+    z_bytes_ref_set_data(&key, z_bytes_data(bytes), hitem.ksize,
+                         &z_vtable_bytes_refs, bytes);
+    z_bytes_ref_set_data(&value, z_bytes_data(bytes) + hitem.ksize, vsize,
+                         &z_vtable_bytes_refs, bytes);
+    item = __sset_item_alloc(&key, (vsize > 0) ? &value : NULL,
+                             hitem.vsize & __SSET_CKPT_DELETE_MARKER);
+    z_bytes_free(bytes);
+    if (Z_MALLOC_IS_NULL(item))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    node->bufsize += __sset_item_size(item);
+    __sset_item_attach(&(node->mem_data), item);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __sset_load (raleighsl_t *fs,
+                                      raleighsl_object_t *object,
+                                      raleighsl_sset_t *sset)
+{
+  struct sset_ckpt_node hnode;
+  struct sset_block *block;
+  struct sset_node *node;
+  raleighsl_errno_t errno;
+  uint64_t nnodes;
+
+  if ((errno = raleighsl_checkpoint_read(fs, object, &nnodes, sizeof(uint64_t))))
+    return(errno);
+
+  /* Nodes are stored in key order, the layout is restored as it was */
+  while (nnodes--) {
+    if ((errno = raleighsl_checkpoint_read(fs, object, &hnode, sizeof(hnode))))
+      return(errno);
+
+    block = NULL;
+    if (hnode.has_block) {
+      block = __sset_block_alloc();
+      if (Z_MALLOC_IS_NULL(block))
+        return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+      errno = raleighsl_checkpoint_read(fs, object, block->data, __SSET_BLOCK_SIZE);
+      if (errno) {
+        __sset_block_free(block);
+        return(errno);
+      }
+      __sset_block_bloom_build(block);
+    }
+
+    node = __sset_node_alloc(block);
+    if (Z_MALLOC_IS_NULL(node)) {
+      __sset_block_free(block);
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+    }
+
+    __sset_node_attach(sset, node);
+    if ((errno = __sset_node_load(fs, object, node, hnode.nitems)))
+      return(errno);
+    sset->memsize += __sset_node_size(node);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __sset_node_sync (raleighsl_t *fs,
+                                           const struct sset_node *node)
+{
+  const z_tree_node_t *tree_node;
+  const struct sset_item *item;
+  struct sset_ckpt_node hnode;
+  struct sset_ckpt_item hitem;
+  raleighsl_errno_t errno;
+  z_tree_iter_t iter;
+  struct iovec iov[3];
+
+  /* Only the committed items are in mem_data, txn_locks are skipped */
+  hnode.has_block = (node->block != NULL);
+  hnode.nitems = 0;
+  z_tree_iter_open(&iter, node->mem_data);
+  while ((hnode.nitems ? z_tree_iter_next(&iter) : z_tree_iter_begin(&iter)) != NULL)
+    hnode.nitems++;
+  z_tree_iter_close(&iter);
+
+  iov[0].iov_base = &hnode;
+  iov[0].iov_len  = sizeof(hnode);
+  iov[1].iov_base = hnode.has_block ? node->block->data : NULL;
+  iov[1].iov_len  = hnode.has_block ? __SSET_BLOCK_SIZE : 0;
+  if ((errno = raleighsl_checkpoint_write(fs, iov, 2)))
+    return(errno);
+
+  z_tree_iter_open(&iter, node->mem_data);
+  tree_node = z_tree_iter_begin(&iter);
+  while (!errno && tree_node != NULL) {
+    item = z_container_of(tree_node, const struct sset_item, __node__);
+    hitem.ksize = item->key.slice.size;
+    hitem.vsize = item->value.slice.size;
+    if (__sset_item_is_delete_marker(item))
+      hitem.vsize |= __SSET_CKPT_DELETE_MARKER;
+
+    iov[0].iov_base = &hitem;
+    iov[0].iov_len  = sizeof(hitem);
+    iov[1].iov_base = item->key.slice.data;
+    iov[1].iov_len  = item->key.slice.size;
+    iov[2].iov_base = item->value.slice.data;
+    iov[2].iov_len  = item->value.slice.size;
+    errno = raleighsl_checkpoint_write(fs, iov, 3);
+    tree_node = z_tree_iter_next(&iter);
+  }
+  z_tree_iter_close(&iter);
+  return(errno);
+}
+
+static raleighsl_errno_t __sset_sync (raleighsl_t *fs,
+                                      raleighsl_sset_t *sset)
+{
+  const struct sset_node *node;
+  raleighsl_errno_t errno;
+  z_tree_iter_t iter;
+  struct iovec iov;
+  uint64_t nnodes;
+
+  nnodes = 0;
+  z_tree_iter_open(&iter, sset->root);
+  while ((nnodes ? z_tree_iter_next(&iter) : z_tree_iter_begin(&iter)) != NULL)
+    nnodes++;
+  z_tree_iter_close(&iter);
+
+  iov.iov_base = &nnodes;
+  iov.iov_len  = sizeof(uint64_t);
+  if ((errno = raleighsl_checkpoint_write(fs, &iov, 1)))
+    return(errno);
+
+  z_tree_iter_open(&iter, sset->root);
+  node = __sset_node_from_tree(z_tree_iter_begin(&iter));
+  while (!errno && node != NULL) {
+    errno = __sset_node_sync(fs, node);
+    node = __sset_node_from_tree(z_tree_iter_next(&iter));
+  }
+  z_tree_iter_close(&iter);
+  return(errno);
+}
+
 /* ============================================================================
  *  SSet Object Plugin
  */
@@ -1215,6 +1669,7 @@ static raleighsl_errno_t __object_create (raleighsl_t *fs,
   /* Attach the Root node */
   sset->root = NULL;
   __sset_node_attach(sset, node);
+  sset->memsize = __sset_node_size(node);
 
   /* Initialize the dirty-queue */
   z_dlink_init(&(sset->txnq));
@@ -1222,6 +1677,10 @@ static raleighsl_errno_t __object_create (raleighsl_t *fs,
 
   z_dlink_init(&(sset->rm_nodes));
   z_dlink_init(&(sset->add_nodes));
+  z_dlink_init(&(sset->rebuilds));
+
+  sset->balance_ksize = 0;
+  sset->balance_more = 0;
 
   object->membufs = sset;
   return(RALEIGHSL_ERRNO_NONE);
@@ -1231,11 +1690,38 @@ static raleighsl_errno_t __object_close (raleighsl_t *fs,
                                          raleighsl_object_t *object)
 {
   raleighsl_sset_t *sset = RALEIGHSL_SSET(object->membufs);
+  struct sset_rebuild *rebuild;
+  z_dlink_del_for_each_entry(&(sset->rebuilds), rebuild, struct sset_rebuild, rebuilds, {
+    __sset_rebuild_free(rebuild);
+  });
   z_tree_node_clear(&__sset_node_tree_info, sset->root, NULL);
   z_memory_struct_free(z_global_memory(), raleighsl_sset_t, sset);
   return(RALEIGHSL_ERRNO_NONE);
 }
 
+static raleighsl_errno_t __object_open (raleighsl_t *fs,
+                                        raleighsl_object_t *object)
+{
+  raleighsl_sset_t *sset;
+  raleighsl_errno_t errno;
+
+  if ((errno = __object_create(fs, object)))
+    return(errno);
+
+  /* Drop the default root node, the checkpoint has its own */
+  sset = RALEIGHSL_SSET(object->membufs);
+  z_tree_node_clear(&__sset_node_tree_info, sset->root, NULL);
+  sset->root = NULL;
+  sset->memsize = 0;
+
+  if ((errno = __sset_load(fs, object, sset))) {
+    __object_close(fs, object);
+    object->membufs = NULL;
+    return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
 static void __object_apply (raleighsl_t *fs,
                             raleighsl_object_t *object,
                             raleighsl_txn_atom_t *atom)
@@ -1260,29 +1746,56 @@ static raleighsl_errno_t __object_commit (raleighsl_t *fs,
                                           raleighsl_object_t *object)
 {
   raleighsl_sset_t *sset = RALEIGHSL_SSET(object->membufs);
+  struct sset_node *empty_node;
   struct sset_node *node;
   struct sset_txn *txn;
 
+  /* The merged nodes may have no entries left, keep an empty root around */
+  empty_node = NULL;
+  if (z_dlink_is_not_empty(&(sset->rm_nodes)) && z_dlink_is_empty(&(sset->add_nodes))) {
+    empty_node = __sset_node_alloc(NULL);
+    if (Z_MALLOC_IS_NULL(empty_node))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+  }
+
   /* Detach old nodes */
   z_dlink_del_for_each_entry(&(sset->rm_nodes), node, struct sset_node, commitq, {
     z_tree_node_t *dnode = __sset_node_detach(sset, node);
     Z_ASSERT(dnode == &(node->__node__), "NOT DETACHD %p", dnode);
+    sset->memsize -= __sset_node_size(node);
     __sset_node_free(sset, node);
+    object->requires_balancing = sset->balance_more;
   });
 
   /* Attach new nodes */
   z_dlink_del_for_each_entry(&(sset->add_nodes), node, struct sset_node, commitq, {
     __sset_node_attach(sset, node);
-    object->requires_balancing = 0;
+    sset->memsize += __sset_node_size(node);
+    object->requires_balancing = sset->balance_more;
   });
 
+  if (empty_node != NULL) {
+    if (sset->root == NULL) {
+      __sset_node_attach(sset, empty_node);
+      sset->memsize += __sset_node_size(empty_node);
+    } else {
+      __sset_node_free(sset, empty_node);
+    }
+  }
+
   /* Apply the pending txn-atom write */
   z_dlink_del_for_each_entry(&(sset->txnq), txn, struct sset_txn, commitq, {
     __sset_txn_commit(sset, txn);
   });
 
-  /* TODO: Write to Journal */
-  Z_LOG_WARN("TODO: Write to Journal");
+  /* Write the redo records to the journal */
+  z_dlink_for_each_entry(&(sset->dirtyq), node, struct sset_node, dirtyq, {
+    z_dlink_for_each_entry(&(node->commitq), txn, struct sset_txn, commitq, {
+      raleighsl_errno_t errno;
+      if ((errno = __sset_txn_journal(fs, object, txn)))
+        return(errno);
+    });
+  });
 
   /* Apply commits - [Point of No Return] */
   z_dlink_del_for_each_entry(&(sset->dirtyq), node, struct sset_node, dirtyq, {
@@ -1294,62 +1807,160 @@ static raleighsl_errno_t __object_commit (raleighsl_t *fs,
   return(RALEIGHSL_ERRNO_NONE);
 }
 
-static raleighsl_errno_t __object_balance (raleighsl_t *fs,
+static raleighsl_errno_t __object_replay (raleighsl_t *fs,
+                                          raleighsl_object_t *object,
+                                          uint16_t op,
+                                          const uint8_t *data,
+                                          uint32_t size)
+{
+  raleighsl_errno_t errno;
+  z_bytes_ref_t value;
+  z_bytes_ref_t key;
+  uint32_t ksize;
+  uint32_t vsize;
+  z_bytes_t *bytes;
+
+  /* key and value refs keep the record copy alive */
+  bytes = z_bytes_from_data(data, size);
+  if (Z_MALLOC_IS_NULL(bytes))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  data = z_bytes_data(bytes);
+  switch (op) {
+    case SSET_JOURNAL_INSERT:
+    case SSET_JOURNAL_UPDATE:
+      z_memcpy(&ksize, data, sizeof(uint32_t));
+      z_memcpy(&vsize, data + sizeof(uint32_t), sizeof(uint32_t));
+      data += 2 * sizeof(uint32_t);
+      z_bytes_ref_set_data(&key, data, ksize, &z_vtable_bytes_refs, bytes);
+      z_bytes_ref_set_data(&value, data + ksize, vsize, &z_vtable_bytes_refs, bytes);
+      errno = raleighsl_sset_insert(fs, NULL, object, 1, &key, &value);
+      break;
+    case SSET_JOURNAL_REMOVE:
+      z_memcpy(&ksize, data, sizeof(uint32_t));
+      data += sizeof(uint32_t);
+      z_bytes_ref_set_data(&key, data, ksize, &z_vtable_bytes_refs, bytes);
+      if (!(errno = raleighsl_sset_remove(fs, NULL, object, &key, &value)))
+        z_bytes_ref_release(&value);
+      break;
+    default:
+      errno = RALEIGHSL_ERRNO_NOT_IMPLEMENTED;
+      break;
+  }
+
+  z_bytes_free(bytes);
+  return(errno);
+}
+
+/*
+ * Runs under the read lock: the nodes are only read, the writers may
+ * add txn-atoms meanwhile but the commits wait for the step to end.
+ */
+static raleighsl_errno_t __object_prepare (raleighsl_t *fs,
                                            raleighsl_object_t *object)
 {
   raleighsl_sset_t *sset = RALEIGHSL_SSET(object->membufs);
-  struct sset_block *block;
+  struct sset_rebuild *rebuild;
   z_tree_iter_t iter_node;
   struct sset_node *node;
-  z_dlink_node_t blkseq;
+  z_bytes_ref_t cursor;
+  uint64_t deadline;
 
-  Z_ASSERT(z_dlink_is_empty(&(sset->txnq)), "there are pending commits for the txns");
-  Z_ASSERT(z_dlink_is_empty(&(sset->dirtyq)), "there are pending commits for the nodes");
+  Z_ASSERT(z_dlink_is_empty(&(sset->rebuilds)), "the previous rebuilds are not swapped in");
+
+  /*
+   * Build new blocks, resuming from the cursor node. The nodes over the
+   * sync size are rewritten, and the adjacent ones that fit in a merge-size
+   * block are rewritten together. The step stops once out of time and the
+   * next one picks up from the first node not visited.
+   */
+  deadline = z_time_micros() + __SSET_BALANCE_STEP_USEC;
+  z_bytes_ref_set_data(&cursor, sset->balance_key, sset->balance_ksize, NULL, NULL);
+  sset->balance_ksize = 0;
+  sset->balance_more = 0;
 
-  /* Build new blocks */
-  z_dlink_init(&blkseq);
+  rebuild = NULL;
   z_tree_iter_open(&iter_node, sset->root);
-  node = __sset_node_from_tree(z_tree_iter_begin(&iter_node));
+  node = __sset_node_from_tree(z_tree_iter_seek_le(&iter_node, __sset_node_key_compare,
+                                                   &cursor, NULL));
   while (node != NULL) {
-    if (__sset_node_requires_balance(node)) {
-      if (__sset_node_balance(node, &blkseq)) {
-        z_dlink_add_tail(&(sset->rm_nodes), &(node->commitq));
-      }
+    unsigned int used;
+    int rebuild_node;
+
+    /* The txn-atoms not yet applied point to the node, retry later */
+    if (node->txn_locks != NULL) {
+      node = __sset_node_from_tree(z_tree_iter_next(&iter_node));
+      continue;
+    }
+
+    if (rebuild == NULL && (rebuild = __sset_rebuild_alloc()) == NULL)
+      break;
+
+    rebuild->nnodes = 0;
+    rebuild->version = 0;
+    __sset_rebuild_add(rebuild, node);
+    rebuild_node = __sset_node_requires_balance(node);
+    used = __sset_node_used(node);
+    while ((node = __sset_node_from_tree(z_tree_iter_next(&iter_node))) != NULL &&
+           rebuild->nnodes < __SSET_REBUILD_MAX_NODES)
+    {
+      unsigned int node_used = __sset_node_used(node);
+      if (node->txn_locks != NULL || (used + node_used) > __SSET_BLOCK_MERGE_SIZE)
+        break;
+      __sset_rebuild_add(rebuild, node);
+      used += node_used;
+    }
+
+    if ((rebuild_node || rebuild->nnodes > 1) &&
+        __sset_node_balance(rebuild->nodes, rebuild->nnodes, &(rebuild->blkseq)))
+    {
+      z_dlink_add_tail(&(sset->rebuilds), &(rebuild->rebuilds));
+      rebuild = NULL;
+      /* The rewritten blocks may now fit with the neighbours, one more pass */
+      sset->balance_more = 1;
+    }
+
+    /* Out of time, save the cursor for the next step */
+    if (node != NULL && z_time_micros() >= deadline) {
+      z_byte_slice_t key;
+      __sset_block_first_key(node->block, &key);
+      z_memcpy(sset->balance_key, key.data, key.size);
+      sset->balance_ksize = key.size;
+      sset->balance_more = 1;
+      break;
     }
-    node = __sset_node_from_tree(z_tree_iter_next(&iter_node));
   }
   z_tree_iter_close(&iter_node);
 
-  /* quick exit, nothing to do */
-  if (z_dlink_is_empty(&blkseq)) {
-    object->requires_balancing = 0;
-    return(RALEIGHSL_ERRNO_NONE);
-  }
+  if (rebuild != NULL)
+    __sset_rebuild_free(rebuild);
 
-  /* TODO: Merge small blocks */
-  Z_LOG_TRACE("TODO: BALANCE!");
+  return(RALEIGHSL_ERRNO_NONE);
+}
 
-  /* Build new nodes */
-  z_dlink_del_for_each_entry(&blkseq, block, struct sset_block, blkseq, {
-    node = __sset_node_alloc(block);
-    if (Z_MALLOC_IS_NULL(node))
-      break;
-    z_dlink_add_tail(&(sset->add_nodes), &(node->commitq));
+/*
+ * Swaps in the prepared blocks, the commit attaches the new nodes.
+ * The rebuilds with nodes changed since the prepare step are dropped,
+ * and picked up again by the next pass.
+ */
+static raleighsl_errno_t __object_balance (raleighsl_t *fs,
+                                           raleighsl_object_t *object)
+{
+  raleighsl_sset_t *sset = RALEIGHSL_SSET(object->membufs);
+  struct sset_rebuild *rebuild;
+
+  Z_ASSERT(z_dlink_is_empty(&(sset->txnq)), "there are pending commits for the txns");
+  Z_ASSERT(z_dlink_is_empty(&(sset->dirtyq)), "there are pending commits for the nodes");
+
+  z_dlink_del_for_each_entry(&(sset->rebuilds), rebuild, struct sset_rebuild, rebuilds, {
+    if (!__sset_rebuild_is_valid(rebuild) || !__sset_rebuild_swap(sset, rebuild))
+      sset->balance_more = 1;
+    __sset_rebuild_free(rebuild);
   });
 
-  if (Z_UNLIKELY(z_dlink_is_not_empty(&blkseq))) {
-    /* Remove new blocks */
-    z_dlink_del_for_each_entry(&blkseq, block, struct sset_block, blkseq, {
-      __sset_block_free(block);
-    });
-    /* Remove new nodes */
-    z_dlink_del_for_each_entry(&(sset->add_nodes), node, struct sset_node, commitq, {
-      __sset_node_free(sset, node);
-    });
-    /* Reset rm_nodes list */
-    z_dlink_init(&(sset->rm_nodes));
-    return(RALEIGHSL_ERRNO_NO_MEMORY);
-  }
+  /* quick exit, nothing to do */
+  if (z_dlink_is_empty(&(sset->add_nodes)) && z_dlink_is_empty(&(sset->rm_nodes)))
+    object->requires_balancing = sset->balance_more;
 
   return(RALEIGHSL_ERRNO_NONE);
 }
@@ -1357,7 +1968,14 @@ static raleighsl_errno_t __object_balance (raleighsl_t *fs,
 static raleighsl_errno_t __object_sync (raleighsl_t *fs,
                                         raleighsl_object_t *object)
 {
-  return(RALEIGHSL_ERRNO_NONE);
+  return(__sset_sync(fs, RALEIGHSL_SSET(object->membufs)));
+}
+
+static uint64_t __object_footprint (raleighsl_t *fs,
+                                    raleighsl_object_t *object)
+{
+  raleighsl_sset_t *sset = RALEIGHSL_SSET(object->membufs);
+  return(sizeof(raleighsl_sset_t) + sset->memsize);
 }
 
 const raleighsl_object_plug_t raleighsl_object_sset = {
@@ -1368,14 +1986,17 @@ const raleighsl_object_plug_t raleighsl_object_sset = {
   },
 
   .create   = __object_create,
-  .open     = NULL,
+  .open     = __object_open,
   .close    = __object_close,
   .unlink   = NULL,
 
   .apply    = __object_apply,
   .revert   = __object_revert,
   .commit   = __object_commit,
+  .replay   = __object_replay,
 
+  .prepare  = __object_prepare,
   .balance  = __object_balance,
   .sync     = __object_sync,
+  .footprint = __object_footprint,
 };
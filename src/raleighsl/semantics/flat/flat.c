@@ -86,6 +86,12 @@ static raleighsl_errno_t __semantic_load (raleighsl_t *fs) {
   if (Z_UNLIKELY(fs->semantic.root == NULL))
     return(RALEIGHSL_ERRNO_NO_MEMORY);
 
+  /* Not in a checkpoint, the root is rebuilt by the journal */
+  if (fs->semantic.root->plug == NULL) {
+    raleighsl_obj_cache_release(fs, fs->semantic.root);
+    return(__semantic_init(fs));
+  }
+
   if ((errno = raleighsl_object_open(fs, fs->semantic.root))) {
     raleighsl_obj_cache_release(fs, fs->semantic.root);
     return(errno);
@@ -0,0 +1,580 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/global.h>
+#include <zcl/bitmap.h>
+#include <zcl/string.h>
+#include <zcl/debug.h>
+#include <zcl/dlink.h>
+#include <zcl/tree.h>
+
+#include "extent.h"
+
+#define __EXTENT_SPACE(fs)        Z_OPAQUE_PTR(&((fs)->space.data), struct extent_space)
+
+/*
+ * The free space is tracked by two trees of free extents, one ordered by
+ * size for the best-fit allocation and one ordered by offset to merge the
+ * adjacent extents on release. The bitmap is the persistent image of the
+ * occupied blocks, written in the checkpoint.
+ *
+ * Released extents may still be referenced by the last checkpoint or by
+ * the journal, so they are parked on the pending list and become available
+ * again only once the next checkpoint is on disk.
+ *
+ * The only user is the checkpoint, which takes its two slots from here.
+ * The objects (sset blocks included) are still streamed into the slot.
+ */
+struct extent {
+  z_tree_node_t by_size;
+  z_tree_node_t by_offset;
+  z_dlink_node_t release;
+
+  uint64_t start;                         /* First block */
+  uint64_t count;                         /* Number of blocks */
+};
+
+struct extent_space {
+  z_spinlock_t lock;
+
+  uint64_t offset;                        /* Device offset of the first block */
+  uint64_t nblocks;                       /* Blocks in the allocator range */
+  uint64_t nfree;                         /* Blocks in the free trees */
+  uint8_t *bitmap;                        /* Occupied blocks */
+
+  z_tree_node_t *by_size;                 /* Free extents by size */
+  z_tree_node_t *by_offset;               /* Free extents by offset */
+  z_dlink_node_t pending;                 /* Released since the last sync */
+  z_dlink_node_t releasing;               /* Released before the last sync */
+};
+
+#define __extent_blocks(size)                                                 \
+  (z_align_up(size, RALEIGHSL_EXTENT_BLOCK_SIZE) / RALEIGHSL_EXTENT_BLOCK_SIZE)
+
+/* ============================================================================
+ *  PRIVATE Extent methods
+ */
+static int __extent_size_compare (void *udata, const void *a, const void *b) {
+  const struct extent *ea = z_container_of(a, const struct extent, by_size);
+  const struct extent *eb = z_container_of(b, const struct extent, by_size);
+  int cmp = z_cmp(ea->count, eb->count);
+  return(cmp ? cmp : z_cmp(ea->start, eb->start));
+}
+
+static int __extent_offset_compare (void *udata, const void *a, const void *b) {
+  const struct extent *ea = z_container_of(a, const struct extent, by_offset);
+  const struct extent *eb = z_container_of(b, const struct extent, by_offset);
+  return(z_cmp(ea->start, eb->start));
+}
+
+static struct extent *__extent_alloc (uint64_t start, uint64_t count) {
+  struct extent *extent;
+
+  extent = z_memory_struct_alloc(z_global_memory(), struct extent);
+  if (Z_MALLOC_IS_NULL(extent))
+    return(NULL);
+
+  z_dlink_init(&(extent->release));
+  extent->start = start;
+  extent->count = count;
+  return(extent);
+}
+
+static void __extent_free (struct extent *extent) {
+  z_memory_struct_free(z_global_memory(), struct extent, extent);
+}
+
+static void __extent_node_free (void *udata, void *obj) {
+  __extent_free(z_container_of(obj, struct extent, by_size));
+}
+
+static const z_tree_info_t __extent_size_tree_info = {
+  .plug         = &z_tree_avl,
+  .node_compare = __extent_size_compare,
+  .key_compare  = __extent_size_compare,
+  .node_free    = __extent_node_free,
+};
+
+/* The extents are owned by the size tree */
+static const z_tree_info_t __extent_offset_tree_info = {
+  .plug         = &z_tree_avl,
+  .node_compare = __extent_offset_compare,
+  .key_compare  = __extent_offset_compare,
+  .node_free    = NULL,
+};
+
+/* ============================================================================
+ *  PRIVATE Extent Free-Trees methods
+ */
+static void __extent_attach (struct extent_space *space, struct extent *extent) {
+  z_tree_node_attach(&__extent_size_tree_info, &(space->by_size), &(extent->by_size), NULL);
+  z_tree_node_attach(&__extent_offset_tree_info, &(space->by_offset), &(extent->by_offset), NULL);
+  space->nfree += extent->count;
+}
+
+static void __extent_detach (struct extent_space *space, struct extent *extent) {
+  z_tree_node_detach(&__extent_size_tree_info, &(space->by_size), &(extent->by_size), NULL);
+  z_tree_node_detach(&__extent_offset_tree_info, &(space->by_offset), &(extent->by_offset), NULL);
+  space->nfree -= extent->count;
+}
+
+static struct extent *__extent_floor (struct extent_space *space, uint64_t start) {
+  z_tree_node_t *node;
+  struct extent key;
+  key.start = start;
+  node = z_tree_node_floor(space->by_offset, __extent_offset_compare, &(key.by_offset), NULL);
+  return(node ? z_container_of(node, struct extent, by_offset) : NULL);
+}
+
+static struct extent *__extent_ceil (struct extent_space *space, uint64_t start) {
+  z_tree_node_t *node;
+  struct extent key;
+  key.start = start;
+  node = z_tree_node_ceil(space->by_offset, __extent_offset_compare, &(key.by_offset), NULL);
+  return(node ? z_container_of(node, struct extent, by_offset) : NULL);
+}
+
+/*
+ * Add the blocks to the free trees, merged with the adjacent extents.
+ */
+static raleighsl_errno_t __extent_insert (struct extent_space *space,
+                                          uint64_t start,
+                                          uint64_t count)
+{
+  struct extent *extent = NULL;
+  struct extent *next;
+
+  if ((next = __extent_floor(space, start)) != NULL &&
+      next->start + next->count == start)
+  {
+    __extent_detach(space, next);
+    next->count += count;
+    extent = next;
+  }
+
+  if ((next = __extent_ceil(space, start + count)) != NULL &&
+      next->start == start + count)
+  {
+    __extent_detach(space, next);
+    if (extent != NULL) {
+      extent->count += next->count;
+      __extent_free(next);
+    } else {
+      next->start = start;
+      next->count += count;
+      extent = next;
+    }
+  }
+
+  if (extent == NULL && (extent = __extent_alloc(start, count)) == NULL)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  __extent_attach(space, extent);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Remove the blocks from the free trees,
+ * the extents partially covered are split.
+ */
+static raleighsl_errno_t __extent_remove (struct extent_space *space,
+                                          uint64_t start,
+                                          uint64_t count)
+{
+  const uint64_t end = start + count;
+  struct extent *extent;
+
+  extent = __extent_floor(space, start);
+  if (extent == NULL || extent->start + extent->count <= start)
+    extent = __extent_ceil(space, start);
+
+  while (extent != NULL && extent->start < end) {
+    const uint64_t extent_end = extent->start + extent->count;
+
+    if (extent->start < start && extent_end > end) {
+      struct extent *right = __extent_alloc(end, extent_end - end);
+      if (Z_MALLOC_IS_NULL(right))
+        return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+      __extent_detach(space, extent);
+      extent->count = start - extent->start;
+      __extent_attach(space, extent);
+      __extent_attach(space, right);
+      break;
+    }
+
+    __extent_detach(space, extent);
+    if (extent->start < start) {
+      extent->count = start - extent->start;
+      __extent_attach(space, extent);
+    } else if (extent_end > end) {
+      extent->start = end;
+      extent->count = extent_end - end;
+      __extent_attach(space, extent);
+    } else {
+      __extent_free(extent);
+    }
+
+    extent = __extent_ceil(space, extent_end);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static struct extent *__extent_best_fit (struct extent_space *space, uint64_t count) {
+  const z_tree_node_t *node;
+  z_tree_iter_t iter;
+  struct extent key;
+
+  key.start = 0;
+  key.count = count;
+  node = z_tree_node_ceil(space->by_size, __extent_size_compare, &(key.by_size), NULL);
+  if (node == NULL) {
+    /* Nothing large enough, hand out the largest one */
+    z_tree_iter_open(&iter, space->by_size);
+    node = z_tree_iter_end(&iter);
+    z_tree_iter_close(&iter);
+  }
+  return(node ? z_container_of(node, struct extent, by_size) : NULL);
+}
+
+static raleighsl_errno_t __extent_to_blocks (const struct extent_space *space,
+                                             uint64_t offset,
+                                             uint64_t size,
+                                             uint64_t *start,
+                                             uint64_t *count)
+{
+  if (Z_UNLIKELY(size == 0 || offset < space->offset ||
+                 (offset - space->offset) % RALEIGHSL_EXTENT_BLOCK_SIZE))
+  {
+    return(RALEIGHSL_ERRNO_SPACE_OUT_OF_RANGE);
+  }
+
+  *start = (offset - space->offset) / RALEIGHSL_EXTENT_BLOCK_SIZE;
+  *count = __extent_blocks(size);
+  if (Z_UNLIKELY(*start + *count > space->nblocks))
+    return(RALEIGHSL_ERRNO_SPACE_OUT_OF_RANGE);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* ============================================================================
+ *  PRIVATE Extent Space methods
+ */
+static void __extent_space_free (struct extent_space *space) {
+  struct extent *extent;
+
+  z_dlink_del_for_each_entry(&(space->pending), extent, struct extent, release, {
+    __extent_free(extent);
+  });
+  z_dlink_del_for_each_entry(&(space->releasing), extent, struct extent, release, {
+    __extent_free(extent);
+  });
+
+  z_tree_node_clear(&__extent_size_tree_info, space->by_size, NULL);
+  z_memory_free(z_global_memory(), space->bitmap);
+  z_spin_free(&(space->lock));
+  z_memory_struct_free(z_global_memory(), struct extent_space, space);
+}
+
+/*
+ * The allocator range is the device area that follows the journal,
+ * a file device may report a different capacity on each open so the
+ * range is never smaller than the stored one.
+ */
+static struct extent_space *__extent_space_alloc (raleighsl_t *fs, uint64_t nblocks) {
+  const raleighsl_device_plug_t *device = fs->device ? fs->device->plug : NULL;
+  struct extent_space *space;
+  uint64_t capacity = 0;
+
+  space = z_memory_struct_alloc(z_global_memory(), struct extent_space);
+  if (Z_MALLOC_IS_NULL(space))
+    return(NULL);
+
+  if (device != NULL && device->used != NULL && device->free != NULL)
+    capacity = device->used(fs) + device->free(fs);
+
+  z_spin_alloc(&(space->lock));
+  space->offset = RALEIGHSL_EXTENT_OFFSET;
+  space->nblocks = nblocks;
+  if (capacity > space->offset)
+    space->nblocks = z_max(nblocks, (capacity - space->offset) / RALEIGHSL_EXTENT_BLOCK_SIZE);
+  space->nfree = 0;
+  space->by_size = NULL;
+  space->by_offset = NULL;
+  z_dlink_init(&(space->pending));
+  z_dlink_init(&(space->releasing));
+
+  space->bitmap = z_memory_alloc(z_global_memory(), uint8_t,
+                                 z_max(1, z_bitmap_size(space->nblocks)));
+  if (Z_MALLOC_IS_NULL(space->bitmap)) {
+    z_spin_free(&(space->lock));
+    z_memory_struct_free(z_global_memory(), struct extent_space, space);
+    return(NULL);
+  }
+  z_memzero(space->bitmap, z_max(1, z_bitmap_size(space->nblocks)));
+  return(space);
+}
+
+/*
+ * Rebuild the free trees from the runs of free blocks in the bitmap.
+ */
+static raleighsl_errno_t __extent_space_scan (struct extent_space *space) {
+  raleighsl_errno_t errno;
+  size_t start, end;
+
+  end = 0;
+  while (end < space->nblocks &&
+         z_bitmap_find_first(space->bitmap, end, space->nblocks, 0, &start))
+  {
+    if (!z_bitmap_find_first(space->bitmap, start, space->nblocks, 1, &end))
+      end = space->nblocks;
+
+    if ((errno = __extent_insert(space, start, end - start)))
+      return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* ============================================================================
+ *  Extent Space Plugin
+ */
+static raleighsl_errno_t __space_init (raleighsl_t *fs) {
+  struct extent_space *space;
+  raleighsl_errno_t errno;
+
+  if ((space = __extent_space_alloc(fs, 0)) == NULL)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  if (space->nblocks > 0 && (errno = __extent_insert(space, 0, space->nblocks))) {
+    __extent_space_free(space);
+    return(errno);
+  }
+
+  Z_OPAQUE_SET_PTR(&(fs->space.data), space);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * The map is loaded from the checkpoint: [u64 nblocks][bitmap]
+ * if the device has grown the new blocks are free.
+ */
+static raleighsl_errno_t __space_load (raleighsl_t *fs) {
+  struct extent_space *space;
+  raleighsl_errno_t errno;
+  uint64_t nblocks;
+
+  if (raleighsl_checkpoint_space_size(fs) == 0)
+    return(__space_init(fs));
+
+  if ((errno = raleighsl_checkpoint_space_read(fs, &nblocks, sizeof(uint64_t))))
+    return(errno);
+
+  if ((space = __extent_space_alloc(fs, nblocks)) == NULL)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  errno = raleighsl_checkpoint_space_read(fs, space->bitmap, z_bitmap_size(nblocks));
+  if (!errno)
+    errno = __extent_space_scan(space);
+
+  if (Z_UNLIKELY(errno)) {
+    __extent_space_free(space);
+    return(errno);
+  }
+
+  Z_LOG_INFO("extent-space: %"PRIu64" blocks, %"PRIu64" free",
+             space->nblocks, space->nfree);
+  Z_OPAQUE_SET_PTR(&(fs->space.data), space);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __space_unload (raleighsl_t *fs) {
+  struct extent_space *space = __EXTENT_SPACE(fs);
+  if (space != NULL) {
+    __extent_space_free(space);
+    Z_OPAQUE_SET_PTR(&(fs->space.data), NULL);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Called by the checkpoint. The image written has the released extents
+ * marked as free, but they stay out of the free trees until the commit.
+ */
+static raleighsl_errno_t __space_sync (raleighsl_t *fs) {
+  struct extent_space *space = __EXTENT_SPACE(fs);
+  struct extent *extent;
+  raleighsl_errno_t errno;
+  struct iovec iov[2];
+  size_t bitmap_size;
+  uint8_t *bitmap;
+
+  bitmap_size = z_bitmap_size(space->nblocks);
+  bitmap = z_memory_alloc(z_global_memory(), uint8_t, z_max(1, bitmap_size));
+  if (Z_MALLOC_IS_NULL(bitmap))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  z_spin_lock(&(space->lock));
+  z_dlink_del_for_each_entry(&(space->pending), extent, struct extent, release, {
+    z_bitmap_change_bits(space->bitmap, extent->start, extent->count, 0);
+    z_dlink_add_tail(&(space->releasing), &(extent->release));
+  });
+  z_memcpy(bitmap, space->bitmap, bitmap_size);
+  z_spin_unlock(&(space->lock));
+
+  iov[0].iov_base = &(space->nblocks);
+  iov[0].iov_len  = sizeof(uint64_t);
+  iov[1].iov_base = bitmap;
+  iov[1].iov_len  = bitmap_size;
+  errno = raleighsl_checkpoint_write(fs, iov, 2);
+  z_memory_free(z_global_memory(), bitmap);
+  return(errno);
+}
+
+static raleighsl_errno_t __space_commit (raleighsl_t *fs) {
+  struct extent_space *space = __EXTENT_SPACE(fs);
+  raleighsl_errno_t errno = RALEIGHSL_ERRNO_NONE;
+  struct extent *extent;
+
+  z_spin_lock(&(space->lock));
+  z_dlink_del_for_each_entry(&(space->releasing), extent, struct extent, release, {
+    if (!errno)
+      errno = __extent_insert(space, extent->start, extent->count);
+    __extent_free(extent);
+  });
+  z_spin_unlock(&(space->lock));
+  return(errno);
+}
+
+/*
+ * Best-fit allocation, if there is no free extent large enough
+ * the largest one is returned and *count is less than the request.
+ */
+static raleighsl_errno_t __space_allocate (raleighsl_t *fs,
+                                           uint64_t request,
+                                           uint64_t *start,
+                                           uint64_t *count)
+{
+  struct extent_space *space = __EXTENT_SPACE(fs);
+  uint64_t nblocks = __extent_blocks(request);
+  struct extent *extent;
+
+  if (Z_UNLIKELY(nblocks == 0))
+    return(RALEIGHSL_ERRNO_SPACE_OUT_OF_RANGE);
+
+  z_spin_lock(&(space->lock));
+  if ((extent = __extent_best_fit(space, nblocks)) == NULL) {
+    z_spin_unlock(&(space->lock));
+    return(RALEIGHSL_ERRNO_DEVICE_NO_SPACE);
+  }
+
+  __extent_detach(space, extent);
+  nblocks = z_min(nblocks, extent->count);
+  *start = space->offset + extent->start * RALEIGHSL_EXTENT_BLOCK_SIZE;
+  *count = nblocks * RALEIGHSL_EXTENT_BLOCK_SIZE;
+  z_bitmap_change_bits(space->bitmap, extent->start, nblocks, 1);
+
+  if (extent->count > nblocks) {
+    extent->start += nblocks;
+    extent->count -= nblocks;
+    __extent_attach(space, extent);
+  } else {
+    __extent_free(extent);
+  }
+  z_spin_unlock(&(space->lock));
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __space_release (raleighsl_t *fs,
+                                          uint64_t start,
+                                          uint64_t count)
+{
+  struct extent_space *space = __EXTENT_SPACE(fs);
+  struct extent *extent;
+  raleighsl_errno_t errno;
+  uint64_t bstart, bcount;
+
+  if ((errno = __extent_to_blocks(space, start, count, &bstart, &bcount)))
+    return(errno);
+
+  if ((extent = __extent_alloc(bstart, bcount)) == NULL)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  /* Delayed until the next checkpoint is on disk */
+  z_spin_lock(&(space->lock));
+  z_dlink_add_tail(&(space->pending), &(extent->release));
+  z_spin_unlock(&(space->lock));
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/*
+ * Mark the range as free, without waiting for a checkpoint.
+ */
+static raleighsl_errno_t __space_available (raleighsl_t *fs,
+                                            uint64_t start,
+                                            uint64_t count)
+{
+  struct extent_space *space = __EXTENT_SPACE(fs);
+  raleighsl_errno_t errno;
+  uint64_t bstart, bcount;
+
+  if ((errno = __extent_to_blocks(space, start, count, &bstart, &bcount)))
+    return(errno);
+
+  z_spin_lock(&(space->lock));
+  if (!(errno = __extent_remove(space, bstart, bcount)))
+    errno = __extent_insert(space, bstart, bcount);
+  if (!errno)
+    z_bitmap_change_bits(space->bitmap, bstart, bcount, 0);
+  z_spin_unlock(&(space->lock));
+  return(errno);
+}
+
+/*
+ * Mark the range as occupied, used to reserve fixed areas.
+ */
+static raleighsl_errno_t __space_occupied (raleighsl_t *fs,
+                                           uint64_t start,
+                                           uint64_t count)
+{
+  struct extent_space *space = __EXTENT_SPACE(fs);
+  raleighsl_errno_t errno;
+  uint64_t bstart, bcount;
+
+  if ((errno = __extent_to_blocks(space, start, count, &bstart, &bcount)))
+    return(errno);
+
+  z_spin_lock(&(space->lock));
+  if (!(errno = __extent_remove(space, bstart, bcount)))
+    z_bitmap_change_bits(space->bitmap, bstart, bcount, 1);
+  z_spin_unlock(&(space->lock));
+  return(errno);
+}
+
+const raleighsl_space_plug_t raleighsl_space_extent = {
+  .info = {
+    .type = RALEIGHSL_PLUG_TYPE_SPACE,
+    .description = "Extent Space Allocator",
+    .label       = "space-extent",
+  },
+
+  .init       = __space_init,
+  .load       = __space_load,
+  .unload     = __space_unload,
+  .sync       = __space_sync,
+  .commit     = __space_commit,
+
+  .allocate   = __space_allocate,
+  .release    = __space_release,
+  .available  = __space_available,
+  .occupied   = __space_occupied,
+};
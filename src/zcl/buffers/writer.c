@@ -45,6 +45,28 @@ void z_dump_bytes (FILE *stream, const z_bytes_ref_t *value) {
   z_dump_byte_slice(stream, &(value->slice));
 }
 
+void z_dump_chunks (FILE *stream, const z_array_t *value) {
+  size_t i;
+  fprintf(stream, "%zu:", z_chunks_size(value));
+  for (i = 0; i < value->count; ++i) {
+    const z_bytes_ref_t *chunk = z_array_get(value, const z_bytes_ref_t, i);
+    fwrite(chunk->slice.data, chunk->slice.size, 1, stream);
+  }
+}
+
+/*
+ * The chunks are an array of z_bytes_ref_t,
+ * encoded as a single bytes field with the chunks concatenated.
+ */
+size_t z_chunks_size (const z_array_t *value) {
+  size_t size = 0;
+  size_t i;
+  for (i = 0; i < value->count; ++i) {
+    size += z_array_get(value, const z_bytes_ref_t, i)->slice.size;
+  }
+  return(size);
+}
+
 int z_write_field (z_buffer_t *buf, uint16_t field_id, size_t length) {
   if (Z_UNLIKELY(z_buffer_ensure(buf, 12 + length)))
     return(-1);
@@ -84,3 +106,26 @@ int z_write_field_bytes (z_buffer_t *buf, uint16_t field_id, const z_bytes_ref_t
   return(z_write_field_byte_slice(buf, field_id, &(value->slice)));
 }
 
+int z_write_field_chunks (z_buffer_t *buf, uint16_t field_id, const z_array_t *value) {
+  size_t i;
+
+  if (Z_UNLIKELY(z_write_field(buf, field_id, z_chunks_size(value))))
+    return(-1);
+
+  for (i = 0; i < value->count; ++i) {
+    const z_bytes_ref_t *chunk = z_array_get(value, const z_bytes_ref_t, i);
+    if (Z_UNLIKELY(z_buffer_append(buf, chunk->slice.data, chunk->slice.size)))
+      return(-1);
+  }
+  return(0);
+}
+
+/* Only the field head is written, the data is sent apart (e.g. by ref) */
+int z_write_field_head (z_buffer_t *buf, uint16_t field_id, size_t length) {
+  if (Z_UNLIKELY(z_buffer_ensure(buf, 12)))
+    return(-1);
+
+  buf->size += z_encode_field(z_buffer_tail(buf), field_id, length);
+  return(0);
+}
+
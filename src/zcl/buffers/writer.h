@@ -21,6 +21,7 @@ __Z_BEGIN_DECLS__
 #include <zcl/macros.h>
 #include <zcl/extent.h>
 #include <zcl/buffer.h>
+#include <zcl/array.h>
 #include <zcl/bytes.h>
 
 #include <stdio.h>
@@ -46,6 +47,9 @@ void z_dump_uint64      (FILE *stream, uint64_t value);
 void z_dump_byte_slice  (FILE *stream, const z_byte_slice_t *value);
 void z_dump_buffer      (FILE *stream, const z_buffer_t *value);
 void z_dump_bytes       (FILE *stream, const z_bytes_ref_t *value);
+void z_dump_chunks      (FILE *stream, const z_array_t *value);
+
+size_t z_chunks_size    (const z_array_t *value);
 
 int z_write_field            (z_buffer_t *buf, uint16_t field_id, size_t length);
 int z_write_field_int64      (z_buffer_t *buf, uint16_t field_id, int64_t value);
@@ -53,5 +57,7 @@ int z_write_field_uint64     (z_buffer_t *buf, uint16_t field_id, uint64_t value
 int z_write_field_byte_slice (z_buffer_t *buf, uint16_t field_id, const z_byte_slice_t *value);
 int z_write_field_buffer     (z_buffer_t *buf, uint16_t field_id, const z_buffer_t *value);
 int z_write_field_bytes      (z_buffer_t *buf, uint16_t field_id, const z_bytes_ref_t *value);
+int z_write_field_chunks     (z_buffer_t *buf, uint16_t field_id, const z_array_t *value);
+int z_write_field_head       (z_buffer_t *buf, uint16_t field_id, size_t length);
 
 #endif /* !_Z_WRITER_H_ */
@@ -29,6 +29,16 @@ __Z_BEGIN_DECLS__
 #define z_bitmap_change(bmap, bit, v)   z_change_1bit(z_bitmap_byte(bmap, bit), bit, v)
 #define z_bitmap_test(bmap, bit)        z_fetch_1bit(z_bitmap_byte(bmap, bit), bit)
 
+void  z_bitmap_change_bits  (uint8_t *bitmap,
+                             size_t offset,
+                             size_t num_bits,
+                             int value);
+int   z_bitmap_find_first   (const uint8_t *bitmap,
+                             size_t offset,
+                             size_t bitmap_size,
+                             int value,
+                             size_t *idx);
+
 __Z_END_DECLS__
 
 #endif /* _Z_BITMAP_H_ */
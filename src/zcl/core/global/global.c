@@ -20,7 +20,25 @@
 #include <zcl/debug.h>
 #include <zcl/time.h>
 
-#define __NUM_WORK_QUEUES         (1)
+/*
+ * Each cpu owns a task queue and a pending tree (ordered by itime),
+ * an idle cpu steals from the others and after a spin phase is parked
+ * on its own task_ready condition. The producers wake the parked threads
+ * only when there are some waiting. The tasks on the home queue are
+ * bound to the cpu and never stolen, only the home cpu is woken up.
+ */
+#define __CPU_CTX_SPIN_ROUNDS     (64)
+
+struct cpu_tasks {
+  z_spinlock_t   lock;
+  z_task_tree_t  pending;
+  z_task_queue_t queue;
+  z_task_queue_t home;
+
+  /* Protected by the global mutex */
+  z_wait_cond_t  task_ready;
+  int            is_parked;
+};
 
 struct cpu_ctx {
   z_thread_t thread;
@@ -28,16 +46,16 @@ struct cpu_ctx {
 
   z_memory_t memory;
   uint8_t pad[z_align_up(sizeof(z_memory_t), 128) - sizeof(z_memory_t)];
+
+  struct cpu_tasks tasks;
+  uint8_t pad1[z_align_up(sizeof(struct cpu_tasks), 128) - sizeof(struct cpu_tasks)];
 };
 
 struct z_global_context {
   z_mutex_t mutex;
   uint64_t req_id;
-  z_task_tree_t  pending[__NUM_WORK_QUEUES];
-  z_task_queue_t queue[__NUM_WORK_QUEUES];
-
-  z_wait_cond_t task_ready;
-  z_wait_cond_t no_active_threads;
+  unsigned int next_cpu;
+  int spin_rounds;
 
   int is_closed;
   int waiting_threads;
@@ -53,99 +71,183 @@ struct z_global_context {
  *  PRIVATE global-context instance
  */
 static z_global_context_t *__global_ctx = NULL;
+static __thread struct cpu_ctx *__local_worker_ctx = NULL;
+static __thread struct cpu_ctx *__local_cpu_ctx = NULL;
 
 /* ============================================================================
  *  PRIVATE cpu-context methods
  */
-static z_task_t *__cpu_ctx_fetch_task (struct cpu_ctx *cpu_ctx) {
+static int __cpu_tasks_open (struct cpu_tasks *self) {
+  if (z_wait_cond_alloc(&(self->task_ready)))
+    return(1);
+  self->is_parked = 0;
+  z_spin_alloc(&(self->lock));
+  z_task_tree_open(&(self->pending));
+  z_task_queue_open(&(self->queue));
+  z_task_queue_open(&(self->home));
+  return(0);
+}
+
+static void __cpu_tasks_close (struct cpu_tasks *self) {
+  z_task_tree_close(&(self->pending));
+  z_task_queue_close(&(self->queue));
+  z_task_queue_close(&(self->home));
+  z_spin_free(&(self->lock));
+  z_wait_cond_free(&(self->task_ready));
+}
+
+static z_task_t *__cpu_tasks_pop (struct cpu_tasks *self, int is_owner) {
   z_task_t *task;
-#if __NUM_WORK_QUEUES > 1
-  int count;
 
-  count = __NUM_WORK_QUEUES;
-  while (count--) {
-    if ((task = z_task_tree_pop(&(__global_ctx->pending[count]))) != NULL)
-      return(task);
+  if (self->pending.root == NULL && self->queue.head == NULL &&
+      (!is_owner || self->home.head == NULL))
+  {
+    return(NULL);
   }
 
-  count = __NUM_WORK_QUEUES;
-  while (count--) {
-    if ((task = z_task_queue_pop(&(__global_ctx->queue[count]))) != NULL)
-      return(task);
+  z_spin_lock(&(self->lock));
+  if ((task = z_task_tree_pop(&(self->pending))) == NULL) {
+    if (!is_owner || (task = z_task_queue_pop(&(self->home))) == NULL)
+      task = z_task_queue_pop(&(self->queue));
   }
-#else
-  if ((task = z_task_tree_pop(&(__global_ctx->pending[0]))) != NULL)
-    return(task);
+  z_spin_unlock(&(self->lock));
+  return(task);
+}
 
-  if ((task = z_task_queue_pop(&(__global_ctx->queue[0]))) != NULL)
+static z_task_t *__cpu_ctx_fetch_task (struct cpu_ctx *cpu_ctx) {
+  const int ncpus = __global_ctx->ncpus;
+  const int cpu_id = cpu_ctx - __global_ctx->cpus;
+  z_task_t *task;
+  int i;
+
+  if ((task = __cpu_tasks_pop(&(cpu_ctx->tasks), 1)) != NULL)
     return(task);
-#endif
+
+  /* Steal from the other cpus */
+  for (i = 1; i < ncpus; ++i) {
+    struct cpu_ctx *victim = &(__global_ctx->cpus[(cpu_id + i) % ncpus]);
+    if ((task = __cpu_tasks_pop(&(victim->tasks), 0)) != NULL)
+      return(task);
+  }
   return(NULL);
 }
 
 static z_task_t *__cpu_ctx_wait_task (struct cpu_ctx *cpu_ctx) {
   z_task_t *task;
+  int rounds;
 
-  z_mutex_lock(&(__global_ctx->mutex));
+  for (rounds = 0; rounds < __global_ctx->spin_rounds; ++rounds) {
+    if (Z_UNLIKELY(__global_ctx->is_closed))
+      return(NULL);
 
-  if (Z_UNLIKELY(__global_ctx->is_closed)) {
-    z_mutex_unlock(&(__global_ctx->mutex));
-    return(0);
-  }
+    if ((task = __cpu_ctx_fetch_task(cpu_ctx)) != NULL)
+      return(task);
 
-  if ((task = __cpu_ctx_fetch_task(cpu_ctx)) == NULL) {
-    if (++__global_ctx->waiting_threads == __global_ctx->ncpus) {
-      z_wait_cond_broadcast(&(__global_ctx->no_active_threads));
-    }
-    z_wait_cond_wait(&(__global_ctx->task_ready), &(__global_ctx->mutex), 0);
-    task = __cpu_ctx_fetch_task(cpu_ctx);
+    z_thread_yield();
   }
 
+  /* The producers look at waiting_threads after the push */
+  z_mutex_lock(&(__global_ctx->mutex));
+  z_atomic_inc(&(__global_ctx->waiting_threads));
+  while (!__global_ctx->is_closed && (task = __cpu_ctx_fetch_task(cpu_ctx)) == NULL) {
+    /* Cleared by the waker, a second push picks another parked cpu */
+    cpu_ctx->tasks.is_parked = 1;
+    z_wait_cond_wait(&(cpu_ctx->tasks.task_ready), &(__global_ctx->mutex), 0);
+  }
+  cpu_ctx->tasks.is_parked = 0;
+  z_atomic_dec(&(__global_ctx->waiting_threads));
   z_mutex_unlock(&(__global_ctx->mutex));
   return(task);
 }
 
 static void *__cpu_ctx_loop (void *cpu_ctx) {
+  __local_worker_ctx = (struct cpu_ctx *)cpu_ctx;
+  __local_cpu_ctx = (struct cpu_ctx *)cpu_ctx;
+
   while (!__global_ctx->is_closed) {
     z_task_t *task = __cpu_ctx_wait_task((struct cpu_ctx *)cpu_ctx);
     if (Z_LIKELY(task != NULL)) {
       z_task_exec(task);
     }
   }
-
-  z_mutex_lock(&(__global_ctx->mutex));
-  if (++__global_ctx->waiting_threads == __global_ctx->ncpus) {
-    z_wait_cond_broadcast(&(__global_ctx->no_active_threads));
-  }
-  z_mutex_unlock(&(__global_ctx->mutex));
   return(NULL);
 }
 
 static int __cpu_ctx_open (struct cpu_ctx *cpu_ctx, int cpu_id) {
+  /* Initialize Memory */
+  z_memory_open(&(cpu_ctx->memory), __global_ctx->allocator);
+
   /* Create the cpu context thread */
   if (z_thread_start(&(cpu_ctx->thread), __cpu_ctx_loop, cpu_ctx)) {
     Z_LOG_FATAL("unable to initialize the thread for cpu %d.", cpu_id);
+    z_memory_close(&(cpu_ctx->memory));
     return(1);
   }
 
   /* Bind the cpu context to the specified core */
   z_thread_bind_to_core(&(cpu_ctx->thread), cpu_id);
-
-  /* Initialize Memory */
-  z_memory_open(&(cpu_ctx->memory), __global_ctx->allocator);
-
   return(0);
 }
 
 static void __cpu_ctx_close (struct cpu_ctx *cpu_ctx) {
   z_thread_join(&(cpu_ctx->thread));
-  z_memory_close(&(cpu_ctx->memory));
+}
+
+/*
+ * The workers push on their own queue, the other threads (e.g. the I/O
+ * poll) spread the tasks over the cpus.
+ */
+static struct cpu_ctx *__cpu_ctx_for_push (void) {
+  unsigned int cpu_id;
+  if (Z_LIKELY(__local_worker_ctx != NULL))
+    return(__local_worker_ctx);
+  cpu_id = z_atomic_fetch_and_add(&(__global_ctx->next_cpu), 1);
+  return(&(__global_ctx->cpus[cpu_id % __global_ctx->ncpus]));
+}
+
+static int __cpu_ctx_wake (struct cpu_ctx *cpu_ctx) {
+  if (!cpu_ctx->tasks.is_parked)
+    return(0);
+  cpu_ctx->tasks.is_parked = 0;
+  z_wait_cond_signal(&(cpu_ctx->tasks.task_ready));
+  return(1);
+}
+
+static void __global_wake_threads (int ntasks) {
+  /* Pairs with the waiting_threads increment in __cpu_ctx_wait_task() */
+  z_atomic_synchronize();
+  if (z_atomic_load(&(__global_ctx->waiting_threads)) > 0) {
+    const int ncpus = __global_ctx->ncpus;
+    int i;
+    z_mutex_lock(&(__global_ctx->mutex));
+    for (i = 0; ntasks > 0 && i < ncpus; ++i) {
+      ntasks -= __cpu_ctx_wake(&(__global_ctx->cpus[i]));
+    }
+    z_mutex_unlock(&(__global_ctx->mutex));
+  }
+}
+
+static void __global_wake_cpu (struct cpu_ctx *cpu_ctx) {
+  /* Pairs with the waiting_threads increment in __cpu_ctx_wait_task() */
+  z_atomic_synchronize();
+  if (z_atomic_load(&(__global_ctx->waiting_threads)) > 0) {
+    z_lock(&(__global_ctx->mutex), z_mutex, {
+      __cpu_ctx_wake(cpu_ctx);
+    });
+  }
+}
+
+/* Called with the global mutex held */
+static void __global_wake_all (void) {
+  int i;
+  for (i = 0; i < __global_ctx->ncpus; ++i) {
+    z_wait_cond_broadcast(&(__global_ctx->cpus[i].tasks.task_ready));
+  }
 }
 
 /* ============================================================================
  *  PRIVATE cpu-context thread-local lookups
  */
-static __thread struct cpu_ctx *__local_cpu_ctx = NULL;
 static struct cpu_ctx *__set_local_cpu_ctx (void) {
   struct cpu_ctx *cpu_ctx = __global_ctx->cpus;
   int ncpus = __global_ctx->ncpus;
@@ -164,9 +266,6 @@ static struct cpu_ctx *__set_local_cpu_ctx (void) {
 #define __current_cpu_ctx()                                                    \
   (Z_LIKELY(__local_cpu_ctx != NULL) ? __local_cpu_ctx : __set_local_cpu_ctx())
 
-#define __current_cpu_ctx_id()    (__current_cpu_ctx() - __global_ctx->cpus)
-#define __current_queue_slot()    (__current_cpu_ctx_id() & (__NUM_WORK_QUEUES - 1))
-
 /* ============================================================================
  *  PUBLIC global-context methods
  */
@@ -200,10 +299,9 @@ int z_global_context_open (z_allocator_t *allocator, void *user_data) {
   __global_ctx->ncpus = ncpus;
 
   __global_ctx->req_id = 0;
-  for (i = 0; i < __NUM_WORK_QUEUES; ++i) {
-    z_task_tree_open(&__global_ctx->pending[i]);
-    z_task_queue_open(&__global_ctx->queue[i]);
-  }
+  __global_ctx->next_cpu = 0;
+  /* Spinning on a single core steals time from the producers */
+  __global_ctx->spin_rounds = (z_system_processors() > 1) ? __CPU_CTX_SPIN_ROUNDS : 0;
 
   if (z_mutex_alloc(&(__global_ctx->mutex))) {
     Z_LOG_FATAL("unable to initialize the global context mutex.");
@@ -212,33 +310,36 @@ int z_global_context_open (z_allocator_t *allocator, void *user_data) {
     return(2);
   }
 
-  /* Initialize the global task queue */
-  if (z_wait_cond_alloc(&(__global_ctx->task_ready))) {
-    Z_LOG_FATAL("unable to initialize the global context wait condition 0.");
-    z_mutex_free(&(__global_ctx->mutex));
-    z_allocator_free(allocator, __global_ctx);
-    __global_ctx = NULL;
-    return(3);
-  }
-
-  if (z_wait_cond_alloc(&(__global_ctx->no_active_threads))) {
-    Z_LOG_FATAL("unable to initialize the global context wait condition 1.");
-    z_wait_cond_free(&(__global_ctx->task_ready));
-    z_mutex_free(&(__global_ctx->mutex));
-    z_allocator_free(allocator, __global_ctx);
-    __global_ctx = NULL;
-    return(4);
+  /* The workers steal from every cpu, initialize all the queues first */
+  for (i = 0; i < ncpus; ++i) {
+    if (__cpu_tasks_open(&(__global_ctx->cpus[i].tasks))) {
+      Z_LOG_FATAL("unable to initialize the cpu %d wait condition.", i);
+      while (i--)
+        __cpu_tasks_close(&(__global_ctx->cpus[i].tasks));
+      z_mutex_free(&(__global_ctx->mutex));
+      z_allocator_free(allocator, __global_ctx);
+      __global_ctx = NULL;
+      return(3);
+    }
   }
 
   /* Initialize cpu context */
   cpu_ctx = __global_ctx->cpus;
   while (ncpus--) {
     if (__cpu_ctx_open(cpu_ctx++, ncpus)) {
-      while (++ncpus < __global_ctx->ncpus)
+      z_lock(&(__global_ctx->mutex), z_mutex, {
+        __global_ctx->is_closed = 1;
+        __global_wake_all();
+      });
+
+      --cpu_ctx;
+      for (i = ncpus + 1; i < __global_ctx->ncpus; ++i)
         __cpu_ctx_close(--cpu_ctx);
+      for (i = ncpus + 1; i < __global_ctx->ncpus; ++i)
+        z_memory_close(&((cpu_ctx++)->memory));
 
-      z_wait_cond_free(&(__global_ctx->no_active_threads));
-      z_wait_cond_free(&(__global_ctx->task_ready));
+      for (i = 0; i < __global_ctx->ncpus; ++i)
+        __cpu_tasks_close(&(__global_ctx->cpus[i].tasks));
       z_mutex_free(&(__global_ctx->mutex));
       z_allocator_free(allocator, __global_ctx);
       __global_ctx = NULL;
@@ -252,26 +353,25 @@ int z_global_context_open (z_allocator_t *allocator, void *user_data) {
 void z_global_context_close (void) {
   int i;
 
-  z_mutex_lock(&(__global_ctx->mutex));
-  __global_ctx->is_closed = 1;
+  z_lock(&(__global_ctx->mutex), z_mutex, {
+    __global_ctx->is_closed = 1;
+    __global_wake_all();
+  });
 
-  /* clear queue */
-  z_wait_cond_broadcast(&(__global_ctx->task_ready));
-  if (__global_ctx->waiting_threads < __global_ctx->ncpus) {
-    z_wait_cond_wait(&(__global_ctx->no_active_threads), &(__global_ctx->mutex), 0);
+  for (i = 0; i < __global_ctx->ncpus; ++i) {
+    __cpu_ctx_close(&(__global_ctx->cpus[i]));
   }
 
-  z_mutex_unlock(&(__global_ctx->mutex));
-
-  while (__global_ctx->ncpus--) {
-    __cpu_ctx_close(&(__global_ctx->cpus[__global_ctx->ncpus]));
+  /* The slab items move across cpus, stop every thread before the close */
+  for (i = 0; i < __global_ctx->ncpus; ++i) {
+    z_memory_close(&(__global_ctx->cpus[i].memory));
   }
 
-  for (i = 0; i < __NUM_WORK_QUEUES; ++i) {
-    z_task_tree_close(&__global_ctx->pending[i]);
-    z_task_queue_close(&__global_ctx->queue[i]);
+  for (i = 0; i < __global_ctx->ncpus; ++i) {
+    __cpu_tasks_close(&(__global_ctx->cpus[i].tasks));
   }
 
+  z_mutex_free(&(__global_ctx->mutex));
   z_allocator_free(__global_ctx->allocator, __global_ctx);
   __global_ctx = NULL;
 
@@ -289,18 +389,41 @@ void *z_global_context_user_data (void) {
   return(__global_ctx->user_data);
 }
 
+int z_global_context_ncpus (void) {
+  return(__global_ctx->ncpus);
+}
+
 z_memory_t *z_global_memory (void) {
   return(&(__current_cpu_ctx()->memory));
 }
 
 void z_global_add_task (z_task_t *task) {
   if (task != NULL) {
-    const int slot = __current_queue_slot();
-    z_mutex_lock(&(__global_ctx->mutex));
-    task->itime = __global_ctx->req_id++;
-    z_task_queue_push(&(__global_ctx->queue[slot]), task);
-    z_wait_cond_signal(&(__global_ctx->task_ready));
-    z_mutex_unlock(&(__global_ctx->mutex));
+    struct cpu_ctx *cpu_ctx = __cpu_ctx_for_push();
+    task->itime = z_atomic_fetch_and_add(&(__global_ctx->req_id), 1);
+    z_lock(&(cpu_ctx->tasks.lock), z_spin, {
+      z_task_queue_push(&(cpu_ctx->tasks.queue), task);
+    });
+    __global_wake_threads(1);
+  }
+}
+
+int z_global_cpu_id (void) {
+  if (__local_worker_ctx == NULL)
+    return(-1);
+  return(__local_worker_ctx - __global_ctx->cpus);
+}
+
+void z_global_add_cpu_task (int cpu_id, z_task_t *task) {
+  if (task != NULL) {
+    struct cpu_ctx *cpu_ctx = &(__global_ctx->cpus[cpu_id % __global_ctx->ncpus]);
+    task->itime = z_atomic_fetch_and_add(&(__global_ctx->req_id), 1);
+    z_lock(&(cpu_ctx->tasks.lock), z_spin, {
+      z_task_queue_push(&(cpu_ctx->tasks.home), task);
+    });
+    /* Only the home cpu can run it, the other parked threads stay asleep */
+    if (cpu_ctx != __local_worker_ctx)
+      __global_wake_cpu(cpu_ctx);
   }
 }
 
@@ -309,7 +432,7 @@ void z_global_add_pending_tasks (z_task_t *tasks) {
 }
 
 void z_global_add_pending_ntasks (int count, ...) {
-  const int slot = __current_queue_slot();
+  struct cpu_ctx *cpu_ctx;
   int ntasks = 0;
   va_list ap;
 
@@ -324,18 +447,15 @@ void z_global_add_pending_ntasks (int count, ...) {
   } while (0);
 
   if (ntasks > 0) {
+    cpu_ctx = __cpu_ctx_for_push();
     va_start(ap, count);
-    z_mutex_lock(&(__global_ctx->mutex));
+    z_spin_lock(&(cpu_ctx->tasks.lock));
     while (count--) {
       z_task_t *tasks = va_arg(ap, z_task_t *);
-      z_task_tree_push(&(__global_ctx->pending[slot]), tasks);
-    }
-    if (ntasks > 1) {
-      z_wait_cond_broadcast(&(__global_ctx->task_ready));
-    } else {
-      z_wait_cond_signal(&(__global_ctx->task_ready));
+      z_task_tree_push(&(cpu_ctx->tasks.pending), tasks);
     }
-    z_mutex_unlock(&(__global_ctx->mutex));
+    z_spin_unlock(&(cpu_ctx->tasks.lock));
     va_end(ap);
+    __global_wake_threads(ntasks);
   }
 }
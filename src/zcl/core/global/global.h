@@ -29,10 +29,14 @@ int   z_global_context_open      (z_allocator_t *allocator, void *user_data);
 void  z_global_context_close     (void);
 void  z_global_context_stop      (void);
 void *z_global_context_user_data (void);
+int   z_global_context_ncpus     (void);
 
 z_memory_t *  z_global_memory     (void);
 
+int  z_global_cpu_id (void);
+
 void z_global_add_task (z_task_t *task);
+void z_global_add_cpu_task (int cpu_id, z_task_t *task);
 void z_global_add_pending_tasks (z_task_t *tasks);
 void z_global_add_pending_ntasks (int count, ...);
 
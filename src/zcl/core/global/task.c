@@ -43,7 +43,7 @@ static const z_tree_info_t __task_tree_info = {
 z_task_t *z_task_alloc (z_task_func_t func) {
   z_task_t *task;
 
-  task = z_memory_struct_alloc(z_global_memory(), z_task_t);
+  task = (z_task_t *)z_memory_pool_alloc(z_global_memory(), Z_MEMORY_POOL_TASK);
   if (Z_MALLOC_IS_NULL(task))
     return(NULL);
 
@@ -53,7 +53,7 @@ z_task_t *z_task_alloc (z_task_func_t func) {
 }
 
 void z_task_free (z_task_t *task) {
-  z_memory_struct_free(z_global_memory(), z_task_t, task);
+  z_memory_pool_free(z_global_memory(), Z_MEMORY_POOL_TASK, task);
 }
 
 /* ===========================================================================
@@ -108,6 +108,22 @@ z_task_t *z_task_queue_drain (z_task_queue_t *self) {
   return(task);
 }
 
+void z_task_queue_concat (z_task_queue_t *self, z_task_queue_t *other) {
+  if (other->head != NULL) {
+    if (self->head != NULL) {
+      z_tree_node_t *head = &(self->head->__node__);
+      z_tree_node_t *other_head = &(other->head->__node__);
+
+      head->child[1]->child[0] = other_head;
+      head->child[1] = other_head->child[1];
+      other_head->child[1] = NULL;
+    } else {
+      self->head = other->head;
+    }
+    other->head = NULL;
+  }
+}
+
 /* ===========================================================================
  *  PUBLIC Task Tree
  */
@@ -192,14 +208,20 @@ int z_task_rwcsem_acquire (z_task_rwcsem_t *self,
                            z_rwcsem_op_t operation_type,
                            z_task_t *task)
 {
-  if (!z_rwcsem_try_acquire(&(self->lock), operation_type)) {
-    /* Add the task to the waiting queue */
-    z_lock(&(self->wlock), z_spin, {
-      __task_rwcsem_add(self, operation_type, task);
-    });
-    return(1);
-  }
-  return(0);
+  int is_waiting;
+
+  if (z_rwcsem_try_acquire(&(self->lock), operation_type))
+    return(0);
+
+  /*
+   * The release looks at the waiting queues under wlock, try again with
+   * wlock held: a release between the two tries can't miss the task.
+   */
+  z_spin_lock(&(self->wlock));
+  if ((is_waiting = !z_rwcsem_try_acquire(&(self->lock), operation_type)))
+    __task_rwcsem_add(self, operation_type, task);
+  z_spin_unlock(&(self->wlock));
+  return(is_waiting);
 }
 
 void z_task_rwcsem_release (z_task_rwcsem_t *self,
@@ -74,6 +74,8 @@ void      z_task_queue_open     (z_task_queue_t *self);
 void      z_task_queue_close    (z_task_queue_t *self);
 void      z_task_queue_push     (z_task_queue_t *self, z_task_t *task);
 z_task_t *z_task_queue_pop      (z_task_queue_t *self);
+z_task_t *z_task_queue_drain    (z_task_queue_t *self);
+void      z_task_queue_concat   (z_task_queue_t *self, z_task_queue_t *other);
 
 void      z_task_tree_open      (z_task_tree_t *self);
 void      z_task_tree_close     (z_task_tree_t *self);
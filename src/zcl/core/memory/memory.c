@@ -13,6 +13,7 @@
  */
 
 #include <zcl/memory.h>
+#include <zcl/task.h>
 #include <zcl/string.h>
 #include <zcl/debug.h>
 
@@ -27,6 +28,15 @@ static const uint64_t __STATS_HISTO_BOUNDS[] = {
 
 #define __STATS_HISTO_NBOUNDS  (sizeof(__STATS_HISTO_BOUNDS) / sizeof(uint64_t))
 
+/*
+ * The rpc ctxs are sized by the protocols, the pool is empty
+ * until the max ctx size is reserved before the global context open.
+ */
+static size_t __POOL_ISIZE[Z_MEMORY_POOLS] = {
+  sizeof(z_task_t),
+  1 << Z_MEMORY_SLAB_ALIGN_SHIFT,
+};
+
 /* ===========================================================================
  *  PUBLIC Memory methods
  */
@@ -38,9 +48,16 @@ z_memory_t *z_memory_open (z_memory_t *memory, z_allocator_t *allocator) {
   /* Initialize stats */
   z_histogram_open(&(memory->histo), __STATS_HISTO_BOUNDS, memory->histo_events, __STATS_HISTO_NBOUNDS);
 
-  /* Initialize Memory Pool */
-  for (i = 0; i < Z_MEMORY_POOL_SIZE; ++i) {
-    z_mempool_open(&(memory->pools[i]), allocator, (i + 1) << Z_MEMORY_POOL_ALIGN_SHIFT);
+  /* Initialize Memory Slabs */
+  for (i = 0; i < Z_MEMORY_SLAB_SIZE; ++i) {
+    z_slab_cache_open(&(memory->slabs[i]), (i + 1) << Z_MEMORY_SLAB_ALIGN_SHIFT);
+    z_slab_magazine_open(&(memory->magazines[i]));
+  }
+
+  /* Initialize Memory Pools */
+  for (i = 0; i < Z_MEMORY_POOLS; ++i) {
+    z_slab_cache_open(&(memory->pools[i]), __POOL_ISIZE[i]);
+    z_slab_magazine_open(&(memory->pool_magazines[i]));
   }
 
   return(memory);
@@ -49,9 +66,18 @@ z_memory_t *z_memory_open (z_memory_t *memory, z_allocator_t *allocator) {
 void z_memory_close (z_memory_t *memory) {
   int i;
 
-  /* Uninitialize Memory Pool */
-  for (i = 0; i < Z_MEMORY_POOL_SIZE; ++i) {
-    z_mempool_close(&(memory->pools[i]), memory->allocator);
+  /*
+   * Uninitialize Memory Slabs, the magazines may hold items of other
+   * memories: every thread using them must be stopped before the close.
+   */
+  for (i = 0; i < Z_MEMORY_SLAB_SIZE; ++i) {
+    z_slab_magazine_close(&(memory->magazines[i]));
+    z_slab_cache_close(&(memory->slabs[i]));
+  }
+
+  for (i = 0; i < Z_MEMORY_POOLS; ++i) {
+    z_slab_magazine_close(&(memory->pool_magazines[i]));
+    z_slab_cache_close(&(memory->pools[i]));
   }
 
   z_memory_stats_dump(memory, stderr);
@@ -77,10 +103,11 @@ void *z_memory_raw_realloc (z_memory_t *memory, void *ptr, size_t size) {
  *  PRIVATE Memory methods
  */
 void *__z_memory_struct_alloc (z_memory_t *memory, size_t size) {
-  size_t index = z_memory_pool_index(size);
-  if (Z_LIKELY(index < Z_MEMORY_POOL_SIZE)) {
+  size_t index = z_memory_slab_index(size);
+  if (Z_LIKELY(index < Z_MEMORY_SLAB_SIZE)) {
     void *ptr;
-    if ((ptr = z_mempool_alloc(&(memory->pools[index]))) != NULL) {
+    ptr = z_slab_alloc(&(memory->magazines[index]), &(memory->slabs[index]));
+    if (Z_LIKELY(ptr != NULL)) {
       z_histogram_add(&(memory->histo), size);
       return(ptr);
     }
@@ -89,10 +116,43 @@ void *__z_memory_struct_alloc (z_memory_t *memory, size_t size) {
 }
 
 void __z_memory_struct_free (z_memory_t *memory, size_t size, void *ptr) {
-  size_t index = z_memory_pool_index(size);
-  if (Z_LIKELY(index < Z_MEMORY_POOL_SIZE)) {
-    if (!z_mempool_free(&(memory->pools[index]), ptr))
+  size_t index = z_memory_slab_index(size);
+  if (Z_LIKELY(index < Z_MEMORY_SLAB_SIZE)) {
+    /* Not a slab item when the slab mapping failed on alloc */
+    z_slab_cache_t *owner = z_slab_owner(ptr);
+    if (Z_LIKELY(owner != NULL)) {
+      Z_ASSERT(owner->isize == memory->slabs[index].isize,
+               "%p freed as %zu bytes, allocated as %u", ptr, size, owner->isize);
+      z_slab_free(&(memory->magazines[index]), ptr);
       return;
+    }
+  }
+  z_memory_free(memory, ptr);
+}
+
+void z_memory_pool_reserve (int pool, size_t isize) {
+  Z_ASSERT(isize <= Z_MEMORY_SLAB_MAX_ISIZE, "pool %d item of %zu bytes", pool, isize);
+  __POOL_ISIZE[pool] = z_max(__POOL_ISIZE[pool], isize);
+}
+
+void *z_memory_pool_alloc (z_memory_t *memory, int pool) {
+  size_t isize = z_memory_pool_isize(memory, pool);
+  void *ptr;
+  z_histogram_add(&(memory->histo), isize);
+  ptr = z_slab_alloc(&(memory->pool_magazines[pool]), &(memory->pools[pool]));
+  if (Z_LIKELY(ptr != NULL))
+    return(ptr);
+  return(z_allocator_raw_alloc(memory->allocator, isize));
+}
+
+void z_memory_pool_free (z_memory_t *memory, int pool, void *ptr) {
+  /* Not a slab item when the slab mapping failed on alloc */
+  z_slab_cache_t *owner = z_slab_owner(ptr);
+  if (Z_LIKELY(owner != NULL)) {
+    Z_ASSERT(owner->isize == z_memory_pool_isize(memory, pool),
+             "%p freed to pool %d, allocated as %u bytes", ptr, pool, owner->isize);
+    z_slab_free(&(memory->pool_magazines[pool]), ptr);
+    return;
   }
   z_memory_free(memory, ptr);
 }
@@ -19,9 +19,9 @@
 __Z_BEGIN_DECLS__
 
 #include <zcl/macros.h>
-#include <zcl/mempool.h>
 #include <zcl/allocator.h>
 #include <zcl/histogram.h>
+#include <zcl/slab.h>
 
 #define Z_MEMORY_ALLOCATOR(x)         (Z_MEMORY(x)->allocator)
 #define Z_MEMORY_DATA(x)              (Z_MEMORY(x)->data)
@@ -31,18 +31,33 @@ __Z_BEGIN_DECLS__
 
 Z_TYPEDEF_STRUCT(z_memory)
 
-/* 16, 32, 48, 64, 80, 96 */
-/* 16, 24, 32, 40, 48, 56, 64, 72 */
-#define Z_MEMORY_POOL_ALIGN_SHIFT      (4)
-#define Z_MEMORY_POOL_MAX_ISIZE        (112)
-#define Z_MEMORY_POOL_SIZE             (Z_MEMORY_POOL_MAX_ISIZE >> Z_MEMORY_POOL_ALIGN_SHIFT)
+/* The structs up to 512 bytes are served by the slabs, in 16 bytes steps */
+#define Z_MEMORY_SLAB_ALIGN_SHIFT      (4)
+#define Z_MEMORY_SLAB_MAX_ISIZE        (512)
+#define Z_MEMORY_SLAB_SIZE             (Z_MEMORY_SLAB_MAX_ISIZE >> Z_MEMORY_SLAB_ALIGN_SHIFT)
 
-#define z_memory_pool_align(x)         z_align_up(x, 1 << Z_MEMORY_POOL_ALIGN_SHIFT)
-#define z_memory_pool_index(x)         ((z_memory_pool_align(x) >> Z_MEMORY_POOL_ALIGN_SHIFT) - 1)
+#define z_memory_slab_align(x)         z_align_up(x, 1 << Z_MEMORY_SLAB_ALIGN_SHIFT)
+#define z_memory_slab_index(x)         ((z_memory_slab_align(x) >> Z_MEMORY_SLAB_ALIGN_SHIFT) - 1)
+
+/*
+ * Dedicated pools of the objects allocated and freed on every request,
+ * their slabs are not shared with the other structs of the size class.
+ * An item freed on another cpu goes to the magazine of that cpu and is
+ * returned to the owner slab in batches, with the magazine flush.
+ */
+#define Z_MEMORY_POOL_TASK             (0)
+#define Z_MEMORY_POOL_RPC_CTX          (1)
+#define Z_MEMORY_POOLS                 (2)
+
+/* The pool item size, see z_memory_pool_reserve() */
+#define z_memory_pool_isize(memory, pool)   ((memory)->pools[pool].isize)
 
 struct z_memory {
   z_allocator_t *allocator;
-  z_mempool_t pools[Z_MEMORY_POOL_SIZE];
+  z_slab_cache_t slabs[Z_MEMORY_SLAB_SIZE];
+  z_slab_magazine_t magazines[Z_MEMORY_SLAB_SIZE];
+  z_slab_cache_t pools[Z_MEMORY_POOLS];
+  z_slab_magazine_t pool_magazines[Z_MEMORY_POOLS];
   z_histogram_t histo;
   uint64_t histo_events[28];
 };
@@ -76,6 +91,11 @@ void *z_memory_raw_realloc (z_memory_t *memory, void *ptr, size_t size);
 #define z_memory_struct_free(memory, type, ptr)                               \
   __z_memory_struct_free(memory, sizeof(type), ptr)
 
+/* pool alloc/free */
+void  z_memory_pool_reserve (int pool, size_t isize);
+void *z_memory_pool_alloc (z_memory_t *memory, int pool);
+void  z_memory_pool_free  (z_memory_t *memory, int pool, void *ptr);
+
 /* array alloc/realloc/free */
 #define z_memory_array_alloc(memory, type, n)                                 \
   ((type *)z_memory_raw_alloc(memory, (n) * sizeof(type)))
@@ -0,0 +1,339 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <sys/mman.h>
+#include <string.h>
+
+#include <zcl/atomic.h>
+#include <zcl/slab.h>
+#include <zcl/debug.h>
+
+#define __SLAB_MAGIC              (0x534c4142)
+#define __SLAB_DEBUG              (__Z_DEBUG__)
+#define __SLAB_HEAD_SIZE          z_align_up(sizeof(z_slab_t), 16)
+
+/* Z_ASSERT() needs THZ_FORCE_DEBUG, the slab checks only __Z_DEBUG__ */
+#define __slab_assert(cond, format, ...)                                    \
+  if (Z_UNLIKELY(!(cond)))                                                  \
+    __z_assert(__FILE__, __LINE__, __FUNCTION__,                            \
+               cond, #cond, format, ##__VA_ARGS__)
+
+#define __slab_from_item(ptr)                                               \
+  ((z_slab_t *)(((uintptr_t)(ptr)) & ~((uintptr_t)Z_SLAB_SIZE - 1)))
+
+/*
+ * Two level bitmap of the mapped slabs over a 48 bit address space.
+ * The owner of a pointer is looked up here, the memory at the masked
+ * address of a pointer that is not a slab item may not be mapped.
+ * The leaves are installed on the first slab and never released.
+ */
+#define __SLAB_MAP_SHIFT          (16)
+#define __SLAB_MAP_LEAF_BITS      (16)
+#define __SLAB_MAP_ROOT_BITS      (48 - __SLAB_MAP_SHIFT - __SLAB_MAP_LEAF_BITS)
+#define __SLAB_MAP_LEAF_WORDS     ((1 << __SLAB_MAP_LEAF_BITS) / 64)
+
+static uint64_t *__slab_map_root[1 << __SLAB_MAP_ROOT_BITS];
+
+/* ===========================================================================
+ *  PRIVATE Slab map helpers
+ */
+static uint64_t *__slab_map_leaf (uintptr_t index, int create) {
+  uint64_t *leaf;
+
+  if (Z_UNLIKELY((index >> (__SLAB_MAP_ROOT_BITS + __SLAB_MAP_LEAF_BITS)) != 0))
+    return(NULL);
+
+  leaf = z_atomic_load_acquire(&(__slab_map_root[index >> __SLAB_MAP_LEAF_BITS]));
+  if (leaf != NULL || !create)
+    return(leaf);
+
+  leaf = (uint64_t *)mmap(NULL, __SLAB_MAP_LEAF_WORDS * sizeof(uint64_t),
+                          PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (Z_UNLIKELY(leaf == MAP_FAILED))
+    return(NULL);
+
+  /* Another cpu may have installed the leaf in the meantime */
+  if (!z_atomic_cas(&(__slab_map_root[index >> __SLAB_MAP_LEAF_BITS]), NULL, leaf)) {
+    munmap(leaf, __SLAB_MAP_LEAF_WORDS * sizeof(uint64_t));
+    leaf = z_atomic_load_acquire(&(__slab_map_root[index >> __SLAB_MAP_LEAF_BITS]));
+  }
+  return(leaf);
+}
+
+static int __slab_map_add (z_slab_t *slab) {
+  uintptr_t index = ((uintptr_t)slab) >> __SLAB_MAP_SHIFT;
+  uint64_t *leaf;
+  if ((leaf = __slab_map_leaf(index, 1)) == NULL)
+    return(1);
+  index &= (1 << __SLAB_MAP_LEAF_BITS) - 1;
+  z_atomic_fetch_and_or(&(leaf[index >> 6]), (1ull << (index & 63)));
+  return(0);
+}
+
+static void __slab_map_remove (z_slab_t *slab) {
+  uintptr_t index = ((uintptr_t)slab) >> __SLAB_MAP_SHIFT;
+  uint64_t *leaf = __slab_map_leaf(index, 0);
+  index &= (1 << __SLAB_MAP_LEAF_BITS) - 1;
+  z_atomic_fetch_and_and(&(leaf[index >> 6]), ~(1ull << (index & 63)));
+}
+
+/* ===========================================================================
+ *  PRIVATE Slab list helpers
+ */
+static void __slab_link (z_slab_t **head, z_slab_t *slab) {
+  slab->prev = NULL;
+  slab->next = *head;
+  if (*head != NULL)
+    (*head)->prev = slab;
+  *head = slab;
+}
+
+static void __slab_unlink (z_slab_t **head, z_slab_t *slab) {
+  if (slab->prev != NULL)
+    slab->prev->next = slab->next;
+  else
+    *head = slab->next;
+  if (slab->next != NULL)
+    slab->next->prev = slab->prev;
+}
+
+/* ===========================================================================
+ *  PRIVATE Slab methods
+ */
+static z_slab_t *__slab_map (z_slab_cache_t *cache) {
+  uint8_t *block, *aligned, *block_end;
+  z_slab_t *slab;
+
+  /* Map twice the size and unmap the excess, to get an aligned slab */
+  block = (uint8_t *)mmap(NULL, 2 * Z_SLAB_SIZE, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (Z_UNLIKELY(block == MAP_FAILED))
+    return(NULL);
+
+  block_end = block + 2 * Z_SLAB_SIZE;
+  aligned = (uint8_t *)z_align_up((uintptr_t)block, Z_SLAB_SIZE);
+  if (aligned > block)
+    munmap(block, aligned - block);
+  if (aligned + Z_SLAB_SIZE < block_end)
+    munmap(aligned + Z_SLAB_SIZE, block_end - (aligned + Z_SLAB_SIZE));
+
+  slab = (z_slab_t *)aligned;
+  if (Z_UNLIKELY(__slab_map_add(slab))) {
+    munmap(slab, Z_SLAB_SIZE);
+    return(NULL);
+  }
+
+  slab->cache = cache;
+  slab->prev = NULL;
+  slab->next = NULL;
+  z_free_list_init(&(slab->free_list));
+  slab->bump = aligned + __SLAB_HEAD_SIZE;
+  slab->inuse = 0;
+  slab->magic = __SLAB_MAGIC;
+  cache->nslabs++;
+  return(slab);
+}
+
+static void __slab_unmap (z_slab_cache_t *cache, z_slab_t *slab) {
+  cache->nslabs--;
+  __slab_map_remove(slab);
+  munmap(slab, Z_SLAB_SIZE);
+}
+
+static void __slab_unmap_list (z_slab_cache_t *cache, z_slab_t *slab) {
+  while (slab != NULL) {
+    z_slab_t *next = slab->next;
+    __slab_unmap(cache, slab);
+    slab = next;
+  }
+}
+
+/* ===========================================================================
+ *  PRIVATE Slab-Cache methods (cache lock held)
+ */
+static void *__slab_cache_pop (z_slab_cache_t *cache) {
+  z_slab_t *slab = cache->partial;
+  void *ptr;
+
+  if (slab == NULL) {
+    if ((slab = cache->empty) != NULL) {
+      cache->empty = NULL;
+    } else if ((slab = __slab_map(cache)) == NULL) {
+      return(NULL);
+    }
+    __slab_link(&(cache->partial), slab);
+  }
+
+  /* The items never allocated are taken once the free-list is drained */
+  if ((ptr = z_free_list_pop(&(slab->free_list))) == NULL) {
+    ptr = slab->bump;
+    slab->bump += cache->isize;
+  }
+
+  if (++slab->inuse == cache->nitems) {
+    __slab_unlink(&(cache->partial), slab);
+    __slab_link(&(cache->full), slab);
+  }
+  return(ptr);
+}
+
+static void __slab_cache_push (z_slab_cache_t *cache, z_slab_t *slab, void *ptr) {
+  if (slab->inuse-- == cache->nitems) {
+    __slab_unlink(&(cache->full), slab);
+    __slab_link(&(cache->partial), slab);
+  }
+
+  z_free_list_add(&(slab->free_list), ptr);
+
+  /* Keep one empty slab around, the others are returned to the OS */
+  if (slab->inuse == 0) {
+    __slab_unlink(&(cache->partial), slab);
+    if (cache->empty == NULL) {
+      cache->empty = slab;
+    } else {
+      __slab_unmap(cache, slab);
+    }
+  }
+}
+
+/* ===========================================================================
+ *  PRIVATE Slab-Magazine methods (magazine lock held)
+ */
+static void __slab_magazine_refill (z_slab_magazine_t *magazine,
+                                    z_slab_cache_t *cache)
+{
+  z_spin_lock(&(cache->lock));
+  while (magazine->count < (Z_SLAB_MAGAZINE_SIZE / 2)) {
+    void *ptr = __slab_cache_pop(cache);
+    if (Z_UNLIKELY(ptr == NULL))
+      break;
+    magazine->items[magazine->count++] = ptr;
+  }
+  z_spin_unlock(&(cache->lock));
+}
+
+/*
+ * The items may come from the caches of other cpus, each one is returned
+ * to the slab it belongs to. The oldest half is flushed, the most recently
+ * freed items are the hot ones.
+ */
+static void __slab_magazine_flush (z_slab_magazine_t *magazine) {
+  const unsigned int nflush = Z_SLAB_MAGAZINE_SIZE / 2;
+  z_slab_cache_t *locked = NULL;
+  unsigned int i;
+
+  for (i = 0; i < nflush; ++i) {
+    void *ptr = magazine->items[i];
+    z_slab_t *slab = __slab_from_item(ptr);
+
+    Z_ASSERT(slab->magic == __SLAB_MAGIC, "%p is not a slab item", ptr);
+    if (slab->cache != locked) {
+      if (locked != NULL)
+        z_spin_unlock(&(locked->lock));
+      locked = slab->cache;
+      z_spin_lock(&(locked->lock));
+    }
+    __slab_cache_push(locked, slab, ptr);
+  }
+
+  if (locked != NULL)
+    z_spin_unlock(&(locked->lock));
+
+  magazine->count -= nflush;
+  memmove(magazine->items, magazine->items + nflush, magazine->count * sizeof(void *));
+}
+
+/* ===========================================================================
+ *  PUBLIC Slab-Cache methods
+ */
+int z_slab_cache_open (z_slab_cache_t *cache, size_t isize) {
+  z_spin_alloc(&(cache->lock));
+  cache->partial = NULL;
+  cache->full = NULL;
+  cache->empty = NULL;
+  cache->isize = z_align_up(isize, 16);
+  cache->nitems = (Z_SLAB_SIZE - __SLAB_HEAD_SIZE) / cache->isize;
+  cache->nslabs = 0;
+  cache->nlive = 0;
+  return(0);
+}
+
+void z_slab_cache_close (z_slab_cache_t *cache) {
+  /* The magazines are closed, the items still in use are leaked */
+  Z_ASSERT(cache->nlive == 0, "%"PRIu64" items of %u bytes leaked",
+           cache->nlive, cache->isize);
+  __slab_unmap_list(cache, cache->partial);
+  __slab_unmap_list(cache, cache->full);
+  /* Not on a list, the links are left over from the partial one */
+  if (cache->empty != NULL)
+    __slab_unmap(cache, cache->empty);
+  z_spin_free(&(cache->lock));
+}
+
+z_slab_cache_t *z_slab_owner (const void *ptr) {
+  uintptr_t index = ((uintptr_t)ptr) >> __SLAB_MAP_SHIFT;
+  uint64_t *leaf;
+
+  if ((leaf = __slab_map_leaf(index, 0)) == NULL)
+    return(NULL);
+
+  index &= (1 << __SLAB_MAP_LEAF_BITS) - 1;
+  if (!(z_atomic_load(&(leaf[index >> 6])) & (1ull << (index & 63))))
+    return(NULL);
+  return(__slab_from_item(ptr)->cache);
+}
+
+/* ===========================================================================
+ *  PUBLIC Slab-Magazine methods
+ */
+void z_slab_magazine_open (z_slab_magazine_t *magazine) {
+  z_spin_alloc(&(magazine->lock));
+  magazine->count = 0;
+}
+
+void z_slab_magazine_close (z_slab_magazine_t *magazine) {
+  /* The items are released with their slabs */
+  magazine->count = 0;
+  z_spin_free(&(magazine->lock));
+}
+
+void *z_slab_alloc (z_slab_magazine_t *magazine, z_slab_cache_t *cache) {
+  void *ptr = NULL;
+
+  z_spin_lock(&(magazine->lock));
+  if (magazine->count == 0)
+    __slab_magazine_refill(magazine, cache);
+  if (Z_LIKELY(magazine->count > 0))
+    ptr = magazine->items[--magazine->count];
+  z_spin_unlock(&(magazine->lock));
+#if __SLAB_DEBUG
+  /* The magazine may hold items of other cpus caches */
+  if (ptr != NULL)
+    z_atomic_inc(&(__slab_from_item(ptr)->cache->nlive));
+#endif
+  return(ptr);
+}
+
+void z_slab_free (z_slab_magazine_t *magazine, void *ptr) {
+#if __SLAB_DEBUG
+  __slab_assert(z_slab_owner(ptr) != NULL, "%p is not a slab item", ptr);
+  z_atomic_dec(&(__slab_from_item(ptr)->cache->nlive));
+#endif
+  z_spin_lock(&(magazine->lock));
+  if (magazine->count == Z_SLAB_MAGAZINE_SIZE)
+    __slab_magazine_flush(magazine);
+  magazine->items[magazine->count++] = ptr;
+  z_spin_unlock(&(magazine->lock));
+}
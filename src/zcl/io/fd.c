@@ -73,20 +73,7 @@ ssize_t z_fd_write (int fd, const void *buf, size_t bufsize) {
   return(total);
 }
 
+/* The write may be partial, the caller keeps track of what was written */
 ssize_t z_fd_writev(int fd, const struct iovec *iov, int iovcnt) {
-  ssize_t wr = writev(fd, iov, iovcnt);
-  /* TODO */
-#if 1 && __Z_DEBUG__
-  ssize_t total = 0;
-
-  while (iovcnt--) {
-    total += iov->iov_len;
-    iov++;
-  }
-
-  if (wr >= 0) {
-    Z_ASSERT(wr == total, "Incomplete writev wr=%zd total=%zd", wr, total);
-  }
-#endif
-  return(wr);
+  return(writev(fd, iov, iovcnt));
 }
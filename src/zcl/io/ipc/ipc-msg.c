@@ -19,6 +19,8 @@
 #include <zcl/ipc.h>
 #include <zcl/fd.h>
 
+#include <errno.h>
+
 #define Z_MSGBUF_VERSION      (0x0)
 #define Z_MSGBUF_MAGIC        (0xaacc33d5)
 
@@ -68,10 +70,18 @@ static void __msgbuf_build_head (z_ipc_msgbuf_t *self, uint8_t head[8], uint32_t
  */
 #define NODE_NBLOCKS      16
 #define DUMP_NBLOCKS      64
+#define DUMP_NIOVS        128
 
+/*
+ * A message is the owned data block followed by the (optional) refs,
+ * the refs are sent as they are and released once written.
+ */
 struct msg {
   uint8_t *data;
   size_t size;
+  size_t length;
+  z_bytes_ref_t *refs;
+  unsigned int nrefs;
 };
 
 struct node {
@@ -79,14 +89,6 @@ struct node {
   struct msg msgs[NODE_NBLOCKS];
 };
 
-struct buf {
-  struct node *head;
-  struct node *tail;
-  int m_count;
-  int m_offset;
-  int d_offset;
-};
-
 static struct node *__node_alloc (z_ipc_msgbuf_t *self) {
   struct node *node;
 
@@ -98,22 +100,59 @@ static struct node *__node_alloc (z_ipc_msgbuf_t *self) {
   return(node);
 }
 
-static void __node_free (struct node *node) {
+static void __msg_free (struct msg *msg) {
   z_memory_t *memory = z_global_memory();
+
+  if (msg->refs != NULL) {
+    unsigned int i;
+    for (i = 0; i < msg->nrefs; ++i) {
+      z_bytes_ref_release(&(msg->refs[i]));
+    }
+    z_memory_array_free(memory, msg->refs);
+  }
+
+  if (msg->data != NULL)
+    z_memory_free(memory, msg->data);
+
+  z_memzero(msg, sizeof(struct msg));
+}
+
+static void __node_free (struct node *node) {
   int i;
 
   for (i = 0; i < NODE_NBLOCKS; ++i) {
-    struct msg *msg = &(node->msgs[i]);
-    if (Z_UNLIKELY(msg->data != NULL)) {
-      z_memory_free(memory, msg->data);
-      msg->data = NULL;
-      msg->size = 0;
-    }
+    __msg_free(&(node->msgs[i]));
   }
 
   z_memory_struct_free(z_global_memory(), struct node, node);
 }
 
+/* Add the message segments, skipping the first 'skip' bytes already sent */
+static int __msg_iovs (const struct msg *msg, uint8_t head[8],
+                       struct iovec *iovs, int niovs, size_t skip)
+{
+  unsigned int i;
+
+#define __msg_add_iov(base, len)                                              \
+  if (skip >= (len)) {                                                        \
+    skip -= (len);                                                            \
+  } else if (niovs < DUMP_NIOVS) {                                            \
+    iovs[niovs].iov_base = (uint8_t *)(base) + skip;                          \
+    iovs[niovs].iov_len  = (len) - skip;                                      \
+    skip = 0;                                                                 \
+    ++niovs;                                                                  \
+  }
+
+  __msg_add_iov(head, 8);
+  __msg_add_iov(msg->data, msg->size);
+  for (i = 0; i < msg->nrefs; ++i) {
+    __msg_add_iov(msg->refs[i].slice.data, msg->refs[i].slice.size);
+  }
+
+#undef __msg_add_iov
+  return(niovs);
+}
+
 static void __ipc_outbuf_open (z_ipc_msgbuf_t *self) {
   self->obuffer.tail = NULL;
   self->obuffer.head = NULL;
@@ -133,22 +172,25 @@ static void __ipc_outbuf_close (z_ipc_msgbuf_t *self) {
   z_spin_free(&(self->obuffer.lock));
 }
 
-static int __ipc_outbuf_add (z_ipc_msgbuf_t *self, void *data, size_t size) {
-  struct node *node = (struct node *)self->obuffer.tail;
-  int require_new_node;
+/*
+ * The messages are pushed by the workers and flushed by the I/O thread,
+ * the slot and node selection are done under the obuffer lock.
+ */
+static int __ipc_outbuf_add (z_ipc_msgbuf_t *self, const struct msg *msg) {
+  struct node *node;
   size_t msg_idx;
 
   z_spin_lock(&(self->obuffer.lock));
+  node = (struct node *)self->obuffer.tail;
   msg_idx = (self->obuffer.m_offset + self->obuffer.m_count) % NODE_NBLOCKS;
-  require_new_node = (msg_idx == 0 && self->obuffer.m_count > 0);
-  z_spin_unlock(&(self->obuffer.lock));
-
-  if (node == NULL || require_new_node) {
+  if (node == NULL || (msg_idx == 0 && self->obuffer.m_count > 0)) {
     struct node *new_node;
 
     new_node = __node_alloc(self);
-    if (Z_MALLOC_IS_NULL(new_node))
+    if (Z_MALLOC_IS_NULL(new_node)) {
+      z_spin_unlock(&(self->obuffer.lock));
       return(-1);
+    }
 
     if (node == NULL) {
       self->obuffer.head = new_node;
@@ -159,119 +201,94 @@ static int __ipc_outbuf_add (z_ipc_msgbuf_t *self, void *data, size_t size) {
     node = new_node;
   }
 
-  z_spin_lock(&(self->obuffer.lock));
+  node->msgs[msg_idx] = *msg;
   ++(self->obuffer.m_count);
   z_spin_unlock(&(self->obuffer.lock));
-
-  struct msg *msg = &(node->msgs[msg_idx]);
-  msg->data = data;
-  msg->size = size;
   return(0);
 }
 
+static int __ipc_outbuf_pending (z_ipc_msgbuf_t *self) {
+  unsigned int count;
+  z_spin_lock(&(self->obuffer.lock));
+  count = self->obuffer.m_count;
+  z_spin_unlock(&(self->obuffer.lock));
+  return(count > 0);
+}
+
 static int __ipc_outbuf_flush (z_ipc_msgbuf_t *self, int fd) {
   uint8_t heads[8 * DUMP_NBLOCKS];
-  struct iovec iovs[2 * DUMP_NBLOCKS];
-  struct iovec *iov = iovs;
-  z_memory_t *memory;
+  struct iovec iovs[DUMP_NIOVS];
   struct node *node;
-  int m_offset;
-  int count;
+  unsigned int m_offset;
+  unsigned int count;
+  unsigned int nmsgs;
+  size_t d_offset;
+  ssize_t wr;
   int niovs;
-  int i;
 
   z_spin_lock(&(self->obuffer.lock));
-  niovs = z_min(self->obuffer.m_count, DUMP_NBLOCKS);
+  count = z_min(self->obuffer.m_count, DUMP_NBLOCKS);
   z_spin_unlock(&(self->obuffer.lock));
 
-  if (Z_UNLIKELY(niovs == 0))
+  if (Z_UNLIKELY(count == 0))
     return(0);
 
-  count = niovs;
+  /* Collect the segments of the pending messages */
   node = (struct node *)self->obuffer.head;
   m_offset = self->obuffer.m_offset;
-
-  if (self->obuffer.d_offset > 0) {
+  d_offset = self->obuffer.d_offset;
+  niovs = 0;
+  for (nmsgs = 0; nmsgs < count && niovs < DUMP_NIOVS; ++nmsgs) {
     struct msg *msg = &(node->msgs[m_offset]);
-    if (self->obuffer.d_offset < 8) {
-      __msgbuf_build_head(self, heads, msg->size);
-      iov->iov_base = heads + self->obuffer.d_offset;
-      iov->iov_len = 8 - self->obuffer.d_offset;
-      ++iov;
-    }
-
-    iov->iov_base = msg->data + (self->obuffer.d_offset - 8);
-    iov->iov_len = msg->size - (self->obuffer.d_offset - 8);
-    ++iov;
-
-    ++m_offset;
-    --count;
-  }
+    uint8_t *head = heads + (nmsgs * 8);
 
-  for (; node != NULL && count > 0; node = node->next) {
-    for (i = m_offset; count > 0 && i < DUMP_NBLOCKS; ++i) {
-      uint8_t *msg_head = heads + ((iov - iovs) * 8);
-      struct msg *msg = &(node->msgs[i]);
+    __msgbuf_build_head(self, head, msg->length);
+    niovs = __msg_iovs(msg, head, iovs, niovs, d_offset);
+    d_offset = 0;
 
-      __msgbuf_build_head(self, msg_head, msg->size);
-      iov->iov_base = msg_head;
-      iov->iov_len = 8;
-      ++iov;
-
-      iov->iov_base = msg->data;
-      iov->iov_len = msg->size;
-      ++iov;
-
-      --count;
+    if (++m_offset == NODE_NBLOCKS) {
+      node = node->next;
+      m_offset = 0;
     }
-    m_offset = 0;
   }
 
-  ssize_t wr = z_fd_writev(fd, iovs, iov - iovs);
-  if (Z_UNLIKELY(wr < 0)) return(-1);
+  wr = z_fd_writev(fd, iovs, niovs);
+  if (Z_UNLIKELY(wr < 0))
+    return((errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1);
 
-  count = niovs;
+  /* Release the messages fully written */
+  z_spin_lock(&(self->obuffer.lock));
   node = (struct node *)self->obuffer.head;
   m_offset = self->obuffer.m_offset;
-  memory = z_global_memory();
-  ssize_t size = -(self->obuffer.d_offset);
-  while (node != NULL && count > 0) {
-    for (i = m_offset; count > 0 && i < DUMP_NBLOCKS; ++i) {
-      struct msg *msg = &(node->msgs[i]);
-      size += (8 + msg->size);
-      if (size > wr) {
-        z_spin_lock(&(self->obuffer.lock));
-        self->obuffer.m_offset = i;
-        self->obuffer.d_offset = (size - wr);
-        self->obuffer.m_count = self->obuffer.m_count - (1 + (niovs - count));
-        z_spin_unlock(&(self->obuffer.lock));
-        return(0);
-      }
-
-      --count;
+  d_offset = self->obuffer.d_offset;
+  for (count = 0; wr > 0; ++count) {
+    struct msg *msg = &(node->msgs[m_offset]);
+    size_t left = (8 + msg->length) - d_offset;
 
-      /* Free Message */
-      z_memory_free(memory, msg->data);
-      msg->data = NULL;
-      msg->size = 0;
+    if ((size_t)wr < left) {
+      d_offset += wr;
+      break;
+    }
 
-      if (size == wr) {
-        z_spin_lock(&(self->obuffer.lock));
-        self->obuffer.m_offset = (i + 1) % NODE_NBLOCKS;
-        self->obuffer.m_count = self->obuffer.m_count - (niovs - count);
-        z_spin_unlock(&(self->obuffer.lock));
-        return(0);
+    wr -= left;
+    d_offset = 0;
+    __msg_free(msg);
+
+    /* The last node is kept, the next message reuses it */
+    if (++m_offset == NODE_NBLOCKS) {
+      m_offset = 0;
+      if (node->next != NULL) {
+        self->obuffer.head = node->next;
+        __node_free(node);
+        node = (struct node *)self->obuffer.head;
       }
     }
-
-    z_spin_lock(&(self->obuffer.lock));
-    self->obuffer.head = node->next;
-    z_spin_lock(&(self->obuffer.lock));
-    __node_free(node);
-
-    node = (struct node *)self->obuffer.head;
-    m_offset = 0;
   }
+
+  self->obuffer.m_offset = m_offset;
+  self->obuffer.d_offset = d_offset;
+  self->obuffer.m_count -= count;
+  z_spin_unlock(&(self->obuffer.lock));
   return(0);
 }
 
@@ -330,12 +347,62 @@ int z_ipc_msgbuf_fetch (z_ipc_msgbuf_t *self,
 }
 
 int z_ipc_msgbuf_push (z_ipc_msgbuf_t *self, void *buf, size_t n) {
-  return(__ipc_outbuf_add(self, buf, n));
+  return(z_ipc_msgbuf_push_refs(self, buf, n, NULL));
+}
+
+/*
+ * The message is the buf followed by the refs data, the refs are acquired
+ * and written without copying them. The buf is owned by the msgbuf.
+ */
+int z_ipc_msgbuf_push_refs (z_ipc_msgbuf_t *self,
+                            void *buf,
+                            size_t n,
+                            const z_array_t *refs)
+{
+  z_bytes_ref_t *msg_refs = NULL;
+  unsigned int nrefs = 0;
+  struct msg msg;
+  size_t length;
+
+  length = n;
+  if (refs != NULL && refs->count > 0) {
+    msg_refs = z_memory_array_alloc(z_global_memory(), z_bytes_ref_t, refs->count);
+    if (Z_MALLOC_IS_NULL(msg_refs))
+      return(-1);
+
+    for (nrefs = 0; nrefs < refs->count; ++nrefs) {
+      const z_bytes_ref_t *ref = z_array_get(refs, const z_bytes_ref_t, nrefs);
+      z_bytes_ref_acquire(&(msg_refs[nrefs]), ref);
+      length += ref->slice.size;
+    }
+  }
+
+  msg.data = buf;
+  msg.size = n;
+  msg.length = length;
+  msg.refs = msg_refs;
+  msg.nrefs = nrefs;
+  if (__ipc_outbuf_add(self, &msg)) {
+    while (nrefs--) {
+      z_bytes_ref_release(&(msg_refs[nrefs]));
+    }
+    if (msg_refs != NULL)
+      z_memory_array_free(z_global_memory(), msg_refs);
+    return(-1);
+  }
+  return(0);
 }
 
 int z_ipc_msgbuf_flush (z_ipc_msgbuf_t *self, z_iopoll_t *iopoll, z_iopoll_entity_t *entity) {
   if (__ipc_outbuf_flush(self, Z_IOPOLL_ENTITY_FD(entity)))
     return(-1);
-  z_iopoll_set_writable(iopoll, entity, self->obuffer.m_count > 0);
+
+  if (__ipc_outbuf_pending(self))
+    return(0);
+
+  /* A message pushed before the reset must keep the client writable */
+  z_iopoll_set_writable(iopoll, entity, 0);
+  if (__ipc_outbuf_pending(self))
+    z_iopoll_set_writable(iopoll, entity, 1);
   return(0);
 }
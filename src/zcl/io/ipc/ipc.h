@@ -18,8 +18,10 @@
 #include <zcl/config.h>
 __Z_BEGIN_DECLS__
 
+#include <zcl/bytesref.h>
 #include <zcl/ringbuf.h>
 #include <zcl/locking.h>
+#include <zcl/array.h>
 #include <zcl/reader.h>
 #include <zcl/macros.h>
 #include <zcl/object.h>
@@ -121,6 +123,10 @@ int             z_ipc_msgbuf_fetch  (z_ipc_msgbuf_t *msgbuf,
 int             z_ipc_msgbuf_push   (z_ipc_msgbuf_t *self,
                                      void *buf,
                                      size_t n);
+int             z_ipc_msgbuf_push_refs (z_ipc_msgbuf_t *self,
+                                     void *buf,
+                                     size_t n,
+                                     const z_array_t *refs);
 int             z_ipc_msgbuf_flush  (z_ipc_msgbuf_t *msgbuf,
                                      z_iopoll_t *iopoll,
                                      z_iopoll_entity_t *client);
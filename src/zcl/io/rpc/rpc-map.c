@@ -169,6 +169,35 @@ static z_rpc_call_t *__htable_remove (z_rpc_map_t *table, uint64_t oid) {
   return(entry);
 }
 
+/* ============================================================================
+ *  PUBLIC IPC-RPC ctx methods
+ */
+z_rpc_ctx_t *__z_rpc_ctx_alloc (size_t size) {
+  z_memory_t *memory = z_global_memory();
+  z_rpc_ctx_t *self;
+
+  /* The large ctxs (e.g. scan, iopoll) go to the struct size class */
+  if (size <= z_memory_pool_isize(memory, Z_MEMORY_POOL_RPC_CTX)) {
+    self = Z_RPC_CTX(z_memory_pool_alloc(memory, Z_MEMORY_POOL_RPC_CTX));
+  } else {
+    self = Z_RPC_CTX(__z_memory_struct_alloc(memory, size));
+  }
+  if (Z_MALLOC_IS_NULL(self))
+    return(NULL);
+
+  self->size = size;
+  return(self);
+}
+
+void __z_rpc_ctx_free (z_rpc_ctx_t *self) {
+  z_memory_t *memory = z_global_memory();
+  if (self->size <= z_memory_pool_isize(memory, Z_MEMORY_POOL_RPC_CTX)) {
+    z_memory_pool_free(memory, Z_MEMORY_POOL_RPC_CTX, self);
+  } else {
+    __z_memory_struct_free(memory, self->size, self);
+  }
+}
+
 /* ============================================================================
  *  PUBLIC IPC-RPC call methods
  */
@@ -191,7 +220,7 @@ void z_rpc_call_free (z_rpc_call_t *self) {
   if (z_atomic_dec(&(self->refs)) > 0)
     return;
 
-  z_memory_array_free(z_global_memory(), self);
+  z_memory_struct_free(z_global_memory(), z_rpc_call_t, self);
 }
 
 /* ============================================================================
@@ -43,6 +43,7 @@ struct z_rpc_ctx {
   uint64_t req_id;
   uint64_t req_time;
   uint64_t msg_type;
+  size_t size;
   uint8_t blob[1];
 };
 
@@ -66,10 +67,16 @@ struct z_rpc_map {
 struct z_rpc_callbacks {
 };
 
+/*
+ * The ctx size is a constant of the message types, the generated
+ * servers export the largest one to reserve the per-cpu rpc ctx pool.
+ * The ctxs that do not fit the pool go to z_memory_struct_alloc().
+ */
+#define z_rpc_ctx_size(req_type, resp_type)                                   \
+  (sizeof(z_rpc_ctx_t) - 1 + sizeof(req_type) + sizeof(resp_type))
+
 #define z_rpc_ctx_alloc(req_type, resp_type)                                  \
-  z_memory_alloc(z_global_memory(), z_rpc_ctx_t,                              \
-                 sizeof(z_rpc_ctx_t) - 1 +                                    \
-                 sizeof(req_type) + sizeof(resp_type))
+  __z_rpc_ctx_alloc(z_rpc_ctx_size(req_type, resp_type))
 
 #define z_rpc_ctx_init(self, req_type)                                        \
   do {                                                                        \
@@ -78,8 +85,10 @@ struct z_rpc_callbacks {
   } while (0)
 
 #define z_rpc_ctx_free(self)                                                  \
-  z_memory_free(z_global_memory(), self)
+  __z_rpc_ctx_free(self)
 
+z_rpc_ctx_t * __z_rpc_ctx_alloc (size_t size);
+void          __z_rpc_ctx_free  (z_rpc_ctx_t *self);
 
 z_rpc_call_t *z_rpc_call_alloc (z_rpc_ctx_t *ctx);
 void          z_rpc_call_free  (z_rpc_call_t *self);
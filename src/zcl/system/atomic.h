@@ -30,10 +30,15 @@ Z_TYPEDEF_STRUCT(z_atomic_queue)
   #define z_atomic_sub_and_fetch(ptr, v) __sync_sub_and_fetch(ptr, v)
   #define z_atomic_fetch_and_add(ptr, v) __sync_fetch_and_add(ptr, v)
   #define z_atomic_fetch_and_sub(ptr, v) __sync_fetch_and_sub(ptr, v)
+  #define z_atomic_fetch_and_or(ptr, v)  __sync_fetch_and_or(ptr, v)
+  #define z_atomic_fetch_and_and(ptr, v) __sync_fetch_and_and(ptr, v)
   #define z_atomic_cas(ptr, o, n)        __sync_bool_compare_and_swap(ptr, o, n)
   #define z_atomic_vcas(ptr, o, n)       __sync_val_compare_and_swap(ptr, o, n)
   #define z_atomic_inc(ptr)              z_atomic_add_and_fetch(ptr, 1)
   #define z_atomic_dec(ptr)              z_atomic_sub_and_fetch(ptr, 1)
+  #define z_atomic_synchronize()         __sync_synchronize()
+  #define z_atomic_load_acquire(ptr)     __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+  #define z_atomic_store_release(ptr, v) __atomic_store_n(ptr, v, __ATOMIC_RELEASE)
 #else
   #error "No atomic support"
 #endif
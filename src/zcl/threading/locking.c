@@ -132,7 +132,7 @@ int z_rwcsem_release_write (z_rwcsem_t *lock) {
   uint32_t curval, expval, newval;
   z_atomic_cas_loop(&(lock->state), curval, expval, newval, {
     expval = curval;
-    newval = expval & Z_RWCSEM_LC_MASK;
+    newval = expval & ~Z_RWCSEM_WRITE_FLAG;
   });
   return(newval);
 }
@@ -212,7 +212,7 @@ int z_rwcsem_try_switch (z_rwcsem_t *lock, z_rwcsem_op_t op_current, z_rwcsem_op
         if (curval & Z_RWCSEM_COMMIT_FLAG)
           return(0);
         expval = curval & Z_RWCSEM_RW_MASK;
-        newval = (expval & Z_RWCSEM_LC_MASK) + 1;
+        newval = (expval & Z_RWCSEM_READERS_MASK) + 1;
       } else if (op_next == Z_RWCSEM_COMMIT) {
         // write -> commit
         return(curval == (Z_RWCSEM_COMMIT_FLAG | Z_RWCSEM_WRITE_FLAG));
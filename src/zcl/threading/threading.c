@@ -17,6 +17,7 @@
 #include <zcl/threading.h>
 #include <zcl/system.h>
 #include <zcl/debug.h>
+#include <zcl/time.h>
 
 /* ============================================================================
  *  Wait condition
@@ -29,9 +30,11 @@ void z_wait_cond_wait (z_wait_cond_t *wcond,
   if (msec == 0) {
     pthread_cond_wait(wcond, mutex);
   } else {
+    /* The timeout is an absolute realtime clock value */
+    uint64_t deadline = z_time_micros() + msec * 1000;
     struct timespec timeout;
-    timeout.tv_sec  = msec / 1000;
-    timeout.tv_nsec = (msec % 1000) * 1000;
+    timeout.tv_sec  = deadline / 1000000;
+    timeout.tv_nsec = (deadline % 1000000) * 1000;
     pthread_cond_timedwait(wcond, mutex, &timeout);
   }
 }
@@ -30,6 +30,12 @@
  *  | head | kprefix | ksize | vsize | key |
  *  +--------------------------------------+
  *    3-int group encoding 3+ bytes
+ *
+ * Every __NODE_RESTART_INTERVAL keys there is a restart point, a key
+ * stored without prefix. On finalize the restart array is written after
+ * the last key, { [u32 key offset][u32 value end offset] }, the lookups
+ * binary search it and scan at most one interval.
+ * Nodes without restarts (nh_restarts == 0) are scanned from the first key.
  */
 
 /* ============================================================================
@@ -38,8 +44,17 @@
 #define __CONST_NODE_HEAD(x)      Z_CONST_CAST(struct node_head, x)
 #define __NODE_HEAD(x)            Z_CAST(struct node_head, x)
 
+#define __NODE_RESTART_INTERVAL   (16)
+#define __NODE_RESTART_SIZE       (8)
+#define __NODE_MAX_KEY_SIZE       (128)
+
 #define __node_space_avail(node)                                    \
-  (__CONST_NODE_HEAD(node)->nh_last_value - __CONST_NODE_HEAD(node)->nh_last_key)
+  (__CONST_NODE_HEAD(node)->nh_last_value -                         \
+   __CONST_NODE_HEAD(node)->nh_last_key -                           \
+   __CONST_NODE_HEAD(node)->nh_restarts * __NODE_RESTART_SIZE)
+
+#define __node_is_restart(index)                                    \
+  (((index) % __NODE_RESTART_INTERVAL) == 0)
 
 #define __node_first_key(node)                                      \
   ((node) + sizeof(struct node_head))
@@ -63,7 +78,9 @@ struct node_head {
   uint8_t  nh_level;
   uint8_t  nh_prefix;
 
-  uint32_t nh_ptrs[3];      /* 0 |   I   I   I   | N */
+  uint32_t nh_restarts;       /* Number of restart points */
+  uint32_t nh_restart_offset; /* Restart array offset, set on finalize */
+  uint32_t nh_last_restart;   /* Offset of the last restart key */
 } __attribute__((packed));
 
 /* ============================================================================
@@ -105,8 +122,39 @@ static int __node_open (const uint8_t *node, uint32_t size) {
   return(0);
 }
 
+static int __node_item_fetch (const uint8_t *node,
+                              const uint8_t *pkey,
+                              z_bucket_entry_t *item);
+
+/* The restart keys are written after the last key, in the reserved space */
+static void __node_write_restarts (uint8_t *node) {
+  struct node_head *head = __NODE_HEAD(node);
+  uint8_t *prestart = node + head->nh_last_key;
+  z_bucket_entry_t item;
+  const uint8_t *pkey;
+  uint32_t voffset;
+  uint32_t koffset;
+
+  item.value.data = node + head->nh_size;
+  item.index = 0;
+  pkey = node + sizeof(struct node_head);
+  while (pkey < __node_last_key(node)) {
+    if (__node_is_restart(item.index)) {
+      koffset = pkey - node;
+      voffset = item.value.data - node;
+      z_encode_uint(prestart, 4, koffset);     prestart += 4;
+      z_encode_uint(prestart, 4, voffset);     prestart += 4;
+    }
+    __node_item_fetch(node, pkey, &item);
+    pkey = item.key.data + item.key.size;
+  }
+  head->nh_restart_offset = head->nh_last_key;
+}
+
 static void __node_finalize (uint8_t *node) {
   struct node_head *head = (struct node_head *)node;
+  if (head->nh_restarts > 0)
+    __node_write_restarts(node);
   head->nh_crc = __node_checksum(node, head->nh_size);
   Z_LOG_TRACE("Node Finalized size=%"PRIu32" with nh_items=%"PRIu32" use-prefix %d\n",
               head->nh_size, head->nh_items, head->nh_prefix);
@@ -150,24 +198,86 @@ static uint32_t __node_available (const uint8_t *node) {
   return(__node_space_avail(node));
 }
 
+/*
+ * Same accounting of __node_append(): a restart point stores the full key,
+ * without prefix, and reserves its slot of the restart array.
+ */
 static int __node_has_space (const uint8_t *node, const z_bucket_entry_t *item) {
+  const struct node_head *head = __CONST_NODE_HEAD(node);
+  z_bucket_entry_t restart;
   uint8_t length[3];
   size_t required;
-  required = __node_calc_khead(item, length) + item->key.size + item->value.size;
+
+  if (__node_is_restart(head->nh_items)) {
+    if (item->kprefix > 0 && head->nh_items > 0) {
+      restart.key.size = item->kprefix + item->key.size;
+      restart.value.size = item->value.size;
+      restart.kprefix = 0;
+      item = &restart;
+    }
+    required = __NODE_RESTART_SIZE;
+  } else {
+    required = 0;
+  }
+
+  required += __node_calc_khead(item, length) + item->key.size + item->value.size;
   return(__node_space_avail(node) >= required);
 }
 
+/*
+ * A restart key is stored without prefix, the shared part comes
+ * from the previous key, rebuilt scanning from the last restart.
+ */
+static void __node_restart_key (const uint8_t *node,
+                                const z_bucket_entry_t *item,
+                                uint8_t kbuffer[__NODE_MAX_KEY_SIZE],
+                                z_bucket_entry_t *restart)
+{
+  const struct node_head *head = __CONST_NODE_HEAD(node);
+  z_bucket_entry_t entry;
+  const uint8_t *pkey;
+
+  entry.value.data = (uint8_t *)node + head->nh_size;
+  pkey = node + head->nh_last_restart;
+  while (__node_item_fetch(node, pkey, &entry)) {
+    z_memcpy(kbuffer + entry.kprefix, entry.key.data, entry.key.size);
+    pkey = entry.key.data + entry.key.size;
+  }
+
+  Z_ASSERT(item->kprefix + item->key.size <= __NODE_MAX_KEY_SIZE,
+           "Keys > %d not supported", __NODE_MAX_KEY_SIZE);
+  z_memcpy(kbuffer + item->kprefix, item->key.data, item->key.size);
+  z_byte_slice_set(&(restart->key), kbuffer, item->kprefix + item->key.size);
+  z_byte_slice_copy(&(restart->value), &(item->value));
+  restart->kprefix = 0;
+}
+
 static int __node_append (uint8_t *node, const z_bucket_entry_t *item) {
   struct node_head *head = __NODE_HEAD(node);
   uint8_t *pkey = __node_last_key(node);
+  uint8_t kbuffer[__NODE_MAX_KEY_SIZE];
+  z_bucket_entry_t restart;
+  uint32_t required;
   uint8_t length[3];
-
   uint32_t ksize;
+  int is_restart;
+
+  is_restart = __node_is_restart(head->nh_items);
+  if (is_restart && item->kprefix > 0 && head->nh_items > 0) {
+    __node_restart_key(node, item, kbuffer, &restart);
+    item = &restart;
+  }
 
   ksize = item->key.size + __node_calc_khead(item, length);
-  if (Z_UNLIKELY((ksize + item->value.size) > __node_space_avail(node)))
+  required = ksize + item->value.size + (is_restart ? __NODE_RESTART_SIZE : 0);
+  if (Z_UNLIKELY(required > __node_space_avail(node)))
     return(1);
 
+  if (is_restart) {
+    head->nh_last_restart = head->nh_last_key;
+    head->nh_restarts++;
+  }
+
   head->nh_last_key += ksize;
   head->nh_last_value -= item->value.size;
   head->nh_prefix |= (item->kprefix > 0);
@@ -203,6 +313,49 @@ static int __node_fetch_next (const uint8_t *node, z_bucket_entry_t *item) {
   return(__node_item_fetch(node, item->key.data + item->key.size, item));
 }
 
+static int __node_fetch_restart (const uint8_t *node,
+                                 uint32_t index,
+                                 z_bucket_entry_t *item)
+{
+  const uint8_t *prestart;
+  uint32_t koffset;
+  uint32_t voffset;
+
+  prestart = node + __CONST_NODE_HEAD(node)->nh_restart_offset +
+             index * __NODE_RESTART_SIZE;
+  z_decode_uint32(prestart, 4, &koffset);
+  z_decode_uint32(prestart + 4, 4, &voffset);
+
+  item->value.data = (uint8_t *)node + voffset;
+  item->index = index * __NODE_RESTART_INTERVAL;
+  return(__node_item_fetch(node, node + koffset, item));
+}
+
+/* Fetch the last restart with a key <= the one searched, or the first */
+static int __node_fetch_floor (const uint8_t *node,
+                               const z_byte_slice_t *key,
+                               z_bucket_entry_t *item)
+{
+  const struct node_head *head = __CONST_NODE_HEAD(node);
+  uint32_t lo, hi;
+
+  if (head->nh_restarts == 0 || head->nh_restart_offset == 0)
+    return(__node_fetch_first(node, item));
+
+  lo = 0;
+  hi = head->nh_restarts - 1;
+  while (lo < hi) {
+    uint32_t mid = lo + ((hi - lo + 1) >> 1);
+    __node_fetch_restart(node, mid, item);
+    if (z_byte_slice_compare(&(item->key), key) <= 0) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return(__node_fetch_restart(node, lo, item));
+}
+
 static void __node_fetch_first_key (const uint8_t *node, z_byte_slice_t *key) {
   z_bucket_entry_t entry;
   __node_fetch_first(node, &entry);
@@ -226,6 +379,7 @@ const z_vtable_bucket_t z_bucket_vprefix = {
   .first_key      = __node_fetch_first_key,
   .fetch_first    = __node_fetch_first,
   .fetch_next     = __node_fetch_next,
+  .fetch_floor    = __node_fetch_floor,
 
   .prefix_encoded = __node_is_prefix_encoded,
 };
@@ -34,7 +34,12 @@ static int __bucket_search (const z_vtable_bucket_t *vtable,
   if (vtable->prefix_encoded(node))
     use_prefix = 0xffffffff;
 
-  has_item = vtable->fetch_first(node, entry);
+  /* Start from the closest key stored without prefix */
+  if (vtable->fetch_floor != NULL)
+    has_item = vtable->fetch_floor(node, key, entry);
+  else
+    has_item = vtable->fetch_first(node, entry);
+
   while (has_item) {
     size_t kshared;
 
@@ -102,9 +107,9 @@ static int __bucket_iter_next (void *self) {
   return(iter->has_data);
 }
 
-static int __bucket_iter_begin (void *self) {
+static int __bucket_iter_start (void *self, int has_data) {
   z_bucket_iterator_t *iter = Z_BUCKET_ITERATOR(self);
-  iter->has_data = iter->vtable->fetch_first(iter->node, &(iter->entry));
+  iter->has_data = has_data;
   if (iter->has_data && iter->entry.is_deleted) {
     return(__bucket_iter_next(self));
   } else {
@@ -115,6 +120,11 @@ static int __bucket_iter_begin (void *self) {
   return(iter->has_data);
 }
 
+static int __bucket_iter_begin (void *self) {
+  z_bucket_iterator_t *iter = Z_BUCKET_ITERATOR(self);
+  return(__bucket_iter_start(self, iter->vtable->fetch_first(iter->node, &(iter->entry))));
+}
+
 static const z_map_entry_t *__bucket_iter_current (const void *self) {
   const z_bucket_iterator_t *iter = Z_CONST_BUCKET_ITERATOR(self);
   return(iter->has_data ? &(iter->map_entry) : NULL);
@@ -147,11 +157,18 @@ static void __bucket_iter_get_refs (const void *self,
 }
 
 static int __bucket_iter_seek (void *self, const z_byte_slice_t *key) {
+  z_bucket_iterator_t *iter = Z_BUCKET_ITERATOR(self);
   const z_map_entry_t *entry;
   int has_data;
   int cmp = 1;
 
-  has_data = __bucket_iter_begin(self);
+  /* Skip the intervals before the key */
+  if (iter->vtable->fetch_floor != NULL) {
+    has_data = iter->vtable->fetch_floor(iter->node, key, &(iter->entry));
+    has_data = __bucket_iter_start(self, has_data);
+  } else {
+    has_data = __bucket_iter_begin(self);
+  }
   while (has_data) {
     entry = __bucket_iter_current(self);
     cmp = z_byte_slice_compare(&(entry->key), key);
@@ -68,6 +68,10 @@ struct z_vtable_bucket {
                                z_bucket_entry_t *entry);
   int       (*fetch_next)     (const uint8_t *node,
                                z_bucket_entry_t *entry);
+  /* Optional, an entry with no prefix at or before the key */
+  int       (*fetch_floor)    (const uint8_t *node,
+                               const z_byte_slice_t *key,
+                               z_bucket_entry_t *entry);
 
   int       (*prefix_encoded) (const uint8_t *node);
 };
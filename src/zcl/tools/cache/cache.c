@@ -32,8 +32,19 @@ enum entry_states {
   CACHED_ENTRY_IS_IN_2Q_AM,
   CACHED_ENTRY_IS_IN_2Q_A1IN,
   CACHED_ENTRY_IS_IN_2Q_A1OUT,
+  /* CLOCK-Pro */
+  CACHED_ENTRY_IS_CLOCK_HOT,
+  CACHED_ENTRY_IS_CLOCK_COLD,
+  CACHED_ENTRY_IS_CLOCK_TEST,
+  /* W-TinyLFU */
+  CACHED_ENTRY_IS_LFU_WINDOW,
+  CACHED_ENTRY_IS_LFU_PROBATION,
+  CACHED_ENTRY_IS_LFU_PROTECTED,
 };
 
+/* Accessed entries moved by a single reclaim, before evicting them anyway */
+#define __CACHE_TOUCH_BUDGET      (128)
+
 struct lru_cache {
   z_spinlock_t lock;
   z_dlink_node_t queue;
@@ -54,33 +65,103 @@ struct q2_cache {
   z_dlink_node_t a1out;
 };
 
+struct clock_pro_cache {
+  z_spinlock_t lock;
+
+  uint32_t cold_target;
+  uint32_t hot_size;
+  uint32_t cold_size;
+
+  uint32_t ghost_mask;
+  uint64_t *ghosts;
+
+  z_dlink_node_t hot;
+  z_dlink_node_t cold;
+};
+
+struct tinylfu_cache {
+  z_spinlock_t lock;
+
+  uint32_t window_max;
+  uint32_t protected_max;
+
+  uint32_t window_size;
+  uint32_t probation_size;
+  uint32_t protected_size;
+
+  uint32_t sketch_mask;
+  uint32_t sketch_count;
+  uint32_t sketch_period;
+  uint8_t *sketch;
+
+  z_dlink_node_t window;
+  z_dlink_node_t probation;
+  z_dlink_node_t protect;
+};
+
 struct hnode {
   z_rwlock_t lock;
   z_cache_entry_t *entry;
 };
 
-struct htable {
-  struct hnode *buckets;
-  z_rwlock_t lock;
+struct hbuckets {
+  z_dlink_node_t limbo;
   uint32_t size;
   uint32_t mask;
+  struct hnode nodes[1];
+};
+
+/*
+ * The writers hold the table read-lock and the bucket write-lock, the
+ * resize holds the table write-lock. The lookups walk the chains without
+ * locks: a miss seen while a resize is relinking the entries is retried
+ * with the locks.
+ */
+struct htable {
+  struct hbuckets *buckets;
+  z_rwlock_t lock;
   uint32_t used;
+  uint32_t resizing;
 };
 
-struct z_cache {
+/*
+ * The readers are counted per cpu on the parity of the epoch they entered.
+ * The released entries and the replaced bucket arrays wait on the limbo
+ * of the current epoch, and are freed once the epoch moved twice.
+ */
+struct cache_cpu {
+  uint32_t readers[2];
   uint64_t hit;
   uint64_t miss;
+  uint8_t pad[128 - 24];
+};
+
+struct cache_gc {
+  z_spinlock_t lock;
+  uint32_t epoch;
+  z_dlink_node_t entries[2];
+  z_dlink_node_t buckets[2];
+};
+
+struct z_cache {
+  struct cache_cpu *cpus;
+  unsigned int ncpus;
 
   uint32_t usage;
   uint32_t capacity;
+  uint64_t weight;
+  uint64_t budget;
 
   struct htable table;
+  struct cache_gc gc;
 
   const z_cache_policy_t *vpolicy;
 
   union policy {
     struct lru_cache lru;
     struct q2_cache q2;
+    struct clock_pro_cache clock_pro;
+    struct tinylfu_cache tinylfu;
   } dpolicy;
 
   z_mem_free_t entry_free;
@@ -88,16 +169,133 @@ struct z_cache {
   void *user_data;
 };
 
+/* ============================================================================
+ *  PRIVATE Epoch methods
+ */
+static struct cache_cpu *__cache_cpu (z_cache_t *cache) {
+  int cpu_id = z_global_cpu_id();
+  /* The threads out of the workers share the last slot */
+  return(cache->cpus + ((cpu_id < 0) ? cache->ncpus : (unsigned int)cpu_id));
+}
+
+static struct cache_cpu *__epoch_enter (z_cache_t *cache, uint32_t *epoch) {
+  struct cache_cpu *cpu = __cache_cpu(cache);
+  uint32_t e;
+
+  while (1) {
+    e = z_atomic_load_acquire(&(cache->gc.epoch));
+    z_atomic_inc(&(cpu->readers[e & 1]));
+    /* The epoch moved before we were counted, the writer may not see us */
+    if (Z_LIKELY(e == z_atomic_load_acquire(&(cache->gc.epoch))))
+      break;
+    z_atomic_dec(&(cpu->readers[e & 1]));
+  }
+
+  *epoch = e;
+  return(cpu);
+}
+
+static void __epoch_exit (struct cache_cpu *cpu, uint32_t epoch) {
+  z_atomic_dec(&(cpu->readers[epoch & 1]));
+}
+
+/* gc lock held: move to the next epoch, if no reader is left on the previous one */
+static int __epoch_try_advance (z_cache_t *cache) {
+  uint32_t prev = (cache->gc.epoch + 1) & 1;
+  unsigned int i;
+
+  z_atomic_synchronize();
+  for (i = 0; i <= cache->ncpus; ++i) {
+    if (z_atomic_load_acquire(&(cache->cpus[i].readers[prev])) > 0)
+      return(0);
+  }
+
+  z_atomic_inc(&(cache->gc.epoch));
+  return(1);
+}
+
+static void __gc_free (z_cache_t *cache,
+                       z_dlink_node_t *entries,
+                       z_dlink_node_t *buckets)
+{
+  z_memory_t *memory = z_global_memory();
+  struct hbuckets *hbuckets;
+  z_cache_entry_t *entry;
+
+  z_dlink_for_each_safe_entry(entries, entry, z_cache_entry_t, cache, {
+    Z_LOG_TRACE("Cache Release %"PRIu64, entry->oid);
+    if (cache->entry_free != NULL)
+      cache->entry_free(cache->user_data, entry);
+  });
+
+  z_dlink_for_each_safe_entry(buckets, hbuckets, struct hbuckets, limbo, {
+    z_memory_free(memory, hbuckets);
+  });
+}
+
+static void __gc_splice (z_dlink_node_t *head, z_dlink_node_t *limbo) {
+  while (z_dlink_is_not_empty(limbo)) {
+    z_dlink_node_t *node = limbo->next;
+    z_dlink_move(head, node);
+  }
+}
+
+static void __gc_retire (z_cache_t *cache,
+                         z_cache_entry_t *entry,
+                         struct hbuckets *buckets)
+{
+  struct cache_gc *gc = &(cache->gc);
+  z_dlink_node_t entries;
+  z_dlink_node_t arrays;
+  int i;
+
+  z_dlink_init(&entries);
+  z_dlink_init(&arrays);
+
+  z_spin_lock(&(gc->lock));
+  if (entry != NULL)
+    z_dlink_add(&(gc->entries[gc->epoch & 1]), &(entry->cache));
+  if (buckets != NULL)
+    z_dlink_add(&(gc->buckets[gc->epoch & 1]), &(buckets->limbo));
+
+  /* Entering epoch e+1 frees what was retired on the epoch e-1 */
+  for (i = 0; i < 2 && __epoch_try_advance(cache); ++i) {
+    const uint32_t p = gc->epoch & 1;
+    __gc_splice(&entries, &(gc->entries[p]));
+    __gc_splice(&arrays, &(gc->buckets[p]));
+  }
+  z_spin_unlock(&(gc->lock));
+
+  __gc_free(cache, &entries, &arrays);
+}
+
+static void __gc_open (struct cache_gc *gc) {
+  z_spin_alloc(&(gc->lock));
+  gc->epoch = 0;
+  z_dlink_init(&(gc->entries[0]));
+  z_dlink_init(&(gc->entries[1]));
+  z_dlink_init(&(gc->buckets[0]));
+  z_dlink_init(&(gc->buckets[1]));
+}
+
+/* No reader is left, everything on the limbo is freed */
+static void __gc_close (z_cache_t *cache) {
+  struct cache_gc *gc = &(cache->gc);
+  __gc_free(cache, &(gc->entries[0]), &(gc->buckets[0]));
+  __gc_free(cache, &(gc->entries[1]), &(gc->buckets[1]));
+  z_spin_free(&(gc->lock));
+}
+
 /* ============================================================================
  *  PRIVATE Hash-Table helper methods
  */
-#define __htable_get_bucket(table, oid)                       \
-  ((table)->buckets + (z_hash64a(oid) & ((table)->mask)))
+#define __htable_get_bucket(buckets, oid)                     \
+  ((buckets)->nodes + (z_hash64a(oid) & ((buckets)->mask)))
 
-static void __htable_resize (struct htable *table, unsigned int required_size) {
+static struct hbuckets *__htable_resize (struct htable *table, unsigned int required_size) {
   z_memory_t *memory = z_global_memory();
-  struct hnode *new_buckets;
-  struct hnode *buckets;
+  struct hbuckets *new_buckets;
+  struct hbuckets *buckets;
   unsigned int new_size;
   unsigned int size;
 
@@ -105,38 +303,42 @@ static void __htable_resize (struct htable *table, unsigned int required_size) {
   while (new_size < required_size)
     new_size <<= 1;
 
-  new_buckets = z_memory_array_alloc(memory, struct hnode, new_size);
+  size = sizeof(struct hbuckets) + (new_size - 1) * sizeof(struct hnode);
+  new_buckets = z_memory_alloc(memory, struct hbuckets, size);
   if (Z_MALLOC_IS_NULL(new_buckets))
-    return;
+    return(NULL);
 
-  size = new_size * sizeof(struct hnode);
   z_memset(new_buckets, 0, size);
+  new_buckets->size = new_size;
+  new_buckets->mask = new_size - 1;
 
-  size = table->size;
   buckets = table->buckets;
   if (buckets != NULL) {
-    unsigned int new_mask = new_size - 1;
     unsigned int i;
-    for (i = 0; i < size; ++i) {
-      z_cache_entry_t *p = buckets[i].entry;
+
+    /* The lookups walking the old chains may miss the moved entries */
+    z_atomic_store_release(&(table->resizing), 1);
+    z_atomic_synchronize();
+
+    for (i = 0; i < buckets->size; ++i) {
+      z_cache_entry_t *p = buckets->nodes[i].entry;
       while (p != NULL) {
         z_cache_entry_t *next;
         struct hnode *node;
 
         next = p->hash;
-        node = new_buckets + (z_hash64a(p->oid) & new_mask);
+        node = __htable_get_bucket(new_buckets, p->oid);
         p->hash = node->entry;
         node->entry = p;
 
         p = next;
       }
     }
-    z_memory_array_free(memory, buckets);
   }
 
-  table->size = new_size;
-  table->mask = new_size - 1;
-  table->buckets = new_buckets;
+  z_atomic_store_release(&(table->buckets), new_buckets);
+  z_atomic_store_release(&(table->resizing), 0);
+  return(buckets);
 }
 
 static z_cache_entry_t **__htable_find (struct hnode *node, uint64_t oid) {
@@ -156,13 +358,24 @@ static z_cache_entry_t **__htable_find_entry (struct hnode *node, uint64_t oid)
   return(NULL);
 }
 
+/* The entry may be already evicted or released and waiting on the limbo */
+static int __htable_entry_acquire (z_cache_entry_t *entry) {
+  uint32_t refs = z_atomic_load_acquire(&(entry->refs));
+  while (refs > 0) {
+    uint32_t cur = z_atomic_vcas(&(entry->refs), refs, refs + 1);
+    if (cur == refs)
+      return(1);
+    refs = cur;
+  }
+  return(0);
+}
+
 /* ============================================================================
  *  PRIVATE Hash-Table methods
  */
 static int __htable_open (struct htable *table, unsigned int capacity) {
   table->used = 0;
-  table->size = 0;
-  table->mask = 0;
+  table->resizing = 0;
   table->buckets = NULL;
   z_rwlock_init(&(table->lock));
   __htable_resize(table, capacity);
@@ -170,43 +383,51 @@ static int __htable_open (struct htable *table, unsigned int capacity) {
 }
 
 static void __htable_close (struct htable *table) {
-  z_memory_array_free(z_global_memory(), table->buckets);
+  z_memory_free(z_global_memory(), table->buckets);
 }
 
-static z_cache_entry_t *__htable_try_insert (struct htable *table,
+static z_cache_entry_t *__htable_try_insert (z_cache_t *cache,
                                              z_cache_entry_t *entry)
 {
+  struct htable *table = &(cache->table);
   z_cache_entry_t *old;
+  uint32_t size;
 
   z_read_lock(&(table->lock), z_rwlock, {
-    struct hnode *bucket = __htable_get_bucket(table, entry->oid);
+    struct hnode *bucket = __htable_get_bucket(table->buckets, entry->oid);
+    size = table->buckets->size;
     z_write_lock(&(bucket->lock), z_rwlock, {
       z_cache_entry_t **node = __htable_find(bucket, entry->oid);
       if ((old = *node) == NULL) {
         entry->hash = NULL;
         entry->state = CACHED_ENTRY_IS_NEW;
-        *node = entry;
+        entry->accessed = 0;
         z_atomic_inc(&(entry->refs));
+        /* Publish the entry once initialized, the lookups are lock-free */
+        z_atomic_store_release(node, entry);
       } else {
         z_atomic_inc(&(old->refs));
       }
     });
   });
 
-  if (old == NULL && z_atomic_inc(&(table->used)) >= (table->size << 1)) {
+  if (old == NULL && z_atomic_inc(&(table->used)) >= (size << 1)) {
+    struct hbuckets *buckets = NULL;
     z_try_write_lock(&(table->lock), z_rwlock, {
-      __htable_resize(table, table->used);
+      buckets = __htable_resize(table, table->used);
     });
+    if (buckets != NULL)
+      __gc_retire(cache, NULL, buckets);
   }
 
   return(old);
 }
 
-static z_cache_entry_t *__htable_lookup (struct htable *table, uint64_t oid) {
+static z_cache_entry_t *__htable_locked_lookup (struct htable *table, uint64_t oid) {
   z_cache_entry_t *entry;
 
   z_read_lock(&(table->lock), z_rwlock, {
-    struct hnode *bucket = __htable_get_bucket(table, oid);
+    struct hnode *bucket = __htable_get_bucket(table->buckets, oid);
     z_read_lock(&(bucket->lock), z_rwlock, {
       z_cache_entry_t **node = __htable_find_entry(bucket, oid);
       if (node != NULL) {
@@ -221,16 +442,56 @@ static z_cache_entry_t *__htable_lookup (struct htable *table, uint64_t oid) {
   return(entry);
 }
 
+static z_cache_entry_t *__htable_lookup (z_cache_t *cache, uint64_t oid) {
+  struct htable *table = &(cache->table);
+  z_cache_entry_t *entry = NULL;
+  struct hbuckets *buckets;
+  struct cache_cpu *cpu;
+  z_cache_entry_t *p;
+  uint32_t epoch;
+  int lost = 0;
+
+  cpu = __epoch_enter(cache, &epoch);
+  buckets = z_atomic_load_acquire(&(table->buckets));
+  p = z_atomic_load_acquire(&(__htable_get_bucket(buckets, oid)->entry));
+  while (p != NULL) {
+    if (p->oid == oid) {
+      if (__htable_entry_acquire(p)) {
+        entry = p;
+        break;
+      }
+      /* Evicted under us, a new entry may be linked past the chain we walk */
+      lost = 1;
+    }
+    p = z_atomic_load_acquire(&(p->hash));
+  }
+
+  /* A resize may have moved the entry away from the chain we walked */
+  if (entry == NULL && (lost || z_atomic_load_acquire(&(table->resizing)) ||
+                        z_atomic_load_acquire(&(table->buckets)) != buckets))
+  {
+    entry = __htable_locked_lookup(table, oid);
+  }
+  __epoch_exit(cpu, epoch);
+
+  if (entry != NULL) {
+    z_atomic_inc(&(cpu->hit));
+  } else {
+    z_atomic_inc(&(cpu->miss));
+  }
+  return(entry);
+}
+
 static z_cache_entry_t *__htable_remove (struct htable *table, uint64_t oid) {
   z_cache_entry_t *entry;
 
   z_read_lock(&(table->lock), z_rwlock, {
-    struct hnode *bucket = __htable_get_bucket(table, oid);
+    struct hnode *bucket = __htable_get_bucket(table->buckets, oid);
     z_write_lock(&(bucket->lock), z_rwlock, {
       z_cache_entry_t **node = __htable_find_entry(bucket, oid);
       if (node != NULL) {
         entry = *node;
-        *node = entry->hash;
+        z_atomic_store_release(node, entry->hash);
       } else {
         entry = NULL;
       }
@@ -242,18 +503,23 @@ static z_cache_entry_t *__htable_remove (struct htable *table, uint64_t oid) {
   return(entry);
 }
 
-static int __htable_remove_entry (struct htable *table, z_cache_entry_t *entry)
+/*
+ * The entry is unlinked only if the table holds the last reference.
+ * The refs drop to zero before the unlink, so a lookup that already
+ * walked to the entry fails to acquire it, and a locked one never sees it.
+ */
+static int __htable_claim_entry (struct htable *table, z_cache_entry_t *entry)
 {
   z_cache_entry_t **node;
   int found = 0;
 
   z_read_lock(&(table->lock), z_rwlock, {
-    struct hnode *bucket = __htable_get_bucket(table, entry->oid);
+    struct hnode *bucket = __htable_get_bucket(table->buckets, entry->oid);
     z_write_lock(&(bucket->lock), z_rwlock, {
       for (node = &(bucket->entry); *node != NULL; node = &((*node)->hash)) {
         if (*node == entry) {
-          *node = entry->hash;
-          found = 1;
+          if ((found = z_atomic_cas(&(entry->refs), 1, 0)))
+            z_atomic_store_release(node, entry->hash);
           break;
         }
       }
@@ -268,10 +534,38 @@ static int __htable_remove_entry (struct htable *table, z_cache_entry_t *entry)
 /* ===========================================================================
  *  Cache Entry
  */
+#define __cache_over_budget(cache, weight)                          \
+  ((cache)->budget > 0 && (weight) > (cache)->budget)
+
+/* Over the entries capacity, or over the weight budget if one is set */
+#define __cache_is_full(cache, usage, weight)                       \
+  ((usage) > (cache)->capacity || __cache_over_budget(cache, weight))
+
+static void __entry_retire (z_cache_t *cache, z_cache_entry_t *entry) {
+  z_atomic_dec(&(cache->usage));
+  z_atomic_sub_and_fetch(&(cache->weight), entry->weight);
+  /* A lookup may still be walking through the entry */
+  __gc_retire(cache, entry, NULL);
+}
+
+/* Fails if the entry was acquired since it was picked as victim */
 static int __entry_reclaim (z_cache_t *cache, z_cache_entry_t *entry) {
-  if (__htable_remove_entry(&(cache->table), entry)) {
+  if (__htable_claim_entry(&(cache->table), entry)) {
     z_dlink_del(&(entry->cache));
-    z_cache_release(cache, entry);
+    __entry_retire(cache, entry);
+    return(1);
+  }
+  return(0);
+}
+
+/* Only the table reference is left, a hint: the reclaim checks it again */
+#define __entry_is_unused(entry)      (z_atomic_load(&((entry)->refs)) == 1)
+
+/* A hit applied by the reclaim, the accessed flag is cleared */
+static int __entry_touched (z_cache_entry_t *entry, int *budget) {
+  if (entry->accessed && *budget > 0) {
+    entry->accessed = 0;
+    *budget -= 1;
     return(1);
   }
   return(0);
@@ -282,8 +576,10 @@ void z_cache_entry_init (z_cache_entry_t *entry, uint64_t oid) {
   z_dlink_init(&(entry->cache));
 
   entry->oid = oid;
+  entry->weight = 1;
   entry->refs = 1;
   entry->state = CACHED_ENTRY_IS_NEW;
+  entry->accessed = 0;
 }
 
 /* ============================================================================
@@ -292,18 +588,35 @@ void z_cache_entry_init (z_cache_entry_t *entry, uint64_t oid) {
 static void __lru_reclaim (z_cache_t *cache, struct lru_cache *lru) {
   z_dlink_node_t *tail = lru->queue.prev;
   uint32_t usage = cache->usage;
-  while (usage > cache->capacity && tail != &(lru->queue)) {
+  uint64_t weight = cache->weight;
+  int budget = __CACHE_TOUCH_BUDGET;
+  while (__cache_is_full(cache, usage, weight) && tail != &(lru->queue)) {
     z_cache_entry_t *evicted = z_dlink_entry(tail, z_cache_entry_t, cache);
+    int res = 1;
+
+    /* Accessed since the last reclaim, move to the head of LRU */
+    if (__entry_touched(evicted, &budget)) {
+      tail = tail->prev;
+      z_dlink_move(&(lru->queue), &(evicted->cache));
+      continue;
+    }
 
-    if (cache->entry_evict != NULL &&
-        !cache->entry_evict(cache->user_data, usage, evicted))
+    if (!__entry_is_unused(evicted)) {
+      res = -1;
+    } else if (cache->entry_evict != NULL &&
+               !(res = cache->entry_evict(cache->user_data, usage, evicted)))
     {
       break;
     }
 
     tail = tail->prev;
-    usage--;
-    __entry_reclaim(cache, evicted);
+    if (res > 0) {
+      uint64_t evicted_weight = evicted->weight;
+      if (__entry_reclaim(cache, evicted)) {
+        usage--;
+        weight -= evicted_weight;
+      }
+    }
   }
 }
 
@@ -332,7 +645,7 @@ static void __lru_init (z_cache_t *cache, struct lru_cache *lru) {
   z_dlink_init(&(lru->queue));
 }
 
-static void __policy_lru_update (z_cache_t *cache, z_cache_entry_t *entry) {
+static void __policy_lru_insert (z_cache_t *cache, z_cache_entry_t *entry) {
   struct lru_cache *lru = &(cache->dpolicy.lru);
   z_lock(&(lru->lock), z_spin, {
     if (entry->state != CACHED_ENTRY_IS_EVICTED)
@@ -355,10 +668,11 @@ static void __policy_lru_reclaim (z_cache_t *cache) {
   });
 }
 
-static void __policy_lru_init (z_cache_t *cache) {
+static int __policy_lru_init (z_cache_t *cache) {
   struct lru_cache *lru = &(cache->dpolicy.lru);
   z_spin_alloc(&(lru->lock));
   __lru_init(cache, lru);
+  return(0);
 }
 
 static void __policy_lru_destroy (z_cache_t *cache) {
@@ -382,8 +696,7 @@ static void __policy_lru_dump (FILE *stream, z_cache_t *cache) {
 }
 
 static const z_cache_policy_t __policy_lru = {
-  .insert  = __policy_lru_update,
-  .update  = __policy_lru_update,
+  .insert  = __policy_lru_insert,
   .remove  = __policy_lru_remove,
   .reclaim = __policy_lru_reclaim,
   .init    = __policy_lru_init,
@@ -393,38 +706,49 @@ static const z_cache_policy_t __policy_lru = {
 };
 
 /* ============================================================================
- *  2Q: A Low Overhead High Performance Buffer Management Replacement
- *  Algorithm", by Theodore Johnson and Dennis Shasha.
- *  http://www.vldb.org/conf/1994/P439.PDF
+ *  Victim lookup, from the tail of the queue skipping the pinned entries
  */
-static void __q2_reclaim (z_cache_t *cache, struct q2_cache *q2) {
-  z_cache_entry_t *evicted;
-  while (cache->usage > cache->capacity && q2->a1in_size > 0) {
-    if (q2->a1in_size > q2->kin) {
-      // page out the tail of a1in, and add it to the head of a1out
-      evicted = z_dlink_entry(q2->a1in.prev, z_cache_entry_t, cache);
-      z_dlink_move(&(q2->a1out), &(evicted->cache));
-      q2->a1out_size++;
-      q2->a1in_size--;
-      evicted->state = CACHED_ENTRY_IS_IN_2Q_A1OUT;
-      if (q2->a1out_size > q2->kout) {
-        // remove identifier of Z from the tail of A1out
-        evicted = z_dlink_entry(q2->a1out.prev, z_cache_entry_t, cache);
-        q2->a1out_size--;
-        if (!__entry_reclaim(cache, evicted))
-          break;
-      }
-    } else if (q2->am_size > 0) {
-      // page out the tail of AM.
-      // do not put it on A1out; it hasn't been accessed for a while
-      evicted = z_dlink_entry(q2->am.prev, z_cache_entry_t, cache);
-      q2->am_size--;
-      if (!__entry_reclaim(cache, evicted))
-        break;
+static z_cache_entry_t *__cache_victim (z_cache_t *cache,
+                                        z_dlink_node_t *queue,
+                                        int *budget,
+                                        void (*touch) (z_cache_t *cache,
+                                                       z_cache_entry_t *entry))
+{
+  z_dlink_node_t *node = queue->prev;
+
+  while (node != queue) {
+    z_cache_entry_t *entry = z_dlink_entry(node, z_cache_entry_t, cache);
+    int res;
+
+    node = node->prev;
+
+    /* Accessed since the last reclaim, apply the hit and look further */
+    if (__entry_touched(entry, budget)) {
+      touch(cache, entry);
+      continue;
     }
+
+    /* Referenced out of the cache, pinned */
+    if (!__entry_is_unused(entry))
+      continue;
+
+    if (cache->entry_evict == NULL)
+      return(entry);
+
+    if ((res = cache->entry_evict(cache->user_data, cache->usage, entry)) > 0)
+      return(entry);
+
+    if (res == 0)
+      break;
   }
+  return(NULL);
 }
 
+/* ============================================================================
+ *  2Q: A Low Overhead High Performance Buffer Management Replacement
+ *  Algorithm", by Theodore Johnson and Dennis Shasha.
+ *  http://www.vldb.org/conf/1994/P439.PDF
+ */
 static void __q2_insert (z_cache_t *cache,
                          struct q2_cache *q2,
                          z_cache_entry_t *entry)
@@ -449,6 +773,48 @@ static void __q2_insert (z_cache_t *cache,
   }
 }
 
+/* Apply a hit deferred by the lookup, q2 lock held */
+static void __q2_touch (z_cache_t *cache, z_cache_entry_t *entry) {
+  __q2_insert(cache, &(cache->dpolicy.q2), entry);
+}
+
+static void __q2_reclaim (z_cache_t *cache, struct q2_cache *q2) {
+  int budget = __CACHE_TOUCH_BUDGET;
+  z_cache_entry_t *evicted;
+  while (__cache_is_full(cache, cache->usage, cache->weight) && q2->a1in_size > 0) {
+    if (q2->a1in_size > q2->kin) {
+      evicted = z_dlink_entry(q2->a1in.prev, z_cache_entry_t, cache);
+      if (__entry_touched(evicted, &budget)) {
+        __q2_insert(cache, q2, evicted);
+        continue;
+      }
+      // page out the tail of a1in, and add it to the head of a1out
+      z_dlink_move(&(q2->a1out), &(evicted->cache));
+      q2->a1out_size++;
+      q2->a1in_size--;
+      evicted->state = CACHED_ENTRY_IS_IN_2Q_A1OUT;
+      if (q2->a1out_size > q2->kout || __cache_over_budget(cache, cache->weight)) {
+        // remove identifier of Z from the tail of A1out
+        if ((evicted = __cache_victim(cache, &(q2->a1out), &budget, __q2_touch)) == NULL)
+          break;
+        if (!__entry_reclaim(cache, evicted))
+          break;
+        q2->a1out_size--;
+      }
+    } else if (q2->am_size > 0) {
+      // page out the tail of AM.
+      // do not put it on A1out; it hasn't been accessed for a while
+      if ((evicted = __cache_victim(cache, &(q2->am), &budget, __q2_touch)) == NULL)
+        break;
+      if (!__entry_reclaim(cache, evicted))
+        break;
+      q2->am_size--;
+    } else {
+      break;
+    }
+  }
+}
+
 static void __q2_remove (z_cache_t *cache,
                          struct q2_cache *q2,
                          z_cache_entry_t *entry)
@@ -481,7 +847,7 @@ static void __q2_init (z_cache_t *cache, struct q2_cache *q2) {
   z_dlink_init(&(q2->a1out));
 }
 
-static void __policy_2q_update (z_cache_t *cache, z_cache_entry_t *entry) {
+static void __policy_2q_insert (z_cache_t *cache, z_cache_entry_t *entry) {
   struct q2_cache *q2 = &(cache->dpolicy.q2);
   z_lock(&(q2->lock), z_spin, {
     if (entry->state != CACHED_ENTRY_IS_EVICTED) {
@@ -505,10 +871,11 @@ static void __policy_2q_reclaim (z_cache_t *cache) {
   });
 }
 
-static void __policy_2q_init (z_cache_t *cache) {
+static int __policy_2q_init (z_cache_t *cache) {
   struct q2_cache *q2 = &(cache->dpolicy.q2);
   z_spin_alloc(&(q2->lock));
   __q2_init(cache, q2);
+  return(0);
 }
 
 static void __policy_2q_destroy (z_cache_t *cache) {
@@ -554,8 +921,7 @@ static void __policy_2q_dump (FILE *stream, z_cache_t *cache) {
 }
 
 static const z_cache_policy_t __policy_2q = {
-  .insert  = __policy_2q_update,
-  .update  = __policy_2q_update,
+  .insert  = __policy_2q_insert,
   .remove  = __policy_2q_remove,
   .reclaim = __policy_2q_reclaim,
   .init    = __policy_2q_init,
@@ -564,31 +930,622 @@ static const z_cache_policy_t __policy_2q = {
   .type    = Z_CACHE_2Q,
 };
 
+/* ============================================================================
+ *  CLOCK-Pro: an Effective Improvement of the CLOCK Replacement,
+ *  by Song Jiang, Feng Chen and Xiaodong Zhang.
+ *  http://www.usenix.org/event/usenix05/tech/general/full_papers/jiang/jiang.pdf
+ *
+ *  The hot and the cold pages run on two clocks, the tail is the hand and
+ *  the accessed flag is the reference bit, so a hit never moves the entry.
+ *  A new page is cold in its test period: accessed again it turns hot.
+ *  The evicted test pages are remembered as oid hashes in a direct-mapped
+ *  table, a hit there means that the cold clock was too small.
+ */
+#define __clock_pro_hot_target(cache, cp)                           \
+  (((cache)->capacity > (cp)->cold_target) ?                        \
+    ((cache)->capacity - (cp)->cold_target) : 0)
+
+#define __clock_pro_ghost(cp, hash)                                 \
+  ((cp)->ghosts + (((hash) >> 1) & (cp)->ghost_mask))
+
+static void __clock_pro_ghost_add (struct clock_pro_cache *cp, uint64_t oid) {
+  uint64_t hash = z_hash64a(oid) | 1;
+  uint64_t *ghost = __clock_pro_ghost(cp, hash);
+  /* The replaced page ended its test period without an access */
+  if (*ghost != 0 && *ghost != hash && cp->cold_target > 1)
+    cp->cold_target--;
+  *ghost = hash;
+}
+
+static int __clock_pro_ghost_hit (struct clock_pro_cache *cp, uint64_t oid) {
+  uint64_t hash = z_hash64a(oid) | 1;
+  uint64_t *ghost = __clock_pro_ghost(cp, hash);
+  if (*ghost == hash) {
+    *ghost = 0;
+    return(1);
+  }
+  return(0);
+}
+
+static void __clock_pro_insert (z_cache_t *cache,
+                                struct clock_pro_cache *cp,
+                                z_cache_entry_t *entry)
+{
+  if (__clock_pro_ghost_hit(cp, entry->oid)) {
+    /* Back within its test period, the cold clock needs more room */
+    if (cp->cold_target < cache->capacity)
+      cp->cold_target++;
+    z_dlink_add(&(cp->hot), &(entry->cache));
+    cp->hot_size++;
+    entry->state = CACHED_ENTRY_IS_CLOCK_HOT;
+  } else {
+    /* add to the head of the cold clock, in its test period */
+    z_dlink_add(&(cp->cold), &(entry->cache));
+    cp->cold_size++;
+    entry->state = CACHED_ENTRY_IS_CLOCK_TEST;
+  }
+}
+
+/* Apply a hit deferred by the lookup, clock-pro lock held */
+static void __clock_pro_touch (z_cache_t *cache, z_cache_entry_t *entry) {
+  struct clock_pro_cache *cp = &(cache->dpolicy.clock_pro);
+  switch (entry->state) {
+    case CACHED_ENTRY_IS_CLOCK_HOT:
+      z_dlink_move(&(cp->hot), &(entry->cache));
+      break;
+    case CACHED_ENTRY_IS_CLOCK_TEST:
+      /* accessed in its test period, the page turns hot */
+      z_dlink_move(&(cp->hot), &(entry->cache));
+      cp->cold_size--;
+      cp->hot_size++;
+      entry->state = CACHED_ENTRY_IS_CLOCK_HOT;
+      break;
+    case CACHED_ENTRY_IS_CLOCK_COLD:
+      /* a new test period starts */
+      z_dlink_move(&(cp->cold), &(entry->cache));
+      entry->state = CACHED_ENTRY_IS_CLOCK_TEST;
+      break;
+  }
+}
+
+/* Run the hot hand until a page is demoted to the cold clock */
+static int __clock_pro_run_hand_hot (struct clock_pro_cache *cp, int *budget) {
+  while (cp->hot_size > 0) {
+    z_cache_entry_t *entry = z_dlink_entry(cp->hot.prev, z_cache_entry_t, cache);
+
+    if (__entry_touched(entry, budget)) {
+      z_dlink_move(&(cp->hot), &(entry->cache));
+      continue;
+    }
+
+    z_dlink_move(&(cp->cold), &(entry->cache));
+    cp->hot_size--;
+    cp->cold_size++;
+    entry->state = CACHED_ENTRY_IS_CLOCK_COLD;
+    return(1);
+  }
+  return(0);
+}
+
+static void __clock_pro_reclaim (z_cache_t *cache, struct clock_pro_cache *cp) {
+  int budget = __CACHE_TOUCH_BUDGET;
+  z_cache_entry_t *evicted;
+  int demoted = 0;
+
+  while (__cache_is_full(cache, cache->usage, cache->weight)) {
+    uint64_t oid;
+    int in_test;
+
+    if (cp->hot_size > __clock_pro_hot_target(cache, cp))
+      __clock_pro_run_hand_hot(cp, &budget);
+
+    evicted = __cache_victim(cache, &(cp->cold), &budget, __clock_pro_touch);
+    if (evicted == NULL) {
+      /*
+       * The cold pages are pinned, demote the hot ones and look once more.
+       * They reach the cold hand in hot clock order, behind the pinned ones.
+       */
+      if (demoted++ || !__clock_pro_run_hand_hot(cp, &budget))
+        break;
+      while (__clock_pro_run_hand_hot(cp, &budget));
+      continue;
+    }
+
+    /* The reclaimed entry may be freed already */
+    in_test = (evicted->state == CACHED_ENTRY_IS_CLOCK_TEST);
+    oid = evicted->oid;
+    if (!__entry_reclaim(cache, evicted))
+      break;
+
+    cp->cold_size--;
+    if (in_test)
+      __clock_pro_ghost_add(cp, oid);
+  }
+}
+
+static void __clock_pro_remove (z_cache_t *cache,
+                                struct clock_pro_cache *cp,
+                                z_cache_entry_t *entry)
+{
+  switch (entry->state) {
+    case CACHED_ENTRY_IS_CLOCK_HOT:
+      cp->hot_size--;
+      break;
+    case CACHED_ENTRY_IS_CLOCK_COLD:
+    case CACHED_ENTRY_IS_CLOCK_TEST:
+      cp->cold_size--;
+      break;
+  }
+
+  z_dlink_del(&(entry->cache));
+}
+
+static int __clock_pro_init (z_cache_t *cache, struct clock_pro_cache *cp) {
+  uint32_t nghosts;
+
+  nghosts = 64;
+  while (nghosts < cache->capacity)
+    nghosts <<= 1;
+
+  cp->ghosts = z_memory_array_alloc(z_global_memory(), uint64_t, nghosts);
+  if (Z_MALLOC_IS_NULL(cp->ghosts))
+    return(1);
+
+  z_memzero(cp->ghosts, nghosts * sizeof(uint64_t));
+  cp->ghost_mask = nghosts - 1;
+
+  cp->cold_target = z_max(1, cache->capacity / 10);
+  cp->hot_size = 0;
+  cp->cold_size = 0;
+
+  z_dlink_init(&(cp->hot));
+  z_dlink_init(&(cp->cold));
+  return(0);
+}
+
+static void __policy_clock_pro_insert (z_cache_t *cache, z_cache_entry_t *entry) {
+  struct clock_pro_cache *cp = &(cache->dpolicy.clock_pro);
+  z_lock(&(cp->lock), z_spin, {
+    if (entry->state != CACHED_ENTRY_IS_EVICTED) {
+      __clock_pro_insert(cache, cp, entry);
+    }
+  });
+}
+
+static void __policy_clock_pro_remove (z_cache_t *cache, z_cache_entry_t *entry) {
+  struct clock_pro_cache *cp = &(cache->dpolicy.clock_pro);
+  z_lock(&(cp->lock), z_spin, {
+    __clock_pro_remove(cache, cp, entry);
+  });
+  z_cache_release(cache, entry);
+}
+
+static void __policy_clock_pro_reclaim (z_cache_t *cache) {
+  struct clock_pro_cache *cp = &(cache->dpolicy.clock_pro);
+  z_lock(&(cp->lock), z_spin, {
+    __clock_pro_reclaim(cache, cp);
+  });
+}
+
+static int __policy_clock_pro_init (z_cache_t *cache) {
+  struct clock_pro_cache *cp = &(cache->dpolicy.clock_pro);
+  if (__clock_pro_init(cache, cp))
+    return(1);
+  z_spin_alloc(&(cp->lock));
+  return(0);
+}
+
+static void __policy_clock_pro_destroy (z_cache_t *cache) {
+  struct clock_pro_cache *cp = &(cache->dpolicy.clock_pro);
+  z_cache_entry_t *entry;
+  z_spin_free(&(cp->lock));
+  z_dlink_for_each_safe_entry(&(cp->hot), entry, z_cache_entry_t, cache, {
+    z_cache_release(cache, entry);
+  });
+  z_dlink_init(&(cp->hot));
+  z_dlink_for_each_safe_entry(&(cp->cold), entry, z_cache_entry_t, cache, {
+    z_cache_release(cache, entry);
+  });
+  z_dlink_init(&(cp->cold));
+  z_memory_array_free(z_global_memory(), cp->ghosts);
+}
+
+static void __policy_clock_pro_dump (FILE *stream, z_cache_t *cache) {
+  struct clock_pro_cache *cp = &(cache->dpolicy.clock_pro);
+  z_cache_entry_t *entry;
+  fprintf(stream, "CLOCK-PRO CACHE\n");
+  fprintf(stream, " - hot_size:    %"PRIu32"\n", cp->hot_size);
+  fprintf(stream, " - cold_size:   %"PRIu32"\n", cp->cold_size);
+  fprintf(stream, " - cold_target: %"PRIu32"\n", cp->cold_target);
+  fprintf(stream, " - hot: ");
+  z_dlink_for_each_entry(&(cp->hot), entry, z_cache_entry_t, cache, {
+    fprintf(stream, "%"PRIu64" -> ", entry->oid);
+  });
+  fprintf(stream, "X\n");
+  fprintf(stream, " - cold: ");
+  z_dlink_for_each_entry(&(cp->cold), entry, z_cache_entry_t, cache, {
+    fprintf(stream, "%"PRIu64"%s -> ", entry->oid,
+            (entry->state == CACHED_ENTRY_IS_CLOCK_TEST) ? "t" : "");
+  });
+  fprintf(stream, "X\n");
+}
+
+static const z_cache_policy_t __policy_clock_pro = {
+  .insert  = __policy_clock_pro_insert,
+  .remove  = __policy_clock_pro_remove,
+  .reclaim = __policy_clock_pro_reclaim,
+  .init    = __policy_clock_pro_init,
+  .destroy = __policy_clock_pro_destroy,
+  .dump    = __policy_clock_pro_dump,
+  .type    = Z_CACHE_CLOCK_PRO,
+};
+
+/* ============================================================================
+ *  W-TinyLFU: "TinyLFU: A Highly Efficient Cache Admission Policy",
+ *  by Gil Einziger, Roy Friedman and Ben Manes.
+ *  http://arxiv.org/abs/1512.00727
+ *
+ *  The new entries land on a small LRU window, the main is a segmented LRU
+ *  (probation and protected). The tail of the window enters the main only
+ *  if it was seen more often than the probation victim, the frequencies
+ *  are estimated by a count-min sketch of 4-bit counters halved every
+ *  sample period. A one-shot scan stays in the window and never pushes
+ *  the hot entries out of the main.
+ */
+#define __TINYLFU_SKETCH_DEPTH      (4)
+#define __TINYLFU_COUNTER_MAX       (15)
+
+#define __tinylfu_main_max(cache, lfu)                              \
+  (((cache)->capacity > (lfu)->window_max) ?                        \
+    ((cache)->capacity - (lfu)->window_max) : 0)
+
+static uint8_t *__tinylfu_counter (struct tinylfu_cache *lfu,
+                                   uint64_t hash,
+                                   unsigned int row)
+{
+  uint32_t h1 = (uint32_t)hash;
+  uint32_t h2 = (uint32_t)(hash >> 32) | 1;
+  uint32_t width = lfu->sketch_mask + 1;
+  return(lfu->sketch + (row * width) + ((h1 + row * h2) & lfu->sketch_mask));
+}
+
+static void __tinylfu_increment (struct tinylfu_cache *lfu, uint64_t oid) {
+  uint64_t hash = z_hash64a(oid);
+  unsigned int i;
+
+  for (i = 0; i < __TINYLFU_SKETCH_DEPTH; ++i) {
+    uint8_t *counter = __tinylfu_counter(lfu, hash, i);
+    if (*counter < __TINYLFU_COUNTER_MAX)
+      *counter += 1;
+  }
+
+  /* Aging, the old frequencies are halved */
+  if (++lfu->sketch_count >= lfu->sketch_period) {
+    uint32_t count = __TINYLFU_SKETCH_DEPTH * (lfu->sketch_mask + 1);
+    uint8_t *counter = lfu->sketch;
+    while (count--) {
+      *counter++ >>= 1;
+    }
+    lfu->sketch_count >>= 1;
+  }
+}
+
+static unsigned int __tinylfu_estimate (struct tinylfu_cache *lfu, uint64_t oid) {
+  uint64_t hash = z_hash64a(oid);
+  unsigned int freq = __TINYLFU_COUNTER_MAX;
+  unsigned int i;
+
+  for (i = 0; i < __TINYLFU_SKETCH_DEPTH; ++i) {
+    freq = z_min(freq, *__tinylfu_counter(lfu, hash, i));
+  }
+  return(freq);
+}
+
+static void __tinylfu_insert (z_cache_t *cache,
+                              struct tinylfu_cache *lfu,
+                              z_cache_entry_t *entry)
+{
+  /* add to the head of the window */
+  __tinylfu_increment(lfu, entry->oid);
+  z_dlink_add(&(lfu->window), &(entry->cache));
+  lfu->window_size++;
+  entry->state = CACHED_ENTRY_IS_LFU_WINDOW;
+}
+
+/* Apply a hit deferred by the lookup, tinylfu lock held */
+static void __tinylfu_touch (z_cache_t *cache, z_cache_entry_t *entry) {
+  struct tinylfu_cache *lfu = &(cache->dpolicy.tinylfu);
+
+  __tinylfu_increment(lfu, entry->oid);
+  switch (entry->state) {
+    case CACHED_ENTRY_IS_LFU_WINDOW:
+      z_dlink_move(&(lfu->window), &(entry->cache));
+      break;
+    case CACHED_ENTRY_IS_LFU_PROBATION:
+      /* promote to the head of protected */
+      z_dlink_move(&(lfu->protect), &(entry->cache));
+      lfu->probation_size--;
+      lfu->protected_size++;
+      entry->state = CACHED_ENTRY_IS_LFU_PROTECTED;
+
+      /* protected is full, its tail goes back on probation */
+      while (lfu->protected_size > lfu->protected_max) {
+        z_cache_entry_t *demoted;
+        demoted = z_dlink_entry(lfu->protect.prev, z_cache_entry_t, cache);
+        z_dlink_move(&(lfu->probation), &(demoted->cache));
+        lfu->protected_size--;
+        lfu->probation_size++;
+        demoted->state = CACHED_ENTRY_IS_LFU_PROBATION;
+      }
+      break;
+    case CACHED_ENTRY_IS_LFU_PROTECTED:
+      z_dlink_move(&(lfu->protect), &(entry->cache));
+      break;
+  }
+}
+
+/* The window tail moves to the head of probation */
+static void __tinylfu_admit (struct tinylfu_cache *lfu, z_cache_entry_t *entry) {
+  z_dlink_move(&(lfu->probation), &(entry->cache));
+  lfu->window_size--;
+  lfu->probation_size++;
+  entry->state = CACHED_ENTRY_IS_LFU_PROBATION;
+}
+
+static int __tinylfu_evict (z_cache_t *cache,
+                            struct tinylfu_cache *lfu,
+                            z_cache_entry_t *entry)
+{
+  uint16_t state = entry->state;
+
+  if (!__entry_reclaim(cache, entry))
+    return(0);
+
+  switch (state) {
+    case CACHED_ENTRY_IS_LFU_WINDOW:
+      lfu->window_size--;
+      break;
+    case CACHED_ENTRY_IS_LFU_PROBATION:
+      lfu->probation_size--;
+      break;
+    case CACHED_ENTRY_IS_LFU_PROTECTED:
+      lfu->protected_size--;
+      break;
+  }
+  return(1);
+}
+
+static void __tinylfu_reclaim (z_cache_t *cache, struct tinylfu_cache *lfu) {
+  int budget = __CACHE_TOUCH_BUDGET;
+
+  while (__cache_is_full(cache, cache->usage, cache->weight)) {
+    z_cache_entry_t *candidate = NULL;
+    z_cache_entry_t *victim;
+
+    if (lfu->window_size > lfu->window_max) {
+      candidate = __cache_victim(cache, &(lfu->window), &budget, __tinylfu_touch);
+
+      /* the main is not full yet, nothing to compare with */
+      if (candidate != NULL &&
+          (lfu->probation_size + lfu->protected_size) < __tinylfu_main_max(cache, lfu))
+      {
+        __tinylfu_admit(lfu, candidate);
+        continue;
+      }
+    }
+
+    victim = __cache_victim(cache, &(lfu->probation), &budget, __tinylfu_touch);
+    if (victim == NULL)
+      victim = __cache_victim(cache, &(lfu->protect), &budget, __tinylfu_touch);
+
+    if (candidate != NULL && victim != NULL) {
+      /* the most frequent stays, on a tie the main wins */
+      if (__tinylfu_estimate(lfu, candidate->oid) > __tinylfu_estimate(lfu, victim->oid))
+        __tinylfu_admit(lfu, candidate);
+      else
+        victim = candidate;
+    } else if (candidate != NULL) {
+      victim = candidate;
+    } else if (victim == NULL) {
+      victim = __cache_victim(cache, &(lfu->window), &budget, __tinylfu_touch);
+      if (victim == NULL)
+        break;
+    }
+
+    if (!__tinylfu_evict(cache, lfu, victim))
+      break;
+  }
+}
+
+static void __tinylfu_remove (z_cache_t *cache,
+                              struct tinylfu_cache *lfu,
+                              z_cache_entry_t *entry)
+{
+  switch (entry->state) {
+    case CACHED_ENTRY_IS_LFU_WINDOW:
+      lfu->window_size--;
+      break;
+    case CACHED_ENTRY_IS_LFU_PROBATION:
+      lfu->probation_size--;
+      break;
+    case CACHED_ENTRY_IS_LFU_PROTECTED:
+      lfu->protected_size--;
+      break;
+  }
+
+  z_dlink_del(&(entry->cache));
+}
+
+static int __tinylfu_init (z_cache_t *cache, struct tinylfu_cache *lfu) {
+  uint32_t width;
+
+  width = 64;
+  while (width < cache->capacity)
+    width <<= 1;
+
+  lfu->sketch = z_memory_array_alloc(z_global_memory(), uint8_t,
+                                     __TINYLFU_SKETCH_DEPTH * width);
+  if (Z_MALLOC_IS_NULL(lfu->sketch))
+    return(1);
+
+  z_memzero(lfu->sketch, __TINYLFU_SKETCH_DEPTH * width);
+  lfu->sketch_mask = width - 1;
+  lfu->sketch_count = 0;
+  lfu->sketch_period = 10 * width;
+
+  /* 1% window, the main is 20% probation and 80% protected */
+  lfu->window_max = z_max(1, cache->capacity / 100);
+  lfu->protected_max = (__tinylfu_main_max(cache, lfu) * 4) / 5;
+
+  lfu->window_size = 0;
+  lfu->probation_size = 0;
+  lfu->protected_size = 0;
+
+  z_dlink_init(&(lfu->window));
+  z_dlink_init(&(lfu->probation));
+  z_dlink_init(&(lfu->protect));
+  return(0);
+}
+
+static void __policy_tinylfu_insert (z_cache_t *cache, z_cache_entry_t *entry) {
+  struct tinylfu_cache *lfu = &(cache->dpolicy.tinylfu);
+  z_lock(&(lfu->lock), z_spin, {
+    if (entry->state != CACHED_ENTRY_IS_EVICTED) {
+      __tinylfu_insert(cache, lfu, entry);
+    }
+  });
+}
+
+static void __policy_tinylfu_remove (z_cache_t *cache, z_cache_entry_t *entry) {
+  struct tinylfu_cache *lfu = &(cache->dpolicy.tinylfu);
+  z_lock(&(lfu->lock), z_spin, {
+    __tinylfu_remove(cache, lfu, entry);
+  });
+  z_cache_release(cache, entry);
+}
+
+static void __policy_tinylfu_reclaim (z_cache_t *cache) {
+  struct tinylfu_cache *lfu = &(cache->dpolicy.tinylfu);
+  z_lock(&(lfu->lock), z_spin, {
+    __tinylfu_reclaim(cache, lfu);
+  });
+}
+
+static int __policy_tinylfu_init (z_cache_t *cache) {
+  struct tinylfu_cache *lfu = &(cache->dpolicy.tinylfu);
+  if (__tinylfu_init(cache, lfu))
+    return(1);
+  z_spin_alloc(&(lfu->lock));
+  return(0);
+}
+
+static void __policy_tinylfu_destroy (z_cache_t *cache) {
+  struct tinylfu_cache *lfu = &(cache->dpolicy.tinylfu);
+  z_cache_entry_t *entry;
+  z_spin_free(&(lfu->lock));
+  z_dlink_for_each_safe_entry(&(lfu->protect), entry, z_cache_entry_t, cache, {
+    z_cache_release(cache, entry);
+  });
+  z_dlink_init(&(lfu->protect));
+  z_dlink_for_each_safe_entry(&(lfu->probation), entry, z_cache_entry_t, cache, {
+    z_cache_release(cache, entry);
+  });
+  z_dlink_init(&(lfu->probation));
+  z_dlink_for_each_safe_entry(&(lfu->window), entry, z_cache_entry_t, cache, {
+    z_cache_release(cache, entry);
+  });
+  z_dlink_init(&(lfu->window));
+  z_memory_array_free(z_global_memory(), lfu->sketch);
+}
+
+static void __policy_tinylfu_dump (FILE *stream, z_cache_t *cache) {
+  struct tinylfu_cache *lfu = &(cache->dpolicy.tinylfu);
+  z_cache_entry_t *entry;
+  fprintf(stream, "W-TINYLFU CACHE\n");
+  fprintf(stream, " - window_size:    %"PRIu32"\n", lfu->window_size);
+  fprintf(stream, " - probation_size: %"PRIu32"\n", lfu->probation_size);
+  fprintf(stream, " - protected_size: %"PRIu32"\n", lfu->protected_size);
+  fprintf(stream, " - window: ");
+  z_dlink_for_each_entry(&(lfu->window), entry, z_cache_entry_t, cache, {
+    fprintf(stream, "%"PRIu64" -> ", entry->oid);
+  });
+  fprintf(stream, "X\n");
+  fprintf(stream, " - probation: ");
+  z_dlink_for_each_entry(&(lfu->probation), entry, z_cache_entry_t, cache, {
+    fprintf(stream, "%"PRIu64" -> ", entry->oid);
+  });
+  fprintf(stream, "X\n");
+  fprintf(stream, " - protected: ");
+  z_dlink_for_each_entry(&(lfu->protect), entry, z_cache_entry_t, cache, {
+    fprintf(stream, "%"PRIu64" -> ", entry->oid);
+  });
+  fprintf(stream, "X\n");
+}
+
+static const z_cache_policy_t __policy_tinylfu = {
+  .insert  = __policy_tinylfu_insert,
+  .remove  = __policy_tinylfu_remove,
+  .reclaim = __policy_tinylfu_reclaim,
+  .init    = __policy_tinylfu_init,
+  .destroy = __policy_tinylfu_destroy,
+  .dump    = __policy_tinylfu_dump,
+  .type    = Z_CACHE_TINYLFU,
+};
+
 /* ===========================================================================
  *  Cache
  */
+/* A hit never writes the policy queues, the reclaim applies it */
+#define __cache_entry_touch(entry)                                  \
+  do {                                                              \
+    if (!(entry)->accessed)                                         \
+      (entry)->accessed = 1;                                        \
+  } while (0)
+
 z_cache_t *z_cache_alloc (z_cache_type_t type,
                           unsigned int capacity,
                           z_mem_free_t entry_free,
                           z_cache_evict_t entry_evict,
                           void *user_data)
 {
+  z_memory_t *memory = z_global_memory();
   z_cache_t *cache;
+  unsigned int i;
 
-  cache = z_memory_struct_alloc(z_global_memory(), z_cache_t);
+  cache = z_memory_struct_alloc(memory, z_cache_t);
   if (Z_MALLOC_IS_NULL(cache))
     return(NULL);
 
-  cache->hit = 0;
-  cache->miss = 0;
+  /* One slot per cpu, plus one shared by the other threads */
+  cache->ncpus = z_global_context_ncpus();
+  cache->cpus = z_memory_array_alloc(memory, struct cache_cpu, cache->ncpus + 1);
+  if (Z_MALLOC_IS_NULL(cache->cpus)) {
+    z_memory_struct_free(memory, z_cache_t, cache);
+    return(NULL);
+  }
+
+  for (i = 0; i <= cache->ncpus; ++i) {
+    cache->cpus[i].readers[0] = 0;
+    cache->cpus[i].readers[1] = 0;
+    cache->cpus[i].hit = 0;
+    cache->cpus[i].miss = 0;
+  }
+
   cache->capacity = capacity;
   cache->usage = 0;
+  cache->weight = 0;
+  cache->budget = 0;
 
   cache->entry_free = entry_free;
   cache->entry_evict = entry_evict;
   cache->user_data = user_data;
 
-  __htable_open(&(cache->table), capacity);
+  __gc_open(&(cache->gc));
+  if (__htable_open(&(cache->table), capacity)) {
+    z_memory_array_free(memory, cache->cpus);
+    z_memory_struct_free(memory, z_cache_t, cache);
+    return(NULL);
+  }
 
   switch (type) {
     case Z_CACHE_LRU:
@@ -597,38 +1554,81 @@ z_cache_t *z_cache_alloc (z_cache_type_t type,
     case Z_CACHE_2Q:
       cache->vpolicy = &__policy_2q;
       break;
+    case Z_CACHE_CLOCK_PRO:
+      cache->vpolicy = &__policy_clock_pro;
+      break;
+    case Z_CACHE_TINYLFU:
+      cache->vpolicy = &__policy_tinylfu;
+      break;
   }
 
-  cache->vpolicy->init(cache);
+  if (cache->vpolicy->init(cache)) {
+    __gc_close(cache);
+    __htable_close(&(cache->table));
+    z_memory_array_free(memory, cache->cpus);
+    z_memory_struct_free(memory, z_cache_t, cache);
+    return(NULL);
+  }
   return(cache);
 }
 
 void z_cache_free (z_cache_t *cache) {
+  z_memory_t *memory = z_global_memory();
   cache->vpolicy->destroy(cache);
+  __gc_close(cache);
   __htable_close(&(cache->table));
-  z_memory_struct_free(z_global_memory(), z_cache_t, cache);
+  z_memory_array_free(memory, cache->cpus);
+  z_memory_struct_free(memory, z_cache_t, cache);
 }
 
 void z_cache_release (z_cache_t *cache, z_cache_entry_t *entry) {
   Z_ASSERT(entry->refs > 0, "Entry already unreferenced");
-  if (z_atomic_dec(&(entry->refs)) == 0) {
-    Z_LOG_TRACE("Cache Release %"PRIu64, entry->oid);
-    z_atomic_dec(&(cache->usage));
-    if (cache->entry_free != NULL)
-      cache->entry_free(cache->user_data, entry);
+  if (z_atomic_dec(&(entry->refs)) == 0)
+    __entry_retire(cache, entry);
+}
+
+/*
+ * The caller holds a reference to the cached entry,
+ * a heavier entry may push the cache over the budget.
+ * Concurrent updates of the same entry are accounted one by one.
+ */
+void z_cache_entry_set_weight (z_cache_t *cache,
+                               z_cache_entry_t *entry,
+                               uint64_t weight)
+{
+  uint64_t old_weight;
+
+  do {
+    old_weight = z_atomic_load(&(entry->weight));
+    if (weight == old_weight)
+      return;
+  } while (!z_atomic_cas(&(entry->weight), old_weight, weight));
+
+  if (weight > old_weight) {
+    uint64_t delta = weight - old_weight;
+    uint64_t total = z_atomic_add_and_fetch(&(cache->weight), delta);
+    /* Reclaim once on crossing the budget, the inserts retry later */
+    if (__cache_over_budget(cache, total) && (total - delta) <= cache->budget)
+      cache->vpolicy->reclaim(cache);
+  } else {
+    z_atomic_sub_and_fetch(&(cache->weight), old_weight - weight);
   }
 }
 
 z_cache_entry_t *z_cache_try_insert (z_cache_t *cache, z_cache_entry_t *entry) {
+  struct cache_cpu *cpu = __cache_cpu(cache);
   z_cache_entry_t *old;
 
-  old = __htable_try_insert(&(cache->table), entry);
+  /* Accounted before a lookup can find it and change the weight */
+  z_atomic_add_and_fetch(&(cache->weight), entry->weight);
+  old = __htable_try_insert(cache, entry);
   if (old != NULL) {
-    z_atomic_inc(&(cache->hit));
-    cache->vpolicy->update(cache, entry);
+    z_atomic_sub_and_fetch(&(cache->weight), entry->weight);
+    z_atomic_inc(&(cpu->hit));
+    __cache_entry_touch(old);
   } else {
     cache->vpolicy->insert(cache, entry);
-    z_atomic_inc(&(cache->miss));
+    z_atomic_inc(&(cpu->miss));
     z_atomic_inc(&(cache->usage));
     cache->vpolicy->reclaim(cache);
   }
@@ -639,11 +1639,8 @@ z_cache_entry_t *z_cache_try_insert (z_cache_t *cache, z_cache_entry_t *entry) {
 z_cache_entry_t *z_cache_lookup (z_cache_t *cache, uint64_t oid) {
   z_cache_entry_t *entry;
 
-  if ((entry = __htable_lookup(&(cache->table), oid)) != NULL) {
-    cache->vpolicy->update(cache, entry);
-    z_atomic_inc(&(cache->hit));
-  } else {
-    z_atomic_inc(&(cache->miss));
+  if ((entry = __htable_lookup(cache, oid)) != NULL) {
+    __cache_entry_touch(entry);
   }
   return(entry);
 }
@@ -662,13 +1659,33 @@ void z_cache_reclaim (z_cache_t *cache, unsigned int capacity) {
   cache->vpolicy->reclaim(cache);
 }
 
+/* Zero means no budget, only the entries capacity is used */
+void z_cache_budget (z_cache_t *cache, uint64_t budget) {
+  cache->budget = budget;
+  cache->vpolicy->reclaim(cache);
+}
+
+uint64_t z_cache_weight (z_cache_t *cache) {
+  return(z_atomic_load(&(cache->weight)));
+}
+
 void z_cache_dump (FILE *stream, z_cache_t *cache) {
+  uint64_t hit = 0, miss = 0;
+  unsigned int i;
+
+  for (i = 0; i <= cache->ncpus; ++i) {
+    hit += cache->cpus[i].hit;
+    miss += cache->cpus[i].miss;
+  }
+
   cache->vpolicy->dump(stream, cache);
   fprintf(stream,
           " - hit %"PRIu64" miss %"PRIu64" (%.2f hit)\n"
           " - htable used %"PRIu32" size %"PRIu32"\n"
-          " - usage %"PRIu32" capacity %"PRIu32"\n\n",
-          cache->hit, cache->miss, (double)cache->hit / (cache->hit + cache->miss),
-          cache->table.used, cache->table.size,
-          cache->usage, cache->capacity);
+          " - usage %"PRIu32" capacity %"PRIu32"\n"
+          " - weight %"PRIu64" budget %"PRIu64"\n\n",
+          hit, miss, (double)hit / (hit + miss),
+          cache->table.used, cache->table.buckets->size,
+          cache->usage, cache->capacity,
+          cache->weight, cache->budget);
 }
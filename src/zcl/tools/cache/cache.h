@@ -29,33 +29,47 @@ Z_TYPEDEF_STRUCT(z_cache_entry)
 Z_TYPEDEF_STRUCT(z_cache_policy)
 Z_TYPEDEF_STRUCT(z_cache)
 
+/*
+ * Called before an entry is evicted: return > 0 to evict it, < 0 to keep
+ * it and look at the next candidate, 0 to stop the reclaim.
+ * The entries referenced out of the cache are pinned, never evicted.
+ */
 typedef int (*z_cache_evict_t) (void *udata,
                                 unsigned int size,
                                 z_cache_entry_t *entry);
 
+/*
+ * The lookups are lock-free, a released entry is handed to the free
+ * callback once no reader can see it anymore. A hit only marks the entry
+ * as accessed, the policy applies it when the entry reaches the reclaim.
+ * The weight is the entry footprint (1 by default), with a budget set the
+ * reclaim runs until both the entries and the total weight fit.
+ */
 struct z_cache_entry {
   z_cache_entry_t *hash;
   z_dlink_node_t cache;
 
   uint64_t oid;
+  uint64_t weight;
   uint32_t refs;
-  uint32_t state;
+  uint16_t state;
+  uint16_t accessed;
 };
 
 enum z_cache_type {
   Z_CACHE_LRU,
   Z_CACHE_2Q,
+  Z_CACHE_CLOCK_PRO,      /* hot/cold clocks, hits only set the ref-bit */
+  Z_CACHE_TINYLFU,        /* frequency admission, scan resistant */
 };
 
 struct z_cache_policy {
   void (*insert)  (z_cache_t *cache,
                    z_cache_entry_t *entry);
-  void (*update)  (z_cache_t *cache,
-                   z_cache_entry_t *entry);
   void (*remove)  (z_cache_t *cache,
                    z_cache_entry_t *entry);
   void (*reclaim) (z_cache_t *cache);
-  void (*init)    (z_cache_t *cache);
+  int  (*init)    (z_cache_t *cache);
   void (*destroy) (z_cache_t *cache);
   void (*dump)    (FILE *stream, z_cache_t *cache);
 
@@ -66,6 +80,9 @@ struct z_cache_policy {
 
 void              z_cache_entry_init (z_cache_entry_t *entry,
                                       uint64_t oid);
+void              z_cache_entry_set_weight (z_cache_t *cache,
+                                            z_cache_entry_t *entry,
+                                            uint64_t weight);
 
 z_cache_t *       z_cache_alloc      (z_cache_type_t type,
                                       unsigned int capacity,
@@ -78,6 +95,8 @@ z_cache_entry_t * z_cache_try_insert (z_cache_t *cache, z_cache_entry_t *entry);
 z_cache_entry_t * z_cache_lookup     (z_cache_t *cache, uint64_t oid);
 z_cache_entry_t * z_cache_remove     (z_cache_t *cache, uint64_t oid);
 void              z_cache_reclaim    (z_cache_t *cache, unsigned int capacity);
+void              z_cache_budget     (z_cache_t *cache, uint64_t budget);
+uint64_t          z_cache_weight     (z_cache_t *cache);
 void              z_cache_dump       (FILE *stream, z_cache_t *cache);
 __Z_END_DECLS__
 
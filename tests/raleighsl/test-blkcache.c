@@ -0,0 +1,240 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/string.h>
+#include <zcl/debug.h>
+
+#include "test-fs.h"
+
+#define __DEVICE_SIZE       (192 << 20)
+#define __BLOCK             RALEIGHSL_BLKCACHE_BLOCK_SIZE
+#define __SHARDS            RALEIGHSL_BLKCACHE_SHARDS
+
+/* The last 32MiB of the device are not used by the file-system */
+#define __AREA_OFFSET       (__DEVICE_SIZE - (32 << 20))
+#define __AREA_BLKNO        (__AREA_OFFSET / __BLOCK)
+
+/* The k-th block of the area that falls in shard 0 */
+#define __shard_block(k)                                                    \
+  ((z_align_up(__AREA_BLKNO, __SHARDS) + (k) * __SHARDS) * __BLOCK)
+
+#define __MAX_WRITES        64
+#define __NDIRTY            5
+
+static raleighsl_device_plug_t __device_plug;
+
+static uint64_t __writes[__MAX_WRITES];
+static unsigned int __nwrites;
+static unsigned int __nreads;
+
+/* ============================================================================
+ *  Device wrapper, counts the reads and logs the writes of the test area
+ */
+static raleighsl_errno_t __device_read (raleighsl_t *fs,
+                                        uint64_t offset,
+                                        void *buffer,
+                                        unsigned int size)
+{
+  if (offset >= __AREA_OFFSET)
+    __nreads++;
+  return(raleighsl_device_file.read(fs, offset, buffer, size));
+}
+
+static raleighsl_errno_t __device_write (raleighsl_t *fs,
+                                         uint64_t offset,
+                                         const void *buffer,
+                                         unsigned int size)
+{
+  if (offset >= __AREA_OFFSET && __nwrites < __MAX_WRITES)
+    __writes[__nwrites++] = offset;
+  return(raleighsl_device_file.write(fs, offset, buffer, size));
+}
+
+/* ============================================================================
+ *  Tests
+ */
+static uint64_t __shard_weight (void) {
+  return(z_cache_weight(__fs.blkcache.shards[0].cache));
+}
+
+static int __read_released (uint64_t offset) {
+  raleighsl_block_t *block;
+  raleighsl_errno_t errno;
+  if ((errno = raleighsl_blkcache_read(&__fs, offset, &block))) {
+    fprintf(stderr, "read %"PRIu64": %s\n", offset, raleighsl_errno_string(errno));
+    return(1);
+  }
+  raleighsl_blkcache_release(&__fs, block);
+  return(0);
+}
+
+/*
+ * The pinned blocks survive a scan larger than the shard,
+ * once released the shard goes back within the budget.
+ */
+static int __test_pin_evict (z_test_t *test) {
+  raleighsl_block_t *pinned[3];
+  raleighsl_block_t *block;
+  unsigned int nreads;
+  int i;
+
+  for (i = 0; i < 3; ++i) {
+    if (raleighsl_blkcache_read(&__fs, __shard_block(i), &pinned[i]))
+      return(1);
+    /* Not dirty, lost if the block is read again from the device */
+    pinned[i]->data[0] = 0xa0 + i;
+  }
+
+  for (i = 3; i < 40; ++i) {
+    if (__read_released(__shard_block(i)))
+      return(1);
+  }
+
+  nreads = __nreads;
+  for (i = 0; i < 3; ++i) {
+    if (raleighsl_blkcache_read(&__fs, __shard_block(i), &block))
+      return(1);
+    if (block != pinned[i] || block->data[0] != 0xa0 + i) {
+      fprintf(stderr, "pin: block %d evicted while pinned\n", i);
+      return(1);
+    }
+    raleighsl_blkcache_release(&__fs, block);
+  }
+  if (__nreads != nreads) {
+    fprintf(stderr, "pin: pinned block read from the device\n");
+    return(1);
+  }
+
+  for (i = 0; i < 3; ++i) {
+    raleighsl_blkcache_release(&__fs, pinned[i]);
+  }
+
+  for (i = 40; i < 80; ++i) {
+    if (__read_released(__shard_block(i)))
+      return(1);
+  }
+
+  if (__shard_weight() > 2) {
+    fprintf(stderr, "budget: %"PRIu64" blocks cached, 2 expected\n", __shard_weight());
+    return(1);
+  }
+
+  /* The first ones are gone and read back from the device */
+  nreads = __nreads;
+  if (__read_released(__shard_block(0)) || __nreads != nreads + 1) {
+    fprintf(stderr, "evict: block 0 still cached\n");
+    return(1);
+  }
+  return(0);
+}
+
+/*
+ * Dirty blocks stay cached until the checkpoint writes them back,
+ * in block order, then they can be evicted.
+ */
+static int __test_dirty_writeback (z_test_t *test) {
+  static const int order[__NDIRTY] = {7, 2, 9, 4, 0};
+  raleighsl_block_t *block;
+  raleighsl_errno_t errno;
+  uint8_t data[__BLOCK];
+  unsigned int i;
+  int fd;
+
+  for (i = 0; i < __NDIRTY; ++i) {
+    if (raleighsl_blkcache_new(&__fs, __shard_block(100 + order[i]), &block))
+      return(1);
+    z_memset(block->data, 0xd0 + order[i], block->length);
+    raleighsl_blkcache_dirty(&__fs, block);
+    raleighsl_blkcache_release(&__fs, block);
+  }
+
+  /* A scan does not evict the dirty blocks */
+  for (i = 0; i < 40; ++i) {
+    if (__read_released(__shard_block(200 + i)))
+      return(1);
+  }
+
+  __nwrites = 0;
+  if ((errno = raleighsl_sync(&__fs))) {
+    fprintf(stderr, "sync: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  if (__nwrites != __NDIRTY) {
+    fprintf(stderr, "write-back: %u writes, %d expected\n",
+            __nwrites, __NDIRTY);
+    return(1);
+  }
+
+  for (i = 1; i < __nwrites; ++i) {
+    if (__writes[i - 1] >= __writes[i]) {
+      fprintf(stderr, "write-back: not in block order\n");
+      return(1);
+    }
+  }
+
+  fd = __device.fd;
+  for (i = 0; i < __NDIRTY; ++i) {
+    if (pread(fd, data, __BLOCK, __shard_block(100 + order[i])) != __BLOCK ||
+        data[0] != 0xd0 + order[i] || data[__BLOCK - 1] != 0xd0 + order[i])
+    {
+      fprintf(stderr, "write-back: block %d not on disk\n", order[i]);
+      return(1);
+    }
+  }
+
+  /* Written back, the dirty references are dropped */
+  for (i = 0; i < 40; ++i) {
+    if (__read_released(__shard_block(300 + i)))
+      return(1);
+  }
+  if (__shard_weight() > 2) {
+    fprintf(stderr, "write-back: %"PRIu64" blocks cached, 2 expected\n", __shard_weight());
+    return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Main
+ */
+static int __setup (void) {
+  /* The device plug is wrapped once the file-system is created */
+  __device_plug = raleighsl_device_file;
+  __device_plug.read = __device_read;
+  __device_plug.write = __device_write;
+  __device.__base__.plug = &__device_plug;
+  __nwrites = 0;
+  __nreads = 0;
+
+  /* Two blocks per shard */
+  raleighsl_blkcache_budget(&__fs, 2 * __SHARDS * __BLOCK);
+  return(0);
+}
+
+static z_test_t __test_blkcache = {
+  .funcs = {
+    __test_pin_evict,
+    __test_dirty_writeback,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  struct test_fs conf = {
+    .device_size = __DEVICE_SIZE,
+    .setup = __setup,
+  };
+  return(__test_fs_run("Block Cache", &__test_blkcache, &conf));
+}
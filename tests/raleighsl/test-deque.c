@@ -0,0 +1,580 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/threading.h>
+#include <zcl/bytesref.h>
+#include <zcl/string.h>
+#include <zcl/array.h>
+#include <zcl/debug.h>
+#include <zcl/math.h>
+#include <zcl/time.h>
+
+#define TEST_FS_EXEC
+#include "test-fs.h"
+
+#define __DEVICE_SIZE       (64 << 20)
+#define __DEQUE_OID         (1 << 20)
+
+#define __NVALUES           (1 << 16)
+#define __MODEL_SIZE        (1 << 20)
+#define __BATCH_MAX         64
+#define __NWAITERS          4
+
+/* The items point to the values, the pending refs stay valid */
+static uint64_t __values[__NVALUES];
+static uint64_t __next_value;
+static unsigned int __seed;
+
+/* The deque the items are checked against */
+static uint64_t __model[__MODEL_SIZE];
+static uint64_t __model_head;
+static uint64_t __model_count;
+static uint64_t __saved[__MODEL_SIZE];
+
+enum deque_test_op {
+  DEQUE_TEST_PUSH,
+  DEQUE_TEST_PUSH_N,
+  DEQUE_TEST_POP,
+  DEQUE_TEST_POP_N,
+};
+
+struct edits {
+  raleighsl_errno_t errno;
+  int nedits;
+  int (*next_op) (int *front, size_t *count);
+};
+
+/* A parked pop, a gone one refuses the item like a disconnected client */
+struct waiter {
+  raleighsl_deque_waiter_t __waiter__;
+  raleighsl_errno_t errno;
+  uint64_t value;
+  int notified;
+  int is_gone;
+  int order;
+};
+
+static struct waiter __waiters[__NWAITERS];
+static int __nnotified;
+
+/* ============================================================================
+ *  Helpers
+ */
+static size_t __rand (size_t max) {
+  return((max > 0) ? (z_rand(&__seed) % max) : 0);
+}
+
+#define __item_value(n)     ((n) & (__NVALUES - 1))
+
+static void __item_next (z_bytes_ref_t *item) {
+  uint64_t *value = &(__values[__item_value(__next_value++)]);
+  z_bytes_ref_set_data(item, value, sizeof(uint64_t), NULL, NULL);
+}
+
+static void __model_push (int front, const z_bytes_ref_t *item) {
+  uint64_t value = *((const uint64_t *)item->slice.data);
+  if (front) {
+    __model[--__model_head] = value;
+  } else {
+    __model[__model_head + __model_count] = value;
+  }
+  __model_count++;
+}
+
+/* The popped item must be the model one, the ref is released */
+static int __model_pop (int front, z_bytes_ref_t *item) {
+  uint64_t expected;
+  uint64_t value;
+
+  if (front) {
+    expected = __model[__model_head++];
+  } else {
+    expected = __model[__model_head + __model_count - 1];
+  }
+  __model_count--;
+
+  z_memcpy(&value, item->slice.data, sizeof(uint64_t));
+  z_bytes_ref_release(item);
+  if (item->slice.size != sizeof(uint64_t) || value != expected) {
+    fprintf(stderr, "pop %s: %"PRIu64" expected %"PRIu64"\n",
+            front ? "front" : "back", value, expected);
+    return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Deque Edits
+ */
+static raleighsl_errno_t __edit (raleighsl_t *fs,
+                                 raleighsl_transaction_t *transaction,
+                                 raleighsl_object_t *object,
+                                 int op, int front, size_t count)
+{
+  raleighsl_errno_t errno;
+  z_bytes_ref_t item;
+  z_array_t items;
+  size_t i, n;
+
+  switch (op) {
+    case DEQUE_TEST_PUSH:
+      __item_next(&item);
+      if ((errno = raleighsl_deque_push(fs, transaction, object, front, &item)))
+        return(errno);
+      __model_push(front, &item);
+      return(RALEIGHSL_ERRNO_NONE);
+    case DEQUE_TEST_POP:
+      errno = raleighsl_deque_pop(fs, transaction, object, front, &item);
+      if (errno == RALEIGHSL_ERRNO_DATA_NO_ITEMS && __model_count == 0)
+        return(RALEIGHSL_ERRNO_NONE);
+      if (errno)
+        return(errno);
+      return(__model_pop(front, &item) ? RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE : errno);
+  }
+
+  if (z_array_open(&items, sizeof(z_bytes_ref_t)))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  if (op == DEQUE_TEST_PUSH_N) {
+    for (i = 0; i < count; ++i) {
+      __item_next(z_array_push_back(&items));
+    }
+    errno = raleighsl_deque_push_n(fs, transaction, object, front, &items);
+    for (i = 0; !errno && i < count; ++i) {
+      __model_push(front, z_array_get(&items, z_bytes_ref_t, i));
+    }
+  } else {
+    errno = raleighsl_deque_pop_n(fs, transaction, object, front, count, &items);
+    if (errno == RALEIGHSL_ERRNO_DATA_NO_ITEMS && __model_count == 0)
+      errno = RALEIGHSL_ERRNO_NONE;
+
+    n = z_min(count, __model_count);
+    if (!errno && items.count != n) {
+      fprintf(stderr, "pop_n %zu: %zu items expected %zu\n", count, items.count, n);
+      errno = RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE;
+    }
+    for (i = 0; i < items.count; ++i) {
+      z_bytes_ref_t *ref = Z_BYTES_REF(z_array_get_raw(&items, i));
+      if (!errno && __model_pop(front, ref))
+        errno = RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE;
+      else if (errno)
+        z_bytes_ref_release(ref);
+    }
+  }
+  z_array_close(&items);
+  return(errno);
+}
+
+static raleighsl_errno_t __edits_func (raleighsl_t *fs,
+                                       raleighsl_transaction_t *transaction,
+                                       raleighsl_object_t *object,
+                                       void *udata)
+{
+  struct edits *edits = (struct edits *)udata;
+  size_t count;
+  int i, op, front;
+
+  for (i = 0; i < edits->nedits; ++i) {
+    op = edits->next_op(&front, &count);
+    if ((edits->errno = __edit(fs, transaction, object, op, front, count))) {
+      fprintf(stderr, "edit %d: %s\n", op, raleighsl_errno_string(edits->errno));
+      return(edits->errno);
+    }
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static int __edits_exec (uint64_t txn_id, int nedits, int (*next_op) (int *, size_t *)) {
+  raleighsl_errno_t errno;
+  struct edits edits;
+
+  edits.errno = RALEIGHSL_ERRNO_NONE;
+  edits.nedits = nedits;
+  edits.next_op = next_op;
+  errno = __wait(raleighsl_exec_write(&__fs, txn_id, __DEQUE_OID, __edits_func,
+                                      __notify, &edits, NULL));
+  return(errno || edits.errno);
+}
+
+/* Steady size around 64 items, the ring head moves around the map */
+static int __op_wraparound (int *front, size_t *count) {
+  *front = 0;
+  *count = 1 + __rand(__BATCH_MAX);
+  if (__model_count < 64) {
+    return(__rand(2) ? DEQUE_TEST_PUSH_N : DEQUE_TEST_PUSH);
+  }
+  *front = 1;
+  return(__rand(2) ? DEQUE_TEST_POP_N : DEQUE_TEST_POP);
+}
+
+/* Pushes at both ends, the chunk map is grown on either side */
+static int __op_growth (int *front, size_t *count) {
+  *front = __rand(2);
+  *count = 1 + __rand(__BATCH_MAX);
+  return(__rand(4) ? DEQUE_TEST_PUSH_N : DEQUE_TEST_PUSH);
+}
+
+static int __op_random (int *front, size_t *count) {
+  *front = __rand(2);
+  *count = 1 + __rand(__BATCH_MAX);
+  return(__rand(4));
+}
+
+/* Pops everything back, from both the ends */
+static int __op_drain (int *front, size_t *count) {
+  *front = __rand(2);
+  *count = 1 + __rand(__BATCH_MAX * 4);
+  return(DEQUE_TEST_POP_N);
+}
+
+static int __check_empty (const char *label) {
+  while (__model_count > 0) {
+    if (__edits_exec(0, 1, __op_drain)) {
+      fprintf(stderr, "%s: drain failed, %"PRIu64" items left\n", label, __model_count);
+      return(1);
+    }
+  }
+  /* Once more, no items are expected */
+  __model_head = __MODEL_SIZE >> 1;
+  return(__edits_exec(0, 4, __op_drain));
+}
+
+/* ============================================================================
+ *  Deque Waiters
+ */
+static int __waiter_notify (raleighsl_deque_waiter_t *self,
+                            raleighsl_errno_t errno,
+                            const z_bytes_ref_t *data)
+{
+  struct waiter *waiter = z_container_of(self, struct waiter, __waiter__);
+
+  waiter->errno = errno;
+  waiter->notified = 1;
+  waiter->order = __nnotified++;
+  if (waiter->is_gone)
+    return(1);
+
+  if (data != NULL)
+    z_memcpy(&(waiter->value), data->slice.data, sizeof(uint64_t));
+  return(0);
+}
+
+static void __waiter_init (struct waiter *waiter, uint64_t deadline, int is_gone) {
+  z_memzero(waiter, sizeof(struct waiter));
+  waiter->__waiter__.notify = __waiter_notify;
+  waiter->__waiter__.deadline = deadline;
+  waiter->__waiter__.pop_front = 1;
+  waiter->is_gone = is_gone;
+  waiter->order = -1;
+}
+
+static raleighsl_errno_t __pop_wait_func (raleighsl_t *fs,
+                                          raleighsl_transaction_t *transaction,
+                                          raleighsl_object_t *object,
+                                          void *udata)
+{
+  struct waiter *waiter = (struct waiter *)udata;
+  raleighsl_errno_t errno;
+  z_bytes_ref_t data;
+
+  errno = raleighsl_deque_pop_wait(fs, transaction, object, &(waiter->__waiter__), &data);
+  if (!errno) {
+    z_memcpy(&(waiter->value), data.slice.data, sizeof(uint64_t));
+    z_bytes_ref_release(&data);
+  }
+  return(errno);
+}
+
+static raleighsl_errno_t __pop_wait (uint64_t txn_id, struct waiter *waiter) {
+  return(__wait(raleighsl_exec_write(&__fs, txn_id, __DEQUE_OID, __pop_wait_func,
+                                     __notify, waiter, NULL)));
+}
+
+static raleighsl_errno_t __push_func (raleighsl_t *fs,
+                                      raleighsl_transaction_t *transaction,
+                                      raleighsl_object_t *object,
+                                      void *udata)
+{
+  size_t i, count = *((size_t *)udata);
+  raleighsl_errno_t errno;
+  z_bytes_ref_t item;
+
+  for (i = 0; i < count; ++i) {
+    __item_next(&item);
+    if ((errno = raleighsl_deque_push(fs, transaction, object, 0, &item)))
+      return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __push (size_t count) {
+  return(__wait(raleighsl_exec_write(&__fs, 0, __DEQUE_OID, __push_func,
+                                     __notify, &count, NULL)));
+}
+
+static raleighsl_errno_t __expire_func (raleighsl_t *fs,
+                                        raleighsl_transaction_t *transaction,
+                                        raleighsl_object_t *object,
+                                        void *udata)
+{
+  raleighsl_deque_expire(fs, object, *((uint64_t *)udata));
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __expire (uint64_t now) {
+  return(__wait(raleighsl_exec_write(&__fs, 0, __DEQUE_OID, __expire_func,
+                                     __notify, &now, NULL)));
+}
+
+/* ============================================================================
+ *  Tests
+ */
+static int __test_wraparound (z_test_t *test) {
+  int i;
+  for (i = 0; i < 500; ++i) {
+    if (__edits_exec(0, 1 + __rand(8), __op_wraparound)) {
+      fprintf(stderr, "wraparound %d: %"PRIu64" items\n", i, __model_count);
+      return(1);
+    }
+  }
+  return(__check_empty("wraparound"));
+}
+
+static int __test_growth (z_test_t *test) {
+  int i;
+  for (i = 0; i < 200; ++i) {
+    if (__edits_exec(0, 1 + __rand(8), __op_growth)) {
+      fprintf(stderr, "growth %d: %"PRIu64" items\n", i, __model_count);
+      return(1);
+    }
+  }
+  return(__check_empty("growth"));
+}
+
+static int __test_random (z_test_t *test) {
+  int i;
+  for (i = 0; i < 500; ++i) {
+    if (__edits_exec(0, 1 + __rand(16), __op_random)) {
+      fprintf(stderr, "random %d: %"PRIu64" items\n", i, __model_count);
+      return(1);
+    }
+  }
+  return(0);
+}
+
+/* The rollback drops the pending pushes and gives the pops back */
+static int __test_revert (z_test_t *test) {
+  uint64_t head, count;
+  raleighsl_errno_t errno;
+  uint64_t txn_id;
+  int i;
+
+  /* Some committed items to give back */
+  if (__test_random(test))
+    return(1);
+
+  for (i = 0; i < 20; ++i) {
+    if ((errno = raleighsl_transaction_create(&__fs, &txn_id))) {
+      fprintf(stderr, "revert: txn create %s\n", raleighsl_errno_string(errno));
+      return(1);
+    }
+
+    head = __model_head;
+    count = __model_count;
+    z_memcpy(__saved, __model + head, count * sizeof(uint64_t));
+    if (__edits_exec(txn_id, 1 + __rand(16), __op_random)) {
+      fprintf(stderr, "revert %d: %"PRIu64" items\n", i, __model_count);
+      return(1);
+    }
+
+    if ((errno = __wait(raleighsl_exec_txn_rollback(&__fs, txn_id, __notify, NULL, NULL)))) {
+      fprintf(stderr, "revert %d: rollback %s\n", i, raleighsl_errno_string(errno));
+      return(1);
+    }
+
+    /* Back to the committed items */
+    z_memcpy(__model + head, __saved, count * sizeof(uint64_t));
+    __model_count = count;
+    __model_head = head;
+  }
+  return(__test_random(test) || __check_empty("revert"));
+}
+
+/*
+ * The pop of an empty deque is parked, the commits of the pushes hand
+ * the items to the oldest waiters and a gone waiter is skipped.
+ * A transaction pop is never parked, an item already there is returned.
+ */
+static int __test_pop_wait (z_test_t *test) {
+  raleighsl_errno_t errno;
+  struct waiter waiter;
+  uint64_t txn_id;
+  uint64_t first;
+  int i;
+
+  for (i = 0; i < __NWAITERS; ++i) {
+    __waiter_init(&(__waiters[i]), UINT64_MAX, i == 1);
+    if ((errno = __pop_wait(0, &(__waiters[i]))) != RALEIGHSL_ERRNO_SCHED_WAIT) {
+      fprintf(stderr, "pop-wait %d: not parked, %s\n", i, raleighsl_errno_string(errno));
+      return(1);
+    }
+  }
+
+  __nnotified = 0;
+  first = __next_value;
+  if ((errno = __push(__NWAITERS - 1))) {
+    fprintf(stderr, "pop-wait: push %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  for (i = 0; i < __NWAITERS; ++i) {
+    const struct waiter *w = &(__waiters[i]);
+    uint64_t expected = __item_value(first + i - (i > 1));
+    if (!w->notified || w->order != i || w->errno) {
+      fprintf(stderr, "pop-wait %d: order %d %s\n", i, w->order, raleighsl_errno_string(w->errno));
+      return(1);
+    }
+    if (!w->is_gone && w->value != expected) {
+      fprintf(stderr, "pop-wait %d: %"PRIu64" expected %"PRIu64"\n", i, w->value, expected);
+      return(1);
+    }
+  }
+
+  /* All the items were handed off, an item pushed now is popped at once */
+  if (__check_empty("pop-wait") || __push(1))
+    return(1);
+
+  __waiter_init(&waiter, UINT64_MAX, 0);
+  if ((errno = __pop_wait(0, &waiter)) || waiter.value != __item_value(__next_value - 1)) {
+    fprintf(stderr, "pop-wait: immediate %s %"PRIu64"\n", raleighsl_errno_string(errno), waiter.value);
+    return(1);
+  }
+
+  if ((errno = raleighsl_transaction_create(&__fs, &txn_id)))
+    return(1);
+  __waiter_init(&waiter, UINT64_MAX, 0);
+  if ((errno = __pop_wait(txn_id, &waiter)) != RALEIGHSL_ERRNO_DATA_NO_ITEMS) {
+    fprintf(stderr, "pop-wait: txn %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(__wait(raleighsl_exec_txn_rollback(&__fs, txn_id, __notify, NULL, NULL)) != 0);
+}
+
+/* The waiters past the deadline get no items, the others stay parked */
+static int __test_pop_expire (z_test_t *test) {
+  raleighsl_errno_t errno;
+  int i;
+
+  for (i = 0; i < 2; ++i) {
+    __waiter_init(&(__waiters[i]), (i == 0) ? 100 : UINT64_MAX, 0);
+    if ((errno = __pop_wait(0, &(__waiters[i]))) != RALEIGHSL_ERRNO_SCHED_WAIT)
+      return(1);
+  }
+
+  __nnotified = 0;
+  if (__expire(200))
+    return(1);
+
+  if (!__waiters[0].notified || __waiters[0].errno != RALEIGHSL_ERRNO_DATA_NO_ITEMS) {
+    fprintf(stderr, "expire: waiter not expired\n");
+    return(1);
+  }
+
+  if (__waiters[1].notified) {
+    fprintf(stderr, "expire: waiter expired before the deadline\n");
+    return(1);
+  }
+
+  /* The one left takes the next item */
+  if (__push(1) || !__waiters[1].notified ||
+      __waiters[1].value != __item_value(__next_value - 1))
+  {
+    fprintf(stderr, "expire: waiter left not served\n");
+    return(1);
+  }
+  return(__check_empty("expire"));
+}
+
+/* The timeout is relative, the condition waits at least that long */
+static int __test_wait_cond_deadline (z_test_t *test) {
+  z_wait_cond_t wcond;
+  z_mutex_t lock;
+  uint64_t elapsed;
+
+  if (z_mutex_alloc(&lock))
+    return(1);
+
+  if (z_wait_cond_alloc(&wcond)) {
+    z_mutex_free(&lock);
+    return(1);
+  }
+
+  z_mutex_lock(&lock);
+  elapsed = z_time_micros();
+  z_wait_cond_wait(&wcond, &lock, 50);
+  elapsed = z_time_micros() - elapsed;
+  z_mutex_unlock(&lock);
+
+  z_wait_cond_free(&wcond);
+  z_mutex_free(&lock);
+
+  if (elapsed < 45000 || elapsed > 5000000) {
+    fprintf(stderr, "wait-cond: 50msec timeout took %"PRIu64"usec\n", elapsed);
+    return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Main
+ */
+static int __setup (void) {
+  raleighsl_errno_t errno;
+
+  __model_head = __MODEL_SIZE >> 1;
+  __model_count = 0;
+  if ((errno = raleighsl_object_create(&__fs, &raleighsl_object_deque, __DEQUE_OID))) {
+    fprintf(stderr, "create: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+static z_test_t __test_deque = {
+  .funcs = {
+    __test_wraparound,
+    __test_growth,
+    __test_random,
+    __test_revert,
+    __test_pop_wait,
+    __test_pop_expire,
+    __test_wait_cond_deadline,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  struct test_fs conf = {
+    .device_size = __DEVICE_SIZE,
+    .objects = {&raleighsl_object_deque, NULL},
+    .setup = __setup,
+  };
+  uint64_t i;
+
+  __seed = 11;
+  for (i = 0; i < __NVALUES; ++i)
+    __values[i] = i;
+
+  return(__test_fs_run("Deque Ring", &__test_deque, &conf));
+}
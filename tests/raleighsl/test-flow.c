@@ -0,0 +1,506 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/bytesref.h>
+#include <zcl/string.h>
+#include <zcl/array.h>
+#include <zcl/debug.h>
+#include <zcl/math.h>
+
+#define TEST_FS_EXEC
+#include "test-fs.h"
+
+#define __DEVICE_SIZE       (64 << 20)
+#define __FLOW_OID          (1 << 20)
+
+#define __POOL_SIZE         (64 << 10)
+#define __MODEL_SIZE        (4 << 20)
+#define __EXTEND_MAX        (64 << 20)
+
+#define __NROUNDS           200
+#define __NEDITS            8
+
+/* The edits data is sliced from the pool, the pending refs stay valid */
+static uint8_t __pool[__POOL_SIZE];
+static unsigned int __seed;
+
+/* The flat buffer the flow is checked against */
+static uint8_t __model[__MODEL_SIZE];
+static uint64_t __model_size;
+static uint8_t __check[__MODEL_SIZE];
+static uint8_t __committed[__MODEL_SIZE];
+
+/* ============================================================================
+ *  Model
+ */
+static void __model_insert (uint64_t offset, const uint8_t *data, uint64_t size) {
+  z_memmove(__model + offset + size, __model + offset, __model_size - offset);
+  z_memcpy(__model + offset, data, size);
+  __model_size += size;
+}
+
+static void __model_write (uint64_t offset, const uint8_t *data, uint64_t size) {
+  z_memcpy(__model + offset, data, size);
+  __model_size = z_max(__model_size, offset + size);
+}
+
+static void __model_remove (uint64_t offset, uint64_t size) {
+  size = z_min(size, __model_size - offset);
+  z_memmove(__model + offset, __model + offset + size, __model_size - offset - size);
+  __model_size -= size;
+}
+
+static void __model_truncate (uint64_t size) {
+  if (size > __model_size)
+    z_memzero(__model + __model_size, size - __model_size);
+  __model_size = size;
+}
+
+/* ============================================================================
+ *  Helpers
+ */
+static uint64_t __rand (uint64_t max) {
+  return((max > 0) ? (z_rand(&__seed) % max) : 0);
+}
+
+/* Mostly small edits, to go through the tail and the coalescing */
+static uint64_t __rand_length (void) {
+  switch (__rand(8)) {
+    case 0:  return(1 + __rand(16 << 10));
+    case 1:  return(1 + __rand(4 << 10));
+    default: return(1 + __rand(300));
+  }
+}
+
+static raleighsl_errno_t __flow_collect (raleighsl_t *fs,
+                                         const raleighsl_transaction_t *transaction,
+                                         raleighsl_object_t *object,
+                                         uint8_t *buffer,
+                                         uint64_t size)
+{
+  raleighsl_errno_t errno;
+  z_array_t chunks;
+  size_t i;
+
+  if (size == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if (z_array_open(&chunks, sizeof(z_bytes_ref_t)))
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+  errno = raleighsl_flow_read(fs, transaction, object, 0, size + 1, &chunks);
+  for (i = 0; i < chunks.count; ++i) {
+    z_bytes_ref_t *chunk = Z_BYTES_REF(z_array_get_raw(&chunks, i));
+    z_memcpy(buffer, chunk->slice.data, chunk->slice.size);
+    buffer += chunk->slice.size;
+    z_bytes_ref_release(chunk);
+  }
+  z_array_close(&chunks);
+  return(errno);
+}
+
+/* ============================================================================
+ *  Flow Edits
+ */
+struct edits {
+  raleighsl_errno_t errno;
+  uint64_t committed;
+  int update_model;
+};
+
+static void __edits_init (struct edits *edits, int update_model) {
+  z_memcpy(__committed, __model, __model_size);
+  edits->committed = __model_size;
+  edits->update_model = update_model;
+  edits->errno = RALEIGHSL_ERRNO_NONE;
+}
+
+static raleighsl_errno_t __edit (raleighsl_t *fs,
+                                 raleighsl_transaction_t *transaction,
+                                 raleighsl_object_t *object,
+                                 int update_model)
+{
+  raleighsl_errno_t errno;
+  z_bytes_ref_t data;
+  uint64_t offset, length;
+  uint64_t res_size;
+  int op;
+
+  /* Without the model the flow only grows, the offsets stay in range */
+  op = __rand(update_model ? 10 : 7);
+  offset = __rand(__model_size + 1);
+  length = __rand_length();
+  if ((__model_size + length) > (__MODEL_SIZE >> 1))
+    op = 8;
+
+  z_bytes_ref_set_data(&data, __pool + __rand(__POOL_SIZE - length), length, NULL, NULL);
+  switch (op) {
+    case 0: case 1: case 2:
+      errno = raleighsl_flow_append(fs, transaction, object, &data, &res_size);
+      if (!errno && update_model) __model_insert(__model_size, data.slice.data, length);
+      break;
+    case 3: case 4:
+      errno = raleighsl_flow_inject(fs, transaction, object, offset, &data, &res_size);
+      if (!errno && update_model) __model_insert(offset, data.slice.data, length);
+      break;
+    case 5: case 6:
+      errno = raleighsl_flow_write(fs, transaction, object, offset, &data, &res_size);
+      if (!errno && update_model) __model_write(offset, data.slice.data, length);
+      break;
+    case 7: case 8:
+      errno = raleighsl_flow_remove(fs, transaction, object, offset, length, &res_size);
+      if (!errno && update_model) __model_remove(offset, length);
+      break;
+    default:
+      length = __rand(__model_size + (12 << 10));
+      errno = raleighsl_flow_truncate(fs, transaction, object, length, &res_size);
+      if (!errno && update_model) __model_truncate(length);
+      break;
+  }
+
+  if (!errno && update_model && res_size != __model_size) {
+    fprintf(stderr, "edit %d: size %"PRIu64" expected %"PRIu64"\n",
+            op, res_size, __model_size);
+    return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+  }
+  return(errno);
+}
+
+/* The edits are pending, the readers still see the committed flow */
+static raleighsl_errno_t __edits_func (raleighsl_t *fs,
+                                       raleighsl_transaction_t *transaction,
+                                       raleighsl_object_t *object,
+                                       void *udata)
+{
+  struct edits *edits = (struct edits *)udata;
+  raleighsl_errno_t errno;
+  int i;
+
+  for (i = 0; i < __NEDITS; ++i) {
+    if ((edits->errno = __edit(fs, transaction, object, edits->update_model)))
+      return(edits->errno);
+  }
+
+  errno = __flow_collect(fs, transaction, object, __check, edits->committed);
+  if (errno && edits->committed > 0) {
+    fprintf(stderr, "edits: committed read %s\n", raleighsl_errno_string(errno));
+    return(edits->errno = errno);
+  }
+  if (z_memcmp(__check, __committed, edits->committed)) {
+    fprintf(stderr, "edits: pending data visible before the commit\n");
+    return(edits->errno = RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __check_func (raleighsl_t *fs,
+                                       const raleighsl_transaction_t *transaction,
+                                       raleighsl_object_t *object,
+                                       void *udata)
+{
+  raleighsl_errno_t errno;
+
+  if (__model_size == 0)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  if ((errno = __flow_collect(fs, transaction, object, __check, __model_size)))
+    return(errno);
+
+  if (z_memcmp(__check, __model, __model_size))
+    return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static raleighsl_errno_t __truncate_func (raleighsl_t *fs,
+                                          raleighsl_transaction_t *transaction,
+                                          raleighsl_object_t *object,
+                                          void *udata)
+{
+  uint64_t size = *((uint64_t *)udata);
+  uint64_t res_size;
+  return(raleighsl_flow_truncate(fs, transaction, object, size, &res_size));
+}
+
+static int __check_flow (const char *label, int round) {
+  raleighsl_errno_t errno;
+
+  errno = __wait(raleighsl_exec_read(&__fs, 0, __FLOW_OID, __check_func, __notify, NULL, NULL));
+  if (errno) {
+    fprintf(stderr, "%s %d: %"PRIu64" bytes flow: %s\n", label, round,
+            __model_size, raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Tests
+ */
+static int __test_edits (z_test_t *test) {
+  struct edits edits;
+  int i;
+
+  for (i = 0; i < __NROUNDS; ++i) {
+    __edits_init(&edits, 1);
+    if (__wait(raleighsl_exec_write(&__fs, 0, __FLOW_OID, __edits_func, __notify, &edits, NULL)) ||
+        edits.errno)
+    {
+      fprintf(stderr, "edits %d: %s\n", i, raleighsl_errno_string(edits.errno));
+      return(1);
+    }
+
+    if (__check_flow("edits", i))
+      return(1);
+  }
+  return(0);
+}
+
+/* The truncate extension is bounded, the zero chunks are shared */
+static int __test_truncate (z_test_t *test) {
+  raleighsl_errno_t errno;
+  uint64_t size;
+
+  size = __model_size + __EXTEND_MAX + 1;
+  errno = __wait(raleighsl_exec_write(&__fs, 0, __FLOW_OID, __truncate_func, __notify, &size, NULL));
+  if (errno != RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE) {
+    fprintf(stderr, "truncate: %s, out of range expected\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  size = __model_size + (1 << 20) + 17;
+  errno = __wait(raleighsl_exec_write(&__fs, 0, __FLOW_OID, __truncate_func, __notify, &size, NULL));
+  if (errno) {
+    fprintf(stderr, "truncate: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  __model_truncate(size);
+  if (__check_flow("truncate", 0))
+    return(1);
+
+  size = 64 << 10;
+  errno = __wait(raleighsl_exec_write(&__fs, 0, __FLOW_OID, __truncate_func, __notify, &size, NULL));
+  __model_truncate(size);
+  return(errno || __check_flow("truncate", 1));
+}
+
+/* The rollback drops the pending edits, the flow is untouched */
+static int __test_revert (z_test_t *test) {
+  raleighsl_errno_t errno;
+  struct edits edits;
+  uint64_t txn_id;
+  int i;
+
+  for (i = 0; i < 8; ++i) {
+    if ((errno = raleighsl_transaction_create(&__fs, &txn_id))) {
+      fprintf(stderr, "revert: txn create %s\n", raleighsl_errno_string(errno));
+      return(1);
+    }
+
+    __edits_init(&edits, 0);
+    errno = __wait(raleighsl_exec_write(&__fs, txn_id, __FLOW_OID, __edits_func, __notify, &edits, NULL));
+    if (errno || edits.errno) {
+      fprintf(stderr, "revert %d: %s\n", i, raleighsl_errno_string(errno ? errno : edits.errno));
+      return(1);
+    }
+
+    if ((errno = __wait(raleighsl_exec_txn_rollback(&__fs, txn_id, __notify, NULL, NULL)))) {
+      fprintf(stderr, "revert %d: rollback %s\n", i, raleighsl_errno_string(errno));
+      return(1);
+    }
+
+    if (__check_flow("revert", i))
+      return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Flow Subscribe
+ */
+struct subscriber {
+  raleighsl_errno_t errno;
+  uint64_t offset;
+  uint64_t size;
+  z_array_t chunks;
+  int done;
+};
+
+static struct subscriber __parked;
+static int __is_parked;
+
+static raleighsl_errno_t __subscribe_func (raleighsl_t *fs,
+                                           const raleighsl_transaction_t *transaction,
+                                           raleighsl_object_t *object,
+                                           void *udata)
+{
+  struct subscriber *subscriber = (struct subscriber *)udata;
+  return(raleighsl_flow_subscribe(fs, transaction, object, subscriber->offset, 1 << 20,
+                                  &(subscriber->size), &(subscriber->chunks)));
+}
+
+static void __subscribe_notify (raleighsl_t *fs,
+                                uint64_t oid, raleighsl_errno_t errno,
+                                void *udata, void *err_data)
+{
+  struct subscriber *subscriber = (struct subscriber *)udata;
+  subscriber->errno = errno;
+  z_atomic_store_release(&(subscriber->done), 1);
+}
+
+static int __subscribe (struct subscriber *subscriber, uint64_t offset) {
+  if (z_array_open(&(subscriber->chunks), sizeof(z_bytes_ref_t)))
+    return(1);
+  subscriber->errno = RALEIGHSL_ERRNO_NONE;
+  subscriber->offset = offset;
+  subscriber->size = 0;
+  subscriber->done = 0;
+  if (raleighsl_exec_read(&__fs, 0, __FLOW_OID, __subscribe_func,
+                          __subscribe_notify, subscriber, NULL))
+  {
+    z_array_close(&(subscriber->chunks));
+    return(1);
+  }
+  return(0);
+}
+
+static void __subscriber_close (struct subscriber *subscriber) {
+  size_t i;
+  for (i = 0; i < subscriber->chunks.count; ++i)
+    z_bytes_ref_release(Z_BYTES_REF(z_array_get_raw(&(subscriber->chunks), i)));
+  z_array_close(&(subscriber->chunks));
+}
+
+static raleighsl_errno_t __append_func (raleighsl_t *fs,
+                                        raleighsl_transaction_t *transaction,
+                                        raleighsl_object_t *object,
+                                        void *udata)
+{
+  z_bytes_ref_t *data = Z_BYTES_REF(udata);
+  uint64_t res_size;
+  return(raleighsl_flow_append(fs, transaction, object, data, &res_size));
+}
+
+/* A subscription past the end is parked and woken by the next commit */
+static int __test_subscribe (z_test_t *test) {
+  struct subscriber subscriber;
+  raleighsl_errno_t errno;
+  z_bytes_ref_t data;
+  uint64_t offset;
+  uint8_t *p;
+  size_t i;
+
+  offset = __model_size;
+  if (__subscribe(&subscriber, offset))
+    return(1);
+
+  usleep(50000);
+  if (z_atomic_load_acquire(&(subscriber.done))) {
+    fprintf(stderr, "subscribe: not parked, %s\n", raleighsl_errno_string(subscriber.errno));
+    __subscriber_close(&subscriber);
+    return(1);
+  }
+
+  z_bytes_ref_set_data(&data, __pool, 1000, NULL, NULL);
+  errno = __wait(raleighsl_exec_write(&__fs, 0, __FLOW_OID, __append_func, __notify, &data, NULL));
+  if (errno) {
+    fprintf(stderr, "subscribe: append %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+  __model_insert(__model_size, __pool, 1000);
+
+  while (!z_atomic_load_acquire(&(subscriber.done)))
+    usleep(100);
+
+  p = __check;
+  for (i = 0; i < subscriber.chunks.count; ++i) {
+    z_bytes_ref_t *chunk = Z_BYTES_REF(z_array_get_raw(&(subscriber.chunks), i));
+    z_memcpy(p, chunk->slice.data, chunk->slice.size);
+    p += chunk->slice.size;
+  }
+  __subscriber_close(&subscriber);
+
+  if (subscriber.errno || subscriber.size != __model_size ||
+      (p - __check) != 1000 || z_memcmp(__check, __pool, 1000))
+  {
+    fprintf(stderr, "subscribe: woken %s, size %"PRIu64" read %zu\n",
+            raleighsl_errno_string(subscriber.errno), subscriber.size,
+            (size_t)(p - __check));
+    return(1);
+  }
+
+  /* Left parked, the close notifies it */
+  if (__subscribe(&__parked, __model_size))
+    return(1);
+  __is_parked = 1;
+  usleep(50000);
+  return(0);
+}
+
+static int __test_subscribe_close (z_test_t *test) {
+  int res;
+
+  if (!__is_parked)
+    return(1);
+
+  res = !z_atomic_load_acquire(&(__parked.done)) ||
+        __parked.errno != RALEIGHSL_ERRNO_DATA_NO_ITEMS;
+  if (res) {
+    fprintf(stderr, "subscribe: close done %d %s\n", __parked.done,
+            raleighsl_errno_string(__parked.errno));
+  }
+  __subscriber_close(&__parked);
+  return(res);
+}
+
+/* ============================================================================
+ *  Main
+ */
+static int __setup (void) {
+  raleighsl_errno_t errno;
+
+  __model_size = 0;
+  if ((errno = raleighsl_object_create(&__fs, &raleighsl_object_flow, __FLOW_OID))) {
+    fprintf(stderr, "create: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+/* The subscription left parked is checked once the file-system is closed */
+static z_test_t __test_flow = {
+  .funcs = {
+    __test_edits,
+    __test_truncate,
+    __test_revert,
+    __test_subscribe,
+    __test_subscribe_close,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  struct test_fs conf = {
+    .device_size = __DEVICE_SIZE,
+    .objects = {&raleighsl_object_flow, NULL},
+    .setup = __setup,
+  };
+  unsigned int i;
+
+  __seed = 7;
+  for (i = 0; i < __POOL_SIZE; ++i)
+    __pool[i] = 'A' + (z_rand(&__seed) % 26);
+
+  return(__test_fs_run("Flow Rope", &__test_flow, &conf));
+}
@@ -0,0 +1,180 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef _RALEIGHSL_TEST_FS_H_
+#define _RALEIGHSL_TEST_FS_H_
+
+#include <raleighsl/raleighsl.h>
+
+#include <zcl/allocator.h>
+#include <zcl/atomic.h>
+#include <zcl/global.h>
+#include <zcl/string.h>
+#include <zcl/test.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdio.h>
+
+#define __TEST_FS_MAX_OBJECTS     4
+#define __TEST_FS_PATH            "/tmp/raleighsl-test.XXXXXX"
+
+/*
+ * Shared fixture of the raleighsl tests, passed as the z_test_t user_data.
+ * The setup creates a new file-system on a sparse temporary file before
+ * each test function and the tear_down closes it.
+ */
+struct test_fs {
+  uint64_t device_size;
+  const raleighsl_object_plug_t *objects[__TEST_FS_MAX_OBJECTS];
+
+  /* Called once the file-system is created, e.g. to add the test objects */
+  int (*setup) (void);
+
+  char path[sizeof(__TEST_FS_PATH)];
+};
+
+static raleighsl_file_device_t __device;
+static raleighsl_t __fs;
+
+/* ============================================================================
+ *  Exec helpers, the notify of a single pending request
+ */
+#ifdef TEST_FS_EXEC
+static int __done;
+static raleighsl_errno_t __done_errno;
+
+static void __notify (raleighsl_t *fs,
+                      uint64_t oid, raleighsl_errno_t errno,
+                      void *udata, void *err_data)
+{
+  __done_errno = errno;
+  z_atomic_store_release(&__done, 1);
+}
+
+static raleighsl_errno_t __wait (int res) {
+  if (res)
+    return(RALEIGHSL_ERRNO_NO_MEMORY);
+  while (!z_atomic_load_acquire(&__done))
+    usleep(100);
+  __done = 0;
+  return(__done_errno);
+}
+#endif /* TEST_FS_EXEC */
+
+/* ============================================================================
+ *  File-system fixture
+ */
+static int __fs_open (const struct test_fs *conf, int create) {
+  raleighsl_errno_t errno;
+  int i;
+
+  if (raleighsl_alloc(&__fs) == NULL)
+    return(1);
+
+  raleighsl_plug_semantic(&__fs, &raleighsl_semantic_flat);
+  raleighsl_plug_space(&__fs, &raleighsl_space_extent);
+  raleighsl_plug_format(&__fs, &raleighsl_format_master);
+  for (i = 0; i < __TEST_FS_MAX_OBJECTS && conf->objects[i] != NULL; ++i)
+    raleighsl_plug_object(&__fs, conf->objects[i]);
+
+  if (raleighsl_file_device_open(&__device, conf->path, conf->device_size,
+                                 RALEIGHSL_FILE_DEVICE_BUFFERED))
+  {
+    raleighsl_free(&__fs);
+    return(1);
+  }
+
+  if (create) {
+    errno = raleighsl_create(&__fs, &(__device.__base__), &raleighsl_format_master,
+                             &raleighsl_space_extent, &raleighsl_semantic_flat);
+  } else {
+    errno = raleighsl_open(&__fs, &(__device.__base__), &raleighsl_format_master,
+                           &raleighsl_space_extent, &raleighsl_semantic_flat);
+  }
+
+  if (errno) {
+    fprintf(stderr, "%s: %s\n", create ? "create" : "open", raleighsl_errno_string(errno));
+    raleighsl_file_device_close(&__device);
+    raleighsl_free(&__fs);
+    return(1);
+  }
+  return(0);
+}
+
+static void __fs_close (void) {
+  raleighsl_close(&__fs);
+  raleighsl_file_device_close(&__device);
+  raleighsl_free(&__fs);
+}
+
+static int __test_fs_setup (z_test_t *test) {
+  const struct test_fs *conf = (const struct test_fs *)test->user_data;
+
+  /* A new sparse device, nothing is left by the previous test */
+  if (truncate(conf->path, 0) || truncate(conf->path, (off_t)conf->device_size))
+    return(1);
+
+  if (__fs_open(conf, 1))
+    return(1);
+
+  if (conf->setup != NULL && conf->setup()) {
+    __fs_close();
+    return(1);
+  }
+  return(0);
+}
+
+static int __test_fs_tear_down (z_test_t *test) {
+  __fs_close();
+  return(0);
+}
+
+static int __test_fs_run (const char *label, z_test_t *test, struct test_fs *conf) {
+  z_allocator_t allocator;
+  int res;
+  int fd;
+
+  z_memcpy(conf->path, __TEST_FS_PATH, sizeof(__TEST_FS_PATH));
+  if ((fd = mkstemp(conf->path)) < 0)
+    return(1);
+  close(fd);
+
+  /* Initialize allocator */
+  if (z_system_allocator_open(&allocator)) {
+    unlink(conf->path);
+    return(1);
+  }
+
+  /* Initialize global context */
+  if (z_global_context_open(&allocator, NULL)) {
+    z_allocator_close(&allocator);
+    unlink(conf->path);
+    return(1);
+  }
+
+  test->setup = __test_fs_setup;
+  test->tear_down = __test_fs_tear_down;
+  if ((res = z_test_run(test, conf)))
+    printf(" [ !! ] %s %d\n", label, res);
+  else
+    printf(" [ ok ] %s\n", label);
+
+  z_global_context_close();
+  z_allocator_close(&allocator);
+  unlink(conf->path);
+  return(res);
+}
+
+#endif /* !_RALEIGHSL_TEST_FS_H_ */
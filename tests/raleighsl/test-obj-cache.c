@@ -0,0 +1,349 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/bytesref.h>
+#include <zcl/string.h>
+#include <zcl/debug.h>
+
+#define TEST_FS_EXEC
+#include "test-fs.h"
+
+#define __DEVICE_SIZE       (160 << 20)
+
+#define __PINNED_OID        (1 << 20)
+#define __DEQUE_OID         (__PINNED_OID + 100)
+#define __UNPINNED_OID      (__PINNED_OID + 1000)
+#define __CLEAN_OID         (__PINNED_OID + 2000)
+
+#define __NPINNED           4
+#define __NUNPINNED         64
+#define __NCLEAN            16
+#define __ITEM_SIZE         (64 << 10)
+
+static uint8_t __item[__ITEM_SIZE];
+
+/* The weight of an unpinned object and the budget over the pinned ones */
+static uint64_t __weight;
+static uint64_t __budget;
+
+static int64_t __clean_values[__NCLEAN];
+static int __clean_done;
+static int __clean_errors;
+
+/* ============================================================================
+ *  Helpers
+ */
+static int __create (uint64_t oid, const raleighsl_object_plug_t *plug) {
+  raleighsl_errno_t errno;
+  if ((errno = raleighsl_object_create(&__fs, plug, oid))) {
+    fprintf(stderr, "create %"PRIu64": %s\n", oid, raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+/* Not part of the next checkpoint, only the cache holds the object */
+static int __create_unpinned (uint64_t oid) {
+  raleighsl_object_t *object;
+  raleighsl_errno_t errno;
+
+  if (__create(oid, &raleighsl_object_number))
+    return(1);
+
+  object = raleighsl_obj_cache_get(&__fs, oid);
+  errno = raleighsl_object_unlink(&__fs, object);
+  raleighsl_obj_cache_release(&__fs, object);
+  if (errno) {
+    fprintf(stderr, "unlink %"PRIu64": %s\n", oid, raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+/* A new object has no plug, the old one was evicted */
+static int __is_cached (uint64_t oid) {
+  raleighsl_object_t *object;
+  int is_cached;
+
+  object = raleighsl_obj_cache_get(&__fs, oid);
+  is_cached = (object->plug != NULL);
+  raleighsl_obj_cache_release(&__fs, object);
+  return(is_cached);
+}
+
+/* Evicted once clean, the object is loaded again on the next open */
+static int __is_open (uint64_t oid) {
+  raleighsl_object_t *object;
+  int is_open;
+
+  object = raleighsl_obj_cache_get(&__fs, oid);
+  is_open = raleighsl_object_is_open(&__fs, object);
+  raleighsl_obj_cache_release(&__fs, object);
+  return(is_open);
+}
+
+static raleighsl_errno_t __push_func (raleighsl_t *fs,
+                                      raleighsl_transaction_t *transaction,
+                                      raleighsl_object_t *object,
+                                      void *udata)
+{
+  z_bytes_ref_t data;
+  z_bytes_ref_set_data(&data, __item, __ITEM_SIZE, NULL, NULL);
+  return(raleighsl_deque_push(fs, transaction, object, 0, &data));
+}
+
+static raleighsl_errno_t __set_func (raleighsl_t *fs,
+                                     raleighsl_transaction_t *transaction,
+                                     raleighsl_object_t *object,
+                                     void *udata)
+{
+  int64_t value = (int64_t)(raleighsl_oid(object) - __CLEAN_OID + 1) * 1000;
+  return(raleighsl_number_set(fs, transaction, object, value));
+}
+
+static raleighsl_errno_t __get_func (raleighsl_t *fs,
+                                     const raleighsl_transaction_t *transaction,
+                                     raleighsl_object_t *object,
+                                     void *udata)
+{
+  int64_t *value = &(__clean_values[raleighsl_oid(object) - __CLEAN_OID]);
+  return(raleighsl_number_get(fs, transaction, object, value));
+}
+
+static void __clean_notify (raleighsl_t *fs,
+                            uint64_t oid, raleighsl_errno_t errno,
+                            void *udata, void *err_data)
+{
+  if (errno) {
+    fprintf(stderr, "object %"PRIu64": %s\n", oid, raleighsl_errno_string(errno));
+    z_atomic_inc(&__clean_errors);
+  }
+  z_atomic_inc(&__clean_done);
+}
+
+static int __clean_wait (void) {
+  while (z_atomic_load_acquire(&__clean_done) < __NCLEAN)
+    usleep(1000);
+  __clean_done = 0;
+  return(__clean_errors);
+}
+
+/* ============================================================================
+ *  Tests
+ */
+static uint64_t __object_weight (void) {
+  uint64_t usage = raleighsl_obj_cache_usage(&__fs);
+  uint64_t weight;
+
+  if (__create_unpinned(__UNPINNED_OID - 1))
+    return(0);
+  weight = raleighsl_obj_cache_usage(&__fs) - usage;
+  return(weight);
+}
+
+/*
+ * The unpinned objects are evicted to stay within the budget,
+ * the checkpointed ones are kept and only counted.
+ */
+static int __test_budget_evict (z_test_t *test) {
+  int i;
+
+  for (i = 0; i < __NUNPINNED; ++i) {
+    if (__create_unpinned(__UNPINNED_OID + i))
+      return(1);
+  }
+
+  for (i = 0; i < __NPINNED; ++i) {
+    if (!__is_cached(__PINNED_OID + i)) {
+      fprintf(stderr, "budget: pinned object %d evicted\n", i);
+      return(1);
+    }
+  }
+
+  if (__is_cached(__UNPINNED_OID)) {
+    fprintf(stderr, "budget: unpinned object not evicted\n");
+    return(1);
+  }
+
+  /* Reclaimed on insert, the entries released later are over by one */
+  if (raleighsl_obj_cache_usage(&__fs) > __budget + __weight) {
+    fprintf(stderr, "budget: %"PRIu64" bytes cached, budget %"PRIu64"\n",
+            raleighsl_obj_cache_usage(&__fs), __budget);
+    return(1);
+  }
+  return(0);
+}
+
+static uint64_t __deque_weight (void) {
+  raleighsl_object_t *object;
+  uint64_t weight;
+
+  object = raleighsl_obj_cache_get(&__fs, __DEQUE_OID);
+  weight = object->cache_entry.weight;
+  raleighsl_obj_cache_release(&__fs, object);
+  return(weight);
+}
+
+/*
+ * The commit grows the object, the weight follows once the commit
+ * lock is released and the unpinned objects make room for it.
+ */
+static int __test_commit_weight (z_test_t *test) {
+  raleighsl_errno_t errno;
+  uint64_t pinned, limit;
+  uint64_t budget;
+  int i;
+
+  if (__create(__DEQUE_OID, &raleighsl_object_deque))
+    return(1);
+
+  /* Room for all the unpinned objects, not for the pushed item */
+  pinned = raleighsl_obj_cache_usage(&__fs) - __deque_weight();
+  budget = __budget + 2 * __NUNPINNED * __weight;
+  raleighsl_obj_cache_budget(&__fs, budget);
+  for (i = 0; i < __NUNPINNED; ++i) {
+    if (__create_unpinned(__UNPINNED_OID + __NUNPINNED + i))
+      return(1);
+  }
+
+  if (!__is_cached(__UNPINNED_OID + __NUNPINNED)) {
+    fprintf(stderr, "commit: unpinned object evicted before the push\n");
+    return(1);
+  }
+
+  errno = __wait(raleighsl_exec_write(&__fs, 0, __DEQUE_OID, __push_func, __notify, NULL, NULL));
+  if (errno) {
+    fprintf(stderr, "push: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  if (__deque_weight() < __ITEM_SIZE) {
+    fprintf(stderr, "commit: weight %"PRIu64" not updated\n", __deque_weight());
+    return(1);
+  }
+
+  /* Only the pinned objects are left */
+  pinned += __deque_weight();
+  limit = z_max(budget, pinned) + __weight;
+  if (raleighsl_obj_cache_usage(&__fs) > limit) {
+    fprintf(stderr, "commit: %"PRIu64" bytes cached, %"PRIu64" expected\n",
+            raleighsl_obj_cache_usage(&__fs), limit);
+    return(1);
+  }
+
+  if (__is_cached(__UNPINNED_OID + __NUNPINNED)) {
+    fprintf(stderr, "commit: unpinned objects not evicted\n");
+    return(1);
+  }
+  return(0);
+}
+
+/*
+ * Once checkpointed the objects are clean and the cache can evict them,
+ * a read loads them again from the extent of the last checkpoint.
+ * The next checkpoint writes the evicted ones too, from the new extent.
+ */
+static int __test_checkpoint_evict (z_test_t *test) {
+  int round, i;
+
+  for (i = 0; i < __NCLEAN; ++i) {
+    if (__create(__CLEAN_OID + i, &raleighsl_object_number))
+      return(1);
+    if (raleighsl_exec_write(&__fs, 0, __CLEAN_OID + i, __set_func, __clean_notify, NULL, NULL))
+      return(1);
+  }
+
+  if (__clean_wait())
+    return(1);
+
+  for (round = 0; round < 2; ++round) {
+    raleighsl_errno_t errno;
+
+    if ((errno = raleighsl_sync(&__fs))) {
+      fprintf(stderr, "checkpoint %d: %s\n", round, raleighsl_errno_string(errno));
+      return(1);
+    }
+
+    /* The unpinned objects push the clean ones out */
+    raleighsl_obj_cache_budget(&__fs, 8 * __weight);
+    for (i = 0; i < __NUNPINNED; ++i) {
+      if (__create_unpinned(__UNPINNED_OID + (2 + round) * __NUNPINNED + i))
+        return(1);
+    }
+
+    if (__is_open(__CLEAN_OID)) {
+      fprintf(stderr, "checkpoint %d: clean object not evicted\n", round);
+      return(1);
+    }
+
+    z_memzero(__clean_values, sizeof(__clean_values));
+    for (i = 0; i < __NCLEAN; ++i) {
+      if (raleighsl_exec_read(&__fs, 0, __CLEAN_OID + i, __get_func, __clean_notify, NULL, NULL))
+        return(1);
+    }
+
+    if (__clean_wait())
+      return(1);
+
+    for (i = 0; i < __NCLEAN; ++i) {
+      if (__clean_values[i] != (i + 1) * 1000) {
+        fprintf(stderr, "checkpoint %d: object %d reloaded %"PRIi64"\n",
+                round, i, __clean_values[i]);
+        return(1);
+      }
+    }
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Main
+ */
+static int __setup (void) {
+  int i;
+
+  if ((__weight = __object_weight()) == 0) {
+    fprintf(stderr, "budget: unweighted object\n");
+    return(1);
+  }
+
+  for (i = 0; i < __NPINNED; ++i) {
+    if (__create(__PINNED_OID + i, &raleighsl_object_number))
+      return(1);
+  }
+
+  __budget = raleighsl_obj_cache_usage(&__fs) + 8 * __weight;
+  raleighsl_obj_cache_budget(&__fs, __budget);
+  return(0);
+}
+
+static z_test_t __test_obj_cache = {
+  .funcs = {
+    __test_budget_evict,
+    __test_commit_weight,
+    __test_checkpoint_evict,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  struct test_fs conf = {
+    .device_size = __DEVICE_SIZE,
+    .objects = {&raleighsl_object_number, &raleighsl_object_deque, NULL},
+    .setup = __setup,
+  };
+
+  z_memset(__item, 0xc5, __ITEM_SIZE);
+  return(__test_fs_run("Object Cache", &__test_obj_cache, &conf));
+}
@@ -0,0 +1,670 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/bytesref.h>
+#include <zcl/string.h>
+#include <zcl/array.h>
+#include <zcl/debug.h>
+#include <zcl/math.h>
+
+#define TEST_FS_EXEC
+#include "test-fs.h"
+
+#define __DEVICE_SIZE       (256 << 20)
+
+#define __NTYPES            4
+#define __NOBJECTS          2     /* Of each type, the OIDs of both replay parts */
+#define __NROUNDS           128
+#define __NEDITS            4
+
+#define __POOL_SIZE         (16 << 10)
+#define __NVALUES           (1 << 12)
+#define __FLOW_MAX          (64 << 10)
+#define __SSET_KEYS         64
+#define __SSET_VALUE_SIZE   16
+
+static raleighsl_device_plug_t __device_plug;
+static int __crashed;
+static int __tear_head;
+
+/* The edits data is taken from the pool and the values, the refs stay valid */
+static uint8_t __pool[__POOL_SIZE];
+static uint64_t __values[__NVALUES];
+static uint64_t __next_value;
+static char __keys[__SSET_KEYS][8];
+static unsigned int __seed;
+
+/* Each object is checked against its model once the file-system is reopened */
+struct object {
+  const raleighsl_object_plug_t *plug;
+  char label[16];
+  z_bytes_ref_t name;
+  uint64_t oid;
+
+  int64_t number;
+  uint64_t deque[__NVALUES];
+  uint64_t deque_head;
+  uint64_t deque_count;
+  uint8_t flow[__FLOW_MAX];
+  uint64_t flow_size;
+  int sset[__SSET_KEYS];                  /* Pool offset of the value or -1 */
+};
+
+struct edits {
+  struct object *object;
+  int update_model;
+};
+
+static const raleighsl_object_plug_t *__plugs[__NTYPES] = {
+  &raleighsl_object_number,
+  &raleighsl_object_deque,
+  &raleighsl_object_flow,
+  &raleighsl_object_sset,
+};
+
+static struct object __objects[__NTYPES][__NOBJECTS];
+static struct object __gone;
+
+/* ============================================================================
+ *  Device wrapper, after a crash nothing reaches the device anymore
+ */
+static raleighsl_errno_t __device_write (raleighsl_t *fs,
+                                         uint64_t offset,
+                                         const void *buffer,
+                                         unsigned int size)
+{
+  if (__crashed)
+    return(RALEIGHSL_ERRNO_NONE);
+
+  /* Only the crc, the magic and the generation of the head are written */
+  if (__tear_head && offset >= RALEIGHSL_CHECKPOINT_HEAD_OFFSET &&
+      offset < (RALEIGHSL_CHECKPOINT_HEAD_OFFSET + 2 * RALEIGHSL_CHECKPOINT_HEAD_SIZE))
+  {
+    __crashed = 1;
+    return(raleighsl_device_file.write(fs, offset, buffer, 16));
+  }
+  return(raleighsl_device_file.write(fs, offset, buffer, size));
+}
+
+static void __device_wrap (void) {
+  __device_plug = raleighsl_device_file;
+  __device_plug.write = __device_write;
+  __device.__base__.plug = &__device_plug;
+}
+
+/* The dirty state is lost, the file-system is loaded from the device */
+static int __crash_and_reopen (z_test_t *test) {
+  __crashed = 1;
+  __fs_close();
+  __crashed = 0;
+  __tear_head = 0;
+
+  if (__fs_open((const struct test_fs *)test->user_data, 0))
+    return(1);
+  __device_wrap();
+  return(0);
+}
+
+/* ============================================================================
+ *  Helpers
+ */
+static uint64_t __rand (uint64_t max) {
+  return((max > 0) ? (z_rand(&__seed) % max) : 0);
+}
+
+static raleighsl_errno_t __create_func (raleighsl_t *fs,
+                                        const raleighsl_object_plug_t *plug,
+                                        void *udata)
+{
+  struct object *object = (struct object *)udata;
+  return(raleighsl_semantic_create(fs, plug, &(object->name), &(object->oid)));
+}
+
+static raleighsl_errno_t __unlink_func (raleighsl_t *fs, void *udata) {
+  struct object *object = (struct object *)udata;
+  return(raleighsl_semantic_unlink(fs, &(object->name)));
+}
+
+static raleighsl_errno_t __lookup_func (raleighsl_t *fs, void *udata) {
+  struct object *object = (struct object *)udata;
+  uint64_t oid;
+  return(raleighsl_semantic_open(fs, &(object->name), &oid));
+}
+
+static int __object_create (struct object *object,
+                            const raleighsl_object_plug_t *plug,
+                            const char *name, int index)
+{
+  raleighsl_errno_t errno;
+  int i;
+
+  object->plug = plug;
+  object->number = 0;
+  object->deque_head = 0;
+  object->deque_count = 0;
+  object->flow_size = 0;
+  for (i = 0; i < __SSET_KEYS; ++i)
+    object->sset[i] = -1;
+
+  snprintf(object->label, sizeof(object->label), "%s-%d", name, index);
+  z_bytes_ref_set_data(&(object->name), object->label, strlen(object->label), NULL, NULL);
+  errno = __wait(raleighsl_exec_create(&__fs, plug, __create_func, __notify, object, NULL));
+  if (errno) {
+    fprintf(stderr, "create %s: %s\n", object->label, raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Object Edits
+ */
+static raleighsl_errno_t __edit (raleighsl_t *fs,
+                                 raleighsl_transaction_t *transaction,
+                                 raleighsl_object_t *raleighsl_object,
+                                 struct object *object,
+                                 int update_model)
+{
+  raleighsl_errno_t errno;
+  z_bytes_ref_t data;
+  z_bytes_ref_t key;
+  uint64_t res_size;
+  int64_t current;
+  int64_t value;
+  uint64_t length;
+  uint64_t offset;
+  int k, v;
+
+  /* Without the model the edits only add, nothing is checked */
+  if (object->plug == &raleighsl_object_number) {
+    value = (int64_t)__rand(2001) - 1000;
+    errno = raleighsl_number_add(fs, transaction, raleighsl_object, value, &current);
+    if (!errno && update_model) {
+      object->number += value;
+      if (current != object->number) {
+        fprintf(stderr, "%s: add %"PRIi64" expected %"PRIi64"\n",
+                object->label, current, object->number);
+        return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+      }
+    }
+    return(errno);
+  }
+
+  if (object->plug == &raleighsl_object_deque) {
+    if (update_model && object->deque_count > 0 && __rand(3) == 0) {
+      uint64_t expected = object->deque[object->deque_head];
+      if ((errno = raleighsl_deque_pop(fs, transaction, raleighsl_object, 1, &data)))
+        return(errno);
+      z_memcpy(&value, data.slice.data, sizeof(uint64_t));
+      z_bytes_ref_release(&data);
+      if ((uint64_t)value != expected) {
+        fprintf(stderr, "%s: pop %"PRIu64" expected %"PRIu64"\n",
+                object->label, (uint64_t)value, expected);
+        return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+      }
+      object->deque_head++;
+      object->deque_count--;
+      return(RALEIGHSL_ERRNO_NONE);
+    }
+
+    if (update_model && (object->deque_head + object->deque_count) == __NVALUES)
+      return(RALEIGHSL_ERRNO_NONE);
+
+    __values[__next_value] = __next_value;
+    z_bytes_ref_set_data(&data, &(__values[__next_value]), sizeof(uint64_t), NULL, NULL);
+    errno = raleighsl_deque_push(fs, transaction, raleighsl_object, 0, &data);
+    if (!errno && update_model)
+      object->deque[object->deque_head + object->deque_count++] = __next_value;
+    __next_value = (__next_value + 1) & (__NVALUES - 1);
+    return(errno);
+  }
+
+  if (object->plug == &raleighsl_object_flow) {
+    length = 1 + __rand(300);
+    offset = __rand(object->flow_size + 1);
+    z_bytes_ref_set_data(&data, __pool + __rand(__POOL_SIZE - length), length, NULL, NULL);
+    if (update_model && __rand(3) == 0 && (offset + length) <= object->flow_size) {
+      errno = raleighsl_flow_write(fs, transaction, raleighsl_object, offset, &data, &res_size);
+      if (!errno)
+        z_memcpy(object->flow + offset, data.slice.data, length);
+      return(errno);
+    }
+
+    if ((object->flow_size + length) > __FLOW_MAX)
+      return(RALEIGHSL_ERRNO_NONE);
+
+    errno = raleighsl_flow_append(fs, transaction, raleighsl_object, &data, &res_size);
+    if (!errno && update_model) {
+      z_memcpy(object->flow + object->flow_size, data.slice.data, length);
+      object->flow_size += length;
+    }
+    return(errno);
+  }
+
+  k = __rand(__SSET_KEYS);
+  z_bytes_ref_set_data(&key, __keys[k], strlen(__keys[k]), NULL, NULL);
+  if (update_model && object->sset[k] >= 0 && __rand(4) == 0) {
+    if ((errno = raleighsl_sset_remove(fs, transaction, raleighsl_object, &key, &data)))
+      return(errno);
+    z_bytes_ref_release(&data);
+    object->sset[k] = -1;
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  v = __rand(__POOL_SIZE - __SSET_VALUE_SIZE);
+  z_bytes_ref_set_data(&data, __pool + v, __SSET_VALUE_SIZE, NULL, NULL);
+  errno = raleighsl_sset_insert(fs, transaction, raleighsl_object, 1, &key, &data);
+  if (!errno && update_model)
+    object->sset[k] = v;
+  return(errno);
+}
+
+static raleighsl_errno_t __edits_func (raleighsl_t *fs,
+                                       raleighsl_transaction_t *transaction,
+                                       raleighsl_object_t *object,
+                                       void *udata)
+{
+  struct edits *edits = (struct edits *)udata;
+  raleighsl_errno_t errno;
+  int i, nedits;
+
+  nedits = 1 + __rand(__NEDITS);
+  for (i = 0; i < nedits; ++i) {
+    if ((errno = __edit(fs, transaction, object, edits->object, edits->update_model)))
+      return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+static int __edits_exec (uint64_t txn_id, struct object *object, int update_model) {
+  raleighsl_errno_t errno;
+  struct edits edits;
+
+  edits.object = object;
+  edits.update_model = update_model;
+  errno = __wait(raleighsl_exec_write(&__fs, txn_id, object->oid,
+                                      __edits_func, __notify, &edits, NULL));
+  if (errno) {
+    fprintf(stderr, "%s: edits %s\n", object->label, raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+/* The objects are edited in turn, each auto-commit waits for the journal */
+static int __edits_rounds (int nrounds) {
+  int i;
+  for (i = 0; i < nrounds; ++i) {
+    if (__edits_exec(0, &(__objects[__rand(__NTYPES)][__rand(__NOBJECTS)]), 1))
+      return(1);
+  }
+  return(0);
+}
+
+/*
+ * A committed transaction over one object of each type is replayed,
+ * the edits of the one left open on the others are dropped.
+ */
+static int __edits_transactions (void) {
+  raleighsl_errno_t errno;
+  uint64_t txn_id;
+  int i;
+
+  if ((errno = raleighsl_transaction_create(&__fs, &txn_id)))
+    return(1);
+  for (i = 0; i < __NTYPES; ++i) {
+    if (__edits_exec(txn_id, &(__objects[i][1]), 1))
+      return(1);
+  }
+  if ((errno = __wait(raleighsl_exec_txn_commit(&__fs, txn_id, __notify, NULL, NULL)))) {
+    fprintf(stderr, "txn commit: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  if ((errno = raleighsl_transaction_create(&__fs, &txn_id)))
+    return(1);
+  for (i = 0; i < __NTYPES; ++i) {
+    if (__edits_exec(txn_id, &(__objects[i][0]), 0))
+      return(1);
+  }
+
+  /* The open transaction records are flushed by the next auto-commit */
+  return(__edits_exec(0, &(__objects[0][1]), 1));
+}
+
+/* Written and then unlinked, the replay must not bring it back */
+static int __object_unlink (struct object *object) {
+  raleighsl_errno_t errno;
+  int i;
+
+  for (i = 0; i < 8; ++i) {
+    if (__edits_exec(0, object, 1))
+      return(1);
+  }
+
+  if ((errno = __wait(raleighsl_exec_unlink(&__fs, __unlink_func, __notify, object, NULL)))) {
+    fprintf(stderr, "%s: unlink %s\n", object->label, raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  if ((errno = raleighsl_journal_flush(&__fs))) {
+    fprintf(stderr, "journal flush: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Object Checks
+ */
+static raleighsl_errno_t __check_func (raleighsl_t *fs,
+                                       raleighsl_transaction_t *transaction,
+                                       raleighsl_object_t *raleighsl_object,
+                                       void *udata)
+{
+  struct object *object = (struct object *)udata;
+  raleighsl_errno_t errno;
+  z_bytes_ref_t data;
+  z_bytes_ref_t key;
+  z_array_t chunks;
+  uint64_t offset;
+  int64_t value;
+  size_t i;
+
+  if (object->plug == &raleighsl_object_number) {
+    if ((errno = raleighsl_number_get(fs, transaction, raleighsl_object, &value)))
+      return(errno);
+    if (value != object->number) {
+      fprintf(stderr, "%s: %"PRIi64" expected %"PRIi64"\n",
+              object->label, value, object->number);
+      return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+    }
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  /* The items are popped in push order */
+  if (object->plug == &raleighsl_object_deque) {
+    for (i = 0; i < object->deque_count; ++i) {
+      uint64_t expected = object->deque[object->deque_head + i];
+      if ((errno = raleighsl_deque_pop(fs, transaction, raleighsl_object, 1, &data))) {
+        fprintf(stderr, "%s: pop %zu of %"PRIu64" %s\n", object->label,
+                i, object->deque_count, raleighsl_errno_string(errno));
+        return(errno);
+      }
+      z_memcpy(&value, data.slice.data, sizeof(uint64_t));
+      z_bytes_ref_release(&data);
+      if ((uint64_t)value != expected) {
+        fprintf(stderr, "%s: item %zu is %"PRIu64" expected %"PRIu64"\n",
+                object->label, i, (uint64_t)value, expected);
+        return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+      }
+    }
+    errno = raleighsl_deque_pop(fs, transaction, raleighsl_object, 1, &data);
+    if (errno != RALEIGHSL_ERRNO_DATA_NO_ITEMS) {
+      if (!errno) z_bytes_ref_release(&data);
+      fprintf(stderr, "%s: more than %"PRIu64" items\n", object->label, object->deque_count);
+      return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+    }
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  if (object->plug == &raleighsl_object_flow) {
+    if (object->flow_size == 0)
+      return(RALEIGHSL_ERRNO_NONE);
+
+    if (z_array_open(&chunks, sizeof(z_bytes_ref_t)))
+      return(RALEIGHSL_ERRNO_NO_MEMORY);
+
+    offset = 0;
+    errno = raleighsl_flow_read(fs, transaction, raleighsl_object, 0,
+                                object->flow_size + 1, &chunks);
+    for (i = 0; i < chunks.count; ++i) {
+      z_bytes_ref_t *chunk = Z_BYTES_REF(z_array_get_raw(&chunks, i));
+      if ((offset + chunk->slice.size) > object->flow_size ||
+          z_memcmp(object->flow + offset, chunk->slice.data, chunk->slice.size))
+      {
+        errno = RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE;
+      }
+      offset += chunk->slice.size;
+      z_bytes_ref_release(chunk);
+    }
+    z_array_close(&chunks);
+
+    if (errno || offset != object->flow_size) {
+      fprintf(stderr, "%s: %"PRIu64" bytes read, %"PRIu64" expected %s\n",
+              object->label, offset, object->flow_size, raleighsl_errno_string(errno));
+      return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+    }
+    return(RALEIGHSL_ERRNO_NONE);
+  }
+
+  /* Every key is looked up, the removed and the never inserted ones too */
+  for (i = 0; i < __SSET_KEYS; ++i) {
+    z_bytes_ref_set_data(&key, __keys[i], strlen(__keys[i]), NULL, NULL);
+    errno = raleighsl_sset_get(fs, transaction, raleighsl_object, &key, &data);
+    if (object->sset[i] < 0) {
+      if (errno != RALEIGHSL_ERRNO_DATA_KEY_NOT_FOUND) {
+        if (!errno) z_bytes_ref_release(&data);
+        fprintf(stderr, "%s: key %s not removed\n", object->label, __keys[i]);
+        return(RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE);
+      }
+      continue;
+    }
+
+    if (errno) {
+      fprintf(stderr, "%s: key %s %s\n", object->label, __keys[i],
+              raleighsl_errno_string(errno));
+      return(errno);
+    }
+    if (data.slice.size != __SSET_VALUE_SIZE ||
+        z_memcmp(data.slice.data, __pool + object->sset[i], __SSET_VALUE_SIZE))
+    {
+      errno = RALEIGHSL_ERRNO_DATA_OUT_OF_RANGE;
+      fprintf(stderr, "%s: key %s wrong value\n", object->label, __keys[i]);
+    }
+    z_bytes_ref_release(&data);
+    if (errno)
+      return(errno);
+  }
+  return(RALEIGHSL_ERRNO_NONE);
+}
+
+/* The deque check pops the items, so it goes through a write */
+static int __check_objects (void) {
+  raleighsl_errno_t errno;
+  int i, j;
+
+  for (i = 0; i < __NTYPES; ++i) {
+    for (j = 0; j < __NOBJECTS; ++j) {
+      struct object *object = &(__objects[i][j]);
+      errno = __wait(raleighsl_exec_write(&__fs, 0, object->oid, __check_func,
+                                          __notify, object, NULL));
+      if (errno) {
+        fprintf(stderr, "%s: check %s\n", object->label, raleighsl_errno_string(errno));
+        return(1);
+      }
+    }
+  }
+
+  if (__gone.plug != NULL) {
+    errno = __wait(raleighsl_exec_lookup(&__fs, __lookup_func, __notify, &__gone, NULL));
+    if (errno != RALEIGHSL_ERRNO_OBJECT_NOT_FOUND) {
+      fprintf(stderr, "%s: unlinked object found %s\n", __gone.label,
+              raleighsl_errno_string(errno));
+      return(1);
+    }
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Tests
+ */
+/*
+ * Never checkpointed, the whole state comes from the journal:
+ * the records of each OID are replayed in order by the parts,
+ * the unlinks are applied once all the parts are done.
+ */
+static int __test_journal_replay (z_test_t *test) {
+  if (__edits_rounds(__NROUNDS) || __edits_transactions())
+    return(1);
+
+  if (__object_create(&__gone, &raleighsl_object_flow, "gone", 0) ||
+      __object_unlink(&__gone))
+  {
+    return(1);
+  }
+
+  if (__crash_and_reopen(test))
+    return(1);
+
+  if (__fs.checkpoint.generation != 0) {
+    fprintf(stderr, "replay: checkpoint %"PRIu64" found\n", __fs.checkpoint.generation);
+    return(1);
+  }
+  return(__check_objects());
+}
+
+/*
+ * Only the tail of the journal after the latest checkpoint is replayed,
+ * an object of the checkpoint unlinked in the tail is gone.
+ */
+static int __test_checkpoint_tail (z_test_t *test) {
+  raleighsl_errno_t errno;
+  uint64_t generation;
+  uint64_t journal_lsn;
+  int i;
+
+  if (__object_create(&__gone, &raleighsl_object_sset, "gone", 0))
+    return(1);
+
+  for (i = 0; i < 2; ++i) {
+    if (__edits_rounds(__NROUNDS) || __edits_exec(0, &__gone, 1))
+      return(1);
+    if ((errno = raleighsl_sync(&__fs))) {
+      fprintf(stderr, "sync: %s\n", raleighsl_errno_string(errno));
+      return(1);
+    }
+  }
+
+  generation = __fs.checkpoint.generation;
+  journal_lsn = __fs.checkpoint.journal_lsn;
+  if (__edits_rounds(__NROUNDS >> 3) || __edits_transactions() || __object_unlink(&__gone))
+    return(1);
+
+  if (__crash_and_reopen(test))
+    return(1);
+
+  if (__fs.checkpoint.generation != generation ||
+      __fs.checkpoint.journal_lsn != journal_lsn)
+  {
+    fprintf(stderr, "tail: checkpoint %"PRIu64" lsn %"PRIu64
+                    " expected %"PRIu64" lsn %"PRIu64"\n",
+            __fs.checkpoint.generation, __fs.checkpoint.journal_lsn,
+            generation, journal_lsn);
+    return(1);
+  }
+  return(__check_objects());
+}
+
+/*
+ * The crash tears the head of the new checkpoint before the format
+ * points to it, the previous checkpoint and its journal are loaded.
+ */
+static int __test_torn_head (z_test_t *test) {
+  raleighsl_errno_t errno;
+  uint64_t generation;
+
+  if (__edits_rounds(__NROUNDS))
+    return(1);
+  if ((errno = raleighsl_sync(&__fs))) {
+    fprintf(stderr, "sync: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  generation = __fs.checkpoint.generation;
+  if (__edits_rounds(__NROUNDS) || __edits_transactions())
+    return(1);
+
+  __tear_head = 1;
+  raleighsl_sync(&__fs);
+  if (!__crashed) {
+    fprintf(stderr, "torn: the checkpoint head was not written\n");
+    return(1);
+  }
+
+  if (__crash_and_reopen(test))
+    return(1);
+
+  if (__fs.checkpoint.generation != generation) {
+    fprintf(stderr, "torn: checkpoint %"PRIu64" loaded, %"PRIu64" expected\n",
+            __fs.checkpoint.generation, generation);
+    return(1);
+  }
+  return(__check_objects());
+}
+
+/* ============================================================================
+ *  Main
+ */
+static int __setup (void) {
+  static const char *names[__NTYPES] = { "number", "deque", "flow", "sset" };
+  int i, j;
+
+  __device_wrap();
+  __crashed = 0;
+  __tear_head = 0;
+  __next_value = 0;
+  __gone.plug = NULL;
+
+  /* Consecutive OIDs, the objects of each type fall in both replay parts */
+  for (i = 0; i < __NTYPES; ++i) {
+    for (j = 0; j < __NOBJECTS; ++j) {
+      if (__object_create(&(__objects[i][j]), __plugs[i], names[i], j))
+        return(1);
+    }
+  }
+  return(0);
+}
+
+static z_test_t __test_recovery = {
+  .funcs = {
+    __test_journal_replay,
+    __test_checkpoint_tail,
+    __test_torn_head,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  struct test_fs conf = {
+    .device_size = __DEVICE_SIZE,
+    .objects = {
+      &raleighsl_object_number,
+      &raleighsl_object_deque,
+      &raleighsl_object_flow,
+      &raleighsl_object_sset,
+    },
+    .setup = __setup,
+  };
+  unsigned int i;
+
+  __seed = 11;
+  for (i = 0; i < __POOL_SIZE; ++i)
+    __pool[i] = 'A' + (z_rand(&__seed) % 26);
+  for (i = 0; i < __SSET_KEYS; ++i)
+    snprintf(__keys[i], sizeof(__keys[i]), "key-%03u", i);
+
+  return(__test_fs_run("Recovery", &__test_recovery, &conf));
+}
@@ -0,0 +1,131 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <zcl/debug.h>
+
+#include "test-fs.h"
+
+#define __DEVICE_SIZE       (160 << 20)
+#define __BLOCK             RALEIGHSL_EXTENT_BLOCK_SIZE
+
+static int __allocate (uint64_t nblocks, uint64_t *start) {
+  raleighsl_errno_t errno;
+  uint64_t count;
+
+  errno = raleighsl_space_extent.allocate(&__fs, nblocks * __BLOCK, start, &count);
+  if (errno || count != nblocks * __BLOCK) {
+    fprintf(stderr, "allocate %"PRIu64" blocks: %s count=%"PRIu64"\n",
+            nblocks, raleighsl_errno_string(errno), errno ? 0 : count);
+    return(1);
+  }
+  return(0);
+}
+
+static int __available (uint64_t start, uint64_t nblocks) {
+  return(raleighsl_space_extent.available(&__fs, start, nblocks * __BLOCK) != 0);
+}
+
+/*
+ * [a:4][b:8][c:2][d:16][e:1][free...] with a and c free,
+ * the smallest extent large enough is picked.
+ */
+static int __test_best_fit (z_test_t *test) {
+  uint64_t a, b, c, d, e, x;
+
+  if (__allocate(4, &a) || __allocate(8, &b) || __allocate(2, &c) ||
+      __allocate(16, &d) || __allocate(1, &e))
+    return(1);
+
+  if (b != a + 4 * __BLOCK || c != b + 8 * __BLOCK) {
+    fprintf(stderr, "best-fit: extents from the free tail are not contiguous\n");
+    return(1);
+  }
+
+  if (__available(a, 4) || __available(c, 2))
+    return(1);
+
+  if (__allocate(2, &x) || x != c) {
+    fprintf(stderr, "best-fit: 2 blocks expected from c\n");
+    return(1);
+  }
+
+  if (__allocate(3, &x) || x != a) {
+    fprintf(stderr, "best-fit: 3 blocks expected from a\n");
+    return(1);
+  }
+
+  /* Back to the free a and c */
+  if (__available(a, 3) || __available(c, 2))
+    return(1);
+
+  /* Releasing b merges a, b and c in a single 14 blocks extent */
+  if (__available(b, 8))
+    return(1);
+
+  if (__allocate(14, &x) || x != a) {
+    fprintf(stderr, "coalesce: 14 blocks expected from a\n");
+    return(1);
+  }
+  return(0);
+}
+
+/*
+ * A released extent is still referenced by the last checkpoint,
+ * it is reused only once the next checkpoint is on disk.
+ */
+static int __test_delayed_release (z_test_t *test) {
+  raleighsl_errno_t errno;
+  uint64_t x, guard, y;
+
+  if (__allocate(5, &x) || __allocate(1, &guard))
+    return(1);
+
+  if ((errno = raleighsl_space_extent.release(&__fs, x, 5 * __BLOCK))) {
+    fprintf(stderr, "release: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  if (__allocate(5, &y))
+    return(1);
+  if (y == x) {
+    fprintf(stderr, "delayed-release: extent reused before the checkpoint\n");
+    return(1);
+  }
+
+  if ((errno = raleighsl_sync(&__fs))) {
+    fprintf(stderr, "sync: %s\n", raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  if (__allocate(5, &y) || y != x) {
+    fprintf(stderr, "delayed-release: extent not reused after the checkpoint\n");
+    return(1);
+  }
+  return(0);
+}
+
+static z_test_t __test_space_extent = {
+  .funcs = {
+    __test_best_fit,
+    __test_delayed_release,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  struct test_fs conf = {
+    .device_size = __DEVICE_SIZE,
+  };
+  return(__test_fs_run("Space Extent", &__test_space_extent, &conf));
+}
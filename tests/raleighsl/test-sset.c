@@ -0,0 +1,415 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <raleighsl/raleighsl.h>
+
+#include <zcl/allocator.h>
+#include <zcl/global.h>
+#include <zcl/math.h>
+#include <zcl/test.h>
+
+#include <stdio.h>
+
+/* The blocks, the nodes and the rebuilds are checked from the inside */
+#include "../../src/raleighsl/objects/sset/sset.c"
+
+#define __NKEYS             (4096)
+#define __VALUE_SIZE        (32)
+#define __POOL_SIZE         (4 << 10)
+#define __BALANCE_PASSES    (1 << 12)
+
+/* The items point to the keys and to the pool, the refs stay valid */
+static char __keys[__NKEYS][16];
+static uint8_t __pool[__POOL_SIZE];
+static char __stale_key[__SSET_KEY_MAX_SIZE];
+
+/* A memory only sset, nothing is journaled without a device */
+static raleighsl_t __fs;
+static raleighsl_object_t __object;
+
+/* ============================================================================
+ *  Helpers
+ */
+#define __sset()            RALEIGHSL_SSET(__object.membufs)
+
+static void __key_ref (z_bytes_ref_t *key, unsigned int i) {
+  z_bytes_ref_set_data(key, __keys[i], strlen(__keys[i]), NULL, NULL);
+}
+
+static void __value_ref (z_bytes_ref_t *value, unsigned int i) {
+  z_bytes_ref_set_data(value, __pool + (i % (__POOL_SIZE - __VALUE_SIZE)), __VALUE_SIZE, NULL, NULL);
+}
+
+static int __insert (unsigned int first, unsigned int last, unsigned int step) {
+  raleighsl_errno_t errno;
+  z_bytes_ref_t value;
+  z_bytes_ref_t key;
+  unsigned int i;
+
+  for (i = first; i < last; i += step) {
+    __key_ref(&key, i);
+    __value_ref(&value, i);
+    if ((errno = raleighsl_sset_insert(&__fs, NULL, &__object, 1, &key, &value))) {
+      fprintf(stderr, "insert %s: %s\n", __keys[i], raleighsl_errno_string(errno));
+      return(1);
+    }
+  }
+  return(__object_commit(&__fs, &__object) != RALEIGHSL_ERRNO_NONE);
+}
+
+static int __remove (unsigned int first, unsigned int last, unsigned int step) {
+  raleighsl_errno_t errno;
+  z_bytes_ref_t value;
+  z_bytes_ref_t key;
+  unsigned int i;
+
+  for (i = first; i < last; i += step) {
+    __key_ref(&key, i);
+    if ((errno = raleighsl_sset_remove(&__fs, NULL, &__object, &key, &value))) {
+      fprintf(stderr, "remove %s: %s\n", __keys[i], raleighsl_errno_string(errno));
+      return(1);
+    }
+    z_bytes_ref_release(&value);
+  }
+  return(__object_commit(&__fs, &__object) != RALEIGHSL_ERRNO_NONE);
+}
+
+/* The balance steps of the object scheduler, until there is nothing left */
+static int __balance (void) {
+  int i;
+  for (i = 0; i < __BALANCE_PASSES; ++i) {
+    __object_prepare(&__fs, &__object);
+    __object_balance(&__fs, &__object);
+    if (__object_commit(&__fs, &__object))
+      return(1);
+    if (!__sset()->balance_more)
+      return(0);
+  }
+  fprintf(stderr, "balance: not done after %d passes\n", __BALANCE_PASSES);
+  return(1);
+}
+
+static unsigned int __nnodes (void) {
+  z_tree_iter_t iter;
+  unsigned int count = 0;
+  z_tree_iter_open(&iter, __sset()->root);
+  if (z_tree_iter_begin(&iter) != NULL) {
+    do {
+      count++;
+    } while (z_tree_iter_next(&iter) != NULL);
+  }
+  z_tree_iter_close(&iter);
+  return(count);
+}
+
+static int __get (unsigned int i, int present) {
+  raleighsl_errno_t errno;
+  z_bytes_ref_t value;
+  z_bytes_ref_t check;
+  z_bytes_ref_t key;
+
+  __key_ref(&key, i);
+  errno = raleighsl_sset_get(&__fs, NULL, &__object, &key, &value);
+  if (!present) {
+    if (errno != RALEIGHSL_ERRNO_DATA_KEY_NOT_FOUND) {
+      if (!errno) z_bytes_ref_release(&value);
+      fprintf(stderr, "get %s: found, absent expected\n", __keys[i]);
+      return(1);
+    }
+    return(0);
+  }
+
+  if (errno) {
+    fprintf(stderr, "get %s: %s\n", __keys[i], raleighsl_errno_string(errno));
+    return(1);
+  }
+
+  __value_ref(&check, i);
+  errno = z_byte_slice_compare(&(value.slice), &(check.slice));
+  z_bytes_ref_release(&value);
+  if (errno) {
+    fprintf(stderr, "get %s: wrong value\n", __keys[i]);
+    return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Tests
+ */
+/*
+ * The keys are looked up in the blocks, in the memory buffers over them
+ * and behind the delete markers.
+ */
+static int __test_get (z_test_t *test) {
+  unsigned int i;
+
+  if (__get(0, 0))
+    return(1);
+
+  /* Even keys in the blocks, then the odd ones of the upper half in memory */
+  if (__insert(0, __NKEYS, 2) || __balance())
+    return(1);
+  if (__insert(1 + (__NKEYS >> 1), __NKEYS, 2))
+    return(1);
+
+  /* Delete markers over the blocks, and removes of the memory items */
+  if (__remove(0, __NKEYS, 6) || __remove(3 + (__NKEYS >> 1), __NKEYS, 6))
+    return(1);
+
+  for (i = 0; i < __NKEYS; ++i) {
+    int present;
+    if (i & 1) {
+      present = (i > (__NKEYS >> 1)) && ((i - 3 - (__NKEYS >> 1)) % 6) != 0;
+    } else {
+      present = (i % 6) != 0;
+    }
+    if (__get(i, present))
+      return(1);
+  }
+
+  /* The compaction drops the markers, nothing changes */
+  if (__balance())
+    return(1);
+  for (i = 0; i < __NKEYS; i += 6) {
+    if (__get(i, 0) || __get(i + 2, 1))
+      return(1);
+  }
+  return(0);
+}
+
+/*
+ * Every key of a block passes its bloom filter,
+ * most of the keys not in the block are skipped without a search.
+ */
+static int __test_bloom_skip (z_test_t *test) {
+  raleighsl_sset_t *sset = __sset();
+  unsigned int npositives = 0;
+  z_bytes_ref_t key;
+  unsigned int i;
+
+  if (__insert(0, __NKEYS, 2) || __balance())
+    return(1);
+
+  for (i = 0; i < __NKEYS; ++i) {
+    struct sset_node *node;
+
+    __key_ref(&key, i);
+    node = __sset_node_lookup(sset, &key);
+    if (node == NULL || node->block == NULL) {
+      fprintf(stderr, "bloom: %s has no block\n", __keys[i]);
+      return(1);
+    }
+
+    if (__sset_block_bloom_contains(node->block, z_bytes_ref_slice(&key))) {
+      npositives += (i & 1);
+    } else if (!(i & 1)) {
+      fprintf(stderr, "bloom: %s is in the block\n", __keys[i]);
+      return(1);
+    } else if (!__sset_block_lookup(node->block, &key, NULL)) {
+      fprintf(stderr, "bloom: %s skipped but found\n", __keys[i]);
+      return(1);
+    }
+  }
+
+  if ((npositives * 20) > (__NKEYS >> 1)) {
+    fprintf(stderr, "bloom: %u false positives of %u\n", npositives, __NKEYS >> 1);
+    return(1);
+  }
+  return(0);
+}
+
+/* Once most of the keys are removed the underfull nodes are merged */
+static int __test_merge_underfull (z_test_t *test) {
+  unsigned int nnodes;
+  unsigned int i;
+
+  if (__insert(0, __NKEYS, 1) || __balance())
+    return(1);
+
+  nnodes = __nnodes();
+  if (nnodes < 8) {
+    fprintf(stderr, "merge: %u nodes, more expected\n", nnodes);
+    return(1);
+  }
+
+  for (i = 1; i < 8; ++i) {
+    if (__remove(i, __NKEYS, 8))
+      return(1);
+  }
+  if (__balance())
+    return(1);
+
+  if ((__nnodes() * 3) > nnodes) {
+    fprintf(stderr, "merge: %u nodes left of %u\n", __nnodes(), nnodes);
+    return(1);
+  }
+
+  for (i = 0; i < __NKEYS; ++i) {
+    if (__get(i, (i & 7) == 0))
+      return(1);
+  }
+  return(0);
+}
+
+/*
+ * A node changed between the prepare and the balance step drops the
+ * rebuild, the blocks prepared would lose the new key.
+ */
+static int __test_stale_rebuild (z_test_t *test) {
+  raleighsl_sset_t *sset = __sset();
+  struct sset_rebuild *rebuild;
+  struct sset_node *node;
+  unsigned int nstale = 0;
+  z_byte_slice_t first;
+  z_bytes_ref_t value;
+  z_bytes_ref_t key;
+  unsigned int i;
+
+  if (__insert(0, __NKEYS, 1) || __balance())
+    return(1);
+
+  /* The delete markers make the nodes ask for a rewrite */
+  for (i = 1; i < 4; ++i) {
+    if (__remove(i, __NKEYS, 4))
+      return(1);
+  }
+
+  __object_prepare(&__fs, &__object);
+  if (z_dlink_is_empty(&(sset->rebuilds))) {
+    fprintf(stderr, "stale: no rebuild prepared\n");
+    return(1);
+  }
+
+  z_dlink_for_each_entry(&(sset->rebuilds), rebuild, struct sset_rebuild, rebuilds, {
+    if (!__sset_rebuild_is_valid(rebuild)) {
+      fprintf(stderr, "stale: rebuild not valid once prepared\n");
+      return(1);
+    }
+  });
+
+  /* A commit after the prepare step, on the first node of the first rebuild */
+  rebuild = z_dlink_front_entry(&(sset->rebuilds), struct sset_rebuild, rebuilds);
+  node = rebuild->nodes[0];
+  __sset_block_first_key(node->block, &first);
+  z_memcpy(__stale_key, first.data, first.size);
+  __stale_key[first.size] = 'x';
+  z_bytes_ref_set_data(&key, __stale_key, first.size + 1, NULL, NULL);
+  __value_ref(&value, 0);
+  if (raleighsl_sset_insert(&__fs, NULL, &__object, 1, &key, &value) ||
+      __object_commit(&__fs, &__object))
+  {
+    return(1);
+  }
+
+  z_dlink_for_each_entry(&(sset->rebuilds), rebuild, struct sset_rebuild, rebuilds, {
+    nstale += !__sset_rebuild_is_valid(rebuild);
+  });
+  if (nstale != 1) {
+    fprintf(stderr, "stale: %u stale rebuilds, 1 expected\n", nstale);
+    return(1);
+  }
+
+  __object_balance(&__fs, &__object);
+  if (!sset->balance_more || __object_commit(&__fs, &__object)) {
+    fprintf(stderr, "stale: the dropped rebuild is not retried\n");
+    return(1);
+  }
+
+  if (raleighsl_sset_get(&__fs, NULL, &__object, &key, &value)) {
+    fprintf(stderr, "stale: the key committed after the prepare is lost\n");
+    return(1);
+  }
+  z_bytes_ref_release(&value);
+
+  /* The next passes pick up the dropped nodes */
+  if (__balance())
+    return(1);
+  if (raleighsl_sset_get(&__fs, NULL, &__object, &key, &value)) {
+    fprintf(stderr, "stale: the key is lost by the next pass\n");
+    return(1);
+  }
+  z_bytes_ref_release(&value);
+
+  for (i = 0; i < __NKEYS; ++i) {
+    if (__get(i, (i & 3) == 0))
+      return(1);
+  }
+  return(0);
+}
+
+/* ============================================================================
+ *  Main
+ */
+static int __test_setup (z_test_t *test) {
+  if (raleighsl_alloc(&__fs) == NULL)
+    return(1);
+
+  z_memzero(&__object, sizeof(raleighsl_object_t));
+  __object.plug = &raleighsl_object_sset;
+  if (__object_create(&__fs, &__object)) {
+    raleighsl_free(&__fs);
+    return(1);
+  }
+  return(0);
+}
+
+static int __test_tear_down (z_test_t *test) {
+  __object_close(&__fs, &__object);
+  raleighsl_free(&__fs);
+  return(0);
+}
+
+static z_test_t __test_sset = {
+  .setup      = __test_setup,
+  .tear_down  = __test_tear_down,
+  .funcs    = {
+    __test_get,
+    __test_bloom_skip,
+    __test_merge_underfull,
+    __test_stale_rebuild,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  z_allocator_t allocator;
+  unsigned int seed = 3;
+  unsigned int i;
+  int res;
+
+  for (i = 0; i < __NKEYS; ++i)
+    snprintf(__keys[i], sizeof(__keys[i]), "key-%06u", i);
+  for (i = 0; i < __POOL_SIZE; ++i)
+    __pool[i] = 'a' + (z_rand(&seed) % 26);
+
+  /* Initialize allocator */
+  if (z_system_allocator_open(&allocator))
+    return(1);
+
+  /* Initialize global context */
+  if (z_global_context_open(&allocator, NULL)) {
+    z_allocator_close(&allocator);
+    return(1);
+  }
+
+  if ((res = z_test_run(&__test_sset, NULL)))
+    printf(" [ !! ] SSet %d\n", res);
+  else
+    printf(" [ ok ] SSet\n");
+
+  z_global_context_close();
+  z_allocator_close(&allocator);
+  return(res);
+}
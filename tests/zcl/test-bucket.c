@@ -320,10 +320,136 @@ static int __test_merge_eq (void) {
   return(0);
 }
 
+/* Prefixed keys over many restart intervals, with hits, misses and seeks */
+static int __test_restarts (void) {
+  const z_map_entry_t *entry;
+  z_bucket_iterator_t iter;
+  z_byte_slice_t value;
+  uint8_t block[8192];
+  char kprev[16];
+  char kbuf[16];
+  char vbuf[16];
+  int i, nkeys;
+
+  __node_create(block, sizeof(block));
+  kprev[0] = '\0';
+  for (nkeys = 0; nkeys < 1000; ++nkeys) {
+    z_bucket_entry_t item;
+    size_t shared;
+
+    snprintf(kbuf, sizeof(kbuf), "key-%06d", nkeys * 2);
+    snprintf(vbuf, sizeof(vbuf), "v%d", nkeys);
+    shared = z_memshared(kprev, z_strlen(kprev), kbuf, z_strlen(kbuf));
+    z_byte_slice_set(&(item.key), kbuf + shared, z_strlen(kbuf) - shared);
+    z_byte_slice_set(&(item.value), vbuf, z_strlen(vbuf));
+    item.kprefix = shared;
+    if (__node_vtable.append(block, &item))
+      break;
+    z_memcpy(kprev, kbuf, sizeof(kbuf));
+  }
+  __node_finalize(block);
+
+  for (i = 0; i < nkeys; ++i) {
+    snprintf(kbuf, sizeof(kbuf), "key-%06d", i * 2);
+    snprintf(vbuf, sizeof(vbuf), "v%d", i);
+    if (__node_search(block, kbuf, z_strlen(kbuf), &value) ||
+        value.size != z_strlen(vbuf) || z_memcmp(value.data, vbuf, value.size))
+    {
+      fprintf(stderr, "restarts: key %s not found\n", kbuf);
+      return(1);
+    }
+
+    snprintf(kbuf, sizeof(kbuf), "key-%06d", i * 2 + 1);
+    if (!__node_search(block, kbuf, z_strlen(kbuf), &value)) {
+      fprintf(stderr, "restarts: key %s found\n", kbuf);
+      return(1);
+    }
+  }
+
+  for (i = 0; i < nkeys; i += 7) {
+    z_byte_slice_t key;
+    snprintf(kbuf, sizeof(kbuf), "key-%06d", i * 2 + 1);
+    z_byte_slice_set(&key, kbuf, z_strlen(kbuf));
+    z_bucket_iterator_open(&iter, &__node_vtable, block, NULL, NULL);
+    z_map_iterator_seek_to(Z_MAP_ITERATOR(&iter), &key, 1);
+    entry = z_map_iterator_current(Z_MAP_ITERATOR(&iter));
+
+    snprintf(kbuf, sizeof(kbuf), "key-%06d", i * 2 + 2);
+    if ((i + 1) < nkeys && (entry == NULL || entry->key.size != z_strlen(kbuf) ||
+                            z_memcmp(entry->key.data, kbuf, entry->key.size)))
+    {
+      fprintf(stderr, "restarts: seek to %s failed\n", kbuf);
+      return(1);
+    }
+  }
+
+  printf("restarts: %d keys ok\n", nkeys);
+  return(0);
+}
+
+/*
+ * has_space() must agree with append(), the restart points store
+ * the full key and take a slot of the restart array.
+ */
+static int __test_fill (uint8_t *block, size_t size, int vpad) {
+  char kbuf[64], kprev[64], vbuf[64];
+  z_bucket_entry_t item;
+  int nkeys = 0;
+  int shared;
+
+  z_memzero(kprev, sizeof(kprev));
+  __node_create(block, size);
+  for (;;) {
+    snprintf(kbuf, sizeof(kbuf), "a-long-shared-prefix-of-the-keys-%06d", nkeys);
+    snprintf(vbuf, sizeof(vbuf), "v%0*d", vpad, nkeys);
+    shared = z_memshared(kprev, z_strlen(kprev), kbuf, z_strlen(kbuf));
+    z_byte_slice_set(&(item.key), kbuf + shared, z_strlen(kbuf) - shared);
+    z_byte_slice_set(&(item.value), vbuf, z_strlen(vbuf));
+    item.kprefix = shared;
+
+    if (!__node_vtable.has_space(block, &item))
+      break;
+    if (__node_vtable.append(block, &item)) {
+      fprintf(stderr, "has-space: append of key %d failed\n", nkeys);
+      return(-1);
+    }
+    z_memcpy(kprev, kbuf, sizeof(kbuf));
+    nkeys++;
+  }
+
+  if (!__node_vtable.append(block, &item)) {
+    fprintf(stderr, "has-space: key %d appended without space\n", nkeys);
+    return(-1);
+  }
+  __node_finalize(block);
+  return(nkeys);
+}
+
+static int __test_has_space (void) {
+  uint8_t block[4096];
+  int restarts = 0;
+  int vpad;
+
+  /* The node gets full on a restart point with some value sizes */
+  for (vpad = 1; vpad <= 48; ++vpad) {
+    int nkeys = __test_fill(block, sizeof(block), vpad);
+    if (nkeys < 0)
+      return(1);
+    restarts += ((nkeys % 16) == 0);
+  }
+
+  printf("has-space: %d nodes full on a restart point\n", restarts);
+  return(0);
+}
+
 int main (int argc, char **argv) {
   __test_lookup();
   __test_merge();
   __test_unprefixed();
   __test_merge_eq();
+  if (__test_restarts())
+    return(1);
+  if (__test_has_space())
+    return(1);
   return(0);
 }
@@ -0,0 +1,201 @@
+/*
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <stdio.h>
+
+#include <zcl/threading.h>
+#include <zcl/global.h>
+#include <zcl/atomic.h>
+#include <zcl/cache.h>
+#include <zcl/debug.h>
+#include <zcl/math.h>
+#include <zcl/test.h>
+
+#define __STRESS_THREADS      (4)
+#define __STRESS_OPS          (200000)
+#define __STRESS_OIDS         (64)
+#define __STRESS_CAPACITY     (16)
+
+struct item {
+  z_cache_entry_t entry;
+  uint64_t oid;
+};
+
+struct user_data {
+  z_cache_t *cache;
+  uint64_t nalloc;
+  uint64_t nfreed;
+  uint64_t errors;
+  unsigned int seed;
+};
+
+static void __item_free (void *udata, void *entry) {
+  struct user_data *data = (struct user_data *)udata;
+  struct item *item = z_container_of(entry, struct item, entry);
+  z_atomic_inc(&(data->nfreed));
+  z_memory_struct_free(z_global_memory(), struct item, item);
+}
+
+static z_cache_entry_t *__item_get (struct user_data *data, uint64_t oid) {
+  z_cache_entry_t *entry;
+  struct item *item;
+
+  if ((entry = z_cache_lookup(data->cache, oid)) != NULL)
+    return(entry);
+
+  item = z_memory_struct_alloc(z_global_memory(), struct item);
+  if (Z_MALLOC_IS_NULL(item))
+    return(NULL);
+
+  item->oid = oid;
+  z_cache_entry_init(&(item->entry), oid);
+  if ((entry = z_cache_try_insert(data->cache, &(item->entry))) != NULL) {
+    z_memory_struct_free(z_global_memory(), struct item, item);
+    return(entry);
+  }
+
+  z_atomic_inc(&(data->nalloc));
+  return(&(item->entry));
+}
+
+/*
+ * A held entry is pinned: every lookup must find the same entry until it
+ * is released, an evicted one handed out is replaced by the next miss.
+ */
+static void *__stress_thread (void *args) {
+  struct user_data *data = (struct user_data *)args;
+  unsigned int seed = z_atomic_fetch_and_add(&(data->seed), 1);
+  int i;
+
+  for (i = 0; i < __STRESS_OPS; ++i) {
+    uint64_t oid = z_rand(&seed) % __STRESS_OIDS;
+    z_cache_entry_t *entry;
+    z_cache_entry_t *other;
+
+    if ((entry = __item_get(data, oid)) == NULL) {
+      z_atomic_inc(&(data->errors));
+      break;
+    }
+
+    other = z_cache_lookup(data->cache, oid);
+    if (other != entry || z_container_of(entry, struct item, entry)->oid != oid)
+      z_atomic_inc(&(data->errors));
+
+    if (other != NULL)
+      z_cache_release(data->cache, other);
+    z_cache_release(data->cache, entry);
+  }
+  return(NULL);
+}
+
+static int __test_stress (z_test_t *test, z_cache_type_t type) {
+  struct user_data *data = (struct user_data *)test->user_data;
+  z_thread_t threads[__STRESS_THREADS];
+  int i;
+
+  data->cache = z_cache_alloc(type, __STRESS_CAPACITY, __item_free, NULL, data);
+  if (Z_MALLOC_IS_NULL(data->cache)) {
+    Z_LOG_ERROR("Failed to allocate the cache");
+    return(1);
+  }
+
+  for (i = 0; i < __STRESS_THREADS; ++i) {
+    z_thread_start(&(threads[i]), __stress_thread, data);
+  }
+  for (i = 0; i < __STRESS_THREADS; ++i) {
+    z_thread_join(&(threads[i]));
+  }
+
+  z_cache_free(data->cache);
+  data->cache = NULL;
+
+  if (data->errors > 0) {
+    Z_LOG_ERROR("Failed 1: %"PRIu64" lookups got an evicted entry", data->errors);
+    return(1);
+  }
+
+  if (data->nfreed != data->nalloc) {
+    Z_LOG_ERROR("Failed 2: freed %"PRIu64" != allocated %"PRIu64,
+                data->nfreed, data->nalloc);
+    return(2);
+  }
+  return(0);
+}
+
+static int __test_setup (z_test_t *test) {
+  struct user_data *data = (struct user_data *)test->user_data;
+  data->cache = NULL;
+  data->nalloc = 0;
+  data->nfreed = 0;
+  data->errors = 0;
+  data->seed = 1;
+  return(0);
+}
+
+static int __test_tear_down (z_test_t *test) {
+  return(0);
+}
+
+static int __test_lru (z_test_t *test) {
+  return(__test_stress(test, Z_CACHE_LRU));
+}
+
+static int __test_2q (z_test_t *test) {
+  return(__test_stress(test, Z_CACHE_2Q));
+}
+
+static int __test_clock_pro (z_test_t *test) {
+  return(__test_stress(test, Z_CACHE_CLOCK_PRO));
+}
+
+static int __test_tinylfu (z_test_t *test) {
+  return(__test_stress(test, Z_CACHE_TINYLFU));
+}
+
+static z_test_t __test_cache = {
+  .setup      = __test_setup,
+  .tear_down  = __test_tear_down,
+  .funcs    = {
+    __test_lru,
+    __test_2q,
+    __test_clock_pro,
+    __test_tinylfu,
+    NULL,
+  },
+};
+
+int main (int argc, char **argv) {
+  z_allocator_t allocator;
+  struct user_data data;
+  int res;
+
+  /* Initialize allocator */
+  if (z_system_allocator_open(&allocator))
+    return(1);
+
+  /* Initialize global context */
+  if (z_global_context_open(&allocator, NULL)) {
+    z_allocator_close(&allocator);
+    return(1);
+  }
+
+  if ((res = z_test_run(&__test_cache, &data)))
+    printf(" [ !! ] Cache %d\n", res);
+  else
+    printf(" [ ok ] Cache\n");
+
+  z_global_context_close();
+  z_allocator_close(&allocator);
+  return(res);
+}